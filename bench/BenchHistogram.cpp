@@ -67,5 +67,62 @@ using HistogramTypes = nvbench::type_list<uint8_t>;
 
 NVBENCH_BENCH_TYPES(Histogram, NVBENCH_TYPE_AXES(HistogramTypes))
     .set_type_axes_names({"InOutDataType"})
-    .add_string_axis("shape", {"1x1080x1920"})
+    .add_string_axis("shape", {"1x1080x1920", "1x2160x3840"})
     .add_int64_axis("varShape", {-1});
+
+template<typename T>
+inline void HistogramBinned(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3       shape    = benchutils::GetShape<3>(state.get_string("shape"));
+    long        channels = state.get_int64("channels");
+    long        numBins  = state.get_int64("numBins");
+    std::string mode     = state.get_string("mode");
+
+    NVCVHistogramMode histMode = mode == "JOINT_2D" ? NVCV_HISTOGRAM_JOINT_2D : NVCV_HISTOGRAM_PER_CHANNEL;
+
+    if (histMode == NVCV_HISTOGRAM_JOINT_2D && channels < 2)
+    {
+        throw std::invalid_argument("JOINT_2D needs at least 2 channels");
+    }
+
+    nvcv::Tensor mask{nullptr};
+
+    nvcv::Tensor hist = histMode == NVCV_HISTOGRAM_JOINT_2D
+                          ? nvcv::Tensor({{shape.x, numBins, numBins}, "NHW"}, nvcv::TYPE_S32)
+                          : nvcv::Tensor({{shape.x, numBins, channels}, "HWC"}, nvcv::TYPE_S32);
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * channels * sizeof(T));
+    state.add_global_memory_writes(hist.shape()[0] * hist.shape()[1] * hist.shape()[2] * sizeof(int));
+
+    cvcuda::Histogram op;
+
+    // clang-format off
+
+    nvcv::Tensor src({{shape.x, shape.y, shape.z, channels}, "NHWC"}, benchutils::GetDataType<T>());
+
+    // values over the default range of the type, [0, 1) for float
+    T maxValue = std::is_integral_v<T> ? nvcv::cuda::TypeTraits<T>::max : T{1};
+
+    benchutils::FillTensor<T>(src, benchutils::RandomValues<T>(T{0}, maxValue));
+
+    state.exec(nvbench::exec_tag::sync, [&op, &src, &mask, &hist, &histMode](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), src, mask, hist, histMode);
+    });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using HistogramBinnedTypes = nvbench::type_list<uint8_t, uint16_t, float>;
+
+NVBENCH_BENCH_TYPES(HistogramBinned, NVBENCH_TYPE_AXES(HistogramBinnedTypes))
+    .set_type_axes_names({"InDataType"})
+    .add_string_axis("shape", {"1x2160x3840"})
+    .add_int64_axis("channels", {1, 3})
+    .add_string_axis("mode", {"PER_CHANNEL", "JOINT_2D"})
+    .add_int64_axis("numBins", {64, 256});
@@ -84,3 +84,13 @@ NVBENCH_BENCH_TYPES(MedianBlur, NVBENCH_TYPE_AXES(MedianBlurTypes))
     .add_string_axis("shape", {"1x1080x1920"})
     .add_int64_axis("varShape", {-1, 0})
     .add_string_axis("kernelSize", {"5x5"});
+
+// Kernel size sweep of the tensor path, 8-bit and 16-bit kernels of 11x11 and more use sliding histograms.
+using MedianBlurKernelSizeTypes = nvbench::type_list<uint8_t, uint16_t>;
+
+NVBENCH_BENCH_TYPES(MedianBlur, NVBENCH_TYPE_AXES(MedianBlurKernelSizeTypes))
+    .set_name("MedianBlurKernelSize")
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_int64_axis("varShape", {-1})
+    .add_string_axis("kernelSize", {"3x3", "5x5", "9x9", "11x11", "15x15", "21x21", "31x31"});
@@ -133,3 +133,16 @@ NVBENCH_BENCH_TYPES(Morphology, NVBENCH_TYPE_AXES(MorphologyTypes))
     .add_string_axis("kernelSize", {"3x3"})
     .add_string_axis("morphType", {"ERODE", "DILATE", "OPEN", "CLOSE"})
     .add_string_axis("border", {"REPLICATE"});
+
+// Kernel size sweep of the tensor path, kernels of 5x5 and more use the separable passes.
+using MorphologyKernelSizeTypes = nvbench::type_list<uint8_t>;
+
+NVBENCH_BENCH_TYPES(Morphology, NVBENCH_TYPE_AXES(MorphologyKernelSizeTypes))
+    .set_name("MorphologyKernelSize")
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_int64_axis("varShape", {-1})
+    .add_int64_axis("iteration", {1})
+    .add_string_axis("kernelSize", {"3x3", "5x5", "11x11", "21x21", "31x31", "51x51", "75x75", "101x101"})
+    .add_string_axis("morphType", {"DILATE", "OPEN"})
+    .add_string_axis("border", {"REPLICATE"});
@@ -74,3 +74,67 @@ NVBENCH_BENCH_TYPES(NMS, NVBENCH_TYPE_AXES(NMSTypes))
     .add_int64_axis("varShape", {-1})
     .add_float64_axis("scoreThreshold", {0.5})
     .add_float64_axis("iouThreshold", {0.75});
+
+template<typename T, typename S = float, typename I = int32_t>
+inline void NMSTopK(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long  numSamples = state.get_int64("numSamples");
+    long  numBBoxes  = state.get_int64("numBBoxes");
+    long  maxOutputs = state.get_int64("maxOutputs");
+    long  numClasses = state.get_int64("numClasses");
+    auto  scoreDecay = static_cast<NVCVNMSScoreDecay>(state.get_int64("scoreDecay"));
+    float scThr      = static_cast<float>(state.get_float64("scoreThreshold"));
+    float iouThr     = static_cast<float>(state.get_float64("iouThreshold"));
+
+    // R/W bandwidth rationale:
+    // 1 read of scores (F32) to threshold and sort them + 1 read of boxes (4S16) and class ids (S32) for IoU
+    // 1 write of indices (S32) and scores (F32) per output box
+    state.add_global_memory_reads(numSamples * numBBoxes * (sizeof(T) + sizeof(S) + (numClasses > 0 ? sizeof(I) : 0)));
+    state.add_global_memory_writes(numSamples * maxOutputs * (sizeof(I) + sizeof(S)) + numSamples * sizeof(I));
+
+    cvcuda::NonMaximumSuppression op;
+
+    cvcuda::UniqueWorkspace ws
+        = cvcuda::AllocateWorkspace(op.getWorkspaceRequirements(numSamples, numBBoxes, maxOutputs));
+
+    // clang-format off
+
+    nvcv::Tensor srcBB({{numSamples, numBBoxes}, "NB"}, benchutils::GetDataType<T>());
+    nvcv::Tensor srcSc({{numSamples, numBBoxes}, "NB"}, benchutils::GetDataType<S>());
+    nvcv::Tensor srcCl;
+    nvcv::Tensor dstIdx({{numSamples, maxOutputs}, "NB"}, benchutils::GetDataType<I>());
+    nvcv::Tensor dstSc({{numSamples, maxOutputs}, "NB"}, benchutils::GetDataType<S>());
+    nvcv::Tensor dstCnt({{numSamples}, "N"}, benchutils::GetDataType<I>());
+
+    benchutils::FillTensor<T>(srcBB, benchutils::RandomValues<T>(10, 50));
+    benchutils::FillTensor<S>(srcSc, benchutils::RandomValues<S>());
+
+    if (numClasses > 0)
+    {
+        srcCl = nvcv::Tensor({{numSamples, numBBoxes}, "NB"}, benchutils::GetDataType<I>());
+
+        benchutils::FillTensor<I>(srcCl, benchutils::RandomValues<I>(0, static_cast<I>(numClasses - 1)));
+    }
+
+    state.exec(nvbench::exec_tag::sync, [&](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), ws.get(), srcBB, srcSc, srcCl, dstIdx, dstSc, dstCnt, scThr, iouThr, scoreDecay);
+    });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+NVBENCH_BENCH_TYPES(NMSTopK, NVBENCH_TYPE_AXES(NMSTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_int64_axis("numSamples", {1, 32})
+    .add_int64_axis("numBBoxes", {1024, 10000, 50000})
+    .add_int64_axis("maxOutputs", {100})
+    .add_int64_axis("numClasses", {0, 80})
+    .add_int64_axis("scoreDecay", {NVCV_NMS_SCORE_DECAY_NONE, NVCV_NMS_SCORE_DECAY_GAUSSIAN})
+    .add_float64_axis("scoreThreshold", {0.5})
+    .add_float64_axis("iouThreshold", {0.75});
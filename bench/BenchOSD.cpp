@@ -22,6 +22,8 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <random>
+
 template<typename T>
 inline void OSD(nvbench::state &state, nvbench::type_list<T>)
 try
@@ -92,3 +94,70 @@ NVBENCH_BENCH_TYPES(OSD, NVBENCH_TYPE_AXES(OSDTypes))
     .add_string_axis("shape", {"1x1080x1920"})
     .add_int64_axis("varShape", {-1})
     .add_int64_axis("numElem", {100});
+
+// Many small boxes spread over the image, as drawn for detections. Shows how the
+// render time scales with the number of elements.
+template<typename T>
+inline void OSDScatteredBoxes(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 shape   = benchutils::GetShape<3>(state.get_string("shape"));
+    int   numElem = static_cast<int>(state.get_int64("numElem"));
+    int   boxSize = static_cast<int>(state.get_int64("boxSize"));
+
+    int ch = nvcv::cuda::NumElements<T>;
+
+    using BT = nvcv::cuda::BaseType<T>;
+
+    std::mt19937                       rng(12345);
+    std::uniform_int_distribution<int> x(0, (int)shape.z - boxSize), y(0, (int)shape.y - boxSize);
+
+    std::vector<std::vector<std::shared_ptr<cvcuda::priv::NVCVElement>>> elementVec;
+
+    for (int n = 0; n < (int)shape.x; n++)
+    {
+        std::vector<std::shared_ptr<cvcuda::priv::NVCVElement>> curVec;
+        for (int i = 0; i < numElem; i++)
+        {
+            NVCVBndBoxI bndbox;
+            bndbox.box         = {x(rng), y(rng), boxSize, boxSize};
+            bndbox.thickness   = i % 2 ? 2 : -1;
+            bndbox.borderColor = {255, 0, 0, 255};
+            bndbox.fillColor   = {0, 255, 0, 128};
+            auto element       = std::make_shared<cvcuda::priv::NVCVElement>(NVCVOSDType::NVCV_OSD_RECT, &bndbox);
+            curVec.push_back(element);
+        }
+        elementVec.push_back(curVec);
+    }
+
+    std::shared_ptr<cvcuda::priv::NVCVElementsImpl> ctx = std::make_shared<cvcuda::priv::NVCVElementsImpl>(elementVec);
+
+    state.add_global_memory_reads(shape.x * shape.y * shape.z * sizeof(T) + numElem * sizeof(int) * 16);
+    state.add_global_memory_writes(shape.x * shape.y * shape.z * sizeof(T));
+
+    cvcuda::OSD op;
+
+    // clang-format off
+
+    nvcv::Tensor src({{shape.x, shape.y, shape.z, ch}, "NHWC"}, benchutils::GetDataType<BT>());
+    nvcv::Tensor dst({{shape.x, shape.y, shape.z, ch}, "NHWC"}, benchutils::GetDataType<BT>());
+
+    benchutils::FillTensor<BT>(src, benchutils::RandomValues<BT>());
+
+    state.exec(nvbench::exec_tag::sync, [&op, &src, &dst, &ctx](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), src, dst, (NVCVElements)ctx.get());
+    });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+NVBENCH_BENCH_TYPES(OSDScatteredBoxes, NVBENCH_TYPE_AXES(OSDTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_int64_axis("numElem", {10, 100, 1000, 10000})
+    .add_int64_axis("boxSize", {32});
@@ -21,6 +21,9 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <algorithm>
+#include <vector>
+
 template<typename ST>
 inline void PairwiseMatcher(nvbench::state &state, nvbench::type_list<ST>)
 try
@@ -106,3 +109,140 @@ NVBENCH_BENCH_TYPES(PairwiseMatcher, NVBENCH_TYPE_AXES(PairwiseMatcherTypes))
     .add_string_axis("writeDistances", {"T"})
     .add_string_axis("normType", {"HAMMING"})
     .add_string_axis("algoChoice", {"BRUTE_FORCE"});
+
+// Approximate matchers are benchmarked on queries near the points of set2, set1 being made of random points of set2
+// perturbed by noise, reporting the recall (fraction of queries given their brute-force best match) next to the
+// throughput, to trade one for the other with the number of probes; the index is built once out of the timing
+
+template<typename ST>
+inline void PairwiseMatcherApprox(nvbench::state &state, nvbench::type_list<ST>)
+try
+{
+    long3 shape = benchutils::GetShape<3>(state.get_string("shape"));
+
+    NVCVPairwiseMatcherParams params{};
+
+    params.numProbes = static_cast<int>(state.get_int64("numProbes"));
+
+    NVCVPairwiseMatcherType algoChoice;
+    NVCVNormType            normType;
+
+    if (state.get_string("algoChoice") == "LSH")
+    {
+        algoChoice = NVCV_LSH;
+        normType   = NVCV_NORM_HAMMING;
+    }
+    else if (state.get_string("algoChoice") == "IVF_FLAT")
+    {
+        algoChoice = NVCV_IVF_FLAT;
+        normType   = NVCV_NORM_L2;
+    }
+    else
+    {
+        throw std::invalid_argument("Unexpected algorithm choice = " + state.get_string("algoChoice"));
+    }
+
+    cvcuda::PairwiseMatcher op(algoChoice, params);
+    cvcuda::PairwiseMatcher bruteForce(NVCV_BRUTE_FORCE);
+
+    state.add_element_count(shape.x * shape.y, "Queries");
+
+    // clang-format off
+
+    nvcv::Tensor set1({{shape.x, shape.y, shape.z}, "NMD"}, benchutils::GetDataType<ST>());
+    nvcv::Tensor set2({{shape.x, shape.y, shape.z}, "NMD"}, benchutils::GetDataType<ST>());
+
+    nvcv::Tensor matches({{shape.x, shape.y, 2}, "NMD"}, nvcv::TYPE_S32);
+
+    nvcv::Tensor numMatches({{shape.x}, "N"}, nvcv::TYPE_S32);
+
+    nvcv::Tensor distances({{shape.x, shape.y}, "NM"}, nvcv::TYPE_F32);
+    nvcv::Tensor exactDistances({{shape.x, shape.y}, "NM"}, nvcv::TYPE_F32);
+
+    nvcv::Tensor numSet1, numSet2;
+
+    std::vector<ST> set2Values(shape.x * shape.y * shape.z);
+
+    auto randomValue = benchutils::RandomValues<ST>();
+
+    for (ST &value : set2Values)
+    {
+        value = randomValue();
+    }
+
+    auto set2Value = [&set2Values, &shape](long x, long y, long z)
+    {
+        return set2Values[(x * shape.y + y) * shape.z + z];
+    };
+
+    // Each point of set1 is a point of set2 with about one bit in 16 flipped (Hamming) or values moved up to 16 (L2)
+    auto randomNoise = benchutils::RandomValues<int>(0, 15);
+
+    benchutils::FillTensor<ST>(set2, [&set2Value](const long4 &c){ return set2Value(c.x, c.y, c.z); });
+    benchutils::FillTensor<ST>(set1, [&](const long4 &c)
+    {
+        ST value = set2Value(c.x, (c.y * 7919) % shape.y, c.z);
+
+        if (normType == NVCV_NORM_HAMMING)
+        {
+            for (int bit = 0; bit < static_cast<int>(sizeof(ST) * 8); ++bit)
+            {
+                value ^= static_cast<ST>(randomNoise() == 0) << bit;
+            }
+        }
+        else
+        {
+            value = std::clamp<int>(value + randomNoise() - 8, 0, 255);
+        }
+
+        return value;
+    });
+
+    // clang-format on
+
+    cvcuda::PairwiseMatcherIndex index = op.buildIndex(0, set2, numSet2);
+
+    op(0, index, set1, set2, numSet1, matches, numMatches, distances, 1, normType);
+    bruteForce(0, set1, set2, numSet1, numSet2, matches, numMatches, exactDistances, false, 1, normType);
+
+    auto dData = distances.exportData<nvcv::TensorDataStridedCuda>();
+    auto eData = exactDistances.exportData<nvcv::TensorDataStridedCuda>();
+    CVCUDA_CHECK_DATA(dData);
+    CVCUDA_CHECK_DATA(eData);
+
+    std::vector<float> dVec(shape.x * shape.y), eVec(shape.x * shape.y);
+
+    CUDA_CHECK_ERROR(cudaMemcpy2D(dVec.data(), shape.y * sizeof(float), dData->basePtr(), dData->stride(0),
+                                  shape.y * sizeof(float), shape.x, cudaMemcpyDeviceToHost));
+    CUDA_CHECK_ERROR(cudaMemcpy2D(eVec.data(), shape.y * sizeof(float), eData->basePtr(), eData->stride(0),
+                                  shape.y * sizeof(float), shape.x, cudaMemcpyDeviceToHost));
+
+    long found = 0;
+
+    for (size_t i = 0; i < dVec.size(); ++i)
+    {
+        found += dVec[i] == eVec[i];
+    }
+
+    auto &recall = state.add_summary("Recall");
+    recall.set_string("name", "Recall");
+    recall.set_string("hint", "percentage");
+    recall.set_float64("value", static_cast<double>(found) / dVec.size());
+
+    state.exec(nvbench::exec_tag::sync,
+               [&op, &index, &set1, &set2, &numSet1, &matches, &numMatches, &distances,
+                &normType](nvbench::launch &launch)
+               { op(launch.get_stream(), index, set1, set2, numSet1, matches, numMatches, distances, 1, normType); });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+using PairwiseMatcherApproxTypes = nvbench::type_list<uint8_t>;
+
+NVBENCH_BENCH_TYPES(PairwiseMatcherApprox, NVBENCH_TYPE_AXES(PairwiseMatcherApproxTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x50000x32", "1x50000x128"})
+    .add_int64_axis("numProbes", {1, 4, 16, 64})
+    .add_string_axis("algoChoice", {"LSH", "IVF_FLAT"});
@@ -103,3 +103,58 @@ NVBENCH_BENCH_TYPES(PillowResize, NVBENCH_TYPE_AXES(PillowResizeTypes))
     .add_int64_axis("varShape", {-1, 0})
     .add_string_axis("resizeType", {"CONTRACT"})
     .add_string_axis("interpolation", {"CUBIC"});
+
+// Per-frame latency of a fixed 1080p to 224x224 resize, with the coefficient tables cached across calls or
+// recomputed on the device at every call.
+
+template<typename T>
+inline void PillowResizeCoeffCache(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 srcShape = benchutils::GetShape<3>(state.get_string("shape"));
+    long3 dstShape = benchutils::GetShape<3>(state.get_string("dstShape"));
+    bool  useCache = state.get_string("coeffCache") == "ON";
+
+    NVCVInterpolationType interpType = benchutils::GetInterpolationType(state.get_string("interpolation"));
+
+    nvcv::Size2D srcSize{(int)srcShape.z, (int)srcShape.y};
+    nvcv::Size2D dstSize{(int)dstShape.z, (int)dstShape.y};
+
+    nvcv::DataType    dtype{benchutils::GetDataType<T>()};
+    nvcv::ImageFormat fmt(nvcv::MemLayout::PITCH_LINEAR, dtype.dataKind(), nvcv::Swizzle::S_X000, dtype.packing());
+
+    state.add_global_memory_reads(srcShape.x * srcShape.y * srcShape.z * sizeof(T));
+    state.add_global_memory_writes(dstShape.x * dstShape.y * dstShape.z * sizeof(T));
+
+    cvcuda::PillowResize op(useCache ? 64 : 0);
+
+    cvcuda::UniqueWorkspace ws
+        = cvcuda::AllocateWorkspace(op.getWorkspaceRequirements(srcShape.x, srcSize, dstSize, fmt));
+
+    nvcv::Tensor src({{srcShape.x, srcShape.y, srcShape.z, 1}, "NHWC"}, dtype);
+    nvcv::Tensor dst({{dstShape.x, dstShape.y, dstShape.z, 1}, "NHWC"}, dtype);
+
+    benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+    // clang-format off
+
+    state.exec(nvbench::exec_tag::sync, [&op, &ws, &src, &dst, &interpType](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), ws.get(), src, dst, interpType);
+    });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using PillowResizeCoeffCacheTypes = nvbench::type_list<uint8_t>;
+
+NVBENCH_BENCH_TYPES(PillowResizeCoeffCache, NVBENCH_TYPE_AXES(PillowResizeCoeffCacheTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_string_axis("dstShape", {"1x224x224"})
+    .add_string_axis("interpolation", {"LINEAR", "CUBIC"})
+    .add_string_axis("coeffCache", {"ON", "OFF"});
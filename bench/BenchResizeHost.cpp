@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchUtils.hpp"
+
+#include <cvcuda/OpResize.hpp>
+#include <cvcuda/OpResizeCropConvertReformat.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+// Resize of tensors in host memory, which runs on the CPU. The measured time is the wall
+// time of the synchronous call, set CVCUDA_HOST_THREADS to benchmark a given thread count.
+
+template<typename T>
+inline void ResizeHost(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 srcShape = benchutils::GetShape<3>(state.get_string("shape"));
+    long  channels = state.get_int64("channels");
+
+    NVCVInterpolationType interpType = benchutils::GetInterpolationType(state.get_string("interpolation"));
+
+    long3 dstShape;
+
+    if (state.get_string("resizeType") == "EXPAND")
+    {
+        dstShape = long3{srcShape.x, srcShape.y * 2, srcShape.z * 2};
+    }
+    else if (state.get_string("resizeType") == "CONTRACT")
+    {
+        dstShape = long3{srcShape.x, srcShape.y / 2, srcShape.z / 2};
+    }
+    else
+    {
+        throw std::invalid_argument("Invalid resizeType = " + state.get_string("resizeType"));
+    }
+
+    state.add_global_memory_reads(srcShape.x * srcShape.y * srcShape.z * channels * sizeof(T));
+    state.add_global_memory_writes(dstShape.x * dstShape.y * dstShape.z * channels * sizeof(T));
+
+    cvcuda::Resize op;
+
+    // clang-format off
+
+    nvcv::Tensor src({{srcShape.x, srcShape.y, srcShape.z, channels}, "NHWC"}, benchutils::GetDataType<T>(),
+                     nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST);
+    nvcv::Tensor dst({{dstShape.x, dstShape.y, dstShape.z, channels}, "NHWC"}, benchutils::GetDataType<T>(),
+                     nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST);
+
+    benchutils::FillTensor<T>(src, benchutils::RandomValues<T>());
+
+    state.exec(nvbench::exec_tag::sync, [&op, &src, &dst, &interpType](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), src, dst, interpType);
+    });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+template<typename T>
+inline void ResizeCropConvertReformatHost(nvbench::state &state, nvbench::type_list<T>)
+try
+{
+    long3 srcShape = benchutils::GetShape<3>(state.get_string("shape"));
+
+    NVCVInterpolationType interpType = benchutils::GetInterpolationType(state.get_string("interpolation"));
+
+    // Half size resize, center crop of half of the resized images and planar output, as in inference pre-processing
+    NVCVSize2D resize{(int)(srcShape.z / 2), (int)(srcShape.y / 2)};
+    long3      dstShape{srcShape.x, srcShape.y / 4, srcShape.z / 4};
+    int2       cropPos{(int)(dstShape.z / 2), (int)(dstShape.y / 2)};
+
+    state.add_global_memory_reads(srcShape.x * srcShape.y * srcShape.z * 3 * sizeof(uint8_t));
+    state.add_global_memory_writes(dstShape.x * dstShape.y * dstShape.z * 3 * sizeof(T));
+
+    cvcuda::ResizeCropConvertReformat op;
+
+    nvcv::Tensor src({{srcShape.x, srcShape.y, srcShape.z, 3}, "NHWC"}, nvcv::TYPE_U8, nvcv::MemAlignment{}, nullptr,
+                     NVCV_RESOURCE_MEM_HOST);
+    nvcv::Tensor dst({{dstShape.x, 3, dstShape.y, dstShape.z}, "NCHW"}, benchutils::GetDataType<T>(),
+                     nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST);
+
+    benchutils::FillTensor<uint8_t>(src, benchutils::RandomValues<uint8_t>());
+
+    state.exec(nvbench::exec_tag::sync, [&op, &src, &dst, &resize, &interpType, &cropPos](nvbench::launch &launch)
+    {
+        op(launch.get_stream(), src, dst, resize, interpType, cropPos, NVCV_CHANNEL_REVERSE, 1.f / 255, 0.f);
+    });
+}
+catch (const std::exception &err)
+{
+    state.skip(err.what());
+}
+
+// clang-format on
+
+using ResizeHostTypes = nvbench::type_list<uint8_t, float>;
+
+NVBENCH_BENCH_TYPES(ResizeHost, NVBENCH_TYPE_AXES(ResizeHostTypes))
+    .set_type_axes_names({"InOutDataType"})
+    .add_string_axis("shape", {"1x1080x1920"})
+    .add_int64_axis("channels", {3})
+    .add_string_axis("resizeType", {"EXPAND", "CONTRACT"})
+    .add_string_axis("interpolation", {"NEAREST", "LINEAR", "CUBIC", "AREA"});
+
+using ResizeCropConvertReformatHostTypes = nvbench::type_list<uint8_t, float>;
+
+NVBENCH_BENCH_TYPES(ResizeCropConvertReformatHost, NVBENCH_TYPE_AXES(ResizeCropConvertReformatHostTypes))
+    .set_type_axes_names({"OutDataType"})
+    .add_string_axis("shape", {"4x1080x1920"})
+    .add_string_axis("interpolation", {"NEAREST", "LINEAR"});
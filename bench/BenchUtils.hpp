@@ -30,6 +30,7 @@
 #include <nvcv/TensorData.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <random>
 #include <stdexcept>
@@ -251,7 +252,7 @@ inline void FillTensor(const nvcv::Tensor &tensor, VG valuesGenerator)
 {
     using longR = nvcv::cuda::MakeType<long, RANK>;
 
-    auto tensorData = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    auto tensorData = tensor.exportData<nvcv::TensorDataStrided>();
     CVCUDA_CHECK_DATA(tensorData);
 
     longR strides, shape;
@@ -268,7 +269,14 @@ inline void FillTensor(const nvcv::Tensor &tensor, VG valuesGenerator)
 
     FillBuffer<VT>(tensorVec, shape, strides, valuesGenerator);
 
-    CUDA_CHECK_ERROR(cudaMemcpy(tensorData->basePtr(), tensorVec.data(), bufSize, cudaMemcpyHostToDevice));
+    if (tensorData->IsCompatible<nvcv::TensorDataStridedHost>())
+    {
+        std::memcpy(tensorData->basePtr(), tensorVec.data(), bufSize);
+    }
+    else
+    {
+        CUDA_CHECK_ERROR(cudaMemcpy(tensorData->basePtr(), tensorVec.data(), bufSize, cudaMemcpyHostToDevice));
+    }
 }
 
 template<typename VT, class VG>
@@ -0,0 +1,423 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Benchmark results database for the nvbench suite.
+
+Results of a run are read from the nvbench CSV output, either from a single
+benchmark or from the bench_output.csv written by run_bench.py. Each result is
+keyed by the benchmark name and its axis values. A database is a JSON file with
+one or more runs, each identified by its GPU model and build.
+
+Usage:
+    python3 bench/bench_db.py save RESULTS.csv --db DB.json --gpu NAME --build ID
+    python3 bench/bench_db.py compare RESULTS.csv --baseline DB.json|BASELINE.csv
+        [--gpu NAME] [--build ID] [--threshold 0.05] [--noise-factor 2]
+        [--markdown OUT.md] [--html OUT.html]
+
+compare exits with status 1 when there are statistically significant regressions.
+This module doesn't need a GPU, it only works on recorded CSV and JSON files.
+"""
+
+import argparse
+import csv
+import datetime
+import html
+import json
+import math
+import os
+import sys
+
+DB_VERSION = 1
+
+# Columns that aren't benchmark axes. Metric columns are matched by prefix, as
+# nvbench appends units to some of them, e.g. "GPU Time (sec)", and pandas
+# renames repeated ones, e.g. "Noise.1".
+META_COLUMNS = {"", "Unnamed: 0", "Benchmark", "Device", "Device Name", "Skipped"}
+METRIC_PREFIXES = (
+    "Samples",
+    "CPU Time",
+    "GPU Time",
+    "Batch GPU",
+    "Noise",
+    "Elem/s",
+    "GlobalMem BW",
+    "BWUtil",
+)
+
+STATUS_REGRESSION = "regression"
+STATUS_IMPROVEMENT = "improvement"
+STATUS_UNCHANGED = "unchanged"
+STATUS_NEW = "new"
+STATUS_MISSING = "missing"
+
+
+def is_axis_column(name):
+    return name not in META_COLUMNS and not name.startswith(METRIC_PREFIXES)
+
+
+def parse_number(value):
+    """Parses a CSV value into a float, None if empty or not a number."""
+    if value is None:
+        return None
+    value = value.strip()
+    if value == "" or value.lower() == "nan":
+        return None
+    scale = 1.0
+    if value.endswith("%"):
+        value, scale = value[:-1], 0.01
+    try:
+        return float(value) * scale
+    except ValueError:
+        return None
+
+
+def result_key(benchmark, axes):
+    """Builds the key of a result, e.g. "Flip[shape=1x1080x1920,dtype=U8]"."""
+    return "{}[{}]".format(
+        benchmark, ",".join(f"{k}={v}" for k, v in sorted(axes.items()))
+    )
+
+
+def read_results_csv(path):
+    """Reads the nvbench CSV output, returns a dict of results by key.
+
+    Each result has the benchmark name, its axes, and the GPU time in seconds
+    with its noise (relative standard deviation) and the bandwidth utilization
+    when available. Skipped benchmarks are ignored.
+    """
+    results = {}
+
+    with open(path, newline="") as f:
+        reader = csv.reader(f)
+        header = next(reader, None)
+        if header is None:
+            return results
+
+        # nvbench writes a "Noise" column after both "CPU Time" and "GPU Time",
+        # each one refers to the time before it.
+        gpu_time_col = gpu_noise_col = bw_util_col = None
+        last_time = None
+        for i, name in enumerate(header):
+            if name.startswith("GPU Time"):
+                gpu_time_col, last_time = i, "gpu"
+            elif name.startswith("CPU Time"):
+                last_time = "cpu"
+            elif name.startswith("Noise") and last_time == "gpu":
+                gpu_noise_col, last_time = i, None
+            elif name == "BWUtil":
+                bw_util_col = i
+
+        if "Benchmark" not in header:
+            raise ValueError(f"{path}: not an nvbench CSV, no Benchmark column")
+        bench_col = header.index("Benchmark")
+        skipped_col = header.index("Skipped") if "Skipped" in header else None
+        axis_cols = [i for i, name in enumerate(header) if is_axis_column(name)]
+
+        def cell(row, col):
+            return row[col] if col is not None and col < len(row) else None
+
+        for row in reader:
+            if not row:
+                continue
+            if skipped_col is not None and cell(row, skipped_col) == "Yes":
+                continue
+
+            benchmark = row[bench_col]
+            # Benchmarks in a merged CSV don't have all axes, their cells are empty
+            axes = {
+                header[i]: row[i] for i in axis_cols if i < len(row) and row[i] != ""
+            }
+
+            gpu_time = parse_number(cell(row, gpu_time_col))
+            if gpu_time is None:
+                continue
+
+            results[result_key(benchmark, axes)] = {
+                "benchmark": benchmark,
+                "axes": axes,
+                "gpu_time": gpu_time,
+                "gpu_noise": parse_number(cell(row, gpu_noise_col)) or 0.0,
+                "bw_util": parse_number(cell(row, bw_util_col)),
+            }
+
+    return results
+
+
+def load_db(path):
+    if not os.path.exists(path):
+        return {"version": DB_VERSION, "runs": []}
+    with open(path) as f:
+        db = json.load(f)
+    if db.get("version") != DB_VERSION:
+        raise ValueError(f"{path}: unsupported database version {db.get('version')}")
+    return db
+
+
+def save_db(db, path):
+    with open(path, "w") as f:
+        json.dump(db, f, indent=1, sort_keys=True)
+        f.write("\n")
+
+
+def add_run(db, results, gpu, build, date=None):
+    """Adds the results of a run to the database.
+
+    A run with the same GPU and build is replaced.
+    """
+    db["runs"] = [r for r in db["runs"] if (r["gpu"], r["build"]) != (gpu, build)]
+    db["runs"].append(
+        {
+            "gpu": gpu,
+            "build": build,
+            "date": date or datetime.datetime.now().isoformat(timespec="seconds"),
+            "results": results,
+        }
+    )
+    return db
+
+
+def find_run(db, gpu=None, build=None):
+    """Returns the run matching the GPU and build, the latest one if build is None.
+
+    gpu can only be None when all runs are from the same GPU.
+    """
+    runs = db["runs"]
+    if gpu is None:
+        gpus = {r["gpu"] for r in runs}
+        if len(gpus) > 1:
+            raise ValueError(
+                "Database has runs from several GPUs, one must be chosen: "
+                f"{sorted(gpus)}"
+            )
+    else:
+        runs = [r for r in runs if r["gpu"] == gpu]
+    if build is not None:
+        runs = [r for r in runs if r["build"] == build]
+    if not runs:
+        raise ValueError(f"No baseline run found for gpu={gpu} build={build}")
+    return max(runs, key=lambda r: r["date"])
+
+
+def load_baseline(path, gpu=None, build=None):
+    """Loads baseline results either from a database or from a recorded CSV."""
+    if path.endswith(".csv"):
+        return read_results_csv(path)
+    return find_run(load_db(path), gpu, build)["results"]
+
+
+def classify(base, cur, threshold, noise_factor):
+    """Classifies the change of GPU time between two results.
+
+    A change is significant when the relative difference is above the threshold
+    and also above noise_factor times the combined noise of both measurements.
+    """
+    rel = cur["gpu_time"] / base["gpu_time"] - 1.0
+    noise = math.hypot(base.get("gpu_noise") or 0.0, cur.get("gpu_noise") or 0.0)
+    limit = max(threshold, noise_factor * noise)
+
+    if rel > limit:
+        return STATUS_REGRESSION, rel, noise
+    elif rel < -limit:
+        return STATUS_IMPROVEMENT, rel, noise
+    else:
+        return STATUS_UNCHANGED, rel, noise
+
+
+def compare(baseline, current, threshold=0.05, noise_factor=2.0):
+    """Compares the current results against the baseline ones.
+
+    Returns a list of rows sorted by status then by relative change, each with
+    the key, status, baseline and current GPU times, relative change and noise.
+    """
+    rows = []
+    for key in sorted(set(baseline) | set(current)):
+        base, cur = baseline.get(key), current.get(key)
+        row = {
+            "key": key,
+            "base_time": base["gpu_time"] if base else None,
+            "cur_time": cur["gpu_time"] if cur else None,
+            "rel": None,
+            "noise": None,
+        }
+        if base is None:
+            row["status"] = STATUS_NEW
+        elif cur is None:
+            row["status"] = STATUS_MISSING
+        else:
+            row["status"], row["rel"], row["noise"] = classify(
+                base, cur, threshold, noise_factor
+            )
+        rows.append(row)
+
+    order = [
+        STATUS_REGRESSION,
+        STATUS_IMPROVEMENT,
+        STATUS_NEW,
+        STATUS_MISSING,
+        STATUS_UNCHANGED,
+    ]
+    rows.sort(key=lambda r: (order.index(r["status"]), -abs(r["rel"] or 0.0)))
+    return rows
+
+
+def count_status(rows):
+    counts = {}
+    for r in rows:
+        counts[r["status"]] = counts.get(r["status"], 0) + 1
+    return counts
+
+
+def _fmt_time(t):
+    return "-" if t is None else f"{t * 1e6:.2f}"
+
+
+def _fmt_pct(p):
+    return "-" if p is None else f"{p:+.2%}"
+
+
+def _table_rows(rows, all_rows):
+    for r in rows:
+        if all_rows or r["status"] != STATUS_UNCHANGED:
+            yield [
+                r["key"],
+                r["status"],
+                _fmt_time(r["base_time"]),
+                _fmt_time(r["cur_time"]),
+                _fmt_pct(r["rel"]),
+                "-" if r["noise"] is None else f"{r['noise']:.2%}",
+            ]
+
+
+TABLE_HEADER = [
+    "Benchmark",
+    "Status",
+    "Baseline (us)",
+    "Current (us)",
+    "Change",
+    "Noise",
+]
+
+
+def summary_line(rows):
+    counts = count_status(rows)
+    return ", ".join(f"{counts[s]} {s}" for s in sorted(counts))
+
+
+def to_markdown(rows, title="Benchmark comparison", all_rows=False):
+    """Renders the comparison as markdown.
+
+    Unchanged results are only listed if all_rows is True.
+    """
+    lines = [f"# {title}", "", summary_line(rows), ""]
+    table = list(_table_rows(rows, all_rows))
+    if table:
+        lines.append("| " + " | ".join(TABLE_HEADER) + " |")
+        lines.append("|" + "---|" * len(TABLE_HEADER))
+        for t in table:
+            lines.append("| " + " | ".join(c.replace("|", "\\|") for c in t) + " |")
+    return "\n".join(lines) + "\n"
+
+
+def to_html(rows, title="Benchmark comparison", all_rows=False):
+    """Renders the comparison as a standalone HTML page."""
+    colors = {STATUS_REGRESSION: "#f8d7da", STATUS_IMPROVEMENT: "#d4edda"}
+    out = [
+        "<!DOCTYPE html>",
+        "<html><head><meta charset='utf-8'>",
+        f"<title>{html.escape(title)}</title></head><body>",
+        f"<h1>{html.escape(title)}</h1>",
+        f"<p>{html.escape(summary_line(rows))}</p>",
+        "<table border='1' cellspacing='0' cellpadding='4'>",
+        "<tr>" + "".join(f"<th>{html.escape(h)}</th>" for h in TABLE_HEADER) + "</tr>",
+    ]
+    for t in _table_rows(rows, all_rows):
+        style = f" style='background:{colors[t[1]]}'" if t[1] in colors else ""
+        out.append(
+            f"<tr{style}>" + "".join(f"<td>{html.escape(c)}</td>" for c in t) + "</tr>"
+        )
+    out += ["</table>", "</body></html>"]
+    return "\n".join(out) + "\n"
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p_save = sub.add_parser("save", help="Stores the results as a baseline run")
+    p_save.add_argument("results", help="nvbench CSV output")
+    p_save.add_argument("--db", required=True, help="JSON database to update")
+    p_save.add_argument("--gpu", required=True, help="GPU model of the run")
+    p_save.add_argument(
+        "--build", required=True, help="Build of the run, e.g. a git hash"
+    )
+
+    p_cmp = sub.add_parser("compare", help="Compares the results against a baseline")
+    p_cmp.add_argument("results", help="nvbench CSV output")
+    p_cmp.add_argument(
+        "--baseline", required=True, help="JSON database or recorded nvbench CSV"
+    )
+    p_cmp.add_argument("--gpu", help="GPU model of the baseline run")
+    p_cmp.add_argument("--build", help="Build of the baseline run, latest if omitted")
+    p_cmp.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="Minimum relative change of GPU time to report",
+    )
+    p_cmp.add_argument(
+        "--noise-factor",
+        type=float,
+        default=2.0,
+        help="Changes must also exceed this many times the combined noise",
+    )
+    p_cmp.add_argument("--markdown", help="Writes a markdown summary to this file")
+    p_cmp.add_argument("--html", help="Writes an HTML summary to this file")
+    p_cmp.add_argument(
+        "--all", action="store_true", help="Also list unchanged results in summaries"
+    )
+
+    args = parser.parse_args(argv)
+
+    results = read_results_csv(args.results)
+
+    if args.command == "save":
+        db = add_run(load_db(args.db), results, args.gpu, args.build)
+        save_db(db, args.db)
+        print(
+            f"I Stored {len(results)} result(s) for {args.gpu} {args.build} "
+            f"in {args.db}"
+        )
+        return 0
+
+    baseline = load_baseline(args.baseline, args.gpu, args.build)
+    rows = compare(baseline, results, args.threshold, args.noise_factor)
+
+    if args.markdown:
+        with open(args.markdown, "w") as f:
+            f.write(to_markdown(rows, all_rows=args.all))
+    if args.html:
+        with open(args.html, "w") as f:
+            f.write(to_html(rows, all_rows=args.all))
+
+    print(to_markdown(rows), end="")
+
+    return 1 if count_status(rows).get(STATUS_REGRESSION, 0) > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,92 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Measures how many NVCV objects per second can be created from multiple Python threads,
+exercising the NVCV Python object cache lookups and insertions under contention.
+
+Usage:
+    python3 bench/python/bench_cache_threads.py [--duration SECONDS] [--shapes N]
+"""
+
+import argparse
+import threading
+import time
+
+import numpy as np
+import nvcv
+
+THREAD_COUNTS = [1, 2, 4, 8, 16, 32]
+
+
+def worker(shapes, duration, barrier, counts, idx):
+    barrier.wait()
+    n = 0
+    end = time.perf_counter() + duration
+    while time.perf_counter() < end:
+        for shape in shapes:
+            # The tensor goes out of scope right away, so the next creation
+            # with the same shape is served by the cache.
+            nvcv.Tensor(shape, np.uint8)
+        n += len(shapes)
+    counts[idx] = n
+
+
+def run(num_threads, shapes, duration):
+    nvcv.clear_cache()
+    counts = [0] * num_threads
+    barrier = threading.Barrier(num_threads + 1)
+    threads = [
+        threading.Thread(target=worker, args=(shapes, duration, barrier, counts, i))
+        for i in range(num_threads)
+    ]
+    for t in threads:
+        t.start()
+
+    barrier.wait()
+    start = time.perf_counter()
+    for t in threads:
+        t.join()
+    elapsed = time.perf_counter() - start
+
+    return sum(counts) / elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--duration", type=float, default=2.0, help="Seconds to run each thread count"
+    )
+    parser.add_argument(
+        "--shapes", type=int, default=8, help="Number of distinct tensor shapes"
+    )
+    args = parser.parse_args()
+
+    shapes = [(64 + i, 64) for i in range(args.shapes)]
+
+    nvcv.reset_cache_stats()
+    print(f"{'threads':>8} {'allocs/s':>14}")
+    for num_threads in THREAD_COUNTS:
+        rate = run(num_threads, shapes, args.duration)
+        print(f"{num_threads:>8} {rate:>14.0f}")
+
+    stats = nvcv.cache_stats()
+    print(
+        f"cache hits: {stats['hits']}, misses: {stats['misses']}, evictions: {stats['evictions']}"
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,93 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Measures the host time spent submitting an operator from Python on tiny tensors, where
+the kernel itself is negligible, for operators holding a growing number of resources.
+Most of it is argument conversion and the resource bookkeeping done for every call.
+
+Usage:
+    python3 bench/python/bench_dispatch_overhead.py [--duration SECONDS] [--size N]
+"""
+
+import argparse
+import time
+
+import cvcuda
+import nvcv
+import torch
+
+
+def make_tensor(shape):
+    return nvcv.as_tensor(torch.zeros(shape, dtype=torch.uint8).cuda(), "NHWC")
+
+
+def make_cases(size):
+    shape = (1, size, size, 3)
+    src = make_tensor(shape)
+    dst = make_tensor(shape)
+    bkg = make_tensor(shape)
+    mask = make_tensor((1, size, size, 1))
+
+    # name, number of tensors, function submitting the operator to the given stream
+    return [
+        ("flip_into", 2, lambda s: cvcuda.flip_into(dst, src, flipCode=1, stream=s)),
+        (
+            "composite_into",
+            4,
+            lambda s: cvcuda.composite_into(dst, src, bkg, mask, stream=s),
+        ),
+    ]
+
+
+def run(submit, duration):
+    stream = cvcuda.Stream()
+
+    # Warm-up, also fills the object cache
+    for _ in range(100):
+        submit(stream)
+    stream.sync()
+
+    n = 0
+    start = time.perf_counter()
+    end = start + duration
+    while time.perf_counter() < end:
+        for _ in range(100):
+            submit(stream)
+        n += 100
+    elapsed = time.perf_counter() - start
+    stream.sync()
+
+    return n / elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--duration", type=float, default=2.0, help="Seconds to run each operator"
+    )
+    parser.add_argument(
+        "--size", type=int, default=8, help="Width and height of the tensors"
+    )
+    args = parser.parse_args()
+
+    print(f"{'operator':>16} {'tensors':>8} {'ops/s':>12} {'us/op':>8}")
+    for name, ntensors, submit in make_cases(args.size):
+        rate = run(submit, args.duration)
+        print(f"{name:>16} {ntensors:>8} {rate:>12.0f} {1e6 / rate:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Measures how many tensor create/use/drop cycles per second can be done from Python, with
+and without the CUDA event pool. Each cycle wraps two torch tensors, uses them on two
+streams, which makes them synchronize through CUDA events, and drops them.
+
+Usage:
+    python3 bench/python/bench_event_pool.py [--duration SECONDS] [--size N]
+"""
+
+import argparse
+import time
+
+import cvcuda
+import nvcv
+import torch
+
+
+def run(limit, src, dst, duration):
+    streams = [cvcuda.Stream(), cvcuda.Stream()]
+    nvcv.cuda.set_event_pool_limit(limit)
+    nvcv.cuda.clear_event_pool()
+
+    def cycle():
+        nsrc = nvcv.as_tensor(src, "NHWC")
+        ndst = nvcv.as_tensor(dst, "NHWC")
+        for stream in streams:
+            cvcuda.flip_into(ndst, nsrc, flipCode=1, stream=stream)
+
+    # Warm-up
+    for _ in range(100):
+        cycle()
+    nvcv.cuda.reset_event_pool_stats()
+
+    n = 0
+    start = time.perf_counter()
+    end = start + duration
+    while time.perf_counter() < end:
+        for _ in range(100):
+            cycle()
+        n += 100
+    for stream in streams:
+        stream.sync()
+    elapsed = time.perf_counter() - start
+
+    return n / elapsed, nvcv.cuda.event_pool_stats()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--duration", type=float, default=2.0, help="Seconds to run each setting"
+    )
+    parser.add_argument(
+        "--size", type=int, default=32, help="Width and height of the tensors"
+    )
+    args = parser.parse_args()
+
+    shape = (1, args.size, args.size, 3)
+    src = torch.zeros(shape, dtype=torch.uint8).cuda()
+    dst = torch.zeros(shape, dtype=torch.uint8).cuda()
+
+    prev_limit = nvcv.cuda.get_event_pool_limit()
+
+    print(f"{'pool':>8} {'cycles/s':>12} {'hits':>10} {'misses':>10} {'discards':>10}")
+    for name, limit in [("off", 0), ("on", prev_limit)]:
+        rate, stats = run(limit, src, dst, args.duration)
+        print(
+            f"{name:>8} {rate:>12.0f} {stats['hits']:>10} {stats['misses']:>10} {stats['discards']:>10}"
+        )
+
+    nvcv.cuda.set_event_pool_limit(prev_limit)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Measures how many operator calls per second can be submitted from Python on small tensors,
+comparing the stream resource release modes: a host callback per call, and epochs of calls
+released together once their event completes.
+
+Usage:
+    python3 bench/python/bench_stream_release.py [--duration SECONDS] [--size N] [--epoch-length N]
+"""
+
+import argparse
+import time
+
+import cvcuda
+import nvcv
+import torch
+
+MODES = [
+    ("callback", nvcv.cuda.ReleaseMode.CALLBACK),
+    ("epoch", nvcv.cuda.ReleaseMode.EPOCH),
+]
+
+
+def run(mode, epoch_length, src, dst, duration):
+    stream = cvcuda.Stream()
+    nvcv.cuda.set_release_mode(mode, epoch_length)
+
+    # Warm-up, also fills the object cache
+    for _ in range(100):
+        cvcuda.flip_into(dst, src, flipCode=1, stream=stream)
+    stream.sync()
+
+    n = 0
+    start = time.perf_counter()
+    end = start + duration
+    while time.perf_counter() < end:
+        for _ in range(100):
+            cvcuda.flip_into(dst, src, flipCode=1, stream=stream)
+        n += 100
+    stream.sync()
+    elapsed = time.perf_counter() - start
+
+    return n / elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--duration", type=float, default=2.0, help="Seconds to run each mode"
+    )
+    parser.add_argument(
+        "--size", type=int, default=32, help="Width and height of the tensors"
+    )
+    parser.add_argument(
+        "--epoch-length", type=int, default=16, help="Operator calls per epoch"
+    )
+    args = parser.parse_args()
+
+    shape = (1, args.size, args.size, 3)
+    src = nvcv.as_tensor(torch.zeros(shape, dtype=torch.uint8).cuda(), "NHWC")
+    dst = nvcv.as_tensor(torch.zeros(shape, dtype=torch.uint8).cuda(), "NHWC")
+
+    prev_mode = nvcv.cuda.get_release_mode()
+
+    print(f"{'mode':>10} {'ops/s':>14}")
+    for name, mode in MODES:
+        rate = run(mode, args.epoch_length, src, dst, args.duration)
+        print(f"{name:>10} {rate:>14.0f}")
+
+    nvcv.cuda.set_release_mode(prev_mode)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,4 @@
-# SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-FileCopyrightText: Copyright (c) 2023-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
 # SPDX-License-Identifier: Apache-2.0
 #
 # Licensed under the Apache License, Version 2.0 (the "License");
@@ -13,12 +13,28 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+"""
+Runs all cvcuda_bench_* binaries in a folder and merges their results into
+bench_output.csv in that folder.
+
+Usage:
+    python3 bench/run_bench.py bench_folder [options] [extra args for benchmarks]
+
+With --save-baseline the results are stored in the --db JSON database, keyed
+by GPU model and build. With --compare they're compared against a baseline run
+from --db, or a recorded CSV, and the script fails on significant regressions.
+See bench_db.py for the comparison details.
+"""
+
+import argparse
 import os
 import sys
 import time
 import subprocess
 import pandas as pd
 
+import bench_db
+
 
 BENCH_PREFIX = "cvcuda_bench_"
 BENCH_OUTPUT = "out.csv"
@@ -29,16 +45,55 @@ BENCH_COLUMNS = {"Benchmark", "BWUtil", "Skipped"}
 BANDWIDTH_COLNAME = "BWUtil"
 
 
+def query_output(cmd, default):
+    try:
+        out = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+        lines = out.stdout.decode().strip().splitlines()
+        return lines[0] if out.returncode == 0 and lines else default
+    except OSError:
+        return default
+
+
+def parse_args():
+    # No abbreviations, they could match the benchmarks' own options
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False,
+    )
+    parser.add_argument("bench_folder", help="Folder with the benchmark binaries")
+    parser.add_argument("--db", help="JSON benchmark results database")
+    parser.add_argument(
+        "--save-baseline", action="store_true", help="Stores the results in --db"
+    )
+    parser.add_argument(
+        "--compare",
+        nargs="?",
+        const="",
+        metavar="BASELINE",
+        help="Compares against a recorded CSV or database, --db if omitted",
+    )
+    parser.add_argument("--gpu", help="GPU model, queried with nvidia-smi by default")
+    parser.add_argument("--build", help="Build of the run, git hash by default")
+    parser.add_argument("--baseline-build", help="Build of the baseline run in --db")
+    parser.add_argument("--threshold", type=float, default=0.05)
+    parser.add_argument("--noise-factor", type=float, default=2.0)
+    parser.add_argument("--markdown", help="Writes a comparison summary to this file")
+    parser.add_argument("--html", help="Writes a comparison summary to this file")
+
+    # Everything else is passed to the benchmarks
+    return parser.parse_known_args()
+
+
 if __name__ == "__main__":
-    if len(sys.argv) == 1:
-        print(
-            "E At least one argument must be provided: benchmark folder"
-            f"I Usage: {sys.argv[0]} bench_folder [extra args for benchmarks]"
-        )
+    args, extra_args = parse_args()
+
+    if (args.save_baseline or args.compare == "") and not args.db:
+        print("E --db must be given to save or compare against a baseline run")
         sys.exit(1)
 
-    bench_args = " ".join(sys.argv[2:]) if len(sys.argv) > 2 else ""
-    bench_folder = sys.argv[1]
+    bench_args = " ".join(extra_args)
+    bench_folder = args.bench_folder
     bench_files = [fn for fn in sorted(os.listdir(bench_folder)) if BENCH_PREFIX in fn]
 
     if len(bench_files) == 0:
@@ -93,3 +148,40 @@ if __name__ == "__main__":
     pd.options.display.float_format = "{:.2%}".format
 
     print(f"I Summary results:\n{df}")
+
+    if args.save_baseline or args.compare is not None:
+        gpu = args.gpu or query_output(
+            ["nvidia-smi", "--query-gpu=name", "--format=csv,noheader"], "unknown"
+        )
+        build = args.build or query_output(
+            ["git", "rev-parse", "--short", "HEAD"], "unknown"
+        )
+        results = bench_db.read_results_csv(filepath)
+
+    status = 0
+
+    if args.compare is not None:
+        baseline = bench_db.load_baseline(
+            args.compare or args.db, gpu, args.baseline_build
+        )
+
+        rows = bench_db.compare(baseline, results, args.threshold, args.noise_factor)
+        title = f"Benchmark comparison on {gpu}, build {build}"
+        if args.markdown:
+            with open(args.markdown, "w") as f:
+                f.write(bench_db.to_markdown(rows, title))
+        if args.html:
+            with open(args.html, "w") as f:
+                f.write(bench_db.to_html(rows, title))
+
+        print(f"I {bench_db.summary_line(rows)}")
+        if bench_db.count_status(rows).get(bench_db.STATUS_REGRESSION, 0) > 0:
+            print(f"E Significant regressions:\n{bench_db.to_markdown(rows, title)}")
+            status = 1
+
+    if args.save_baseline:
+        db = bench_db.add_run(bench_db.load_db(args.db), results, gpu, build)
+        bench_db.save_db(db, args.db)
+        print(f"I Results stored in {args.db} for {gpu}, build {build}")
+
+    sys.exit(status)
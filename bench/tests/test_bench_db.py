@@ -0,0 +1,156 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Tests of the benchmark results database on recorded nvbench CSVs, no GPU needed:
+#     python3 -m pytest bench/tests
+
+import os
+import sys
+
+import pytest as t
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+import bench_db  # noqa: E402
+
+DATA_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "data")
+
+
+def data(name):
+    return os.path.join(DATA_DIR, name)
+
+
+def status_by_key(rows):
+    return {r["key"]: r["status"] for r in rows}
+
+
+def test_read_results_csv():
+    res = bench_db.read_results_csv(data("baseline.csv"))
+
+    # The skipped configuration isn't a result
+    assert len(res) == 5
+    r = res["Flip[dtype=U8,shape=1x1080x1920]"]
+    assert r["benchmark"] == "Flip"
+    assert r["axes"] == {"shape": "1x1080x1920", "dtype": "U8"}
+    assert r["gpu_time"] == t.approx(100e-6)
+    # The noise is the one after the GPU time, not the CPU time
+    assert r["gpu_noise"] == t.approx(0.01)
+    assert r["bw_util"] == t.approx(0.60)
+
+
+def test_read_merged_results_csv():
+    res = bench_db.read_results_csv(data("merged.csv"))
+
+    # Axes missing from a benchmark are empty cells in run_bench.py output
+    assert sorted(res) == [
+        "Flip[dtype=U8,shape=1x1080x1920]",
+        "MedianBlur[dtype=U8,kernelSize=3x3,shape=1x1080x1920]",
+        "MedianBlur[dtype=U8,kernelSize=5x5,shape=1x1080x1920]",
+    ]
+    r = res["MedianBlur[dtype=U8,kernelSize=5x5,shape=1x1080x1920]"]
+    assert r["gpu_time"] == t.approx(900e-6)
+    assert r["gpu_noise"] == t.approx(0.03)
+
+
+def test_compare():
+    base = bench_db.read_results_csv(data("baseline.csv"))
+    cur = bench_db.read_results_csv(data("current.csv"))
+
+    rows = bench_db.compare(base, cur, threshold=0.05, noise_factor=2.0)
+
+    assert status_by_key(rows) == {
+        "Flip[dtype=U8,shape=1x1080x1920]": "regression",
+        "Flip[dtype=F32,shape=1x1080x1920]": "improvement",
+        "Flip[dtype=U8,shape=16x1080x1920]": "unchanged",
+        # +25% but within twice the 20% noise of the measurements
+        "Flip[dtype=F32,shape=16x1080x1920]": "unchanged",
+        "Flip[dtype=U8,shape=32x1080x1920]": "missing",
+        "Flip[dtype=U8,shape=64x1080x1920]": "new",
+    }
+    assert rows[0]["status"] == "regression"
+    assert rows[0]["rel"] == t.approx(0.20)
+
+
+@t.mark.parametrize(
+    "threshold,noise_factor,expected",
+    [
+        (0.30, 2.0, "unchanged"),
+        (0.05, 0.5, "regression"),
+    ],
+)
+def test_compare_limits(threshold, noise_factor, expected):
+    base = {"k": {"gpu_time": 1.0, "gpu_noise": 0.2}}
+    cur = {"k": {"gpu_time": 1.25, "gpu_noise": 0.0}}
+
+    rows = bench_db.compare(base, cur, threshold, noise_factor)
+    assert rows[0]["status"] == expected
+
+
+def test_db_runs(tmp_path):
+    path = str(tmp_path / "db.json")
+    base = bench_db.read_results_csv(data("baseline.csv"))
+    cur = bench_db.read_results_csv(data("current.csv"))
+
+    db = bench_db.load_db(path)
+    bench_db.add_run(db, base, "GPU A", "abc", date="2025-01-01T00:00:00")
+    bench_db.add_run(db, cur, "GPU A", "def", date="2025-01-02T00:00:00")
+    bench_db.add_run(db, cur, "GPU B", "abc", date="2025-01-03T00:00:00")
+    bench_db.save_db(db, path)
+
+    db = bench_db.load_db(path)
+    assert bench_db.find_run(db, "GPU A")["build"] == "def"
+    assert bench_db.find_run(db, "GPU A", "abc")["results"] == base
+    with t.raises(ValueError):
+        bench_db.find_run(db)
+    with t.raises(ValueError):
+        bench_db.find_run(db, "GPU C")
+
+    # Same GPU and build replaces the run
+    bench_db.add_run(db, base, "GPU A", "def")
+    assert len(db["runs"]) == 3
+    assert bench_db.find_run(db, "GPU A", "def")["results"] == base
+
+
+def test_reports():
+    base = bench_db.read_results_csv(data("baseline.csv"))
+    cur = bench_db.read_results_csv(data("current.csv"))
+    rows = bench_db.compare(base, cur)
+
+    md = bench_db.to_markdown(rows)
+    assert "1 improvement, 1 missing, 1 new, 1 regression, 2 unchanged" in md
+    row = "| Flip[dtype=U8,shape=1x1080x1920] | regression | 100.00 | 120.00 |"
+    assert row in md
+    assert "shape=16x1080x1920" not in md
+    assert "shape=16x1080x1920" in bench_db.to_markdown(rows, all_rows=True)
+
+    page = bench_db.to_html(rows)
+    assert page.startswith("<!DOCTYPE html>")
+    assert "<td>regression</td>" in page
+
+
+def test_main_exit_status(tmp_path):
+    md = str(tmp_path / "out.md")
+    args = ["compare", data("current.csv"), "--baseline", data("baseline.csv")]
+
+    assert bench_db.main(args + ["--markdown", md]) == 1
+    assert os.path.getsize(md) > 0
+    same = ["compare", data("baseline.csv"), "--baseline", data("baseline.csv")]
+    assert bench_db.main(same) == 0
+
+    db = str(tmp_path / "db.json")
+    save = ["save", data("baseline.csv"), "--db", db, "--gpu", "A", "--build", "1"]
+    assert bench_db.main(save) == 0
+    loose = ["compare", data("current.csv"), "--baseline", db, "--threshold", "0.5"]
+    assert bench_db.main(loose) == 0
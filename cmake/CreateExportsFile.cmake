@@ -33,13 +33,14 @@ file(WRITE ${OUTPUT} "")
 set(all_versions "")
 
 foreach(src ${SOURCES})
-    file(STRINGS ${src} funcdef_list REGEX "_DEFINE_API.*")
+    file(STRINGS ${src} funcdef_list REGEX "_DEFINE_(OLD_)?API.*")
 
     foreach(func_def ${funcdef_list})
-        if(func_def MATCHES "^[A-Z_]+_DEFINE_API\\(+([^,]+),([^,]+),[^,]+,([^,]+).*$")
-            string(STRIP "${CMAKE_MATCH_1}" ver_major)
-            string(STRIP "${CMAKE_MATCH_2}" ver_minor)
-            string(STRIP "${CMAKE_MATCH_3}" func)
+        # Old versions of a function are listed in their version too
+        if(func_def MATCHES "^[A-Z_]+_DEFINE_(OLD_)?API\\(+([^,]+),([^,]+),[^,]+,([^,]+).*$")
+            string(STRIP "${CMAKE_MATCH_2}" ver_major)
+            string(STRIP "${CMAKE_MATCH_3}" ver_minor)
+            string(STRIP "${CMAKE_MATCH_4}" func)
             list(APPEND all_versions ${ver_major}.${ver_minor})
             list(APPEND funcs_${ver_major}_${ver_minor} ${func})
         else()
@@ -150,7 +150,9 @@ void ExportOpPairwiseMatcher(py::module &m)
                                           the best match (minimum distance) from 1st set to 2nd set and vice versa.
             matches_per_point (Number, optional): Number of best matches to return per point.
             norm_type (cvcuda.Norm, optional): Choice on how distances are normalized.  Defaults to cvcuda.Norm.L2.
-            algo_choice (cvcuda.Matcher, optional): Choice of the algorithm to perform the match.
+            algo_choice (cvcuda.Matcher, optional): Choice of the algorithm to perform the match.  The approximate
+                                                    LSH (Hamming norm) and IVF_FLAT (L1 or L2 norms) matchers use
+                                                    default parameters and index set2 on each call.
             stream (nvcv.cuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -186,7 +188,9 @@ void ExportOpPairwiseMatcher(py::module &m)
                                           the best match (minimum distance) from 1st set to 2nd set and vice versa.
             matches_per_point (Number, optional): Number of best matches to return per point.
             norm_type (cvcuda.Norm, optional): Choice on how distances are normalized.  Defaults to cvcuda.Norm.L2.
-            algo_choice (cvcuda.Matcher, optional): Choice of the algorithm to perform the match.
+            algo_choice (cvcuda.Matcher, optional): Choice of the algorithm to perform the match.  The approximate
+                                                    LSH (Hamming norm) and IVF_FLAT (L1 or L2 norms) matchers use
+                                                    default parameters and index set2 on each call.
             stream (nvcv.cuda.Stream, optional): CUDA Stream on which to perform the operation.
 
         Returns:
@@ -23,7 +23,10 @@ namespace cvcudapy {
 
 void ExportPairwiseMatcherType(py::module &m)
 {
-    py::enum_<NVCVPairwiseMatcherType>(m, "Matcher", py::arithmetic()).value("BRUTE_FORCE", NVCV_BRUTE_FORCE);
+    py::enum_<NVCVPairwiseMatcherType>(m, "Matcher", py::arithmetic())
+        .value("BRUTE_FORCE", NVCV_BRUTE_FORCE)
+        .value("LSH", NVCV_LSH)
+        .value("IVF_FLAT", NVCV_IVF_FLAT);
 }
 
 } // namespace cvcudapy
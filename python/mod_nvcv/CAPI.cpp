@@ -178,6 +178,38 @@ extern "C" void ImplStream_HoldResources(PyObject *stream, PyObject *resourceLis
     CATCH_RETURN_DEFAULT(, "Hold resources failed")
 }
 
+extern "C" void ImplStream_SubmitSyncResources(PyObject *stream, PyObject *const *resources, int32_t count)
+{
+    try
+    {
+        std::shared_ptr<Stream> pstream = ToSharedObj<Stream>(stream);
+
+        for (int32_t i = 0; i < count; ++i)
+        {
+            ToSharedObj<Resource>(resources[i])->submitSync(*pstream);
+        }
+    }
+    CATCH_RETURN_DEFAULT(, "Submit sync failed")
+}
+
+extern "C" void ImplStream_HoldResourceArray(PyObject *stream, PyObject *const *resources, const LockMode *lockModes,
+                                             int32_t count)
+{
+    try
+    {
+        LockResources resVector;
+        resVector.reserve(count);
+
+        for (int32_t i = 0; i < count; ++i)
+        {
+            resVector.emplace(lockModes[i], ToSharedObj<const Resource>(resources[i]));
+        }
+
+        ToSharedObj<Stream>(stream)->holdResources(std::move(resVector));
+    }
+    CATCH_RETURN_DEFAULT(, "Hold resources failed")
+}
+
 extern "C" PyObject *ImplStream_GetCurrent()
 {
     try
@@ -443,6 +475,8 @@ void ExportCAPI(py::module &m)
         .TensorBatch_PushBack            = &ImplTensorBatch_PushBack,
         .TensorBatch_PopBack             = &ImplTensorBatch_PopBack,
         .TensorBatch_Clear               = &ImplTensorBatch_Clear,
+        .Stream_SubmitSyncResources      = &ImplStream_SubmitSyncResources,
+        .Stream_HoldResourceArray        = &ImplStream_HoldResourceArray,
     };
 
     m.add_object("_C_API", py::capsule(&capi, "nvcv._C_API"));
@@ -23,8 +23,14 @@
 #include <common/Assert.hpp>
 #include <common/CheckError.hpp>
 #include <common/PyUtil.hpp>
+#include <pybind11/stl.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <limits>
+#include <list>
 #include <mutex>
 #include <numeric>
 #include <thread>
@@ -81,33 +87,259 @@ bool CacheItem::isInUse() const
     return sthis.use_count() > 2;
 }
 
-using Items = std::unordered_multimap<const IKey *, std::shared_ptr<CacheItem>, HashKey, KeyEqual>;
+// Number of independently locked shards the cached items are distributed into, by key hash.
+constexpr int kNumShards = 16;
+static_assert((kNumShards & (kNumShards - 1)) == 0, "Number of shards must be a power of two");
+
+// Maximum number of distinct cache item types with quota accounting.
+constexpr int kMaxItemTypes = 64;
+
+struct TypeQuota
+{
+    std::atomic<const std::type_info *> type{nullptr};
+    std::atomic<int64_t>                limit_inbytes{-1}; // -1: no quota
+    std::atomic<int64_t>                size_inbytes{0};
+};
+
+struct Entry
+{
+    Cache                     *owner;
+    std::shared_ptr<CacheItem> item;
+    TypeQuota                 *quota;
+    int64_t                    size_inbytes;
+    int64_t                    last_use; // steady clock ticks of the last fetch hit
+};
+
+// Cached items of a shard, least recently used first.
+using LruList = std::list<Entry>;
+
+// List iterators stay valid when entries are moved around the LRU list.
+using Items = std::unordered_multimap<const IKey *, LruList::iterator, HashKey, KeyEqual>;
+
+// Items removed while a mutex is locked must only be destroyed once it's unlocked,
+// see Cache::removeAllNotInUseMatching.
+using HeldItems = std::vector<std::shared_ptr<CacheItem>>;
+
+// Tail of a shard with no items
+constexpr int64_t kNoTail = std::numeric_limits<int64_t>::max();
+
+struct alignas(64) Shard
+{
+    std::mutex mtx;
+    LruList    lru;
+    CacheStats stats;
+
+    // Last use of the shard's least recently used item, read without locking to pick the shard to evict from.
+    std::atomic<int64_t> tail_use{kNoTail};
+
+    // Must be called with mtx locked whenever the front of lru may have changed.
+    void updateTail()
+    {
+        tail_use.store(lru.empty() ? kNoTail : lru.front().last_use, std::memory_order_relaxed);
+    }
+};
+
+static int64_t Now()
+{
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+static int ShardIndex(const IKey &key)
+{
+    size_t h = HashKey{}(&key);
+    return static_cast<int>((h ^ (h >> 16)) & (kNumShards - 1));
+}
 
 struct Cache::Impl
 {
-    Items                    items;
-    inline static std::mutex mtx;
-    inline static int64_t    cache_limit_inbytes;
-    inline static int64_t    current_size_inbytes;
+    // Items of this cache, shard i is protected by shards[i].mtx
+    std::array<Items, kNumShards> items;
+
+    inline static std::mutex                           instancesMtx;
+    inline static std::array<Shard, kNumShards>        shards;
+    inline static std::atomic<int64_t>                 cache_limit_inbytes;
+    inline static std::atomic<int64_t>                 current_size_inbytes;
+    inline static std::array<TypeQuota, kMaxItemTypes> quotas;
+    inline static std::atomic<int>                     numQuotas;
+    inline static std::mutex                           quotasMtx;
+
+    // Entries of a destroyed cache whose items can only be released with the GIL held.
+    LruList orphans;
+
+    static TypeQuota &QuotaOf(const std::type_info &type)
+    {
+        // Lock-free lookup, item types are only ever added.
+        int n = numQuotas.load(std::memory_order_acquire);
+        for (int i = 0; i < n; ++i)
+        {
+            if (*quotas[i].type.load(std::memory_order_relaxed) == type)
+            {
+                return quotas[i];
+            }
+        }
+
+        std::lock_guard<std::mutex> lk(quotasMtx);
+        n = numQuotas.load(std::memory_order_relaxed);
+        for (int i = 0; i < n; ++i)
+        {
+            if (*quotas[i].type.load(std::memory_order_relaxed) == type)
+            {
+                return quotas[i];
+            }
+        }
+        if (n == kMaxItemTypes)
+        {
+            throw std::length_error("Too many cache item types");
+        }
+        quotas[n].type.store(&type, std::memory_order_relaxed);
+        numQuotas.store(n + 1, std::memory_order_release);
+        return quotas[n];
+    }
+
+    // Atomically adds size to used unless it would go over limit (no limit if negative).
+    static bool TryReserve(std::atomic<int64_t> &used, int64_t size, int64_t limit)
+    {
+        int64_t cur = used.load(std::memory_order_relaxed);
+        do
+        {
+            if (limit >= 0 && cur + size > limit)
+            {
+                return false;
+            }
+        }
+        while (!used.compare_exchange_weak(cur, cur + size, std::memory_order_relaxed));
+        return true;
+    }
+
+    // Removes the entry from its owner cache and from the shard, must be called with the shard locked.
+    static void Erase(int shardIdx, LruList::iterator itEntry, HeldItems &held)
+    {
+        Items &ownerItems = itEntry->owner->pimpl->items[shardIdx];
+
+        auto itrange = ownerItems.equal_range(&itEntry->item->key());
+        for (auto it = itrange.first; it != itrange.second; ++it)
+        {
+            if (it->second == itEntry)
+            {
+                ownerItems.erase(it);
+                break;
+            }
+        }
+
+        current_size_inbytes -= itEntry->size_inbytes;
+        itEntry->quota->size_inbytes -= itEntry->size_inbytes;
+        held.push_back(std::move(itEntry->item));
+        shards[shardIdx].lru.erase(itEntry);
+        shards[shardIdx].updateTail();
+    }
+
+    static bool IsEvictable(const Entry &e, bool evictInUse, const TypeQuota *quota)
+    {
+        return (quota == nullptr || e.quota == quota) && (evictInUse || !e.item->isInUse());
+    }
+
+    // Evicts the least recently used evictable item, looking into the shards in the order of their LRU tails.
+    // Only one shard is locked at a time, usually the first one has an item to evict. The choice is approximate
+    // under concurrent use.
+    static bool EvictOne(bool evictInUse, const TypeQuota *quota, HeldItems &held)
+    {
+        std::array<std::pair<int64_t, int>, kNumShards> order;
+
+        int numShards = 0;
+        for (int s = 0; s < kNumShards; ++s)
+        {
+            int64_t tail = shards[s].tail_use.load(std::memory_order_relaxed);
+            if (tail != kNoTail)
+            {
+                order[numShards++] = {tail, s};
+            }
+        }
+        std::sort(order.begin(), order.begin() + numShards);
+
+        for (int i = 0; i < numShards; ++i)
+        {
+            int                         shardIdx = order[i].second;
+            Shard                      &shard    = shards[shardIdx];
+            std::lock_guard<std::mutex> lk(shard.mtx);
+
+            // Items in use are as good as just used. They're moved to the back as they're skipped,
+            // so that the next evictions don't walk over them again.
+            auto end = shard.lru.end();
+            for (auto it = shard.lru.begin(); it != end;)
+            {
+                if (IsEvictable(*it, evictInUse, quota))
+                {
+                    ++shard.stats.evictions;
+                    shard.stats.evicted_inbytes += it->size_inbytes;
+                    Erase(shardIdx, it, held);
+                    return true;
+                }
+
+                auto next = std::next(it);
+                if (!evictInUse && (quota == nullptr || it->quota == quota))
+                {
+                    if (end == shard.lru.end())
+                    {
+                        end = it;
+                    }
+                    it->last_use = Now();
+                    shard.lru.splice(shard.lru.end(), shard.lru, it);
+                    shard.updateTail();
+                }
+                it = next;
+            }
+        }
+        return false;
+    }
+
+    // Reserves size bytes in used, evicting least recently used items until it fits within limit.
+    // Items not in use go first, items still in use are only dropped from the cache
+    // (not destroyed) if there's no other way to make room.
+    static bool ReserveEvicting(std::atomic<int64_t> &used, int64_t size, const std::atomic<int64_t> &limit,
+                                const TypeQuota *quota, HeldItems &held)
+    {
+        for (bool evictInUse : {false, true})
+        {
+            do
+            {
+                if (TryReserve(used, size, limit.load(std::memory_order_relaxed)))
+                {
+                    return true;
+                }
+            }
+            while (EvictOne(evictInUse, quota, held));
+        }
+        return false;
+    }
 };
 
 Cache::Cache()
     : pimpl(new Impl())
 {
-    std::lock_guard<std::mutex> lk(pimpl->mtx);
+    std::lock_guard<std::mutex> lk(Impl::instancesMtx);
     instances.insert(this);
 }
 
 Cache::~Cache()
 {
     {
-        std::lock_guard<std::mutex> lk(pimpl->mtx);
+        std::lock_guard<std::mutex> lk(Impl::instancesMtx);
         instances.erase(this);
-        // It might not be safe to call destructors here, decrease the size manually
-        for (const auto &node : pimpl->items)
+    }
+
+    // It might not be safe to call destructors here, move the entries out of the shards
+    // and decrease the size manually
+    for (int s = 0; s < kNumShards; ++s)
+    {
+        std::lock_guard<std::mutex> lk(Impl::shards[s].mtx);
+        for (const auto &node : pimpl->items[s])
         {
-            pimpl->current_size_inbytes -= node.second->GetSizeInBytes();
+            Impl::current_size_inbytes -= node.second->size_inbytes;
+            node.second->quota->size_inbytes -= node.second->size_inbytes;
+            pimpl->orphans.splice(pimpl->orphans.end(), Impl::shards[s].lru, node.second);
         }
+        pimpl->items[s].clear();
+        Impl::shards[s].updateTail();
     }
 
     Impl *pimpl = this->pimpl.release();
@@ -133,24 +365,40 @@ Cache::~Cache()
 
 void Cache::add(CacheItem &item)
 {
-    Items savedItems;
-    {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
-        if (item.GetSizeInBytes() > doGetCacheLimit())
-        {
-            return;
-        }
+    // Destroyed after all locks are released.
+    HeldItems holdItemsUntilMtxUnlocked;
 
-        if (item.GetSizeInBytes() + doGetCurrentSizeInBytes() > doGetCacheLimit())
-        {
-            // we clear the cache: all pimpl->items will be dtor'ed at the end of scope of savedItems and cache size will be reset to 0
-            savedItems                  = std::move(pimpl->items);
-            pimpl->current_size_inbytes = 0;
-        }
+    int64_t size = item.GetSizeInBytes();
+    if (size > doGetCacheLimit())
+    {
+        return;
+    }
 
-        pimpl->items.emplace(&item.key(), item.shared_from_this());
-        pimpl->current_size_inbytes += item.GetSizeInBytes();
+    // Make room among the items of the same type first, their memory is the most likely to be re-used.
+    TypeQuota &quota      = Impl::QuotaOf(typeid(item));
+    int64_t    quotaLimit = quota.limit_inbytes;
+    if (quotaLimit >= 0 && size > quotaLimit)
+    {
+        return;
     }
+    if (!Impl::ReserveEvicting(quota.size_inbytes, size, quota.limit_inbytes, &quota, holdItemsUntilMtxUnlocked))
+    {
+        return;
+    }
+    if (!Impl::ReserveEvicting(Impl::current_size_inbytes, size, Impl::cache_limit_inbytes, nullptr,
+                               holdItemsUntilMtxUnlocked))
+    {
+        quota.size_inbytes -= size;
+        return;
+    }
+
+    int    shardIdx = ShardIndex(item.key());
+    Shard &shard    = Impl::shards[shardIdx];
+
+    std::lock_guard<std::mutex> lk(shard.mtx);
+    auto itEntry = shard.lru.insert(shard.lru.end(), Entry{this, item.shared_from_this(), &quota, size, Now()});
+    pimpl->items[shardIdx].emplace(&item.key(), itEntry);
+    shard.updateTail();
 }
 
 void Cache::removeAllNotInUseMatching(const IKey &key)
@@ -165,27 +413,23 @@ void Cache::removeAllNotInUseMatching(const IKey &key)
     // refcount will be decremented, and any object destruction will happen
     // after the mutex is unlocked. Recursion can happen in this case, but won't
     // lead to deadlocks
-    std::vector<std::shared_ptr<CacheItem>> holdItemsUntilMtxUnlocked;
+    HeldItems holdItemsUntilMtxUnlocked;
 
     {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
+        int                          shardIdx = ShardIndex(key);
+        std::unique_lock<std::mutex> lk(Impl::shards[shardIdx].mtx);
 
-        auto itrange = pimpl->items.equal_range(&key);
+        auto itrange = pimpl->items[shardIdx].equal_range(&key);
 
         int numItems = std::distance(itrange.first, itrange.second);
 
         auto it = itrange.first;
         for (int i = 0; i < numItems; ++i)
         {
-            if (!it->second->isInUse())
-            {
-                holdItemsUntilMtxUnlocked.push_back(it->second);
-                pimpl->current_size_inbytes -= it->second->GetSizeInBytes();
-                pimpl->items.erase(it++);
-            }
-            else
+            auto cur = it++;
+            if (!cur->second->item->isInUse())
             {
-                ++it;
+                Impl::Erase(shardIdx, cur->second, holdItemsUntilMtxUnlocked);
             }
         }
     }
@@ -195,19 +439,27 @@ std::vector<std::shared_ptr<CacheItem>> Cache::fetch(const IKey &key) const
 {
     std::vector<std::shared_ptr<CacheItem>> v;
 
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
+    int                          shardIdx = ShardIndex(key);
+    Shard                       &shard    = Impl::shards[shardIdx];
+    std::unique_lock<std::mutex> lk(shard.mtx);
 
-    auto itrange = pimpl->items.equal_range(&key);
+    auto itrange = pimpl->items[shardIdx].equal_range(&key);
 
     v.reserve(distance(itrange.first, itrange.second));
 
     for (auto it = itrange.first; it != itrange.second; ++it)
     {
-        if (!it->second->isInUse())
+        if (!it->second->item->isInUse())
         {
-            v.emplace_back(it->second);
+            v.emplace_back(it->second->item);
+            // Mark as most recently used
+            it->second->last_use = Now();
+            shard.lru.splice(shard.lru.end(), shard.lru, it->second);
         }
     }
+    shard.updateTail();
+
+    ++(v.empty() ? shard.stats.misses : shard.stats.hits);
 
     return v;
 }
@@ -215,42 +467,64 @@ std::vector<std::shared_ptr<CacheItem>> Cache::fetch(const IKey &key) const
 #ifndef NDEBUG
 void Cache::dbgPrintCacheForKey(const IKey &key, const std::string &prefix)
 {
-    std::vector<std::shared_ptr<CacheItem>> v;
-    std::unique_lock<std::mutex>            lk(pimpl->mtx);
-    auto                                    itrange = pimpl->items.equal_range(&key);
+    int                          shardIdx = ShardIndex(key);
+    std::unique_lock<std::mutex> lk(Impl::shards[shardIdx].mtx);
+    auto                         itrange = pimpl->items[shardIdx].equal_range(&key);
 
     for (auto it = itrange.first; it != itrange.second; ++it)
     {
-        std::cerr << prefix << typeid(*(it->second)).name() << " - " << it->second.use_count() << std::endl;
+        std::cerr << prefix << typeid(*(it->second->item)).name() << " - " << it->second->item.use_count()
+                  << std::endl;
     }
 }
 #endif
 
 std::shared_ptr<CacheItem> Cache::fetchOne(const IKey &key) const
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
+    int                          shardIdx = ShardIndex(key);
+    Shard                       &shard    = Impl::shards[shardIdx];
+    std::unique_lock<std::mutex> lk(shard.mtx);
 
-    auto itrange = pimpl->items.equal_range(&key);
+    auto itrange = pimpl->items[shardIdx].equal_range(&key);
 
     for (auto it = itrange.first; it != itrange.second; ++it)
     {
-        if (!it->second->isInUse())
+        if (!it->second->item->isInUse())
         {
-            return it->second;
+            ++shard.stats.hits;
+            it->second->last_use = Now();
+            shard.lru.splice(shard.lru.end(), shard.lru, it->second);
+            shard.updateTail();
+            return it->second->item;
         }
     }
 
+    ++shard.stats.misses;
     return {};
 }
 
 void Cache::clear()
 {
-    pimpl->items.clear();
+    HeldItems holdItemsUntilMtxUnlocked;
+    for (int s = 0; s < kNumShards; ++s)
+    {
+        std::unique_lock<std::mutex> lk(Impl::shards[s].mtx);
+        while (!pimpl->items[s].empty())
+        {
+            Impl::Erase(s, pimpl->items[s].begin()->second, holdItemsUntilMtxUnlocked);
+        }
+    }
 }
 
 size_t Cache::size() const
 {
-    return pimpl->items.size();
+    size_t count = 0;
+    for (int s = 0; s < kNumShards; ++s)
+    {
+        std::unique_lock<std::mutex> lk(Impl::shards[s].mtx);
+        count += pimpl->items[s].size();
+    }
+    return count;
 }
 
 void Cache::setCacheLimit(int64_t new_cache_limit_inbytes)
@@ -271,60 +545,86 @@ void Cache::setCacheLimit(int64_t new_cache_limit_inbytes)
                   << " is more than total available memory on current device: " << total_mem << std::endl;
     }
 
-    Items savedItems;
+    HeldItems holdItemsUntilMtxUnlocked;
+    Impl::cache_limit_inbytes = new_cache_limit_inbytes;
+    for (bool evictInUse : {false, true})
     {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
-        if (doGetCurrentSizeInBytes() > new_cache_limit_inbytes)
+        while (doGetCurrentSizeInBytes() > new_cache_limit_inbytes
+               && Impl::EvictOne(evictInUse, nullptr, holdItemsUntilMtxUnlocked))
         {
-            // we clear the cache: all pimpl->items will be dtor'ed at the end of scope of savedItems and cache size will be reset to 0
-            savedItems                  = std::move(pimpl->items);
-            pimpl->current_size_inbytes = 0;
         }
-        pimpl->cache_limit_inbytes = new_cache_limit_inbytes;
     }
 }
 
 int64_t Cache::getCacheLimit() const
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
     return doGetCacheLimit();
 }
 
 int64_t Cache::doGetCacheLimit() const
 {
-    return pimpl->cache_limit_inbytes;
+    return Impl::cache_limit_inbytes;
 }
 
 int64_t Cache::getCurrentSizeInBytes()
 {
-    std::unique_lock<std::mutex> lk(pimpl->mtx);
     return doGetCurrentSizeInBytes();
 }
 
 int64_t Cache::doGetCurrentSizeInBytes() const
 {
-    return pimpl->current_size_inbytes;
+    return Impl::current_size_inbytes;
 }
 
-void Cache::doIterateThroughItems(const std::function<void(CacheItem &item)> &fn) const
+void Cache::setCacheQuota(const std::type_info &itemType, std::optional<int64_t> quota_inbytes)
 {
-    // To avoid keeping mutex locked for too long, let's first gather all items
-    // into a vector, unlock the mutex, and then iterate through them.
-    std::vector<std::shared_ptr<CacheItem>> v;
-
+    if (quota_inbytes && *quota_inbytes < 0)
     {
-        std::unique_lock<std::mutex> lk(pimpl->mtx);
-        v.reserve(pimpl->items.size());
+        throw std::invalid_argument("Cache quota must be non-negative.");
+    }
+
+    HeldItems  holdItemsUntilMtxUnlocked;
+    TypeQuota &quota = Impl::QuotaOf(itemType);
 
-        for (auto it = pimpl->items.begin(); it != pimpl->items.end(); ++it)
+    quota.limit_inbytes = quota_inbytes.value_or(-1);
+    for (bool evictInUse : {false, true})
+    {
+        while (quota_inbytes && quota.size_inbytes > *quota_inbytes
+               && Impl::EvictOne(evictInUse, &quota, holdItemsUntilMtxUnlocked))
         {
-            v.push_back(it->second);
         }
     }
+}
 
-    for (const std::shared_ptr<CacheItem> &item : v)
+std::optional<int64_t> Cache::getCacheQuota(const std::type_info &itemType) const
+{
+    int64_t limit = Impl::QuotaOf(itemType).limit_inbytes;
+    return limit >= 0 ? std::optional<int64_t>(limit) : std::nullopt;
+}
+
+void Cache::doIterateThroughItems(const std::function<void(CacheItem &item)> &fn) const
+{
+    // To avoid keeping mutexes locked for too long, let's gather the items of
+    // one shard at a time, unlock its mutex, and then iterate through them.
+    std::vector<std::shared_ptr<CacheItem>> v;
+
+    for (int s = 0; s < kNumShards; ++s)
     {
-        fn(*item);
+        v.clear();
+        {
+            std::unique_lock<std::mutex> lk(Impl::shards[s].mtx);
+            v.reserve(pimpl->items[s].size());
+
+            for (auto it = pimpl->items[s].begin(); it != pimpl->items[s].end(); ++it)
+            {
+                v.push_back(it->second->item);
+            }
+        }
+
+        for (const std::shared_ptr<CacheItem> &item : v)
+        {
+            fn(*item);
+        }
     }
 }
 
@@ -336,22 +636,77 @@ Cache &Cache::Instance()
 
 void Cache::ClearAll()
 {
-    Items savedItems;
+    LruList savedItems;
     {
-        std::lock_guard<std::mutex> lk(Cache::Impl::mtx);
-        std::for_each(instances.begin(), instances.end(),
-                      [&](Cache *instance) { savedItems.merge(instance->pimpl->items); });
-        Cache::Impl::current_size_inbytes = 0;
+        std::lock_guard<std::mutex> lkInstances(Cache::Impl::instancesMtx);
+        for (int s = 0; s < kNumShards; ++s)
+        {
+            Shard                      &shard = Cache::Impl::shards[s];
+            std::lock_guard<std::mutex> lk(shard.mtx);
+
+            for (Cache *instance : instances)
+            {
+                instance->pimpl->items[s].clear();
+            }
+            for (const Entry &e : shard.lru)
+            {
+                Cache::Impl::current_size_inbytes -= e.size_inbytes;
+                e.quota->size_inbytes -= e.size_inbytes;
+            }
+            savedItems.splice(savedItems.end(), shard.lru);
+            shard.updateTail();
+        }
     }
 }
 
 size_t Cache::TotalSize()
 {
-    std::lock_guard<std::mutex> lk(Cache::Impl::mtx);
-    return std::accumulate(instances.cbegin(), instances.cend(), static_cast<size_t>(0),
-                           [](size_t sum, const Cache *instance) { return sum + instance->size(); });
+    size_t count = 0;
+    for (Shard &shard : Cache::Impl::shards)
+    {
+        std::lock_guard<std::mutex> lk(shard.mtx);
+        count += shard.lru.size();
+    }
+    return count;
+}
+
+CacheStats Cache::Stats()
+{
+    CacheStats total;
+    for (Shard &shard : Cache::Impl::shards)
+    {
+        std::lock_guard<std::mutex> lk(shard.mtx);
+        total.hits += shard.stats.hits;
+        total.misses += shard.stats.misses;
+        total.evictions += shard.stats.evictions;
+        total.evicted_inbytes += shard.stats.evicted_inbytes;
+    }
+    return total;
+}
+
+void Cache::ResetStats()
+{
+    for (Shard &shard : Cache::Impl::shards)
+    {
+        std::lock_guard<std::mutex> lk(shard.mtx);
+        shard.stats = {};
+    }
+}
+
+namespace {
+
+const std::type_info &GetCacheItemType(const py::type &type)
+{
+    const py::detail::type_info *info = py::detail::get_type_info(reinterpret_cast<PyTypeObject *>(type.ptr()));
+    if (info == nullptr || info->cpptype == nullptr)
+    {
+        throw std::invalid_argument("Type must be an NVCV class, such as nvcv.Tensor or nvcv.Image");
+    }
+    return *info->cpptype;
 }
 
+} // namespace
+
 void Cache::Export(py::module &m)
 {
     using namespace pybind11::literals;
@@ -424,6 +779,49 @@ void Cache::Export(py::module &m)
         "current_cache_size_inbytes", [] { return Cache::Instance().getCurrentSizeInBytes(); },
         "Returns the current cache size [in bytes]");
 
+    m.def(
+        "set_cache_quota_inbytes",
+        [](py::type type, std::optional<int64_t> quota_inbytes)
+        { Cache::Instance().setCacheQuota(GetCacheItemType(type), quota_inbytes); },
+        "type"_a, "quota_inbytes"_a, R"pbdoc(
+        Limits the bytes the cache can hold for objects of the given type
+
+        When adding an object would exceed the quota, the least recently used objects of the same type
+        are evicted first.
+
+        Args:
+            type (type): Class of the cached objects, e.g. ``nvcv.Tensor``.
+            quota_inbytes (int, optional): Quota in bytes, ``None`` removes the quota.
+    )pbdoc");
+
+    m.def(
+        "get_cache_quota_inbytes",
+        [](py::type type) { return Cache::Instance().getCacheQuota(GetCacheItemType(type)); }, "type"_a,
+        "Returns the cache quota [in bytes] of objects of the given type, or None if there's no quota");
+
+    m.def(
+        "cache_stats",
+        []
+        {
+            CacheStats stats = Cache::Stats();
+
+            py::dict out;
+            out["hits"]            = stats.hits;
+            out["misses"]          = stats.misses;
+            out["evictions"]       = stats.evictions;
+            out["evicted_inbytes"] = stats.evicted_inbytes;
+            return out;
+        },
+        R"pbdoc(
+        Returns the NVCV Python cache statistics since start or the last call to ``nvcv.reset_cache_stats()``
+
+        Returns:
+            dict: ``hits`` and ``misses`` count cache lookups when creating objects, ``evictions`` and
+            ``evicted_inbytes`` count objects removed to stay within the cache limit and quotas.
+    )pbdoc");
+
+    m.def("reset_cache_stats", &Cache::ResetStats, "Resets the NVCV Python cache statistics");
+
     py::module_ internal = m.attr(INTERNAL_SUBMODULE_NAME);
     internal.def("nbytes_in_cache", [](const CacheItem &item) { return item.GetSizeInBytes(); });
 
@@ -25,6 +25,8 @@
 #include <nvcv/python/Cache.hpp>
 #include <pybind11/pybind11.h>
 
+#include <optional>
+#include <typeinfo>
 #include <unordered_set>
 #include <vector>
 
@@ -88,14 +90,24 @@ private:
     int64_t m_size_inbytes = -1;
 };
 
+struct CacheStats
+{
+    int64_t hits            = 0; // fetches that found at least one item not in use
+    int64_t misses          = 0;
+    int64_t evictions       = 0;
+    int64_t evicted_inbytes = 0;
+};
+
 class PYBIND11_EXPORT Cache
 {
 public:
     static void Export(py::module &m);
 
-    static Cache &Instance();
-    static void   ClearAll();
-    static size_t TotalSize();
+    static Cache     &Instance();
+    static void       ClearAll();
+    static size_t     TotalSize();
+    static CacheStats Stats();
+    static void       ResetStats();
 
     void add(CacheItem &container);
     void removeAllNotInUseMatching(const IKey &key);
@@ -131,6 +143,10 @@ public:
     int64_t getCacheLimit() const;
     int64_t getCurrentSizeInBytes();
 
+    // Limits the bytes taken by items of the given dynamic type, std::nullopt removes the quota.
+    void                   setCacheQuota(const std::type_info &itemType, std::optional<int64_t> quota_inbytes);
+    std::optional<int64_t> getCacheQuota(const std::type_info &itemType) const;
+
 private:
     inline static std::unordered_set<Cache *> instances;
 
@@ -111,6 +111,16 @@ DLPackTensor::DLPackTensor(const nvcv::TensorDataStrided &tensorData)
             // TODO: detect correct device_id from memory buffer (if possible)
             tensor.device.device_id = 0;
         }
+        else if (tensorData.IsCompatible<nvcv::TensorDataStridedHostPinned>())
+        {
+            tensor.device.device_type = kDLCUDAHost;
+            tensor.device.device_id   = 0;
+        }
+        else if (tensorData.IsCompatible<nvcv::TensorDataStridedHost>())
+        {
+            tensor.device.device_type = kDLCPU;
+            tensor.device.device_id   = 0;
+        }
         else
         {
             throw std::runtime_error("Tensor buffer type not supported, must be either CUDA or Host (CPU)");
@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EventPool.hpp"
+
+#include <common/CheckError.hpp>
+#include <common/PyUtil.hpp>
+
+namespace nvcvpy::priv {
+
+EventPool &EventPool::Instance()
+{
+    static EventPool pool;
+    return pool;
+}
+
+EventPool::~EventPool()
+{
+    // The CUDA runtime might be already unloaded, errors are expected here
+    for (cudaEvent_t event : m_events)
+    {
+        cudaEventDestroy(event);
+    }
+}
+
+cudaEvent_t EventPool::acquire()
+{
+    {
+        std::lock_guard lk(m_mtx);
+        if (!m_events.empty())
+        {
+            cudaEvent_t event = m_events.back();
+            m_events.pop_back();
+            ++m_stats.hits;
+            return event;
+        }
+        ++m_stats.misses;
+    }
+
+    cudaEvent_t event;
+    util::CheckThrow(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    return event;
+}
+
+void EventPool::release(cudaEvent_t event) noexcept
+{
+    if (event == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard lk(m_mtx);
+        if (m_events.size() < m_limit)
+        {
+            try
+            {
+                m_events.push_back(event);
+                return;
+            }
+            catch (...)
+            {
+                // out of memory, just destroy it
+            }
+        }
+        ++m_stats.discards;
+    }
+
+    util::CheckLog(cudaEventDestroy(event));
+}
+
+void EventPool::setLimit(size_t limit)
+{
+    std::vector<cudaEvent_t> exceeding;
+    {
+        std::lock_guard lk(m_mtx);
+        m_limit = limit;
+        if (m_events.size() > limit)
+        {
+            exceeding.assign(m_events.begin() + limit, m_events.end());
+            m_events.resize(limit);
+        }
+    }
+
+    for (cudaEvent_t event : exceeding)
+    {
+        util::CheckLog(cudaEventDestroy(event));
+    }
+}
+
+size_t EventPool::getLimit() const
+{
+    std::lock_guard lk(m_mtx);
+    return m_limit;
+}
+
+size_t EventPool::size() const
+{
+    std::lock_guard lk(m_mtx);
+    return m_events.size();
+}
+
+void EventPool::clear()
+{
+    std::vector<cudaEvent_t> events;
+    {
+        std::lock_guard lk(m_mtx);
+        events.swap(m_events);
+    }
+
+    for (cudaEvent_t event : events)
+    {
+        util::CheckLog(cudaEventDestroy(event));
+    }
+}
+
+EventPoolStats EventPool::stats() const
+{
+    std::lock_guard lk(m_mtx);
+    return m_stats;
+}
+
+void EventPool::resetStats()
+{
+    std::lock_guard lk(m_mtx);
+    m_stats = {};
+}
+
+void EventPool::Export(py::module &m)
+{
+    using namespace pybind11::literals;
+
+    // Destroy the idle events while the CUDA runtime is still around
+    util::RegisterCleanup(m, [] { EventPool::Instance().clear(); });
+
+    m.def(
+        "event_pool_size", [] { return EventPool::Instance().size(); },
+        "Returns the number of idle CUDA events in the pool shared by NVCV Python objects");
+
+    m.def(
+        "get_event_pool_limit", [] { return EventPool::Instance().getLimit(); },
+        "Returns the maximum number of idle CUDA events kept in the pool");
+    m.def(
+        "set_event_pool_limit", [](size_t limit) { EventPool::Instance().setLimit(limit); }, "limit"_a, R"pbdoc(
+        Sets the maximum number of idle CUDA events kept in the pool
+
+        Tensors, images, batches and streams take the CUDA events they use for synchronization from a shared pool
+        and return them when destroyed. Events returned while the pool is full are destroyed, as are the idle ones
+        exceeding a new limit.
+
+        Args:
+            limit (int): Maximum number of idle events, 0 disables pooling.
+    )pbdoc");
+
+    m.def("clear_event_pool", [] { EventPool::Instance().clear(); }, "Destroys all idle CUDA events in the pool");
+
+    m.def(
+        "event_pool_stats",
+        []
+        {
+            EventPoolStats stats = EventPool::Instance().stats();
+
+            py::dict out;
+            out["hits"]     = stats.hits;
+            out["misses"]   = stats.misses;
+            out["discards"] = stats.discards;
+            return out;
+        },
+        R"pbdoc(
+        Returns the CUDA event pool statistics since start or the last call to ``nvcv.cuda.reset_event_pool_stats()``
+
+        Returns:
+            dict: ``hits`` counts events reused from the pool, ``misses`` events created because it was empty and
+            ``discards`` events destroyed because it was full.
+    )pbdoc");
+
+    m.def(
+        "reset_event_pool_stats", [] { EventPool::Instance().resetStats(); },
+        "Resets the CUDA event pool statistics");
+}
+
+} // namespace nvcvpy::priv
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PYTHON_PRIV_EVENTPOOL_HPP
+#define NVCV_PYTHON_PRIV_EVENTPOOL_HPP
+
+#include <cuda_runtime.h>
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace nvcvpy::priv {
+namespace py = pybind11;
+
+struct EventPoolStats
+{
+    int64_t hits     = 0; // events acquired from the pool
+    int64_t misses   = 0; // events created because the pool was empty
+    int64_t discards = 0; // events destroyed on release because the pool was full
+};
+
+/**
+ * @brief Pool of CUDA events shared by all Python resources and streams.
+ *
+ * Python code creates and drops many short-lived objects, the events they use
+ * for stream synchronization are recycled here instead of being created and
+ * destroyed with them. Events are created with cudaEventDisableTiming.
+ *
+ * Released events can be acquired again right away, even if work waiting on
+ * them is still pending: cudaStreamWaitEvent uses the state of the event when
+ * it's called, later records don't affect it.
+ */
+class PYBIND11_EXPORT EventPool
+{
+public:
+    static void Export(py::module &m);
+
+    static EventPool &Instance();
+
+    ~EventPool();
+
+    /**
+     * @brief Returns an event from the pool, or a new one if the pool is empty.
+     */
+    cudaEvent_t acquire();
+
+    /**
+     * @brief Returns the event to the pool, it's destroyed if the pool is full.
+     *
+     * @param event The event to release, it can be null.
+     */
+    void release(cudaEvent_t event) noexcept;
+
+    /**
+     * @brief Sets the maximum number of idle events kept in the pool, exceeding ones are destroyed.
+     */
+    void   setLimit(size_t limit);
+    size_t getLimit() const;
+
+    // Number of idle events in the pool
+    size_t size() const;
+
+    // Destroys all idle events
+    void clear();
+
+    EventPoolStats stats() const;
+    void           resetStats();
+
+private:
+    EventPool() = default;
+
+    mutable std::mutex       m_mtx;
+    std::vector<cudaEvent_t> m_events;
+    size_t                   m_limit = 1024;
+    EventPoolStats           m_stats;
+};
+
+} // namespace nvcvpy::priv
+
+#endif // NVCV_PYTHON_PRIV_EVENTPOOL_HPP
@@ -21,6 +21,7 @@
 #include "Container.hpp"
 #include "DataType.hpp"
 #include "Definitions.hpp"
+#include "EventPool.hpp"
 #include "ExternalBuffer.hpp"
 #include "Image.hpp"
 #include "ImageBatch.hpp"
@@ -92,5 +93,6 @@ PYBIND11_MODULE(nvcv, m)
         cuda.def_submodule(INTERNAL_SUBMODULE_NAME);
 
         Stream::Export(cuda);
+        EventPool::Export(cuda);
     }
 }
@@ -17,6 +17,7 @@
 
 #include "Resource.hpp"
 
+#include "EventPool.hpp"
 #include "Stream.hpp"
 
 #include <common/Assert.hpp>
@@ -35,7 +36,7 @@ Resource::Resource()
 
 Resource::~Resource()
 {
-    cudaEventDestroy(m_event);
+    EventPool::Instance().release(m_event);
 }
 
 uint64_t Resource::id() const
@@ -47,7 +48,7 @@ cudaEvent_t Resource::event()
 {
     if (m_event == nullptr)
     {
-        util::CheckThrow(cudaEventCreateWithFlags(&m_event, cudaEventDisableTiming));
+        m_event = EventPool::Instance().acquire();
     }
     return m_event;
 }
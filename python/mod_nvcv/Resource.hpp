@@ -90,7 +90,7 @@ protected:
 
 private:
     uint64_t                                     m_id;         /**< The unique identifier of the resource. */
-    cudaEvent_t                                  m_event;      /**< The CUDA event used for synchronization. */
+    cudaEvent_t                                  m_event;      /**< The CUDA event used for synchronization, from the EventPool. */
     std::optional<std::shared_ptr<const Stream>> m_lastStream; /**< Cache the last stream used for this resource. */
     std::mutex                                   m_mtx;        /**< Lock reads and writes to the resource.  */
 
@@ -19,6 +19,7 @@
 
 #include "Cache.hpp"
 #include "Definitions.hpp"
+#include "EventPool.hpp"
 #include "StreamStack.hpp"
 
 #include <common/Assert.hpp>
@@ -35,6 +36,10 @@ std::atomic<int> Stream::m_instanceCount = 0;
 std::mutex       Stream::m_auxStreamMutex;
 std::mutex       Stream::m_gcMutex;
 
+// Release mode of all streams
+static std::atomic<ReleaseMode> g_releaseMode = ReleaseMode::CALLBACK;
+static std::atomic<int>         g_epochLength = 16;
+
 // Here we define the representation of external cuda streams.
 // It defines pybind11's type casters from the python object
 // to the corresponding ExternalStream<E>.
@@ -206,7 +211,7 @@ Stream::Stream()
         util::CheckThrow(cudaStreamCreateWithFlags(&m_handle, cudaStreamNonBlocking));
         incrementInstanceCount();
         GetAuxStream();
-        util::CheckThrow(cudaEventCreateWithFlags(&m_event, cudaEventDisableTiming));
+        m_event = EventPool::Instance().acquire();
     }
     catch (...)
     {
@@ -230,7 +235,7 @@ Stream::Stream(IExternalStream &extStream)
     {
         incrementInstanceCount();
         GetAuxStream(); // Make sure the singleton aux stream is created
-        util::CheckThrow(cudaEventCreateWithFlags(&m_event, cudaEventDisableTiming));
+        m_event = EventPool::Instance().acquire();
     }
     catch (...)
     {
@@ -239,6 +244,21 @@ Stream::Stream(IExternalStream &extStream)
     }
 }
 
+void Stream::SetReleaseMode(ReleaseMode mode, int epochLength)
+{
+    if (epochLength < 1)
+    {
+        throw std::invalid_argument("Epoch length must be at least 1");
+    }
+    g_epochLength.store(epochLength, std::memory_order_relaxed);
+    g_releaseMode.store(mode, std::memory_order_relaxed);
+}
+
+ReleaseMode Stream::GetReleaseMode()
+{
+    return g_releaseMode.load(std::memory_order_relaxed);
+}
+
 void Stream::incrementInstanceCount()
 {
     m_instanceCount.fetch_add(1, std::memory_order_relaxed);
@@ -275,6 +295,29 @@ Stream::~Stream()
 
 void Stream::destroy()
 {
+    {
+        // Resources still held by epochs must outlive the work using them
+        std::lock_guard lk(m_epochMutex);
+        try
+        {
+            closeEpoch();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: failed to record the last epoch of a stream: " << e.what() << std::endl;
+        }
+        if (!m_epochs.empty())
+        {
+            util::CheckLog(cudaEventSynchronize(m_epochs.back().event));
+        }
+        for (Epoch &epoch : m_epochs)
+        {
+            EventPool::Instance().release(epoch.event);
+        }
+        m_epochs.clear();
+        m_openEpoch.clear();
+    }
+
     if (m_owns)
     {
         if (m_handle)
@@ -293,11 +336,8 @@ void Stream::destroy()
             m_auxStream = nullptr;
         }
     }
-    if (m_event)
-    {
-        util::CheckThrow(cudaEventDestroy(m_event));
-        m_event = nullptr;
-    }
+    EventPool::Instance().release(m_event);
+    m_event = nullptr;
 }
 
 int64_t Stream::doComputeSizeInBytes()
@@ -336,8 +376,15 @@ intptr_t Stream::pyhandle() const
 
 void Stream::sync()
 {
-    py::gil_scoped_release release;
-    util::CheckThrow(cudaStreamSynchronize(m_handle));
+    {
+        std::lock_guard lk(m_epochMutex);
+        closeEpoch();
+    }
+    {
+        py::gil_scoped_release release;
+        util::CheckThrow(cudaStreamSynchronize(m_handle));
+    }
+    releaseEpochs();
 }
 
 Stream &Stream::Current()
@@ -370,6 +417,107 @@ struct Stream::HostFunctionClosure
 
 void Stream::holdResources(LockResources usedResources)
 {
+    if (g_releaseMode.load(std::memory_order_relaxed) == ReleaseMode::EPOCH)
+    {
+        holdResourcesEpoch(std::move(usedResources));
+    }
+    else
+    {
+        holdResourcesCallback(std::move(usedResources));
+    }
+}
+
+// Instead of a host callback per call, the resources of consecutive calls are appended to the open epoch.
+// Every epochLength calls the epoch is closed by recording an event, pooled by the stream, after the work
+// submitted so far. Closed epochs complete in order, so releasing them only has to query the oldest events.
+// This happens lazily in the next calls, in the calling thread, which makes the GC bag unnecessary.
+void Stream::holdResourcesEpoch(LockResources usedResources)
+{
+    // Closures from a previous callback mode may still be waiting
+    ClearGCBag();
+
+    releaseEpochs();
+
+    if (!usedResources.empty())
+    {
+        std::lock_guard lk(m_epochMutex);
+
+        for (auto &[lockMode, resource] : usedResources)
+        {
+            m_openEpoch.push_back(std::move(resource));
+        }
+        if (++m_openEpochCalls >= g_epochLength.load(std::memory_order_relaxed))
+        {
+            closeEpoch();
+        }
+    }
+}
+
+void Stream::closeEpoch()
+{
+    if (m_openEpoch.empty())
+    {
+        return;
+    }
+
+    cudaEvent_t event = EventPool::Instance().acquire();
+
+    if (cudaError_t err = cudaEventRecord(event, m_handle); err != cudaSuccess)
+    {
+        EventPool::Instance().release(event);
+        util::CheckThrow(err);
+    }
+
+    m_epochs.push_back(Epoch{event, std::move(m_openEpoch)});
+    m_openEpoch.clear();
+    m_openEpochCalls = 0;
+}
+
+void Stream::releaseEpochs()
+{
+    // Destroyed after the mutex is unlocked
+    std::vector<std::vector<std::shared_ptr<const Resource>>> released;
+
+    std::lock_guard lk(m_epochMutex);
+
+    // Left open when switching back to callback mode
+    if (g_releaseMode.load(std::memory_order_relaxed) != ReleaseMode::EPOCH)
+    {
+        closeEpoch();
+    }
+
+    while (!m_epochs.empty())
+    {
+        cudaError_t err = cudaEventQuery(m_epochs.front().event);
+        if (err == cudaErrorNotReady)
+        {
+            break;
+        }
+        util::CheckThrow(err);
+
+        released.push_back(std::move(m_epochs.front().resources));
+        EventPool::Instance().release(m_epochs.front().event);
+        m_epochs.pop_front();
+    }
+}
+
+size_t Stream::numHeldResources() const
+{
+    std::lock_guard lk(m_epochMutex);
+
+    size_t count = m_openEpoch.size();
+    for (const Epoch &epoch : m_epochs)
+    {
+        count += epoch.resources.size();
+    }
+    return count;
+}
+
+void Stream::holdResourcesCallback(LockResources usedResources)
+{
+    // Epochs from a previous epoch mode are released as they complete
+    releaseEpochs();
+
     if (!usedResources.empty())
     {
         // Looks like a good place to clear the gc bag, as every time we create
@@ -506,6 +654,28 @@ void Stream::Export(py::module &m)
 
     py::module_ internal = m.attr(INTERNAL_SUBMODULE_NAME);
     internal.def("syncAuxStream", &SyncAuxStream);
+    internal.def("num_held_resources", &Stream::numHeldResources);
+
+    using namespace py::literals;
+
+    py::enum_<ReleaseMode>(m, "ReleaseMode")
+        .value("CALLBACK", ReleaseMode::CALLBACK, "A host callback per operator call releases its resources.")
+        .value("EPOCH", ReleaseMode::EPOCH, "Operator calls are grouped in epochs, released once they complete.");
+
+    m.def("set_release_mode", &Stream::SetReleaseMode, "mode"_a, "epoch_length"_a = 16, R"pbdoc(
+        Sets how streams keep the resources used by operators alive until the operators are done
+
+        In ``CALLBACK`` mode each operator call records an event and enqueues a host callback that releases
+        its resources. In ``EPOCH`` mode the resources of ``epoch_length`` consecutive calls on a stream are
+        released together, once one event recorded after them completes. Completed epochs are released by the
+        following calls on the same stream and by ``Stream.sync()``. This is cheaper per call, but resources
+        are held for up to ``epoch_length`` calls longer.
+
+        Args:
+            mode (nvcv.cuda.ReleaseMode): Release mode of all streams.
+            epoch_length (int): Number of operator calls per epoch, at least 1.
+    )pbdoc");
+    m.def("get_release_mode", &Stream::GetReleaseMode, "Returns the release mode of the streams");
 
     // Create the global stream object by wrapping cuda stream 0.
     // It'll be destroyed when python module is deinitialized.
@@ -25,6 +25,7 @@
 #include <nvcv/python/LockMode.hpp>
 
 #include <atomic>
+#include <deque>
 #include <initializer_list>
 #include <memory>
 #include <mutex>
@@ -44,6 +45,13 @@ public:
 
 using LockResources = std::unordered_multimap<LockMode, std::shared_ptr<const Resource>>;
 
+// How streams keep the resources used by submitted work alive until the work is done
+enum class ReleaseMode
+{
+    CALLBACK, // each operator call enqueues a host callback that releases its resources
+    EPOCH     // operator calls are grouped in epochs, each released once its event completes
+};
+
 class PYBIND11_EXPORT Stream : public CacheItem
 {
 public:
@@ -53,6 +61,9 @@ public:
 
     static std::shared_ptr<Stream> Create();
 
+    static void        SetReleaseMode(ReleaseMode mode, int epochLength);
+    static ReleaseMode GetReleaseMode();
+
     virtual ~Stream();
 
     std::shared_ptr<Stream>       shared_from_this();
@@ -63,6 +74,9 @@ public:
 
     void holdResources(LockResources usedResources);
 
+    // Number of resources held by epochs not released yet
+    size_t numHeldResources() const;
+
     int64_t GetSizeInBytes() const override;
 
     void         sync();
@@ -98,12 +112,33 @@ private:
 
     void destroy();
 
+    void holdResourcesCallback(LockResources usedResources);
+    void holdResourcesEpoch(LockResources usedResources);
+
+    // Records the event of the open epoch, must be called with m_epochMutex locked
+    void closeEpoch();
+
+    // Releases the resources of the epochs whose work is done
+    void releaseEpochs();
+
     bool         m_owns   = false;
     cudaStream_t m_handle = nullptr;
     cudaEvent_t  m_event  = nullptr;
     py::object   m_wrappedObj;
     int64_t      m_size_inbytes = -1;
 
+    // Epoch release mode state, epochs are ordered as they were submitted to the stream
+    struct Epoch
+    {
+        cudaEvent_t                                  event;
+        std::vector<std::shared_ptr<const Resource>> resources;
+    };
+
+    mutable std::mutex                           m_epochMutex;
+    std::deque<Epoch>                            m_epochs;
+    std::vector<std::shared_ptr<const Resource>> m_openEpoch;
+    int                                          m_openEpochCalls = 0;
+
     // TODO: these don't have to be static members, but simply defined
     // as local entities in Stream.cpp, thereby minimizing code coupling and
     // unnecessary rebuilds.
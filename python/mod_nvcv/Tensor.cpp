@@ -88,8 +88,7 @@ std::shared_ptr<Tensor> Tensor::CreateFromReqs(const nvcv::Tensor::Requirements
 
 namespace {
 
-NVCVTensorData FillNVCVTensorData(const DLTensor &tensor, std::optional<nvcv::TensorLayout> layout,
-                                  NVCVTensorBufferType bufType)
+NVCVTensorData FillNVCVTensorData(const DLTensor &tensor, std::optional<nvcv::TensorLayout> layout)
 {
     NVCVTensorData tensorData = {};
 
@@ -122,9 +121,13 @@ NVCVTensorData FillNVCVTensorData(const DLTensor &tensor, std::optional<nvcv::Te
     {
         tensorData.bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
     }
+    else if (tensor.device.device_type == kDLCPU)
+    {
+        tensorData.bufferType = NVCV_TENSOR_BUFFER_STRIDED_HOST;
+    }
     else
     {
-        throw std::runtime_error("Only CUDA-accessible tensors are supported for now");
+        throw std::runtime_error("Only CUDA-accessible or host tensors are supported for now");
     }
 
     NVCVTensorBufferStrided &dataStrided = tensorData.buffer.strided;
@@ -142,18 +145,13 @@ NVCVTensorData FillNVCVTensorData(const DLTensor &tensor, std::optional<nvcv::Te
     return tensorData;
 }
 
-NVCVTensorData FillNVCVTensorDataCUDA(const DLTensor &tensor, std::optional<nvcv::TensorLayout> layout)
-{
-    return FillNVCVTensorData(tensor, std::move(layout), NVCV_TENSOR_BUFFER_STRIDED_CUDA);
-}
-
 } // namespace
 
 std::shared_ptr<Tensor> Tensor::Wrap(ExternalBuffer &buffer, std::optional<nvcv::TensorLayout> layout)
 {
     const DLTensor &dlTensor = buffer.dlTensor();
 
-    nvcv::TensorDataStridedCuda data{FillNVCVTensorDataCUDA(dlTensor, std::move(layout))};
+    nvcv::TensorDataStridedCuda data{FillNVCVTensorData(dlTensor, std::move(layout))};
 
     // This is the key of a tensor wrapper.
     // All tensor wrappers have the same key.
@@ -171,6 +169,22 @@ std::shared_ptr<Tensor> Tensor::Wrap(ExternalBuffer &buffer, std::optional<nvcv:
     return tensor;
 }
 
+std::shared_ptr<Tensor> Tensor::WrapHost(py::array array, std::optional<nvcv::TensorLayout> layout)
+{
+    // The array isn't copied, the tensor refers to its memory directly
+    DLPackTensor dlTensor(array.request(), DLDevice{kDLCPU, 0});
+
+    nvcv::TensorDataStridedHost data{FillNVCVTensorData(*dlTensor, std::move(layout))};
+
+    Tensor::Key key;
+    Cache::Instance().removeAllNotInUseMatching(key);
+
+    auto tensor = std::shared_ptr<Tensor>(new Tensor(data, std::move(array)));
+
+    Cache::Instance().add(*tensor);
+    return tensor;
+}
+
 std::shared_ptr<Tensor> Tensor::WrapImage(Image &img)
 {
     Tensor::Key key;
@@ -236,8 +250,13 @@ Tensor::Tensor(nvcv::Tensor &&tensor)
 
 int64_t Tensor::doComputeSizeInBytes(const nvcv::Tensor::Requirements &reqs)
 {
-    int64_t size_inbytes;
-    util::CheckThrow(nvcvMemRequirementsCalcTotalSizeBytes(&(reqs.mem.cudaMem), &size_inbytes));
+    int64_t size_inbytes = 0;
+    for (const NVCVMemRequirements *memReqs : {&reqs.mem.cudaMem, &reqs.mem.hostMem, &reqs.mem.hostPinnedMem})
+    {
+        int64_t memSize;
+        util::CheckThrow(nvcvMemRequirementsCalcTotalSizeBytes(memReqs, &memSize));
+        size_inbytes += memSize;
+    }
     return size_inbytes;
 }
 
@@ -426,6 +445,10 @@ void Tensor::Export(py::module &m)
              "Produces a tensor pointing to the same data but with a new shape and layout.")
         .def("__repr__", &util::ToString<Tensor>, "Return the string representation of the Tensor object.");
 
+    // NumPy arrays are wrapped in host memory; it must come first so that their
+    // __dlpack__ isn't rejected by the cuda-only buffer overload below.
+    m.def("as_tensor", &Tensor::WrapHost, py::arg("buffer").noconvert(), "layout"_a = std::nullopt,
+          "Wrap an existing NumPy array into a host Tensor object with the given layout.");
     m.def("as_tensor", &Tensor::Wrap, "buffer"_a, "layout"_a = std::nullopt,
           "Wrap an existing buffer into a Tensor object with the given layout.");
     m.def("as_tensor", &Tensor::WrapImage, "image"_a, "Wrap an existing image into a Tensor object.");
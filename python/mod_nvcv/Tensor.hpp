@@ -46,6 +46,7 @@ public:
     static std::shared_ptr<Tensor> CreateFromReqs(const nvcv::Tensor::Requirements &reqs);
 
     static std::shared_ptr<Tensor> Wrap(ExternalBuffer &buffer, std::optional<nvcv::TensorLayout> layout);
+    static std::shared_ptr<Tensor> WrapHost(py::array array, std::optional<nvcv::TensorLayout> layout);
     static std::shared_ptr<Tensor> WrapImage(Image &img);
     static std::shared_ptr<Tensor> ReshapeTensor(Tensor &tensor, Shape shape, std::optional<nvcv::TensorLayout> layout);
 
@@ -18,6 +18,8 @@
 #ifndef NVCV_PYTHON_CAPI_HPP
 #define NVCV_PYTHON_CAPI_HPP
 
+#include "LockMode.hpp"
+
 #include <cuda_runtime.h>
 #include <nvcv/Array.h>
 #include <nvcv/DataType.hpp>
@@ -85,6 +87,14 @@ struct CAPI
 
     void (*TensorBatch_Clear)(PyObject *tensorBatch);
 
+    // Same as Resource_SubmitSync on each of the resources, with a single call.
+    void (*Stream_SubmitSyncResources)(PyObject *stream, PyObject *const *resources, int32_t count);
+
+    // Same as Stream_HoldResources, with the resources and lock modes given as
+    // plain arrays instead of a python list of (lock mode, resource) tuples.
+    void (*Stream_HoldResourceArray)(PyObject *stream, PyObject *const *resources, const LockMode *lockModes,
+                                     int32_t count);
+
     // always add new functions at the end, and never change the function prototypes above.
 };
 
@@ -18,6 +18,8 @@
 #ifndef NVCV_PYTHON_LOCKMODE_HPP
 #define NVCV_PYTHON_LOCKMODE_HPP
 
+#include <cstdint>
+
 namespace nvcvpy {
 
 enum LockMode : uint8_t
@@ -23,10 +23,17 @@
 #include "Resource.hpp"
 #include "Stream.hpp"
 
+#include <vector>
+
 namespace nvcvpy {
 
 namespace py = pybind11;
 
+// Keeps track of the resources used by an operator submitted to a stream.
+// Resources are synchronized with the stream when added, and held by it
+// until the operator finishes when the guard is committed or destroyed.
+// They're stored in a small inline buffer and passed to the C API as plain
+// arrays, which avoids creating python objects for each resource.
 class ResourceGuard
 {
 public:
@@ -35,6 +42,9 @@ public:
     {
     }
 
+    ResourceGuard(const ResourceGuard &)            = delete;
+    ResourceGuard &operator=(const ResourceGuard &) = delete;
+
     ~ResourceGuard()
     {
         this->commit();
@@ -42,44 +52,94 @@ public:
 
     ResourceGuard &add(LockMode mode, std::initializer_list<std::reference_wrapper<const Resource>> resources)
     {
-        py::object pyLockMode;
-        switch (mode)
-        {
-        case LockMode::LOCK_MODE_NONE:
-            pyLockMode = py::str("");
-            break;
-        case LockMode::LOCK_MODE_READ:
-            pyLockMode = py::str("r");
-            break;
-        case LockMode::LOCK_MODE_WRITE:
-            pyLockMode = py::str("w");
-            break;
-        case LockMode::LOCK_MODE_READWRITE:
-            pyLockMode = py::str("rw");
-            break;
-        }
+        int32_t first = m_count;
 
         for (const std::reference_wrapper<const Resource> &r : resources)
         {
-            py::object pyRes = r.get();
-            capi().Resource_SubmitSync(pyRes.ptr(), m_pyStream.ptr());
-            CheckCAPIError();
-            m_resourcesPerLockMode.append(std::make_pair(pyLockMode, std::move(pyRes)));
+            this->push(r.get().ptr(), mode);
         }
 
+        capi().Stream_SubmitSyncResources(m_pyStream.ptr(), this->resources() + first, m_count - first);
+        CheckCAPIError();
+
         return *this;
     }
 
     void commit()
     {
-        capi().Stream_HoldResources(m_pyStream.ptr(), m_resourcesPerLockMode.ptr());
+        if (m_count == 0)
+        {
+            return;
+        }
+
+        capi().Stream_HoldResourceArray(m_pyStream.ptr(), this->resources(), this->lockModes(), m_count);
+        this->clear();
         CheckCAPIError();
     }
 
 private:
+    static constexpr int32_t kInlineCapacity = 16;
+
     py::object m_pyStream;
-    py::object m_pyLockMode;
-    py::list   m_resourcesPerLockMode;
+
+    // Owned (strong) references to the resources, inline until
+    // kInlineCapacity is exceeded, then in the heap vectors.
+    int32_t   m_count = 0;
+    PyObject *m_inlineResources[kInlineCapacity];
+    LockMode  m_inlineLockModes[kInlineCapacity];
+
+    std::vector<PyObject *> m_heapResources;
+    std::vector<LockMode>   m_heapLockModes;
+
+    bool onHeap() const
+    {
+        return !m_heapResources.empty();
+    }
+
+    PyObject *const *resources() const
+    {
+        return this->onHeap() ? m_heapResources.data() : m_inlineResources;
+    }
+
+    const LockMode *lockModes() const
+    {
+        return this->onHeap() ? m_heapLockModes.data() : m_inlineLockModes;
+    }
+
+    void push(PyObject *res, LockMode mode)
+    {
+        if (!this->onHeap() && m_count == kInlineCapacity)
+        {
+            m_heapResources.assign(m_inlineResources, m_inlineResources + m_count);
+            m_heapLockModes.assign(m_inlineLockModes, m_inlineLockModes + m_count);
+        }
+
+        Py_INCREF(res);
+
+        if (this->onHeap())
+        {
+            m_heapResources.push_back(res);
+            m_heapLockModes.push_back(mode);
+        }
+        else
+        {
+            m_inlineResources[m_count] = res;
+            m_inlineLockModes[m_count] = mode;
+        }
+        ++m_count;
+    }
+
+    void clear()
+    {
+        PyObject *const *res = this->resources();
+        for (int32_t i = 0; i < m_count; ++i)
+        {
+            Py_DECREF(res[i]);
+        }
+        m_count = 0;
+        m_heapResources.clear();
+        m_heapLockModes.clear();
+    }
 };
 
 } // namespace nvcvpy
@@ -51,3 +51,23 @@ CVCUDA_DEFINE_API(0, 4, NVCVStatus, cvcudaHistogramSubmit,
             priv::ToDynamicRef<priv::Histogram>(handle)(stream, input, NVCV_TENSOR_HANDLE_TO_OPTIONAL(mask), output);
         });
 }
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaHistogramBinnedSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle mask,
+                   NVCVTensorHandle histogram, NVCVHistogramMode mode, const NVCVHistogramRange *ranges,
+                   int32_t numRanges))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (ranges == nullptr && numRanges != 0)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to histogram ranges must not be NULL when numRanges is not 0");
+            }
+
+            nvcv::TensorWrapHandle input(in), output(histogram);
+            priv::ToDynamicRef<priv::Histogram>(handle)(stream, input, NVCV_TENSOR_HANDLE_TO_OPTIONAL(mask), output,
+                                                        mode, ranges, numRanges);
+        });
+}
@@ -52,3 +52,38 @@ CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaNonMaximumSuppressionSubmit,
                                                                     iouThreshold);
         });
 }
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaNonMaximumSuppressionTopKGetWorkspaceRequirements,
+                  (NVCVOperatorHandle handle, int32_t numSamples, int32_t numBBoxes, int32_t maxOutputs,
+                   NVCVWorkspaceRequirements *reqOut))
+{
+    if (!reqOut)
+        return NVCV_ERROR_INVALID_ARGUMENT;
+
+    return nvcv::ProtectCall(
+        [&]
+        {
+            *reqOut = priv::ToDynamicRef<priv::NonMaximumSuppression>(handle).getWorkspaceRequirements(
+                numSamples, numBBoxes, maxOutputs);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaNonMaximumSuppressionTopKSubmit,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, const NVCVWorkspace *workspace, NVCVTensorHandle in,
+                   NVCVTensorHandle scores, NVCVTensorHandle classIds, NVCVTensorHandle outIndices,
+                   NVCVTensorHandle outScores, NVCVTensorHandle outCount, float scoreThreshold, float iouThreshold,
+                   NVCVNMSScoreDecay scoreDecay, float sigma))
+{
+    if (!workspace)
+        return NVCV_ERROR_INVALID_ARGUMENT;
+
+    return nvcv::ProtectCall(
+        [&]
+        {
+            priv::ToDynamicRef<priv::NonMaximumSuppression>(handle)(
+                stream, *workspace, nvcv::TensorWrapHandle{in}, nvcv::TensorWrapHandle{scores},
+                nvcv::TensorWrapHandle{classIds}, nvcv::TensorWrapHandle{outIndices},
+                nvcv::TensorWrapHandle{outScores}, nvcv::TensorWrapHandle{outCount}, scoreThreshold, iouThreshold,
+                scoreDecay, sigma);
+        });
+}
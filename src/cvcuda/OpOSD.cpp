@@ -40,6 +40,22 @@ CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaOSDCreate, (NVCVOperatorHandle * handl
         });
 }
 
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaOSDCreateWithParams,
+                  (NVCVOperatorHandle * handle, const NVCVOSDParams *params))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::OSD(params));
+        });
+}
+
 CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaOSDSubmit,
                   (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in, NVCVTensorHandle out,
                    const NVCVElements elements))
@@ -52,3 +68,11 @@ CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaOSDSubmit,
             priv::ToDynamicRef<priv::OSD>(handle)(stream, input, output, elements);
         });
 }
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaOSDPrewarm,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, const char *utf8Text, const char *fontName,
+                   int32_t fontSize))
+{
+    return nvcv::ProtectCall(
+        [&] { priv::ToDynamicRef<priv::OSD>(handle).prewarm(stream, utf8Text, fontName, fontSize); });
+}
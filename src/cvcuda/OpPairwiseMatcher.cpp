@@ -41,6 +41,53 @@ CVCUDA_DEFINE_API(0, 5, NVCVStatus, cvcudaPairwiseMatcherCreate,
         });
 }
 
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaPairwiseMatcherCreateWithParams,
+                  (NVCVOperatorHandle * handle, NVCVPairwiseMatcherType algoChoice,
+                   const NVCVPairwiseMatcherParams *params))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new cvcuda::priv::PairwiseMatcher(algoChoice, params));
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaPairwiseMatcherBuildIndex,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle set2, NVCVTensorHandle numSet2,
+                   NVCVPairwiseMatcherIndexHandle *index))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (index == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVPairwiseMatcherIndex handle must not be NULL");
+            }
+
+            *index = cvcuda::priv::ToDynamicRef<cvcuda::priv::PairwiseMatcher>(handle)
+                         .buildIndex(stream, nvcv::TensorWrapHandle{set2}, nvcv::TensorWrapHandle{numSet2})
+                         .release()
+                         ->handle();
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, void, cvcudaPairwiseMatcherIndexDestroy, (NVCVPairwiseMatcherIndexHandle index))
+{
+    nvcv::ProtectCall(
+        [&]
+        {
+            if (index)
+                delete &priv::ToPairwiseMatcherIndexRef(index);
+        });
+}
+
 CVCUDA_DEFINE_API(0, 5, NVCVStatus, cvcudaPairwiseMatcherSubmit,
                   (NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle set1, NVCVTensorHandle set2,
                    NVCVTensorHandle numSet1, NVCVTensorHandle numSet2, NVCVTensorHandle matches,
@@ -56,3 +103,19 @@ CVCUDA_DEFINE_API(0, 5, NVCVStatus, cvcudaPairwiseMatcherSubmit,
                 nvcv::TensorWrapHandle{distances}, crossCheck, matchesPerPoint, normType);
         });
 }
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaPairwiseMatcherSubmitWithIndex,
+                  (NVCVOperatorHandle handle, cudaStream_t stream, NVCVPairwiseMatcherIndexHandle index,
+                   NVCVTensorHandle set1, NVCVTensorHandle set2, NVCVTensorHandle numSet1, NVCVTensorHandle matches,
+                   NVCVTensorHandle numMatches, NVCVTensorHandle distances, int matchesPerPoint,
+                   NVCVNormType normType))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            cvcuda::priv::ToDynamicRef<cvcuda::priv::PairwiseMatcher>(handle)(
+                stream, priv::ToPairwiseMatcherIndexRef(index), nvcv::TensorWrapHandle{set1},
+                nvcv::TensorWrapHandle{set2}, nvcv::TensorWrapHandle{numSet1}, nvcv::TensorWrapHandle{matches},
+                nvcv::TensorWrapHandle{numMatches}, nvcv::TensorWrapHandle{distances}, matchesPerPoint, normType);
+        });
+}
@@ -41,6 +41,21 @@ CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaPillowResizeCreate, (NVCVOperatorHandl
         });
 }
 
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaPillowResizeCreateWithCoeffCache,
+                  (NVCVOperatorHandle * handle, int32_t coeffCacheSize))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVOperator handle must not be NULL");
+            }
+            *handle = reinterpret_cast<NVCVOperatorHandle>(new priv::PillowResize(coeffCacheSize));
+        });
+}
+
 CVCUDA_DEFINE_API(0, 3, NVCVStatus, cvcudaPillowResizeGetWorkspaceRequirements,
                   (NVCVOperatorHandle handle, int maxBatchSize, int32_t maxInWidth, int32_t maxInHeight,
                    int32_t maxOutWidth, int32_t maxOutHeight, NVCVImageFormat fmt, NVCVWorkspaceRequirements *reqOut))
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "priv/SymbolVersioning.hpp"
+#include "priv/WorkspaceCache.hpp"
+
+#include <cvcuda/WorkspaceCache.h>
+#include <nvcv/Exception.hpp>
+#include <nvcv/alloc/Allocator.hpp>
+
+namespace priv = cvcuda::priv;
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheCreate,
+                  (NVCVWorkspaceCacheHandle * handle, NVCVAllocatorHandle alloc, uint32_t flags))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to NVCVWorkspaceCache handle must not be NULL");
+            }
+
+            *handle = (new priv::WorkspaceCache(nvcv::Allocator::FromHandle(alloc, true), flags))->handle();
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, void, cvcudaWorkspaceCacheDestroy, (NVCVWorkspaceCacheHandle handle))
+{
+    nvcv::ProtectCall(
+        [&]
+        {
+            if (handle)
+                delete &priv::ToWorkspaceCacheRef(handle);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheAcquire,
+                  (NVCVWorkspaceCacheHandle handle, const NVCVWorkspaceRequirements *req, cudaStream_t stream,
+                   NVCVWorkspace *workspace))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (req == nullptr || workspace == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Workspace requirements and output workspace must not be NULL");
+            }
+            *workspace = priv::ToWorkspaceCacheRef(handle).acquire(*req, stream);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheRelease,
+                  (NVCVWorkspaceCacheHandle handle, const NVCVWorkspace *workspace, cudaStream_t stream))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (workspace == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Workspace must not be NULL");
+            }
+            priv::ToWorkspaceCacheRef(handle).release(*workspace, stream);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheSetLimits,
+                  (NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind, const NVCVWorkspaceCacheLimits *limits))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (limits == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Limits must not be NULL");
+            }
+            priv::ToWorkspaceCacheRef(handle).pool(kind).setLimits(*limits);
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheGetLimits,
+                  (NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind, NVCVWorkspaceCacheLimits *limits))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (limits == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to output limits must not be NULL");
+            }
+            *limits = priv::ToWorkspaceCacheRef(handle).pool(kind).limits();
+        });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheTrim,
+                  (NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind, size_t maxCachedBytes))
+{
+    return nvcv::ProtectCall([&] { priv::ToWorkspaceCacheRef(handle).pool(kind).trim(maxCachedBytes); });
+}
+
+CVCUDA_DEFINE_API(0, 15, NVCVStatus, cvcudaWorkspaceCacheGetStats,
+                  (NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind, NVCVWorkspaceCacheStats *stats))
+{
+    return nvcv::ProtectCall(
+        [&]
+        {
+            if (stats == nullptr)
+            {
+                throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                      "Pointer to output stats must not be NULL");
+            }
+            *stats = priv::ToWorkspaceCacheRef(handle).pool(kind).stats();
+        });
+}
@@ -27,6 +27,7 @@
 #define CVCUDA__HISTOGRAM_H
 
 #include "Operator.h"
+#include "Types.h"
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
@@ -112,6 +113,79 @@ CVCUDA_PUBLIC NVCVStatus cvcudaHistogramCreate(NVCVOperatorHandle *handle);
 CVCUDA_PUBLIC NVCVStatus cvcudaHistogramSubmit(NVCVOperatorHandle handle, cudaStream_t stream, NVCVTensorHandle in,
                                                NVCVTensorHandle mask, NVCVTensorHandle histogram);
 
+/** Executes the binned Histogram operation on the given cuda stream. This operation does not
+ *  wait for completion.
+ *
+ *  Values are counted in bins of equal width over a range per histogram axis. A value v of the range
+ *  [lowerBound, upperBound) falls in bin (v - lowerBound) * numBins / (upperBound - lowerBound), values outside of
+ *  the range are not counted. With \ref NVCV_HISTOGRAM_PER_CHANNEL each channel has its own histogram, with
+ *  \ref NVCV_HISTOGRAM_JOINT_2D the pairs of values of the first two channels are counted in a 2D histogram and
+ *  pixels with either value out of range are not counted.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [kNHWC, kHWC]
+ *       Channels:       [1, 2, 3, 4], at least 2 for \ref NVCV_HISTOGRAM_JOINT_2D
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | Yes
+ *       8bit  Signed   | No
+ *       16bit Unsigned | Yes
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | Yes
+ *       64bit Float    | No
+ *
+ *  Output:
+ *       Data Layout:    [kHWC] for \ref NVCV_HISTOGRAM_PER_CHANNEL, [kNHW] for \ref NVCV_HISTOGRAM_JOINT_2D
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | Yes
+ *       32bit Signed   | Yes
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] in input tensor.
+ *
+ * @param [in] mask mask tensor, with shape the same as input tensor any value != 0 will be counted in the histogram.
+ *                  May be NULL to count all pixels.
+ *
+ * @param [out] histogram output histogram, packed with int32 elements.
+ *                        With \ref NVCV_HISTOGRAM_PER_CHANNEL an HWC tensor of height N of the input tensor (1 if
+ *                        HWC), width the number of bins and one channel per input channel.
+ *                        With \ref NVCV_HISTOGRAM_JOINT_2D an NHW tensor of N samples, whose height is the number of
+ *                        bins of the first channel and width the number of bins of the second one.
+ *
+ * @param [in] mode \ref NVCVHistogramMode of the histogram.
+ *
+ * @param [in] ranges Ranges of the values counted, one per channel with \ref NVCV_HISTOGRAM_PER_CHANNEL and two
+ *                    with \ref NVCV_HISTOGRAM_JOINT_2D, or a single one used by all axes. May be NULL to count the
+ *                    values of [0, 256) for 8bit, [0, 65536) for 16bit and [0, 1) for float inputs.
+ *                    + Lower bounds must be less than upper bounds.
+ *
+ * @param [in] numRanges Number of ranges, 0 if \p ranges is NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaHistogramBinnedSubmit(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                     NVCVTensorHandle in, NVCVTensorHandle mask,
+                                                     NVCVTensorHandle histogram, NVCVHistogramMode mode,
+                                                     const NVCVHistogramRange *ranges, int32_t numRanges);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,10 @@ public:
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef mask,
                     const nvcv::Tensor &histogram);
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef mask,
+                    const nvcv::Tensor &histogram, NVCVHistogramMode mode, const NVCVHistogramRange *ranges = nullptr,
+                    int32_t numRanges = 0);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -71,6 +75,14 @@ inline void Histogram::operator()(cudaStream_t stream, const nvcv::Tensor &in, n
         cvcudaHistogramSubmit(m_handle, stream, in.handle(), NVCV_OPTIONAL_TO_HANDLE(mask), histogram.handle()));
 }
 
+inline void Histogram::operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef mask,
+                                  const nvcv::Tensor &histogram, NVCVHistogramMode mode,
+                                  const NVCVHistogramRange *ranges, int32_t numRanges)
+{
+    nvcv::detail::CheckThrow(cvcudaHistogramBinnedSubmit(m_handle, stream, in.handle(), NVCV_OPTIONAL_TO_HANDLE(mask),
+                                                         histogram.handle(), mode, ranges, numRanges));
+}
+
 inline NVCVOperatorHandle Histogram::handle() const noexcept
 {
     return m_handle;
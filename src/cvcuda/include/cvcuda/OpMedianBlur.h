@@ -56,6 +56,10 @@ CVCUDA_PUBLIC NVCVStatus cvcudaMedianBlurCreate(NVCVOperatorHandle *handle, cons
 /** Executes the median blur operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
+ *  Tensors of 8bit or 16bit unsigned pixels filtered with kernels of 121 elements or more use
+ *  sliding histograms, whose cost per pixel grows much slower than the kernel size: it doesn't
+ *  grow at all for 8bit pixels, and only with the kernel height for 16bit ones.
+ *
  *  Limitations:
  *
  *  Input:
@@ -28,6 +28,7 @@
 
 #include "Operator.h"
 #include "Types.h"
+#include "Workspace.h"
 #include "detail/Export.h"
 
 #include <cuda_runtime.h>
@@ -137,6 +138,130 @@ CVCUDA_PUBLIC NVCVStatus cvcudaNonMaximumSuppressionSubmit(NVCVOperatorHandle ha
                                                            NVCVTensorHandle scores, float scoreThreshold,
                                                            float iouThreshold);
 
+/** Calculates the workspace required by \ref cvcudaNonMaximumSuppressionTopKSubmit.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] numSamples Number of samples, the first shape of the input tensor.
+ * @param [in] numBBoxes Number of bbox proposals per sample, the second shape of the input tensor.
+ * @param [in] maxOutputs Number of bboxes selected per sample, K, the second shape of the output indices tensor.
+ * @param [out] reqOut Requirements for the operator's workspace
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or one of the arguments is out of range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaNonMaximumSuppressionTopKGetWorkspaceRequirements(NVCVOperatorHandle handle,
+                                                                                 int32_t numSamples, int32_t numBBoxes,
+                                                                                 int32_t                    maxOutputs,
+                                                                                 NVCVWorkspaceRequirements *reqOut);
+
+/** Executes the sorted, top-K Non-Maximum Suppression operation on the given cuda stream.
+ *
+ *  Instead of a mask over all input bboxes, this variant outputs the indices of at most K selected bboxes per
+ *  sample, ordered by decreasing score.  Input bboxes with scores less than the score threshold are discarded and
+ *  the remaining ones are sorted by decreasing score, ties broken by lower bbox index.  The sorted bboxes are then
+ *  visited in order: with \ref NVCV_NMS_SCORE_DECAY_NONE a bbox is selected unless it overlaps an already selected
+ *  bbox by more than the IoU threshold.  With the Soft-NMS decays the highest scored remaining bbox is selected
+ *  and the scores of the others are decayed by their overlap with it, bboxes whose score falls below the score
+ *  threshold being discarded.  When class ids are given, only bboxes of the same class suppress each other.
+ *  Selection stops after K bboxes, K being the second shape of the output indices tensor.
+ *
+ *  Limitations:
+ *
+ *  Input:
+ *       Data Layout:    [NW]
+ *       Channel count:  [4]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | Yes
+ *       32bit Unsigned | No
+ *       32bit Signed   | No
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Output indices:
+ *       Data Layout:    [NW]
+ *       Channel count:  [1]
+ *
+ *       Data Type      | Allowed
+ *       -------------- | -------------
+ *       8bit  Unsigned | No
+ *       8bit  Signed   | No
+ *       16bit Unsigned | No
+ *       16bit Signed   | No
+ *       32bit Unsigned | No
+ *       32bit Signed   | Yes
+ *       32bit Float    | No
+ *       64bit Float    | No
+ *
+ *  Input/Output dependency
+ *
+ *       Property      |  Input == Output
+ *      -------------- | -------------
+ *       Data Layout   | Yes
+ *       Data Type     | No
+ *       Batches (N)   | Yes
+ *       Bboxes (W)    | No
+ *       Channels      | No
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] workspace The workspace with memory for intermediate results. The requirements for a given input
+ *                       can be acquired with a call to `cvcudaNonMaximumSuppressionTopKGetWorkspaceRequirements`.
+ *                       Calls running concurrently on different streams need different workspaces.
+ *
+ * @param [in] in Input tensor of bbox proposals, as in \ref cvcudaNonMaximumSuppressionSubmit.
+ *
+ * @param [in] scores Input tensor, scores[i, j] is the score of bbox j of image i.
+ *                    + Must have data type F32
+ *                    + Must have rank 2 or 3, in case of 3 last shape must be 1
+ *
+ * @param [in] classIds Optional input tensor, classIds[i, j] is the class of bbox j of image i, may be NULL
+ *                      to suppress bboxes regardless of their class.
+ *                      + Must have data type S32
+ *                      + Must have rank 2 or 3, in case of 3 last shape must be 1
+ *
+ * @param [out] outIndices Output tensor, outIndices[i, k] is the index in ``in`` of the k-th selected bbox of
+ *                         image i, -1 past the number of selected bboxes.
+ *                         + Must have data type S32
+ *                         + Must have rank 2 or 3, in case of 3 last shape must be 1
+ *
+ * @param [out] outScores Optional output tensor, outScores[i, k] is the score of the k-th selected bbox of image
+ *                        i, after decay in Soft-NMS, 0 past the number of selected bboxes.  May be NULL.
+ *                        + Must have data type F32
+ *                        + Must have the same shape as ``outIndices``
+ *
+ * @param [out] outCount Output tensor, outCount[i] is the number of bboxes selected for image i.
+ *                       + Must have data type S32
+ *                       + Must have rank 1 or 2, in case of 2 last shape must be 1
+ *
+ * @param [in] scoreThreshold Minimum score an input bbox proposal need to have to be kept
+ *
+ * @param [in] iouThreshold Maximum overlap between bbox proposals covering the same effective image region as
+ *                          calculated by Intersection-over-Union (IoU) fraction.  Not used by
+ *                          \ref NVCV_NMS_SCORE_DECAY_GAUSSIAN.
+ *
+ * @param [in] scoreDecay How overlapping bboxes are treated, \ref NVCVNMSScoreDecay.
+ *
+ * @param [in] sigma Gaussian decay parameter, used by \ref NVCV_NMS_SCORE_DECAY_GAUSSIAN only.
+ *                   + Must be positive
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    The workspace is too small.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaNonMaximumSuppressionTopKSubmit(
+    NVCVOperatorHandle handle, cudaStream_t stream, const NVCVWorkspace *workspace, NVCVTensorHandle in,
+    NVCVTensorHandle scores, NVCVTensorHandle classIds, NVCVTensorHandle outIndices, NVCVTensorHandle outScores,
+    NVCVTensorHandle outCount, float scoreThreshold, float iouThreshold, NVCVNMSScoreDecay scoreDecay, float sigma);
+
 #ifdef __cplusplus
 }
 #endif
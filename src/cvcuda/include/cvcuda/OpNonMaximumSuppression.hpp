@@ -26,6 +26,7 @@
 
 #include "IOperator.hpp"
 #include "OpNonMaximumSuppression.h"
+#include "Workspace.hpp"
 
 #include <cuda_runtime.h>
 #include <nvcv/Tensor.hpp>
@@ -43,6 +44,13 @@ public:
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, const nvcv::Tensor &scores,
                     float scoreThreshold, float iouThreshold);
 
+    WorkspaceRequirements getWorkspaceRequirements(int numSamples, int numBBoxes, int maxOutputs);
+
+    void operator()(cudaStream_t stream, const Workspace &ws, const nvcv::Tensor &in, const nvcv::Tensor &scores,
+                    const nvcv::Tensor &classIds, const nvcv::Tensor &outIndices, const nvcv::Tensor &outScores,
+                    const nvcv::Tensor &outCount, float scoreThreshold, float iouThreshold,
+                    NVCVNMSScoreDecay scoreDecay = NVCV_NMS_SCORE_DECAY_NONE, float sigma = 0.5f);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -67,6 +75,26 @@ inline void NonMaximumSuppression::operator()(cudaStream_t stream, const nvcv::T
                                                                scores.handle(), scoreThreshold, iouThreshold));
 }
 
+inline WorkspaceRequirements NonMaximumSuppression::getWorkspaceRequirements(int numSamples, int numBBoxes,
+                                                                             int maxOutputs)
+{
+    WorkspaceRequirements req{};
+    nvcv::detail::CheckThrow(cvcudaNonMaximumSuppressionTopKGetWorkspaceRequirements(m_handle, numSamples, numBBoxes,
+                                                                                     maxOutputs, &req));
+    return req;
+}
+
+inline void NonMaximumSuppression::operator()(cudaStream_t stream, const Workspace &ws, const nvcv::Tensor &in,
+                                              const nvcv::Tensor &scores, const nvcv::Tensor &classIds,
+                                              const nvcv::Tensor &outIndices, const nvcv::Tensor &outScores,
+                                              const nvcv::Tensor &outCount, float scoreThreshold, float iouThreshold,
+                                              NVCVNMSScoreDecay scoreDecay, float sigma)
+{
+    nvcv::detail::CheckThrow(cvcudaNonMaximumSuppressionTopKSubmit(
+        m_handle, stream, &ws, in.handle(), scores.handle(), classIds.handle(), outIndices.handle(), outScores.handle(),
+        outCount.handle(), scoreThreshold, iouThreshold, scoreDecay, sigma));
+}
+
 inline NVCVOperatorHandle NonMaximumSuppression::handle() const noexcept
 {
     return m_handle;
@@ -40,6 +40,10 @@ extern "C"
 #endif
 
 /** Constructs and an instance of the OSD operator.
+ *
+ *  Text glyphs are rasterized on the host the first time they are drawn, by up to 8 threads,
+ *  see \ref cvcudaOSDCreateWithParams to choose the thread count and \ref cvcudaOSDPrewarm to
+ *  rasterize glyphs ahead of time.
  *
  * @param [out] handle Where the image instance handle will be written to.
  *                     + Must not be NULL.
@@ -50,6 +54,48 @@ extern "C"
  */
 CVCUDA_PUBLIC NVCVStatus cvcudaOSDCreate(NVCVOperatorHandle *handle);
 
+/** Constructs and an instance of the OSD operator with the given parameters.
+ *
+ *  The CVCUDA_OSD_RASTER_THREADS environment variable, when set to a positive number, overrides
+ *  the number of raster threads of all OSD operators.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] params Parameters of the operator, fields left to zero select the defaults.
+ *                    + If NULL, all parameters take their defaults.
+ *                    + numRasterThreads must be >= 0.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaOSDCreateWithParams(NVCVOperatorHandle *handle, const NVCVOSDParams *params);
+
+/** Rasterizes the glyphs of the given characters and uploads them on the given cuda stream, so that
+ *  the first frames drawing them with this operator don't pay for it.  This operation waits for the
+ *  upload to complete.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ * @param [in] stream Handle to a valid CUDA stream.
+ *
+ * @param [in] utf8Text Characters to prepare, UTF-8 encoded, whitespace is ignored.
+ *                      + Must not be NULL.
+ *
+ * @param [in] fontName Font of the characters, as in \ref NVCVText.
+ *                      + Must not be NULL.
+ *
+ * @param [in] fontSize Font size of the characters, as in \ref NVCVText.
+ *                      + Must be > 0.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, the text can't be rasterized.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaOSDPrewarm(NVCVOperatorHandle handle, cudaStream_t stream, const char *utf8Text,
+                                          const char *fontName, int32_t fontSize);
+
 /** Executes the OSD operation on the given cuda stream. This operation does not
  *  wait for completion.
  *
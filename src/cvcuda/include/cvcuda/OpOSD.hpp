@@ -41,10 +41,14 @@ class OSD final : public IOperator
 public:
     explicit OSD();
 
+    explicit OSD(const NVCVOSDParams &params);
+
     ~OSD();
 
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, const NVCVElements elements);
 
+    void prewarm(cudaStream_t stream, const char *utf8Text, const char *fontName, int32_t fontSize);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
@@ -57,6 +61,12 @@ inline OSD::OSD()
     assert(m_handle);
 }
 
+inline OSD::OSD(const NVCVOSDParams &params)
+{
+    nvcv::detail::CheckThrow(cvcudaOSDCreateWithParams(&m_handle, &params));
+    assert(m_handle);
+}
+
 inline OSD::~OSD()
 {
     nvcvOperatorDestroy(m_handle);
@@ -69,6 +79,11 @@ inline void OSD::operator()(cudaStream_t stream, const nvcv::Tensor &in, const n
     nvcv::detail::CheckThrow(cvcudaOSDSubmit(m_handle, stream, in.handle(), out.handle(), elements));
 }
 
+inline void OSD::prewarm(cudaStream_t stream, const char *utf8Text, const char *fontName, int32_t fontSize)
+{
+    nvcv::detail::CheckThrow(cvcudaOSDPrewarm(m_handle, stream, utf8Text, fontName, fontSize));
+}
+
 inline NVCVOperatorHandle OSD::handle() const noexcept
 {
     return m_handle;
@@ -39,6 +39,8 @@ extern "C"
 {
 #endif
 
+typedef struct NVCVPairwiseMatcherIndex *NVCVPairwiseMatcherIndexHandle;
+
 /** Constructs and an instance of the PairwiseMatcher operator.
  *
  * @param [out] handle Where the image instance handle will be written to.
@@ -52,6 +54,85 @@ extern "C"
  */
 CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherCreate(NVCVOperatorHandle *handle, NVCVPairwiseMatcherType algoChoice);
 
+/** Constructs and an instance of the PairwiseMatcher operator with the parameters of the approximate matchers.
+ *
+ *  The approximate matchers search only part of the 2nd set for each point of the 1st set, trading recall (how
+ *  often the best match is found) for speed.  Both index the 2nd set once, see \ref cvcudaPairwiseMatcherBuildIndex,
+ *  and then query the index for any number of 1st sets.
+ *
+ *  - \ref NVCV_LSH hashes each point of the 2nd set in \ref NVCVPairwiseMatcherParams::numTables tables, the key
+ *    of each table being numHashBits bits sampled from the point.  A point of the 1st set is compared with the
+ *    points in the numProbes buckets of each table whose key differs the least from its own (multi-probe LSH).
+ *    It requires Hamming norm and U8 or U32 points, e.g. ORB or BRIEF descriptors.
+ *  - \ref NVCV_IVF_FLAT clusters the 2nd set with k-means in numLists lists.  A point of the 1st set is compared
+ *    with the points in the numProbes lists with nearest centers.  It requires L1 or L2 norm, e.g. for SIFT.
+ *
+ *  More probes (and tables) increase recall and latency.  Probing all buckets or lists gives the brute-force
+ *  result.  The brute-force matcher ignores the parameters.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] algoChoice Choice of algorithm to find pair-wise matches.
+ *
+ * @param [in] params Parameters of the approximate matchers, fields left to zero select the defaults.
+ *                    + It may be NULL to use only defaults.
+ *                    + numTables must be in [0, 32], numHashBits in [0, 16], numLists in [0, 4096].
+ *                    + numProbes must be at most 2^numHashBits for LSH, and at most numLists and 256 for IVF.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherCreateWithParams(NVCVOperatorHandle *handle,
+                                                               NVCVPairwiseMatcherType algoChoice,
+                                                               const NVCVPairwiseMatcherParams *params);
+
+/** Builds the index of the 2nd set of points of an approximate PairwiseMatcher on the given CUDA stream.  This
+ *  operation does not wait for completion.
+ *
+ *  The index is a separate object owned by the caller, passed to \ref cvcudaPairwiseMatcherSubmitWithIndex to
+ *  query it with any number of 1st sets, on any stream, until it is destroyed by
+ *  \ref cvcudaPairwiseMatcherIndexDestroy.  It is never modified after it is built, and the submissions using it
+ *  wait for its build to complete on the device.  It refers to the contents of \ref set2 and \ref numSet2 at the
+ *  time it is built: when they change, a new index must be built.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *                    + It must be created with an approximate matcher algorithm.
+ *
+ * @param [in] stream Handle to a CUDA stream.
+ *                    + Must be a valid CUDA stream.
+ *
+ * @param [in] set2 Input 2nd set of points tensor, as in \ref cvcudaPairwiseMatcherSubmit.
+ *                  + It must have U8 or U32 data type for \ref NVCV_LSH, and U8 or U32 or F32 for
+ *                    \ref NVCV_IVF_FLAT.
+ *
+ * @param [in] numSet2 Input tensor storing the actual number of points in \ref set2 tensor, as in
+ *                     \ref cvcudaPairwiseMatcherSubmit.
+ *                     + It may be NULL to use entire set2 maximum capacity M as valid points.
+ *
+ * @param [out] index Where the index handle will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the index.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherBuildIndex(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                         NVCVTensorHandle set2, NVCVTensorHandle numSet2,
+                                                         NVCVPairwiseMatcherIndexHandle *index);
+
+/** Destroys an index built by \ref cvcudaPairwiseMatcherBuildIndex.
+ *
+ * Waits for the pending work that uses the index.
+ *
+ * @param [in] index Index to be destroyed.
+ *                   + It may be NULL, then nothing is done.
+ */
+CVCUDA_PUBLIC void cvcudaPairwiseMatcherIndexDestroy(NVCVPairwiseMatcherIndexHandle index);
+
 /** Executes the PairwiseMatcher operation on the given CUDA stream. This operation does not wait for completion.
  *
  * This operation computes the pair-wise matcher between two sets of n-dimensional points.  For instance
@@ -60,6 +141,12 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherCreate(NVCVOperatorHandle *handle,
  * defined by \ref set2 with size \ref numSet2.  If \ref crossCheck is true, $p1_i$ must also be the best match
  * from $p2_j$ considering all possible matches from the 2nd set to the 1st set, to return them as a match.
  *
+ * With an approximate matcher, see \ref cvcudaPairwiseMatcherCreateWithParams, the best matches are searched among
+ * the points of the 2nd set found in its index, which is built from \ref set2 and \ref numSet2 for this call only.
+ * To build the index once and query it many times, see \ref cvcudaPairwiseMatcherSubmitWithIndex.  A point with no
+ * candidate in the searched part of the index is matched to the 2nd set index -1.  Approximate matchers do not
+ * support \ref crossCheck.
+ *
  * @note This operation does not guarantee deterministic output.  Each output tensor limits the number of matches
  *       found by the operator, that is the total number may be greater than this limitation and the order of
  *       matches returned might differ in different runs.
@@ -147,6 +234,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherCreate(NVCVOperatorHandle *handle,
  *                        \ref set1 to 2nd set of points in \ref set2.  Use true to cross check best matches, a
  *                        best match is only returned if it is the best match (minimum distance) from 1st set to
  *                        2nd set and vice versa.
+ *                        + It must be false for approximate matchers.
  *
  * @param [in] matchesPerPoint Number of best matches $k$ per point.  The operator returns the top-$k$ best matches
  *                             from 1st set to 2nd set.
@@ -154,6 +242,7 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherCreate(NVCVOperatorHandle *handle,
  *                             + It has to be 1 if \ref crossCheck is true.
  *
  * @param [in] normType Choice of norm type to normalize distances, used in points difference $|p1 - p2|$.
+ *                      + It must be Hamming for \ref NVCV_LSH, and L1 or L2 for \ref NVCV_IVF_FLAT.
  *
  * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
  * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
@@ -166,6 +255,53 @@ CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherSubmit(NVCVOperatorHandle handle,
                                                      NVCVTensorHandle distances, bool crossCheck, int matchesPerPoint,
                                                      NVCVNormType normType);
 
+/** Executes an approximate PairwiseMatcher operation on the given CUDA stream with the index of the 2nd set built
+ *  by \ref cvcudaPairwiseMatcherBuildIndex.  This operation does not wait for completion.
+ *
+ *  It is \ref cvcudaPairwiseMatcherSubmit without building the index of the 2nd set.  The same index may be used
+ *  by concurrent submissions on different streams.
+ *
+ * @param [in] handle Handle to the operator.
+ *                    + Must not be NULL.
+ *                    + It must be created with the same algorithm and parameters as the one that built \ref index.
+ *
+ * @param [in] stream Handle to a CUDA stream.
+ *                    + Must be a valid CUDA stream.
+ *
+ * @param [in] index Index of the 2nd set of points.
+ *                   + Must not be NULL.
+ *
+ * @param [in] set1 Input 1st set of points tensor, as in \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @param [in] set2 Input 2nd set of points tensor the index was built from.
+ *                  + It must have the shape and data type it had when the index was built.
+ *                  + Its contents must not have changed since the index was built.
+ *
+ * @param [in] numSet1 Input tensor storing the actual number of points in \ref set1 tensor, as in
+ *                     \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @param [out] matches Output tensor to store the matches, as in \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @param [out] numMatches Output tensor to store the number of matches, as in \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @param [out] distances Output tensor to store distances of matches, as in \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @param [in] matchesPerPoint Number of best matches $k$ per point, as in \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @param [in] normType Choice of norm type to normalize distances, as in \ref cvcudaPairwiseMatcherSubmit.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range, or the index does not match the
+ *                                      operator or \ref set2.
+ * @retval #NVCV_ERROR_INTERNAL         Internal error in the operator, invalid types passed in.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPairwiseMatcherSubmitWithIndex(NVCVOperatorHandle handle, cudaStream_t stream,
+                                                              NVCVPairwiseMatcherIndexHandle index,
+                                                              NVCVTensorHandle set1, NVCVTensorHandle set2,
+                                                              NVCVTensorHandle numSet1, NVCVTensorHandle matches,
+                                                              NVCVTensorHandle numMatches, NVCVTensorHandle distances,
+                                                              int matchesPerPoint, NVCVNormType normType);
+
 #ifdef __cplusplus
 }
 #endif
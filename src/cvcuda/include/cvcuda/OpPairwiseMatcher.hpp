@@ -35,36 +35,112 @@
 
 namespace cvcuda {
 
+/** Index of the 2nd set of points of an approximate PairwiseMatcher, see \ref PairwiseMatcher::buildIndex. */
+class PairwiseMatcherIndex
+{
+public:
+    explicit PairwiseMatcherIndex(NVCVPairwiseMatcherIndexHandle handle = nullptr) noexcept;
+
+    PairwiseMatcherIndex(PairwiseMatcherIndex &&that) noexcept;
+    PairwiseMatcherIndex &operator=(PairwiseMatcherIndex &&that) noexcept;
+
+    PairwiseMatcherIndex(const PairwiseMatcherIndex &)            = delete;
+    PairwiseMatcherIndex &operator=(const PairwiseMatcherIndex &) = delete;
+
+    ~PairwiseMatcherIndex();
+
+    NVCVPairwiseMatcherIndexHandle handle() const noexcept;
+
+private:
+    NVCVPairwiseMatcherIndexHandle m_handle;
+};
+
 class PairwiseMatcher final : public IOperator
 {
 public:
     explicit PairwiseMatcher(NVCVPairwiseMatcherType algoChoice);
 
+    PairwiseMatcher(NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams &params);
+
     ~PairwiseMatcher();
 
+    PairwiseMatcherIndex buildIndex(cudaStream_t stream, const nvcv::Tensor &set2, const nvcv::Tensor &numSet2);
+
     void operator()(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
                     const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2, const nvcv::Tensor &matches,
                     const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint,
                     NVCVNormType normType);
 
+    void operator()(cudaStream_t stream, const PairwiseMatcherIndex &index, const nvcv::Tensor &set1,
+                    const nvcv::Tensor &set2, const nvcv::Tensor &numSet1, const nvcv::Tensor &matches,
+                    const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, int matchesPerPoint,
+                    NVCVNormType normType);
+
     virtual NVCVOperatorHandle handle() const noexcept override;
 
 private:
     NVCVOperatorHandle m_handle;
 };
 
+inline PairwiseMatcherIndex::PairwiseMatcherIndex(NVCVPairwiseMatcherIndexHandle handle) noexcept
+    : m_handle(handle)
+{
+}
+
+inline PairwiseMatcherIndex::PairwiseMatcherIndex(PairwiseMatcherIndex &&that) noexcept
+    : m_handle(that.m_handle)
+{
+    that.m_handle = nullptr;
+}
+
+inline PairwiseMatcherIndex &PairwiseMatcherIndex::operator=(PairwiseMatcherIndex &&that) noexcept
+{
+    if (this != &that)
+    {
+        cvcudaPairwiseMatcherIndexDestroy(m_handle);
+        m_handle      = that.m_handle;
+        that.m_handle = nullptr;
+    }
+    return *this;
+}
+
+inline PairwiseMatcherIndex::~PairwiseMatcherIndex()
+{
+    cvcudaPairwiseMatcherIndexDestroy(m_handle);
+}
+
+inline NVCVPairwiseMatcherIndexHandle PairwiseMatcherIndex::handle() const noexcept
+{
+    return m_handle;
+}
+
 inline PairwiseMatcher::PairwiseMatcher(NVCVPairwiseMatcherType algoChoice)
 {
     nvcv::detail::CheckThrow(cvcudaPairwiseMatcherCreate(&m_handle, algoChoice));
     assert(m_handle);
 }
 
+inline PairwiseMatcher::PairwiseMatcher(NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams &params)
+{
+    nvcv::detail::CheckThrow(cvcudaPairwiseMatcherCreateWithParams(&m_handle, algoChoice, &params));
+    assert(m_handle);
+}
+
 inline PairwiseMatcher::~PairwiseMatcher()
 {
     nvcvOperatorDestroy(m_handle);
     m_handle = nullptr;
 }
 
+inline PairwiseMatcherIndex PairwiseMatcher::buildIndex(cudaStream_t stream, const nvcv::Tensor &set2,
+                                                        const nvcv::Tensor &numSet2)
+{
+    NVCVPairwiseMatcherIndexHandle index = nullptr;
+    nvcv::detail::CheckThrow(
+        cvcudaPairwiseMatcherBuildIndex(m_handle, stream, set2.handle(), numSet2.handle(), &index));
+    return PairwiseMatcherIndex(index);
+}
+
 inline void PairwiseMatcher::operator()(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
                                         const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2,
                                         const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
@@ -76,6 +152,17 @@ inline void PairwiseMatcher::operator()(cudaStream_t stream, const nvcv::Tensor
         numMatches.handle(), distances.handle(), crossCheck, matchesPerPoint, normType));
 }
 
+inline void PairwiseMatcher::operator()(cudaStream_t stream, const PairwiseMatcherIndex &index,
+                                        const nvcv::Tensor &set1, const nvcv::Tensor &set2,
+                                        const nvcv::Tensor &numSet1, const nvcv::Tensor &matches,
+                                        const nvcv::Tensor &numMatches, const nvcv::Tensor &distances,
+                                        int matchesPerPoint, NVCVNormType normType)
+{
+    nvcv::detail::CheckThrow(cvcudaPairwiseMatcherSubmitWithIndex(
+        m_handle, stream, index.handle(), set1.handle(), set2.handle(), numSet1.handle(), matches.handle(),
+        numMatches.handle(), distances.handle(), matchesPerPoint, normType));
+}
+
 inline NVCVOperatorHandle PairwiseMatcher::handle() const noexcept
 {
     return m_handle;
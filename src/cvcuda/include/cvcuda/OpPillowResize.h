@@ -43,6 +43,10 @@ extern "C"
 #endif
 
 /** Constructs and an instance of the pillow resize operator.
+ *
+ *  The operator keeps the resampling coefficients it computes for tensor inputs and reuses them
+ *  across calls and streams for the same input size, output size and interpolation. Up to 64 tables
+ *  are kept, see \ref cvcudaPillowResizeCreateWithCoeffCache to set another limit.
  *
  * @param [out] handle Where the image instance handle will be written to.
  *                     + Must not be NULL.
@@ -54,6 +58,22 @@ extern "C"
  */
 CVCUDA_PUBLIC NVCVStatus cvcudaPillowResizeCreate(NVCVOperatorHandle *handle);
 
+/** Constructs an instance of the pillow resize operator keeping a given number of coefficient tables.
+ *
+ *  See \ref cvcudaPillowResizeCreate, each table holds the resampling coefficients of one axis.
+ *
+ * @param [out] handle Where the image instance handle will be written to.
+ *                     + Must not be NULL.
+ * @param [in] coeffCacheSize Maximum number of coefficient tables kept by the operator.
+ *                            + Must not be negative.
+ *                            + 0 disables the cache, the coefficients are then computed on the device at each call.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null or coeffCacheSize is negative.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the operator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaPillowResizeCreateWithCoeffCache(NVCVOperatorHandle *handle, int32_t coeffCacheSize);
+
 /** Calculates the upper bounds of buffer sizes required to run the operator
  *
  * @param [in] handle Where the image instance handle will be written to.
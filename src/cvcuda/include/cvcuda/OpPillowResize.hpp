@@ -44,6 +44,8 @@ class PillowResize final : public IOperator
 public:
     PillowResize();
 
+    explicit PillowResize(int32_t coeffCacheSize);
+
     ~PillowResize();
 
     WorkspaceRequirements getWorkspaceRequirements(int batchSize, const nvcv::Size2D *in_sizes,
@@ -70,6 +72,12 @@ inline PillowResize::PillowResize()
     assert(m_handle);
 }
 
+inline PillowResize::PillowResize(int32_t coeffCacheSize)
+{
+    nvcv::detail::CheckThrow(cvcudaPillowResizeCreateWithCoeffCache(&m_handle, coeffCacheSize));
+    assert(m_handle);
+}
+
 inline PillowResize::~PillowResize()
 {
     nvcvOperatorDestroy(m_handle);
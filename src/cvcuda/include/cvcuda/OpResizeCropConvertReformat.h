@@ -56,6 +56,12 @@ CVCUDA_PUBLIC NVCVStatus cvcudaResizeCropConvertReformatCreate(NVCVOperatorHandl
 /** Executes the fused ResizeCropConvertReformat operation on the given cuda
  *  stream. This operation does not wait for completion.
  *
+ *  When both input and output tensors are in host memory, pinned or not, the operation runs on the
+ *  CPU instead, on up to one thread per core (set CVCUDA_HOST_THREADS to change it). The stream is
+ *  synchronized first, so that work queued on it before the call is complete, and the call returns
+ *  once the output is written. Results may differ from the device ones by one before the scale and
+ *  offset are applied.
+ *
  *  ResizeCropConvertReformat is a fused operator that performs the following
  *  operations in order:
  *
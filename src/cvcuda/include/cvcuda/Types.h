@@ -421,9 +421,33 @@ typedef enum
 // @brief Defines pair-wise matcher algorithms of choice
 typedef enum
 {
-    NVCV_BRUTE_FORCE //!< Select brute-force algorithm as the matcher
+    NVCV_BRUTE_FORCE, //!< Select brute-force algorithm as the matcher
+    NVCV_LSH,         //!< Select multi-probe locality-sensitive hashing, approximate matcher for Hamming norm
+    NVCV_IVF_FLAT,    //!< Select inverted lists of k-means clusters, approximate matcher for L1 and L2 norms
 } NVCVPairwiseMatcherType;
 
+// @brief Defines how Non-Maximum Suppression treats boxes overlapping a selected box
+typedef enum
+{
+    NVCV_NMS_SCORE_DECAY_NONE,     //!< Discards overlapping boxes (hard NMS).
+    NVCV_NMS_SCORE_DECAY_LINEAR,   //!< Scales the score of overlapping boxes by (1 - IoU) (Soft-NMS).
+    NVCV_NMS_SCORE_DECAY_GAUSSIAN, //!< Scales the score of all boxes by exp(-IoU^2 / sigma) (Soft-NMS).
+} NVCVNMSScoreDecay;
+
+// @brief Defines which histograms are computed over the channels of the input of a binned histogram
+typedef enum
+{
+    NVCV_HISTOGRAM_PER_CHANNEL, //!< One histogram per channel.
+    NVCV_HISTOGRAM_JOINT_2D,    //!< One 2D histogram of the pairs of values of the first two channels.
+} NVCVHistogramMode;
+
+// @brief Defines the range of values binned along one axis of a histogram
+typedef struct NVCVHistogramRangeRec
+{
+    float lowerBound; //!< Smallest value counted, inclusive.
+    float upperBound; //!< Bound of the values counted, exclusive.
+} NVCVHistogramRange;
+
 // @brief Defines how a vector normalization should occur
 typedef enum
 {
@@ -536,6 +560,22 @@ typedef enum
     HHMMSS        = 3
 } NVCVClockFormat;
 
+// @brief Defines the index and search parameters of the approximate pair-wise matchers, zero selects the default
+typedef struct NVCVPairwiseMatcherParamsRec
+{
+    int32_t numTables;   //!< LSH: number of hash tables, up to 32 (default 8).
+    int32_t numHashBits; //!< LSH: number of point bits sampled in the key of each table, up to 16 (default 14).
+    int32_t numLists;    //!< IVF: number of inverted lists (k-means clusters) per sample, up to 4096 (default 256).
+    int32_t numProbes;   //!< LSH buckets per table or IVF lists searched per point (default 1 + numHashBits or 16).
+    int32_t seed;        //!< Seed of the LSH bit sampling and of the IVF cluster initialization.
+} NVCVPairwiseMatcherParams;
+
+// @brief Defines the parameters of the OSD operator, zero selects the default
+typedef struct NVCVOSDParamsRec
+{
+    int32_t numRasterThreads; //!< Threads rasterizing new text glyphs, caller included (default min(8, CPU threads)).
+} NVCVOSDParams;
+
 typedef void *NVCVElements;
 
 #ifdef __cplusplus
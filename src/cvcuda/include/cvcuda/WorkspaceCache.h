@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file WorkspaceCache.h
+ *
+ * @brief Defines types and functions to handle a stream-aware cache of workspace memory.
+ */
+
+#ifndef CVCUDA_WORKSPACE_CACHE_H
+#define CVCUDA_WORKSPACE_CACHE_H
+
+#include "Workspace.h"
+#include "detail/Export.h"
+
+#include <cuda_runtime.h>
+#include <nvcv/Status.h>
+#include <nvcv/alloc/Allocator.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct NVCVWorkspaceCache *NVCVWorkspaceCacheHandle;
+
+/** Kinds of memory in a workspace, see \ref NVCVWorkspace. */
+typedef enum
+{
+    NVCV_WORKSPACE_MEM_HOST   = 0,
+    NVCV_WORKSPACE_MEM_PINNED = 1,
+    NVCV_WORKSPACE_MEM_CUDA   = 2
+} NVCVWorkspaceMemKind;
+
+/** Flags passed to \ref cvcudaWorkspaceCacheCreate. */
+typedef enum
+{
+    /** Allocates every kind of memory as plain host memory and doesn't use any CUDA events or streams.
+     *  Meant for testing the caching logic on machines without a device. */
+    NVCV_WORKSPACE_CACHE_HOST_ONLY = (1 << 0)
+} NVCVWorkspaceCacheFlags;
+
+/** Value of a \ref NVCVWorkspaceCacheLimits field meaning "no limit". */
+#define NVCV_WORKSPACE_CACHE_UNLIMITED ((size_t)-1)
+
+/** Limits on the memory of one kind held by a workspace cache. */
+typedef struct NVCVWorkspaceCacheLimitsRec
+{
+    /** Maximum number of bytes kept for reuse once released. Beyond it, the largest blocks no longer
+     *  used by the device are freed. 0 disables caching. */
+    size_t maxCachedBytes;
+
+    /** Maximum number of bytes allocated, in use and cached. When a new block would exceed it, cached blocks
+     *  are freed to make room and if that's not enough, the acquisition fails with NVCV_ERROR_OUT_OF_MEMORY. */
+    size_t maxTotalBytes;
+} NVCVWorkspaceCacheLimits;
+
+/** Statistics about the memory of one kind handled by a workspace cache. */
+typedef struct NVCVWorkspaceCacheStatsRec
+{
+    /** Number of requests served with a cached block. */
+    uint64_t hits;
+    /** Number of requests that needed a new allocation. */
+    uint64_t misses;
+    /** Number of blocks given back to the allocator. */
+    uint64_t frees;
+    /** Bytes currently acquired and not released yet. */
+    size_t bytesInUse;
+    /** Bytes currently cached for reuse. */
+    size_t bytesCached;
+    /** Highest value reached by bytesInUse + bytesCached. */
+    size_t peakBytes;
+} NVCVWorkspaceCacheStats;
+
+/** Constructs a workspace cache.
+ *
+ * Workspace memory acquired from the cache is returned to it once released, and reused by subsequent acquisitions
+ * after the work scheduled on it has completed. Block sizes are rounded up to size classes spaced by a quarter of
+ * an octave, so that requests of similar size can share blocks.
+ *
+ * @param [out] handle Where the workspace cache handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @param [in] alloc Allocator used to allocate the memory blocks. If NULL, the default allocator is used.
+ *
+ * @param [in] flags A combination of \ref NVCVWorkspaceCacheFlags.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Handle is null.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the workspace cache.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheCreate(NVCVWorkspaceCacheHandle *handle, NVCVAllocatorHandle alloc,
+                                                    uint32_t flags);
+
+/** Destroys a workspace cache, freeing all the memory it holds.
+ *
+ * All workspaces acquired from the cache must have been released before.
+ * Waits for the pending work that uses the cached memory.
+ *
+ * @param [in] handle Workspace cache to be destroyed.
+ */
+CVCUDA_PUBLIC void cvcudaWorkspaceCacheDestroy(NVCVWorkspaceCacheHandle handle);
+
+/** Acquires a workspace satisfying the given requirements.
+ *
+ * Pinned and device memory come with a `ready` event that must be honored as described in \ref NVCVWorkspaceMem.
+ * Plain host memory is never in use by the device when acquired and has no event.
+ *
+ * @param [in] handle Workspace cache handle.
+ *
+ * @param [in] req Workspace requirements. Sizes of 0 yield NULL memory of that kind.
+ *                 + Must not be NULL.
+ *
+ * @param [in] stream Stream on which the pinned and device memory will be used. Memory previously released on this
+ *                    stream can be reused right away.
+ *
+ * @param [out] workspace Where the acquired workspace will be written to.
+ *                        + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    The memory can't be allocated or would exceed the total limit.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheAcquire(NVCVWorkspaceCacheHandle         handle,
+                                                     const NVCVWorkspaceRequirements *req, cudaStream_t stream,
+                                                     NVCVWorkspace *workspace);
+
+/** Returns a workspace to the cache.
+ *
+ * @param [in] handle Workspace cache handle.
+ *
+ * @param [in] workspace Workspace returned by \ref cvcudaWorkspaceCacheAcquire, unmodified.
+ *                       + Must not be NULL.
+ *
+ * @param [in] stream Stream on which the last work using the pinned and device memory was scheduled, the `ready`
+ *                    events must have been recorded after it.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheRelease(NVCVWorkspaceCacheHandle handle, const NVCVWorkspace *workspace,
+                                                     cudaStream_t stream);
+
+/** Sets the limits on the memory of one kind.
+ *
+ * By default, no limits are set. Cached memory beyond the new limits is freed, if not in use by the device.
+ *
+ * @param [in] handle Workspace cache handle.
+ * @param [in] kind   Memory kind the limits apply to.
+ * @param [in] limits New limits.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheSetLimits(NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind,
+                                                       const NVCVWorkspaceCacheLimits *limits);
+
+/** Gets the limits on the memory of one kind.
+ *
+ * @param [in] handle Workspace cache handle.
+ * @param [in] kind   Memory kind.
+ * @param [out] limits Where the limits will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheGetLimits(NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind,
+                                                       NVCVWorkspaceCacheLimits *limits);
+
+/** Frees cached memory of one kind, largest blocks first, until at most maxCachedBytes remain cached.
+ *
+ * Blocks still in use by the device are kept.
+ *
+ * @param [in] handle Workspace cache handle.
+ * @param [in] kind   Memory kind.
+ * @param [in] maxCachedBytes Number of cached bytes to keep at most, 0 frees everything possible.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheTrim(NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind,
+                                                  size_t maxCachedBytes);
+
+/** Gets the statistics about the memory of one kind.
+ *
+ * @param [in] handle Workspace cache handle.
+ * @param [in] kind   Memory kind.
+ * @param [out] stats Where the statistics will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+CVCUDA_PUBLIC NVCVStatus cvcudaWorkspaceCacheGetStats(NVCVWorkspaceCacheHandle handle, NVCVWorkspaceMemKind kind,
+                                                      NVCVWorkspaceCacheStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CVCUDA_WORKSPACE_CACHE_H */
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file WorkspaceCache.hpp
+ *
+ * @brief Defines the public C++ class for the stream-aware workspace cache.
+ */
+
+#ifndef CVCUDA_WORKSPACE_CACHE_HPP
+#define CVCUDA_WORKSPACE_CACHE_HPP
+
+#include "Workspace.hpp"
+#include "WorkspaceCache.h"
+
+#include <nvcv/alloc/Allocator.hpp>
+#include <nvcv/detail/CheckError.hpp>
+
+#include <cassert>
+
+namespace cvcuda {
+
+using WorkspaceMemKind     = NVCVWorkspaceMemKind;
+using WorkspaceCacheLimits = NVCVWorkspaceCacheLimits;
+using WorkspaceCacheStats  = NVCVWorkspaceCacheStats;
+
+/** Pool of workspace memory, reused across operator calls in stream order.
+ *
+ * Typical use with operators that take a workspace:
+ *
+ * @code
+ * cvcuda::WorkspaceCache cache;
+ * ...
+ * auto ws = cache.get(op.getWorkspaceRequirements(...), stream);
+ * op(stream, ws.get(), ...);
+ * // ws goes back to the cache when destroyed, it can be reused once the work scheduled on stream completes
+ * @endcode
+ */
+class WorkspaceCache
+{
+public:
+    explicit WorkspaceCache(const nvcv::Allocator &alloc = {}, uint32_t flags = 0);
+
+    ~WorkspaceCache();
+
+    WorkspaceCache(const WorkspaceCache &)            = delete;
+    WorkspaceCache &operator=(const WorkspaceCache &) = delete;
+
+    /** Acquires a workspace to be used on the given stream, released on the same stream when destroyed. */
+    UniqueWorkspace get(const WorkspaceRequirements &req, cudaStream_t stream);
+
+    void                 setLimits(WorkspaceMemKind kind, const WorkspaceCacheLimits &limits);
+    WorkspaceCacheLimits limits(WorkspaceMemKind kind) const;
+
+    /** Frees cached memory not in use by the device, largest blocks first, until at most maxCachedBytes remain. */
+    void trim(WorkspaceMemKind kind, size_t maxCachedBytes = 0);
+
+    WorkspaceCacheStats stats(WorkspaceMemKind kind) const;
+
+    NVCVWorkspaceCacheHandle handle() const noexcept;
+
+private:
+    NVCVWorkspaceCacheHandle m_handle;
+};
+
+inline WorkspaceCache::WorkspaceCache(const nvcv::Allocator &alloc, uint32_t flags)
+{
+    nvcv::detail::CheckThrow(cvcudaWorkspaceCacheCreate(&m_handle, alloc.handle(), flags));
+    assert(m_handle);
+}
+
+inline WorkspaceCache::~WorkspaceCache()
+{
+    cvcudaWorkspaceCacheDestroy(m_handle);
+}
+
+inline UniqueWorkspace WorkspaceCache::get(const WorkspaceRequirements &req, cudaStream_t stream)
+{
+    Workspace ws{};
+    nvcv::detail::CheckThrow(cvcudaWorkspaceCacheAcquire(m_handle, &req, stream, &ws));
+
+    NVCVWorkspaceCacheHandle handle = m_handle;
+    return UniqueWorkspace(ws, [handle, stream](Workspace &ws)
+                           { nvcv::detail::CheckThrow(cvcudaWorkspaceCacheRelease(handle, &ws, stream)); });
+}
+
+inline void WorkspaceCache::setLimits(WorkspaceMemKind kind, const WorkspaceCacheLimits &limits)
+{
+    nvcv::detail::CheckThrow(cvcudaWorkspaceCacheSetLimits(m_handle, kind, &limits));
+}
+
+inline WorkspaceCacheLimits WorkspaceCache::limits(WorkspaceMemKind kind) const
+{
+    WorkspaceCacheLimits limits;
+    nvcv::detail::CheckThrow(cvcudaWorkspaceCacheGetLimits(m_handle, kind, &limits));
+    return limits;
+}
+
+inline void WorkspaceCache::trim(WorkspaceMemKind kind, size_t maxCachedBytes)
+{
+    nvcv::detail::CheckThrow(cvcudaWorkspaceCacheTrim(m_handle, kind, maxCachedBytes));
+}
+
+inline WorkspaceCacheStats WorkspaceCache::stats(WorkspaceMemKind kind) const
+{
+    WorkspaceCacheStats stats;
+    nvcv::detail::CheckThrow(cvcudaWorkspaceCacheGetStats(m_handle, kind, &stats));
+    return stats;
+}
+
+inline NVCVWorkspaceCacheHandle WorkspaceCache::handle() const noexcept
+{
+    return m_handle;
+}
+
+} // namespace cvcuda
+
+#endif // CVCUDA_WORKSPACE_CACHE_HPP
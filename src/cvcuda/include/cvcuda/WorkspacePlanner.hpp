@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file WorkspacePlanner.hpp
+ *
+ * @brief Defines a planner that lays out the workspaces of a pipeline of operators in a single arena.
+ */
+
+#ifndef CVCUDA_WORKSPACE_PLANNER_HPP
+#define CVCUDA_WORKSPACE_PLANNER_HPP
+
+#include "Workspace.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/detail/Align.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace cvcuda {
+
+/** Lays out the workspaces of a sequence of operator calls in one arena.
+ *
+ * Each workspace is added with the range of pipeline steps in which it's used. Workspaces whose step ranges
+ * don't overlap can share memory, so the arena is usually much smaller than the sum of the requirements -
+ * e.g. in an HQResize -> CvtColor -> Normalize -> Reformat chain where each operator only needs its workspace
+ * for its own call, the arena is as large as the largest of them.
+ *
+ * The offsets are assigned separately for each kind of memory, placing the largest workspaces first,
+ * each at the lowest offset that doesn't collide with the workspaces already placed that are used in any
+ * of the same steps.
+ *
+ * Example:
+ * @code
+ *   cvcuda::WorkspacePlanner planner;
+ *   int resizeWs = planner.add(resizeReq, 0);
+ *   int cvtWs    = planner.add(cvtReq, 1);
+ *   auto arena   = cvcuda::AllocateWorkspace(planner.plan());
+ *   resize(stream, planner.get(arena.get(), resizeWs), ...);
+ *   cvtColor(stream, planner.get(arena.get(), cvtWs), ...);
+ * @endcode
+ *
+ * The sub-workspaces share the memory and the `ready` events of the arena, so the operators must be
+ * submitted to the same stream, in the order of the steps.
+ */
+class WorkspacePlanner
+{
+public:
+    /** Adds a workspace used in the pipeline steps from `firstStep` to `lastStep`, inclusive.
+     *
+     * @return The index of the workspace, to be passed to `offsets` and `get`.
+     */
+    int add(const WorkspaceRequirements &req, int firstStep, int lastStep)
+    {
+        if (firstStep > lastStep)
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "The first step of a workspace must not come after the last one");
+        checkAlignment(req.hostMem);
+        checkAlignment(req.pinnedMem);
+        checkAlignment(req.cudaMem);
+
+        m_items.push_back({req, firstStep, lastStep, {}});
+        m_planned = false;
+        return static_cast<int>(m_items.size() - 1);
+    }
+
+    /** Adds a workspace used only in the pipeline step `step`. */
+    int add(const WorkspaceRequirements &req, int step)
+    {
+        return add(req, step, step);
+    }
+
+    int size() const
+    {
+        return static_cast<int>(m_items.size());
+    }
+
+    /** Assigns the offsets of all workspaces added so far.
+     *
+     * @return The requirements of the arena.
+     */
+    const WorkspaceRequirements &plan()
+    {
+        m_arena.hostMem   = planMem(&WorkspaceRequirements::hostMem, 0);
+        m_arena.pinnedMem = planMem(&WorkspaceRequirements::pinnedMem, 1);
+        m_arena.cudaMem   = planMem(&WorkspaceRequirements::cudaMem, 2);
+        m_planned         = true;
+        return m_arena;
+    }
+
+    /** The requirements of the arena, as returned by the last call to `plan`. */
+    const WorkspaceRequirements &requirements() const
+    {
+        checkPlanned();
+        return m_arena;
+    }
+
+    /** The offsets of the host, pinned and device memory of the workspace `index` in the arena. */
+    const std::array<size_t, 3> &offsets(int index) const
+    {
+        checkPlanned();
+        return item(index).offsets;
+    }
+
+    /** Gets the sub-workspace of the workspace `index` from an arena allocated with `requirements()`.
+     */
+    Workspace get(const Workspace &arena, int index) const
+    {
+        checkPlanned();
+        const Item &it = item(index);
+
+        Workspace ws;
+        ws.hostMem   = subMem(arena.hostMem, m_arena.hostMem, it.req.hostMem, it.offsets[0]);
+        ws.pinnedMem = subMem(arena.pinnedMem, m_arena.pinnedMem, it.req.pinnedMem, it.offsets[1]);
+        ws.cudaMem   = subMem(arena.cudaMem, m_arena.cudaMem, it.req.cudaMem, it.offsets[2]);
+        return ws;
+    }
+
+private:
+    struct Item
+    {
+        WorkspaceRequirements req;
+        int                   firstStep, lastStep;
+        std::array<size_t, 3> offsets;
+    };
+
+    static void checkAlignment(const WorkspaceMemRequirements &req)
+    {
+        if (req.size && (req.alignment == 0 || (req.alignment & (req.alignment - 1)) != 0))
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Workspace memory alignment must be a power of two");
+    }
+
+    void checkPlanned() const
+    {
+        if (!m_planned)
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_OPERATION,
+                                  "The workspaces must be planned after the last one is added");
+    }
+
+    const Item &item(int index) const
+    {
+        if (index < 0 || index >= size())
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Workspace index out of range");
+        return m_items[index];
+    }
+
+    static bool overlap(const Item &a, const Item &b)
+    {
+        return a.firstStep <= b.lastStep && b.firstStep <= a.lastStep;
+    }
+
+    WorkspaceMemRequirements planMem(WorkspaceMemRequirements WorkspaceRequirements::*kind, int k)
+    {
+        std::vector<int> order;
+        for (int i = 0; i < size(); i++)
+        {
+            m_items[i].offsets[k] = 0;
+            if ((m_items[i].req.*kind).size)
+                order.push_back(i);
+        }
+        // Largest first; ties in the order of the steps, so that the layout is deterministic
+        std::stable_sort(order.begin(), order.end(),
+                         [&](int a, int b)
+                         {
+                             size_t sa = (m_items[a].req.*kind).size, sb = (m_items[b].req.*kind).size;
+                             if (sa != sb)
+                                 return sa > sb;
+                             return m_items[a].firstStep < m_items[b].firstStep;
+                         });
+
+        WorkspaceMemRequirements arena{0, 1};
+        std::vector<int>         placed;
+        std::vector<int>         colliding;
+        for (int i : order)
+        {
+            Item                          &cur = m_items[i];
+            const WorkspaceMemRequirements req = cur.req.*kind;
+
+            colliding.clear();
+            for (int j : placed)
+                if (overlap(cur, m_items[j]))
+                    colliding.push_back(j);
+            std::sort(colliding.begin(), colliding.end(),
+                      [&](int a, int b) { return m_items[a].offsets[k] < m_items[b].offsets[k]; });
+
+            // Find the lowest gap that fits, going through the colliding workspaces by offset
+            size_t offset = 0;
+            for (int j : colliding)
+            {
+                size_t start = m_items[j].offsets[k];
+                size_t end   = start + (m_items[j].req.*kind).size;
+                if (nvcv::detail::AlignUp(offset, req.alignment) + req.size <= start)
+                    break;
+                offset = std::max(offset, end);
+            }
+            offset = nvcv::detail::AlignUp(offset, req.alignment);
+
+            cur.offsets[k]  = offset;
+            arena.size      = std::max(arena.size, offset + req.size);
+            arena.alignment = std::max(arena.alignment, req.alignment);
+            placed.push_back(i);
+        }
+        arena.size = nvcv::detail::AlignUp(arena.size, arena.alignment);
+        return arena;
+    }
+
+    static WorkspaceMem subMem(const WorkspaceMem &arena, const WorkspaceMemRequirements &arenaReq,
+                               const WorkspaceMemRequirements &req, size_t offset)
+    {
+        if (!req.size)
+            return WorkspaceMem{req, nullptr, nullptr};
+
+        if (!arena.data || arena.req.size < arenaReq.size)
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "The arena doesn't satisfy the planned requirements");
+        if (reinterpret_cast<uintptr_t>(arena.data) & (arenaReq.alignment - 1))
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "The arena is not properly aligned");
+
+        return WorkspaceMem{req, static_cast<char *>(arena.data) + offset, arena.ready};
+    }
+
+    std::vector<Item>     m_items;
+    WorkspaceRequirements m_arena{};
+    bool                  m_planned = false;
+};
+
+} // namespace cvcuda
+
+#endif // CVCUDA_WORKSPACE_PLANNER_HPP
@@ -52,4 +52,25 @@ void Histogram::operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::Op
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, mask, *outHistogram, stream));
 }
 
+void Histogram::operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef mask,
+                           const nvcv::Tensor &histogram, NVCVHistogramMode mode, const NVCVHistogramRange *ranges,
+                           int32_t numRanges) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (inData == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+
+    auto outHistogram = histogram.exportData<nvcv::TensorDataStridedCuda>();
+    if (outHistogram == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output must be cuda-accessible, pitch-linear tensor");
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, mask, *outHistogram, mode, ranges, numRanges, stream));
+}
+
 } // namespace cvcuda::priv
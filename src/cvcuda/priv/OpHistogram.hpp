@@ -41,6 +41,10 @@ public:
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef mask,
                     const nvcv::Tensor &histogram) const;
 
+    void operator()(cudaStream_t stream, const nvcv::Tensor &in, nvcv::OptionalTensorConstRef mask,
+                    const nvcv::Tensor &histogram, NVCVHistogramMode mode, const NVCVHistogramRange *ranges,
+                    int32_t numRanges) const;
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::Histogram> m_legacyOp;
 };
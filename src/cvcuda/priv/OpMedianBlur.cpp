@@ -17,6 +17,7 @@
 
 #include "OpMedianBlur.hpp"
 
+#include "WorkspaceAllocator.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -52,7 +53,17 @@ void MedianBlur::operator()(cudaStream_t stream, const nvcv::Tensor &in, const n
                               "Output must be cuda-accessible, pitch-linear tensor");
     }
 
-    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, ksize, stream));
+    constexpr size_t kHistBufferAlign = 256;
+
+    NVCVWorkspaceRequirements req{};
+    req.cudaMem = {m_legacyOp->histBufferSize(*inData, ksize), kHistBufferAlign};
+
+    // The allocator waits for the buffer on the stream and marks it ready after the legacy op, before it's released
+    ScopedWorkspace       histBuffer(m_histBuffers, req, stream);
+    WorkspaceMemAllocator cudaMem(histBuffer.get().cudaMem, stream);
+
+    void *histBufferData = req.cudaMem.size > 0 ? cudaMem.get<char>(req.cudaMem.size, kHistBufferAlign) : nullptr;
+    NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, ksize, histBufferData, stream));
 }
 
 void MedianBlur::operator()(cudaStream_t stream, const nvcv::ImageBatchVarShape &in,
@@ -25,6 +25,7 @@
 #define CVCUDA_PRIV_MEDIAN_BLUR_HPP
 
 #include "IOperator.hpp"
+#include "WorkspaceCache.hpp"
 #include "legacy/CvCudaLegacy.h"
 
 #include <nvcv/ImageBatch.hpp>
@@ -48,6 +49,9 @@ public:
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::MedianBlur>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::MedianBlurVarShape> m_legacyOpVarShape;
+
+    // Column histograms of large kernels, reused per stream so that concurrent calls don't share them
+    mutable WorkspaceCache m_histBuffers{nvcv::Allocator{}, 0};
 };
 
 } // namespace cvcuda::priv
@@ -17,6 +17,7 @@
 
 #include "OpMorphology.hpp"
 
+#include "WorkspaceAllocator.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -33,6 +34,24 @@ Morphology::Morphology()
     m_legacyOpVarShape = std::make_unique<legacy::MorphologyVarShape>();
 }
 
+void Morphology::inferTensor(cudaStream_t stream, const nvcv::TensorDataStridedCuda &in,
+                             const nvcv::TensorDataStridedCuda &out, NVCVMorphologyType morph_type,
+                             nvcv::Size2D mask_size, int2 anchor, bool noop, NVCVBorderType borderMode) const
+{
+    constexpr size_t kRowBufferAlign = 256;
+
+    NVCVWorkspaceRequirements req{};
+    req.cudaMem = {noop ? 0 : m_legacyOp->rowBufferSize(in, out, mask_size), kRowBufferAlign};
+
+    // The allocator waits for the buffer on the stream and marks it ready after the legacy op, before it's released
+    ScopedWorkspace       rowBuffer(m_rowBuffers, req, stream);
+    WorkspaceMemAllocator cudaMem(rowBuffer.get().cudaMem, stream);
+
+    void *rowBufferData = req.cudaMem.size > 0 ? cudaMem.get<char>(req.cudaMem.size, kRowBufferAlign) : nullptr;
+    NVCV_CHECK_THROW(
+        m_legacyOp->infer(in, out, morph_type, mask_size, anchor, noop, borderMode, rowBufferData, stream));
+}
+
 void Morphology::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
                             nvcv::OptionalTensorConstRef workspace, NVCVMorphologyType morph_type,
                             nvcv::Size2D mask_size, int2 anchor, int32_t iteration,
@@ -69,8 +88,8 @@ void Morphology::operator()(cudaStream_t stream, const nvcv::Tensor &in, const n
 
         if (workspace == nullptr)
         {
-            NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, morph_type, mask_size, anchor,
-                                               iteration == 0 ? true : false, borderMode, stream));
+            inferTensor(stream, *inData, *outData, morph_type, mask_size, anchor, iteration == 0 ? true : false,
+                        borderMode);
         }
         else
         {
@@ -84,15 +103,14 @@ void Morphology::operator()(cudaStream_t stream, const nvcv::Tensor &in, const n
             // pick for parity of iteration
             nvcv::TensorDataStridedCuda *in  = &(*inData);
             nvcv::TensorDataStridedCuda *out = (iteration % 2 == 1) ? &(*outData) : &(*workspaceData);
-            NVCV_CHECK_THROW(m_legacyOp->infer(*in, *out, morph_type, mask_size, anchor, false, borderMode, stream));
+            inferTensor(stream, *in, *out, morph_type, mask_size, anchor, false, borderMode);
 
             std::swap(in, out);
             out = (iteration % 2 == 0) ? &(*outData) : &(*workspaceData);
 
             for (int i = 1; i < iteration; ++i)
             {
-                NVCV_CHECK_THROW(
-                    m_legacyOp->infer(*in, *out, morph_type, mask_size, anchor, false, borderMode, stream));
+                inferTensor(stream, *in, *out, morph_type, mask_size, anchor, false, borderMode);
                 std::swap(in, out);
             }
         }
@@ -117,16 +135,14 @@ void Morphology::operator()(cudaStream_t stream, const nvcv::Tensor &in, const n
         auto workspaceData = workspace->get().exportData<nvcv::TensorDataStridedCuda>();
         NVCV_ASSERT(workspaceData);
 
-        NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *workspaceData, first, mask_size, anchor,
-                                           iteration == 0 ? true : false, borderMode, stream));
-        NVCV_CHECK_THROW(m_legacyOp->infer(*workspaceData, *outData, second, mask_size, anchor,
-                                           iteration == 0 ? true : false, borderMode, stream));
+        inferTensor(stream, *inData, *workspaceData, first, mask_size, anchor, iteration == 0 ? true : false,
+                    borderMode);
+        inferTensor(stream, *workspaceData, *outData, second, mask_size, anchor, iteration == 0 ? true : false,
+                    borderMode);
         for (int i = 1; i < iteration; ++i)
         {
-            NVCV_CHECK_THROW(
-                m_legacyOp->infer(*outData, *workspaceData, first, mask_size, anchor, false, borderMode, stream));
-            NVCV_CHECK_THROW(
-                m_legacyOp->infer(*workspaceData, *outData, second, mask_size, anchor, false, borderMode, stream));
+            inferTensor(stream, *outData, *workspaceData, first, mask_size, anchor, false, borderMode);
+            inferTensor(stream, *workspaceData, *outData, second, mask_size, anchor, false, borderMode);
         }
         break;
     }
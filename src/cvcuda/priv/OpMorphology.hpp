@@ -25,6 +25,7 @@
 #define CVCUDA_PRIV_MORPHOLOGY_HPP
 
 #include "IOperator.hpp"
+#include "WorkspaceCache.hpp"
 #include "legacy/CvCudaLegacy.h"
 
 #include <nvcv/ImageBatch.hpp>
@@ -51,6 +52,15 @@ public:
 protected:
     std::unique_ptr<nvcv::legacy::cuda_op::Morphology>         m_legacyOp;
     std::unique_ptr<nvcv::legacy::cuda_op::MorphologyVarShape> m_legacyOpVarShape;
+
+private:
+    // Runs one erode or dilate of the tensor path, with a row buffer for large masks from m_rowBuffers
+    void inferTensor(cudaStream_t stream, const nvcv::TensorDataStridedCuda &in, const nvcv::TensorDataStridedCuda &out,
+                     NVCVMorphologyType morph_type, nvcv::Size2D mask_size, int2 anchor, bool noop,
+                     NVCVBorderType borderMode) const;
+
+    // Row buffers of large masks, reused per stream so that concurrent calls don't share them
+    mutable WorkspaceCache m_rowBuffers{nvcv::Allocator{}, 0};
 };
 
 } // namespace cvcuda::priv
@@ -16,12 +16,14 @@
 **/
 
 #include "OpNonMaximumSuppression.hpp"
+#include "WorkspaceUtil.hpp"
 
 #include <cvcuda/cuda_tools/DropCast.hpp>
 #include <cvcuda/cuda_tools/MathOps.hpp>
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
 #include <cvcuda/cuda_tools/StaticCast.hpp>
 #include <cvcuda/cuda_tools/TensorWrap.hpp>
+#include <cvcuda/cuda_tools/TypeTraits.hpp>
 #include <nvcv/DataType.hpp>
 #include <nvcv/Exception.hpp>
 #include <nvcv/TensorData.hpp>
@@ -29,6 +31,8 @@
 #include <nvcv/util/CheckError.hpp>
 #include <nvcv/util/Math.hpp>
 
+#include <cub/cub.cuh>
+
 namespace cuda = nvcv::cuda;
 namespace util = nvcv::util;
 
@@ -132,6 +136,467 @@ inline __host__ void RunNonMaximumSuppresion(const nvcv::TensorDataStridedCuda &
     NonMaximumSuppression<<<grid, block, 0, stream>>>(inWrap, outWrap, scoresWrap, numBBoxes, scThresh, iouThresh);
 }
 
+// Top-K variant --------------------------------------------------------------
+//
+// Boxes below the score threshold are given a -inf key, then each sample is sorted by decreasing score (the radix
+// sort is stable, so ties keep the lower box index first) and only its leading candidates are visited.  Hard NMS
+// walks the sorted candidates in tiles of kTopKTile: a candidate is first checked against the boxes already kept,
+// then each candidate builds the bitmask of later tile candidates it overlaps, and a single thread resolves the
+// tile by clearing the masks of the surviving candidates in order.  Soft-NMS repeatedly selects the highest score
+// and decays the remaining scores in place.
+
+constexpr int kTopKTile  = 256;
+constexpr int kTopKWords = kTopKTile / 32;
+
+constexpr float kRemovedScore = -INFINITY; // marks discarded candidates
+
+__global__ void ThresholdScores(cuda::Tensor2DWrap<const float, int32_t> inScores, float *keys, int *values,
+                                int *offsets, int *counts, int numBBoxes, float scoreThreshold)
+{
+    const int bboxIdx  = blockDim.x * blockIdx.x + threadIdx.x;
+    const int batchIdx = blockIdx.z;
+
+    bool valid = false;
+
+    if (bboxIdx < numBBoxes)
+    {
+        const float score = inScores[int2{bboxIdx, batchIdx}];
+
+        valid = score >= scoreThreshold;
+
+        keys[batchIdx * numBBoxes + bboxIdx]   = valid ? score : kRemovedScore;
+        values[batchIdx * numBBoxes + bboxIdx] = bboxIdx;
+    }
+
+    const int numValid = __syncthreads_count(valid);
+
+    if (threadIdx.x == 0)
+    {
+        if (numValid > 0)
+        {
+            atomicAdd(&counts[batchIdx], numValid);
+        }
+        if (blockIdx.x == 0)
+        {
+            offsets[batchIdx] = batchIdx * numBBoxes;
+            if (batchIdx == static_cast<int>(gridDim.z) - 1)
+            {
+                offsets[batchIdx + 1] = (batchIdx + 1) * numBBoxes;
+            }
+        }
+    }
+}
+
+__global__ void SelectTopK(cuda::Tensor2DWrap<const short4, int32_t> inBBoxes,
+                           cuda::Tensor2DWrap<const int, int32_t> inClassIds, const float *sortedScores,
+                           const int *sortedIndices, const int *counts, short4 *keptBBoxes, int *keptClassIds,
+                           cuda::Tensor2DWrap<int, int32_t> outIndices, cuda::Tensor2DWrap<float, int32_t> outScores,
+                           cuda::Tensor1DWrap<int, int32_t> outCount, int numBBoxes, int maxOutputs,
+                           float iouThreshold)
+{
+    __shared__ short4   tileBBoxes[kTopKTile];
+    __shared__ int      tileClassIds[kTopKTile];
+    __shared__ uint32_t tileMasks[kTopKTile][kTopKWords];
+    __shared__ uint32_t tileAlive[kTopKWords];
+    __shared__ int      numKept;
+
+    const int batchIdx = blockIdx.x;
+    const int tid      = threadIdx.x;
+    const int numCands = counts[batchIdx];
+
+    const bool hasClassIds = inClassIds.ptr(0) != nullptr;
+    const bool hasScores   = outScores.ptr(0) != nullptr;
+
+    const float *candScores  = sortedScores + batchIdx * numBBoxes;
+    const int   *candIndices = sortedIndices + batchIdx * numBBoxes;
+
+    keptBBoxes += batchIdx * maxOutputs;
+    keptClassIds += batchIdx * maxOutputs;
+
+    if (tid == 0)
+    {
+        numKept = 0;
+    }
+    __syncthreads();
+
+    for (int tileStart = 0; tileStart < numCands && numKept < maxOutputs; tileStart += kTopKTile)
+    {
+        const int cand  = tileStart + tid;
+        bool      valid = cand < numCands;
+        int       bboxIdx{-1}, classId{0};
+        short4    bbox{};
+
+        if (valid)
+        {
+            bboxIdx = candIndices[cand];
+            bbox    = inBBoxes[int2{bboxIdx, batchIdx}];
+            classId = hasClassIds ? inClassIds[int2{bboxIdx, batchIdx}] : 0;
+
+            for (int k = 0; k < numKept; ++k)
+            {
+                if (keptClassIds[k] == classId && ComputeIoU(keptBBoxes[k], bbox) > iouThreshold)
+                {
+                    valid = false;
+                    break;
+                }
+            }
+        }
+
+        tileBBoxes[tid]   = bbox;
+        tileClassIds[tid] = classId;
+
+        const uint32_t ballot = __ballot_sync(0xFFFFFFFF, valid);
+        if (tid % 32 == 0)
+        {
+            tileAlive[tid / 32] = ballot;
+        }
+
+        __syncthreads();
+
+        // Bit j of word w is set when the (tid)-th candidate suppresses the (w * 32 + j)-th one
+        for (int w = 0; w < kTopKWords; ++w)
+        {
+            uint32_t mask = 0;
+            if (valid && w * 32 + 31 > tid)
+            {
+                for (int j = 0; j < 32; ++j)
+                {
+                    const int other = w * 32 + j;
+                    if (other > tid && tileClassIds[other] == classId
+                        && ComputeIoU(bbox, tileBBoxes[other]) > iouThreshold)
+                    {
+                        mask |= 1u << j;
+                    }
+                }
+            }
+            tileMasks[tid][w] = mask;
+        }
+
+        __syncthreads();
+
+        if (tid == 0)
+        {
+            int room = maxOutputs - numKept;
+            for (int i = 0; i < kTopKTile; ++i)
+            {
+                if (tileAlive[i / 32] & (1u << (i % 32)))
+                {
+                    if (room == 0)
+                    {
+                        tileAlive[i / 32] &= ~(1u << (i % 32));
+                        continue;
+                    }
+                    --room;
+                    for (int w = i / 32; w < kTopKWords; ++w)
+                    {
+                        tileAlive[w] &= ~tileMasks[i][w];
+                    }
+                }
+            }
+        }
+
+        __syncthreads();
+
+        if (tileAlive[tid / 32] & (1u << (tid % 32)))
+        {
+            int pos = numKept + __popc(tileAlive[tid / 32] & ((1u << (tid % 32)) - 1));
+            for (int w = 0; w < tid / 32; ++w)
+            {
+                pos += __popc(tileAlive[w]);
+            }
+
+            outIndices[int2{pos, batchIdx}] = bboxIdx;
+            if (hasScores)
+            {
+                outScores[int2{pos, batchIdx}] = candScores[cand];
+            }
+            keptBBoxes[pos]   = bbox;
+            keptClassIds[pos] = classId;
+        }
+
+        __syncthreads();
+
+        if (tid == 0)
+        {
+            for (int w = 0; w < kTopKWords; ++w)
+            {
+                numKept += __popc(tileAlive[w]);
+            }
+        }
+
+        __syncthreads();
+    }
+
+    for (int k = numKept + tid; k < maxOutputs; k += blockDim.x)
+    {
+        outIndices[int2{k, batchIdx}] = -1;
+        if (hasScores)
+        {
+            outScores[int2{k, batchIdx}] = 0.f;
+        }
+    }
+
+    if (tid == 0)
+    {
+        outCount[batchIdx] = numKept;
+    }
+}
+
+struct ScoredCandidate
+{
+    float score;
+    int   cand;
+};
+
+inline __device__ ScoredCandidate MaxScore(const ScoredCandidate &a, const ScoredCandidate &b)
+{
+    return (b.score > a.score || (b.score == a.score && b.cand < a.cand)) ? b : a;
+}
+
+__global__ void SoftSelectTopK(cuda::Tensor2DWrap<const short4, int32_t> inBBoxes,
+                               cuda::Tensor2DWrap<const int, int32_t> inClassIds, float *sortedScores,
+                               const int *sortedIndices, const int *counts, cuda::Tensor2DWrap<int, int32_t> outIndices,
+                               cuda::Tensor2DWrap<float, int32_t> outScores, cuda::Tensor1DWrap<int, int32_t> outCount,
+                               int numBBoxes, int maxOutputs,
+                               float scoreThreshold, float iouThreshold, NVCVNMSScoreDecay scoreDecay, float sigma)
+{
+    using BlockReduce = cub::BlockReduce<ScoredCandidate, kTopKTile>;
+
+    __shared__ typename BlockReduce::TempStorage cubTempStorage;
+    __shared__ int                               selected;
+
+    const int batchIdx = blockIdx.x;
+    const int tid      = threadIdx.x;
+    const int numCands = counts[batchIdx];
+
+    const bool hasClassIds = inClassIds.ptr(0) != nullptr;
+    const bool hasScores   = outScores.ptr(0) != nullptr;
+
+    float     *candScores  = sortedScores + batchIdx * numBBoxes;
+    const int *candIndices = sortedIndices + batchIdx * numBBoxes;
+
+    int numKept = 0;
+
+    for (; numKept < maxOutputs; ++numKept)
+    {
+        ScoredCandidate best{kRemovedScore, -1};
+        for (int cand = tid; cand < numCands; cand += kTopKTile)
+        {
+            if (candScores[cand] > best.score)
+            {
+                best = ScoredCandidate{candScores[cand], cand};
+            }
+        }
+
+        best = BlockReduce(cubTempStorage).Reduce(best, MaxScore);
+
+        if (tid == 0)
+        {
+            selected = best.score > kRemovedScore ? best.cand : -1;
+            if (selected >= 0)
+            {
+                outIndices[int2{numKept, batchIdx}] = candIndices[selected];
+                if (hasScores)
+                {
+                    outScores[int2{numKept, batchIdx}] = best.score;
+                }
+                candScores[selected] = kRemovedScore;
+            }
+        }
+
+        __syncthreads();
+
+        if (selected < 0)
+        {
+            break;
+        }
+
+        const short4 selBBox    = inBBoxes[int2{candIndices[selected], batchIdx}];
+        const int    selClassId = hasClassIds ? inClassIds[int2{candIndices[selected], batchIdx}] : 0;
+
+        for (int cand = tid; cand < numCands; cand += kTopKTile)
+        {
+            float score = candScores[cand];
+            if (score == kRemovedScore)
+            {
+                continue;
+            }
+
+            const int bboxIdx = candIndices[cand];
+            if (hasClassIds && inClassIds[int2{bboxIdx, batchIdx}] != selClassId)
+            {
+                continue;
+            }
+
+            const float iou = ComputeIoU(selBBox, inBBoxes[int2{bboxIdx, batchIdx}]);
+            if (scoreDecay == NVCV_NMS_SCORE_DECAY_LINEAR)
+            {
+                if (iou > iouThreshold)
+                {
+                    score *= 1.f - iou;
+                }
+            }
+            else
+            {
+                score *= cuda::exp(-iou * iou / sigma);
+            }
+
+            candScores[cand] = score >= scoreThreshold ? score : kRemovedScore;
+        }
+
+        __syncthreads();
+    }
+
+    for (int k = numKept + tid; k < maxOutputs; k += kTopKTile)
+    {
+        outIndices[int2{k, batchIdx}] = -1;
+        if (hasScores)
+        {
+            outScores[int2{k, batchIdx}] = 0.f;
+        }
+    }
+
+    if (tid == 0)
+    {
+        outCount[batchIdx] = numKept;
+    }
+}
+
+// Scratch memory of the top-K variant, each buffer aligned to kTopKWorkspaceAlign bytes
+constexpr size_t kTopKWorkspaceAlign = 256;
+
+struct TopKWorkspace
+{
+    float  *keys[2];
+    int    *values[2];
+    int    *offsets;
+    int    *counts;
+    short4 *keptBBoxes;
+    int    *keptClassIds;
+    void   *sortStorage;
+    size_t  sortStorageSize;
+};
+
+inline __host__ size_t SortStorageSize(int numSamples, int numBBoxes)
+{
+    size_t size     = 0;
+    int    numItems = numSamples * numBBoxes;
+    if (numSamples == 1)
+    {
+        NVCV_CHECK_THROW(cub::DeviceRadixSort::SortPairsDescending<float, int>(nullptr, size, nullptr, nullptr,
+                                                                               nullptr, nullptr, numItems));
+    }
+    else
+    {
+        NVCV_CHECK_THROW(cub::DeviceSegmentedRadixSort::SortPairsDescending<float, int>(
+            nullptr, size, nullptr, nullptr, nullptr, nullptr, numItems, numSamples, static_cast<const int *>(nullptr),
+            static_cast<const int *>(nullptr)));
+    }
+    return size;
+}
+
+inline __host__ TopKWorkspace LayoutWorkspace(void *base, int numSamples, int numBBoxes, int maxOutputs,
+                                              size_t *totalSize)
+{
+    constexpr size_t kAlign = kTopKWorkspaceAlign;
+
+    size_t numItems = static_cast<size_t>(numSamples) * numBBoxes;
+    size_t numKept  = static_cast<size_t>(numSamples) * maxOutputs;
+    size_t offset   = 0;
+
+    auto take = [&](size_t bytes)
+    {
+        void *ptr = base ? static_cast<char *>(base) + offset : nullptr;
+        offset    = util::RoundUp(offset + bytes, kAlign);
+        return ptr;
+    };
+
+    TopKWorkspace ws;
+    ws.keys[0]         = static_cast<float *>(take(numItems * sizeof(float)));
+    ws.keys[1]         = static_cast<float *>(take(numItems * sizeof(float)));
+    ws.values[0]       = static_cast<int *>(take(numItems * sizeof(int)));
+    ws.values[1]       = static_cast<int *>(take(numItems * sizeof(int)));
+    ws.offsets         = static_cast<int *>(take((numSamples + 1) * sizeof(int)));
+    ws.counts          = static_cast<int *>(take(numSamples * sizeof(int)));
+    ws.keptBBoxes      = static_cast<short4 *>(take(numKept * sizeof(short4)));
+    ws.keptClassIds    = static_cast<int *>(take(numKept * sizeof(int)));
+    ws.sortStorageSize = SortStorageSize(numSamples, numBBoxes);
+    ws.sortStorage     = take(ws.sortStorageSize);
+
+    *totalSize = offset;
+    return ws;
+}
+
+inline __host__ void RunNonMaximumSuppressionTopK(const TopKWorkspace &ws, const nvcv::TensorDataStridedCuda &in,
+                                                  const nvcv::TensorDataStridedCuda               &scores,
+                                                  const nvcv::Optional<nvcv::TensorDataStridedCuda> &classIds,
+                                                  const nvcv::TensorDataStridedCuda                 &outIndices,
+                                                  const nvcv::Optional<nvcv::TensorDataStridedCuda> &outScores,
+                                                  const nvcv::TensorDataStridedCuda &outCount, float scThresh,
+                                                  float iouThresh, NVCVNMSScoreDecay scoreDecay, float sigma,
+                                                  cudaStream_t stream)
+{
+    cuda::Tensor2DWrap<const short4, int32_t> inWrap(in);
+    cuda::Tensor2DWrap<const float, int32_t>  scoresWrap(scores);
+    cuda::Tensor2DWrap<const int, int32_t>    classIdsWrap;
+    cuda::Tensor2DWrap<int, int32_t>          outIndicesWrap(outIndices);
+    cuda::Tensor2DWrap<float, int32_t>        outScoresWrap;
+    cuda::Tensor1DWrap<int, int32_t>          outCountWrap(outCount);
+
+    if (classIds)
+    {
+        classIdsWrap = cuda::Tensor2DWrap<const int, int32_t>(*classIds);
+    }
+    if (outScores)
+    {
+        outScoresWrap = cuda::Tensor2DWrap<float, int32_t>(*outScores);
+    }
+
+    int numSamples = in.shape(0);
+    int numBBoxes  = in.shape(1);
+    int maxOutputs = outIndices.shape(1);
+    int numItems   = numSamples * numBBoxes;
+
+    NVCV_CHECK_THROW(cudaMemsetAsync(ws.counts, 0, numSamples * sizeof(int), stream));
+
+    dim3 block(256, 1, 1);
+    dim3 grid(util::DivUp(numBBoxes, block.x), 1, numSamples);
+
+    ThresholdScores<<<grid, block, 0, stream>>>(scoresWrap, ws.keys[0], ws.values[0], ws.offsets, ws.counts,
+                                                numBBoxes, scThresh);
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    size_t sortStorageSize = ws.sortStorageSize;
+    if (numSamples == 1)
+    {
+        NVCV_CHECK_THROW(cub::DeviceRadixSort::SortPairsDescending(ws.sortStorage, sortStorageSize, ws.keys[0],
+                                                                   ws.keys[1], ws.values[0], ws.values[1], numItems,
+                                                                   0, sizeof(float) * 8, stream));
+    }
+    else
+    {
+        NVCV_CHECK_THROW(cub::DeviceSegmentedRadixSort::SortPairsDescending(
+            ws.sortStorage, sortStorageSize, ws.keys[0], ws.keys[1], ws.values[0], ws.values[1], numItems, numSamples,
+            ws.offsets, ws.offsets + 1, 0, sizeof(float) * 8, stream));
+    }
+
+    if (scoreDecay == NVCV_NMS_SCORE_DECAY_NONE)
+    {
+        SelectTopK<<<numSamples, kTopKTile, 0, stream>>>(inWrap, classIdsWrap, ws.keys[1], ws.values[1], ws.counts,
+                                                         ws.keptBBoxes, ws.keptClassIds, outIndicesWrap,
+                                                         outScoresWrap, outCountWrap, numBBoxes, maxOutputs,
+                                                         iouThresh);
+    }
+    else
+    {
+        SoftSelectTopK<<<numSamples, kTopKTile, 0, stream>>>(inWrap, classIdsWrap, ws.keys[1], ws.values[1],
+                                                             ws.counts, outIndicesWrap, outScoresWrap, outCountWrap,
+                                                             numBBoxes, maxOutputs, scThresh, iouThresh, scoreDecay,
+                                                             sigma);
+    }
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
 } // namespace
 
 // =============================================================================
@@ -204,4 +669,155 @@ void NonMaximumSuppression::operator()(cudaStream_t stream, const nvcv::Tensor &
     RunNonMaximumSuppresion(*inData, *outData, *scoreData, scoreThreshold, iouThreshold, stream);
 }
 
+// Checks a [N, W] or [N, W, 1] tensor, returning its data
+static nvcv::TensorDataStridedCuda CheckPerBBoxTensor(const nvcv::Tensor &tensor, nvcv::DataType dtype,
+                                                      const char *name)
+{
+    auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+    if (!data)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "%s must be cuda-accessible, pitch-linear tensor",
+                              name);
+    }
+    if (!((data->rank() == 3 && data->dtype() == dtype && data->shape(2) == 1)
+          || (data->rank() == 2 && data->dtype() == dtype)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "%s tensor must have rank 2 or 3 and %s data type",
+                              name, nvcvDataTypeGetName(dtype));
+    }
+    return *data;
+}
+
+WorkspaceRequirements NonMaximumSuppression::getWorkspaceRequirements(int numSamples, int numBBoxes,
+                                                                      int maxOutputs) const
+{
+    if (numSamples < 0 || numBBoxes < 0 || maxOutputs < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Number of samples, boxes and outputs must not be negative");
+    }
+    if (static_cast<int64_t>(numSamples) * numBBoxes > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Too many boxes in total, %ld, must be smaller than or equal to %d",
+                              static_cast<int64_t>(numSamples) * numBBoxes, cuda::TypeTraits<int32_t>::max);
+    }
+
+    size_t size = 0;
+    LayoutWorkspace(nullptr, numSamples, numBBoxes, maxOutputs, &size);
+
+    cvcuda::WorkspaceEstimator est;
+    est.addCuda<char>(size, kTopKWorkspaceAlign);
+
+    cvcuda::WorkspaceRequirements req{};
+    req.hostMem   = est.hostMem.req;
+    req.pinnedMem = est.pinnedMem.req;
+    req.cudaMem   = est.cudaMem.req;
+
+    // The allocator requires the total size of the allocation to be aligned
+    cvcuda::AlignUp(req);
+    return req;
+}
+
+void NonMaximumSuppression::operator()(cudaStream_t stream, const Workspace &ws, const nvcv::Tensor &in,
+                                       const nvcv::Tensor &scores, const nvcv::Tensor &classIds,
+                                       const nvcv::Tensor &outIndices, const nvcv::Tensor &outScores,
+                                       const nvcv::Tensor &outCount, float scoreThreshold, float iouThreshold,
+                                       NVCVNMSScoreDecay scoreDecay, float sigma) const
+{
+    auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
+    if (!inData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input must be cuda-accessible, pitch-linear tensor");
+    }
+    if (!((inData->rank() == 3 && inData->dtype() == nvcv::TYPE_S16 && inData->shape(2) == 4)
+          || (inData->rank() == 3 && inData->dtype() == nvcv::TYPE_4S16 && inData->shape(2) == 1)
+          || (inData->rank() == 2 && inData->dtype() == nvcv::TYPE_4S16)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input tensor must have rank 2 or 3 and 4xS16 or 4S16 data type");
+    }
+
+    auto scoreData   = CheckPerBBoxTensor(scores, nvcv::TYPE_F32, "Scores");
+    auto indicesData = CheckPerBBoxTensor(outIndices, nvcv::TYPE_S32, "Output indices");
+
+    nvcv::Optional<nvcv::TensorDataStridedCuda> classIdsData, outScoresData;
+    if (classIds)
+    {
+        classIdsData = CheckPerBBoxTensor(classIds, nvcv::TYPE_S32, "Class ids");
+    }
+    if (outScores)
+    {
+        outScoresData = CheckPerBBoxTensor(outScores, nvcv::TYPE_F32, "Output scores");
+    }
+
+    auto countData = outCount.exportData<nvcv::TensorDataStridedCuda>();
+    if (!countData)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output count must be cuda-accessible, pitch-linear tensor");
+    }
+    if (!((countData->rank() == 2 && countData->dtype() == nvcv::TYPE_S32 && countData->shape(1) == 1)
+          || (countData->rank() == 1 && countData->dtype() == nvcv::TYPE_S32)))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output count tensor must have rank 1 or 2 and S32 data type");
+    }
+
+    int64_t numSamples = inData->shape(0);
+    int64_t numBBoxes  = inData->shape(1);
+
+    if (scoreData.shape(0) != numSamples || indicesData.shape(0) != numSamples || countData->shape(0) != numSamples
+        || (classIdsData && classIdsData->shape(0) != numSamples)
+        || (outScoresData && outScoresData->shape(0) != numSamples))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input, scores, class ids and outputs number of batches (first shape) must be equal");
+    }
+    if (scoreData.shape(1) != numBBoxes || (classIdsData && classIdsData->shape(1) != numBBoxes))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Input, scores and class ids number of boxes (second shape) must be equal");
+    }
+    if (outScoresData && outScoresData->shape(1) != indicesData.shape(1))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Output indices and scores number of boxes (second shape) must be equal");
+    }
+    if (numSamples * numBBoxes > cuda::TypeTraits<int32_t>::max)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Too many boxes in total, %ld, must be smaller than or equal to %d",
+                              numSamples * numBBoxes, cuda::TypeTraits<int32_t>::max);
+    }
+
+    if (scoreDecay != NVCV_NMS_SCORE_DECAY_NONE && scoreDecay != NVCV_NMS_SCORE_DECAY_LINEAR
+        && scoreDecay != NVCV_NMS_SCORE_DECAY_GAUSSIAN)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid score decay %d",
+                              static_cast<int>(scoreDecay));
+    }
+    if (scoreDecay != NVCV_NMS_SCORE_DECAY_GAUSSIAN && (iouThreshold <= 0.f || iouThreshold > 1.f))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "IoU threshold must be in (0, 1]");
+    }
+    if (scoreDecay == NVCV_NMS_SCORE_DECAY_GAUSSIAN && !(sigma > 0.f))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Gaussian decay sigma must be positive");
+    }
+
+    // Waits for the workspace to be ready on the stream, and marks it ready again after the last use
+    cvcuda::WorkspaceMemAllocator cudaMem(ws.cudaMem, stream);
+
+    size_t workspaceSize = 0;
+    LayoutWorkspace(nullptr, numSamples, numBBoxes, indicesData.shape(1), &workspaceSize);
+    void *base = cudaMem.get<char>(workspaceSize, kTopKWorkspaceAlign);
+
+    TopKWorkspace topK = LayoutWorkspace(base, numSamples, numBBoxes, indicesData.shape(1), &workspaceSize);
+
+    RunNonMaximumSuppressionTopK(topK, *inData, scoreData, classIdsData, indicesData, outScoresData, *countData,
+                                 scoreThreshold, iouThreshold, scoreDecay, sigma, stream);
+}
+
 } // namespace cvcuda::priv
@@ -27,8 +27,12 @@
 #include "IOperator.hpp"
 
 #include <cuda_runtime.h>
+#include <cvcuda/OpNonMaximumSuppression.h>
+#include <cvcuda/Workspace.hpp>
 #include <nvcv/Tensor.hpp>
 
+#include <cstddef>
+
 namespace cvcuda::priv {
 
 class NonMaximumSuppression : public IOperator
@@ -58,6 +62,51 @@ public:
      */
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out, const nvcv::Tensor &scores,
                     float scoreThreshold, float iouThreshold) const;
+
+    /**
+     * @brief Computes the workspace needed by the top-K variant.
+     *
+     * @param numSamples Number of samples in the batch
+     *
+     * @param numBBoxes Number of bounding box proposals per sample
+     *
+     * @param maxOutputs Number of bounding boxes selected per sample, K
+     */
+    WorkspaceRequirements getWorkspaceRequirements(int numSamples, int numBBoxes, int maxOutputs) const;
+
+    /**
+     * @brief Selects up to K bounding boxes per sample, by decreasing score, after score thresholding and sorting.
+     *
+     * @param ws Workspace of at least the size given by getWorkspaceRequirements
+     *
+     * @param in GPU tensor of bounding box proposals, as above
+     *
+     * @param scores GPU tensor, scores[i, j] is the score of bounding box j of sample i
+     *
+     * @param classIds Optional GPU tensor, classIds[i, j] is the class of bounding box j of sample i, boxes of
+     *                 different classes do not suppress each other
+     *
+     * @param outIndices GPU tensor, outIndices[i, k] is the index of the k-th selected bounding box of sample i,
+     *                   -1 past the selected ones; K is its second shape
+     *
+     * @param outScores Optional GPU tensor, outScores[i, k] is the (decayed) score of the k-th selected box
+     *
+     * @param outCount GPU tensor, outCount[i] is the number of bounding boxes selected for sample i
+     *
+     * @param scoreThreshold Minimum score of a bounding box proposals, also applied after Soft-NMS decay
+     *
+     * @param iouThreshold Overlap above which a selected box suppresses (or linearly decays) another one
+     *
+     * @param scoreDecay Hard suppression or one of the Soft-NMS decays
+     *
+     * @param sigma Parameter of the gaussian decay
+     *
+     * @param stream for the asynchronous execution.
+     */
+    void operator()(cudaStream_t stream, const Workspace &ws, const nvcv::Tensor &in, const nvcv::Tensor &scores,
+                    const nvcv::Tensor &classIds, const nvcv::Tensor &outIndices, const nvcv::Tensor &outScores,
+                    const nvcv::Tensor &outCount, float scoreThreshold, float iouThreshold,
+                    NVCVNMSScoreDecay scoreDecay, float sigma) const;
 };
 
 } // namespace cvcuda::priv
@@ -27,10 +27,17 @@ namespace cvcuda::priv {
 
 namespace legacy = nvcv::legacy::cuda_op;
 
-OSD::OSD()
+OSD::OSD(const NVCVOSDParams *params)
 {
+    int numRasterThreads = params ? params->numRasterThreads : 0;
+    if (numRasterThreads < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid numRasterThreads %d is negative",
+                              numRasterThreads);
+    }
+
     legacy::DataShape maxIn, maxOut; //maxIn/maxOut not used by op.
-    m_legacyOp = std::make_unique<legacy::OSD>(maxIn, maxOut);
+    m_legacyOp = std::make_unique<legacy::OSD>(maxIn, maxOut, numRasterThreads);
 }
 
 void OSD::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
@@ -53,4 +60,18 @@ void OSD::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Te
     NVCV_CHECK_THROW(m_legacyOp->infer(*inData, *outData, elements, stream));
 }
 
+void OSD::prewarm(cudaStream_t stream, const char *utf8Text, const char *fontName, int32_t fontSize)
+{
+    if (utf8Text == nullptr || fontName == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Text and font name must not be NULL");
+    }
+    if (fontSize <= 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid font size %d must be positive", fontSize);
+    }
+
+    NVCV_CHECK_THROW(m_legacyOp->prewarm(utf8Text, fontName, fontSize, stream));
+}
+
 } // namespace cvcuda::priv
@@ -36,11 +36,13 @@ namespace cvcuda::priv {
 class OSD final : public IOperator
 {
 public:
-    explicit OSD();
+    explicit OSD(const NVCVOSDParams *params = nullptr);
 
     void operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
                     const NVCVElements &elements) const;
 
+    void prewarm(cudaStream_t stream, const char *utf8Text, const char *fontName, int32_t fontSize);
+
 private:
     std::unique_ptr<nvcv::legacy::cuda_op::OSD> m_legacyOp;
 };
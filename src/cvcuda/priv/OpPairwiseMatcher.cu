@@ -17,6 +17,7 @@
 
 #include "Assert.h"
 #include "OpPairwiseMatcher.hpp"
+#include "WorkspaceUtil.hpp"
 
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
 #include <cvcuda/cuda_tools/TensorWrap.hpp>
@@ -27,7 +28,12 @@
 
 #include <cub/cub.cuh>
 
+#include <algorithm>
+#include <bitset>
+#include <numeric>
+#include <random>
 #include <sstream>
+#include <vector>
 
 namespace {
 
@@ -40,6 +46,21 @@ constexpr int kIntMax = cuda::TypeTraits<int>::max; // maximum number represente
 
 constexpr int kNumThreads = 64; // number of threads per block
 
+constexpr int      kWarpSize      = 32;        // number of threads per warp
+constexpr unsigned kFullMask      = 0xffffffff; // mask of all threads in a warp
+constexpr int      kBuildThreads  = 256;       // number of threads per block to build the index of approximate matchers
+constexpr int      kMaxTables     = 32;        // maximum number of LSH hash tables
+constexpr int      kMaxHashBits   = 16;        // maximum number of bits in a LSH key
+constexpr int      kMaxLists      = 4096;      // maximum number of IVF lists
+constexpr int      kMaxProbes     = 256;       // maximum number of IVF lists probed per point
+constexpr int      kNumIterations = 8;         // number of k-means iterations to cluster IVF lists
+constexpr int      kTrainPerList  = 64;        // k-means is trained on up to this number of points per IVF list
+
+constexpr int kDefaultNumTables   = 8;   // default number of LSH hash tables
+constexpr int kDefaultNumHashBits = 14;  // default number of bits in a LSH key
+constexpr int kDefaultNumLists    = 256; // default number of IVF lists
+constexpr int kDefaultIvfProbes   = 16;  // default number of IVF lists probed per point
+
 // Key value pair type used in CUB (CUDA Unbound) sort and reduce-min operations
 // The idea is to sort or get the minimum by distance (dist) and then by index (idx)
 struct KeyValueT
@@ -172,48 +193,35 @@ inline __device__ void ComputeDistance(float &distance, const T &e1, const T &e2
     }
 }
 
-// Sort pairs of (distance, index) one per thread from a fixed point p1 to all points p2 in set2 with numDim
-// dimensions, each point is an array with numDim elements of source type ST, each set is an array of points, and
-// the tensor is an array of sets where the sampleIdx selects the current set within it with set2Size points
-template<NVCVNormType NORM, class Point, class SetWrapper>
-inline __device__ void SortKeyValue(float &sortedDist, int &sortedIdx, const Point &p1, const SetWrapper &set2,
-                                    int numDim, int matchesPerPoint, int sampleIdx, int set2Size)
+// Distance between n-dimensional points p1 and p2 with numDim dimensions, the square-root of L2 is postponed
+template<NVCVNormType NORM, class Point>
+inline __device__ float PointDistance(const Point &p1, const Point &p2, int numDim)
 {
-    sortedDist = cuda::TypeTraits<float>::max;
-    sortedIdx  = -1;
-
-    float curDist;
-    Point p2;
+    float distance = 0.f;
 
-    for (int set2Idx = threadIdx.x; set2Idx < set2Size; set2Idx += kNumThreads)
+    if constexpr (Point::kMaxSize > 0)
     {
-        p2.load(set2, sampleIdx, set2Idx, numDim);
-
-        curDist = 0.f;
-
-        if constexpr (Point::kMaxSize > 0)
-        {
 #pragma unroll
-            for (int i = 0; i < Point::kMaxDims && i < numDim; ++i)
-            {
-                ComputeDistance<NORM>(curDist, p1[i], p2[i]);
-            }
-        }
-        else
+        for (int i = 0; i < Point::kMaxDims && i < numDim; ++i)
         {
-            for (int i = 0; i < numDim; ++i)
-            {
-                ComputeDistance<NORM>(curDist, p1[i], p2[i]);
-            }
+            ComputeDistance<NORM>(distance, p1[i], p2[i]);
         }
-
-        if (curDist < sortedDist)
+    }
+    else
+    {
+        for (int i = 0; i < numDim; ++i)
         {
-            sortedDist = curDist;
-            sortedIdx  = set2Idx;
+            ComputeDistance<NORM>(distance, p1[i], p2[i]);
         }
     }
 
+    return distance;
+}
+
+// Select the top-N pairs of (distance, index) among the pairs of all threads, N = matchesPerPoint, the i-th best
+// pair being returned in the i-th thread
+inline __device__ void SelectTopN(float &sortedDist, int &sortedIdx, int matchesPerPoint)
+{
     __syncthreads(); // wait for all the threads to complete their local sorted (distance, index) pair
 
     if (matchesPerPoint == 1) // fast path for top-1 sort is reduce minimum
@@ -251,6 +259,35 @@ inline __device__ void SortKeyValue(float &sortedDist, int &sortedIdx, const Poi
     }
 }
 
+// Sort pairs of (distance, index) one per thread from a fixed point p1 to all points p2 in set2 with numDim
+// dimensions, each point is an array with numDim elements of source type ST, each set is an array of points, and
+// the tensor is an array of sets where the sampleIdx selects the current set within it with set2Size points
+template<NVCVNormType NORM, class Point, class SetWrapper>
+inline __device__ void SortKeyValue(float &sortedDist, int &sortedIdx, const Point &p1, const SetWrapper &set2,
+                                    int numDim, int matchesPerPoint, int sampleIdx, int set2Size)
+{
+    sortedDist = cuda::TypeTraits<float>::max;
+    sortedIdx  = -1;
+
+    float curDist;
+    Point p2;
+
+    for (int set2Idx = threadIdx.x; set2Idx < set2Size; set2Idx += kNumThreads)
+    {
+        p2.load(set2, sampleIdx, set2Idx, numDim);
+
+        curDist = PointDistance<NORM>(p1, p2, numDim);
+
+        if (curDist < sortedDist)
+        {
+            sortedDist = curDist;
+            sortedIdx  = set2Idx;
+        }
+    }
+
+    SelectTopN(sortedDist, sortedIdx, matchesPerPoint);
+}
+
 // Write a match of (set1Idx, set2Idx) with (distance) found at matchIdx inside output matches and distances
 template<NVCVNormType NORM>
 inline __device__ void WriteMatch(int matchIdx, int set1Idx, int set2Idx, int sampleIdx, float &distance,
@@ -363,202 +400,1033 @@ __global__ void WriteNumMatches(cuda::Tensor1DWrap<const int> numSet1, cuda::Ten
     numMatches[sampleIdx] = set1Size * matchesPerPoint;
 }
 
-// Run functions ---------------------------------------------------------------
+// Approximate matchers: the index of set2 is built by hashing (LSH) or clustering (IVF) its points, assigning each
+// point a key per table (IVF has a single table), then grouping the points by key with a counting sort, where a
+// key is a bucket (LSH) or a list (IVF); a point in set1 is then compared only to the points in some of the buckets
+// (or lists) of set2, the ones more likely to hold its best matches, instead of to all points as in brute force
 
-// Run brute-force matcher, using NORM type for distance calculations and SrcT is the input source data type
-template<NVCVNormType NORM, typename SrcT>
-inline void RunBruteForceMatcherForNorm(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
-                                        const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2,
-                                        const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
-                                        const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint)
+// Index of set2 of the approximate matchers, each buffer laid out in the operator index buffer by LayoutIndex
+struct IndexLayout
 {
-    cuda::Tensor3DWrap<const SrcT>    w_set1, w_set2; // tensor wraps of set1 and set2 and other tensors
-    cuda::Tensor1DWrap<const int32_t> w_numSet1, w_numSet2;
-    cuda::Tensor3DWrap<int32_t>       w_matches;
-    cuda::Tensor1DWrap<int32_t>       w_numMatches;
-    cuda::Tensor2DWrap<float>         w_distances;
+    int   *bitPos;          // LSH: positions of the point bits sampled in the key of each table
+    int   *probeMasks;      // LSH: masks XOR-ed with a key to get the probed buckets, by increasing bits set
+    int   *probeRanks;      // LSH: position of each mask in probeMasks, or numProbes when it is not probed
+    float *centers;         // IVF: center of each list
+    float *sums;            // IVF: sum of the points of each list while clustering
+    int   *keys;            // bucket (LSH) or list (IVF) of each point of set2 in each table
+    int   *counts;          // number of points in each bucket or list, zero after the counting sort
+    int   *offsets;         // start of each bucket or list in entries
+    int   *entries;         // indices of the points of set2 grouped by bucket or list
+    void  *scanStorage;     // temporary storage of the exclusive sum of counts
+    size_t scanStorageSize; // size in bytes of the scan storage
+    int    numTables;       // number of hash tables, 1 for IVF
+    int    numBuckets;      // number of buckets per table (LSH) or lists (IVF)
+    int    numHashBits;     // number of bits in a LSH key
+    int    numProbes;       // number of buckets per table (LSH) or lists (IVF) probed per point
+    int    set2Capacity;    // set capacity is the maximum allowed number of points in set2
+};
 
-#define CVCUDA_BFM_WRAP(TENSOR)                                                                                     \
-    if (TENSOR)                                                                                                     \
-    {                                                                                                               \
-        auto data = TENSOR.exportData<nvcv::TensorDataStridedCuda>();                                               \
-        if (!data)                                                                                                  \
-        {                                                                                                           \
-            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, #TENSOR " tensor must be cuda-accessible"); \
-        }                                                                                                           \
-        w_##TENSOR = decltype(w_##TENSOR)(*data);                                                                   \
+// Get the number of valid points in a set of a sample, stored in numSet if not null, up to the set capacity
+inline __device__ int GetSetSize(cuda::Tensor1DWrap<const int> numSet, int sampleIdx, int setCapacity)
+{
+    int setSize = setCapacity;
+
+    if (numSet.ptr(0) != nullptr)
+    {
+        setSize = numSet[sampleIdx];
+        setSize = setSize > setCapacity ? setCapacity : (setSize < 0 ? 0 : setSize);
     }
 
-    CVCUDA_BFM_WRAP(set1);
-    CVCUDA_BFM_WRAP(set2);
+    return setSize;
+}
 
-    CVCUDA_BFM_WRAP(numSet1);
-    CVCUDA_BFM_WRAP(numSet2);
+// Hash a point of a set to its LSH key, the concatenation of numHashBits bits sampled at bitPos from the point
+// bits, the bits of a point being the bits of its elements of type ST from first to last
+template<typename ST>
+inline __device__ int HashPoint(cuda::Tensor3DWrap<ST> set, int sampleIdx, int setIdx, const int *bitPos,
+                                int numHashBits)
+{
+    constexpr int kElemBits = sizeof(ST) * 8;
 
-    CVCUDA_BFM_WRAP(matches);
-    CVCUDA_BFM_WRAP(numMatches);
+    int key = 0;
 
-    CVCUDA_BFM_WRAP(distances);
+    for (int i = 0; i < numHashBits; ++i)
+    {
+        int bit = bitPos[i];
 
-#undef CVCUDA_BFM_WRAP
+        key |= static_cast<int>((*set.ptr(sampleIdx, setIdx, bit / kElemBits) >> (bit % kElemBits)) & 1) << i;
+    }
 
-    int numSamples   = set1.shape()[0];            // number of samples, where each sample is a set of points
-    int set1Capacity = set1.shape()[1];            // set capacity is the maximum allowed number of points in set1
-    int set2Capacity = set2.shape()[1];            // set capacity is the maximum allowed number of points in set2
-    int numDim       = set1.shape()[2];            // number of dimensions of each n-dimensional point in set1 and set2
-    int outCapacity  = matches.shape()[1];         // output capacity to store matches and distances
-    int minStride    = getMinStride<SrcT>(numDim); // minimum stride in sets to allow the usage of PointT class
+    return key;
+}
 
-    dim3 threads(kNumThreads, 1, 1);
-    dim3 blocks1(numSamples, 1, 1);
-    dim3 blocks2(numSamples, set1Capacity, 1);
+// Squared L2 distance between a n-dimensional point p and the center of an IVF list, used to probe the lists
+template<class Point>
+inline __device__ float CenterDistance(const Point &p, const float *center, int numDim)
+{
+    float distance = 0.f;
 
-    if (crossCheck)
+    if constexpr (Point::kMaxSize > 0)
     {
-        // Cross check returns a varying number of matches, as a match is only valid if it is the best (closest)
-        // match from set1 to set2 and back from set2 to set1, the numMatches output starts at zero and is
-        // atomically incremented in the BruteForceMatcher kernel
+#pragma unroll
+        for (int i = 0; i < Point::kMaxDims && i < numDim; ++i)
+        {
+            float d = p[i] - center[i];
 
-        NVCV_CHECK_THROW(cudaMemsetAsync(w_numMatches.ptr(0), 0, sizeof(int32_t) * numSamples, stream));
+            distance = fma(d, d, distance);
+        }
     }
     else
     {
-        // Without cross check has a fixed number of matches equal to the set1 size, meaning for every point in
-        // set1 there is (are) one (or more) matche(s) (up to matchesPerPoint) in set2
-
-        if (numMatches)
+        for (int i = 0; i < numDim; ++i)
         {
-            WriteNumMatches<<<blocks1, threads, 0, stream>>>(w_numSet1, w_numMatches, set1Capacity, matchesPerPoint);
+            float d = p[i] - center[i];
+
+            distance = fma(d, d, distance);
         }
     }
 
-    // Cache-based kernel specialization: numDim and SrcT must fit a cache in PointT class; it works for 32B and
-    // 128B descriptors, such as ORB and SIFT.  Even though it has 256 bytes spill loads/stores for NB = 128, it
-    // still gives almost 2x performance benefit.
-
-    // TODO: The caveat of below kernel specializations is that it takes time to compile (~30sec) and it does not
-    //       cover points bigger than 128B in size, incurring in low performance for big points.  It may be better
-    //       to use shared memory for those big points, given a certain maximum point dimension, and use threads to
-    //       compute per element results instead of per point.
+    return distance;
+}
 
-#define CVCUDA_BFM_RUN(NB)                                                                                      \
-    BruteForceMatcher<NB, NORM><<<blocks2, threads, 0, stream>>>(                                               \
-        w_set1, w_set2, w_numSet1, w_numSet2, w_matches, w_numMatches, w_distances, set1Capacity, set2Capacity, \
-        outCapacity, numDim, crossCheck, matchesPerPoint);                                                      \
-    return
+// Get the IVF list with nearest center (by L2 distance) to a point of set2, computed by all threads in a warp
+template<typename ST>
+inline __device__ int NearestList(cuda::Tensor3DWrap<ST> set2, int sampleIdx, int set2Idx, const float *centers,
+                                  int numDim, int numLists)
+{
+    int   lane    = threadIdx.x % kWarpSize;
+    int   nearest = 0;
+    float minDist = cuda::TypeTraits<float>::max;
 
-    if (w_set1.strides()[1] >= minStride && w_set2.strides()[1] >= minStride)
+    for (int listIdx = 0; listIdx < numLists; ++listIdx)
     {
-        if (isCompatible<SrcT, 32>(numDim))
+        const float *center = centers + (int64_t)listIdx * numDim;
+
+        float dist = 0.f;
+
+        for (int i = lane; i < numDim; i += kWarpSize)
         {
-            CVCUDA_BFM_RUN(32);
+            float d = static_cast<float>(*set2.ptr(sampleIdx, set2Idx, i)) - center[i];
+
+            dist = fma(d, d, dist);
         }
-        else if (isCompatible<SrcT, 128>(numDim))
+        for (int offset = kWarpSize / 2; offset > 0; offset /= 2)
         {
-            CVCUDA_BFM_RUN(128);
+            dist += __shfl_down_sync(kFullMask, dist, offset);
+        }
+
+        dist = __shfl_sync(kFullMask, dist, 0); // all lanes take the first lane sum to agree on the nearest list
+
+        if (dist < minDist)
+        {
+            minDist = dist;
+            nearest = listIdx;
         }
     }
 
-    CVCUDA_BFM_RUN(0);
+    return nearest;
+}
 
-#undef CVCUDA_BFM_RUN
+// Hash each valid point of set2 in each LSH table, storing its key in keys laid out as [sample][table][point]
+template<typename ST>
+__global__ void HashPoints(cuda::Tensor3DWrap<ST> set2, cuda::Tensor1DWrap<const int> numSet2, IndexLayout index)
+{
+    int set2Idx   = blockIdx.x * blockDim.x + threadIdx.x;
+    int tableIdx  = blockIdx.y;
+    int sampleIdx = blockIdx.z;
+
+    if (set2Idx >= GetSetSize(numSet2, sampleIdx, index.set2Capacity))
+    {
+        return;
+    }
+
+    int64_t keyIdx = ((int64_t)sampleIdx * index.numTables + tableIdx) * index.set2Capacity + set2Idx;
+
+    index.keys[keyIdx]
+        = HashPoint<ST>(set2, sampleIdx, set2Idx, index.bitPos + tableIdx * index.numHashBits, index.numHashBits);
 }
 
-template<typename SrcT>
-inline void RunBruteForceMatcherForType(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
-                                        const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2,
-                                        const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
-                                        const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint,
-                                        NVCVNormType normType)
+// Initialize the center of each IVF list with a point of set2, points being evenly spaced in the set from a seed
+template<typename ST>
+__global__ void InitCenters(cuda::Tensor3DWrap<ST> set2, cuda::Tensor1DWrap<const int> numSet2, IndexLayout index,
+                            int numDim, int seed)
 {
-    switch (normType)
+    int listIdx   = blockIdx.x;
+    int sampleIdx = blockIdx.y;
+    int set2Size  = GetSetSize(numSet2, sampleIdx, index.set2Capacity);
+    int set2Idx   = -1;
+
+    if (set2Size > 0)
     {
-    case NVCV_NORM_HAMMING:
-        if constexpr (std::is_floating_point_v<SrcT>)
+        set2Idx = ((int64_t)listIdx * set2Size / index.numBuckets + static_cast<uint32_t>(seed)) % set2Size;
+    }
+
+    float *center = index.centers + ((int64_t)sampleIdx * index.numBuckets + listIdx) * numDim;
+
+    for (int i = threadIdx.x; i < numDim; i += blockDim.x)
+    {
+        center[i] = set2Idx < 0 ? 0.f : static_cast<float>(*set2.ptr(sampleIdx, set2Idx, i));
+    }
+}
+
+// Assign points of set2 to the IVF list with nearest center, one warp per point: when training (k-means
+// iteration) up to numTrain points evenly spaced in set2 are accumulated in their list sums and counts, otherwise
+// all valid points of set2 have their list stored in keys
+template<typename ST>
+__global__ void AssignLists(cuda::Tensor3DWrap<ST> set2, cuda::Tensor1DWrap<const int> numSet2, IndexLayout index,
+                            int numDim, int numTrain, bool train)
+{
+    int warpIdx   = (blockIdx.x * blockDim.x + threadIdx.x) / kWarpSize;
+    int sampleIdx = blockIdx.y;
+    int set2Size  = GetSetSize(numSet2, sampleIdx, index.set2Capacity);
+    int numPoints = (train && numTrain < set2Size) ? numTrain : set2Size;
+
+    if (warpIdx >= numPoints) // warp-uniform exit, as all threads in a warp work on the same point
+    {
+        return;
+    }
+
+    int     set2Idx    = train ? (int64_t)warpIdx * set2Size / numPoints : warpIdx;
+    int64_t listOffset = (int64_t)sampleIdx * index.numBuckets;
+
+    int listIdx = NearestList<ST>(set2, sampleIdx, set2Idx, index.centers + listOffset * numDim, numDim,
+                                  index.numBuckets);
+
+    if (train)
+    {
+        float *sum = index.sums + (listOffset + listIdx) * numDim;
+
+        for (int i = threadIdx.x % kWarpSize; i < numDim; i += kWarpSize)
         {
-            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm Hamming with float input type");
+            atomicAdd(&sum[i], static_cast<float>(*set2.ptr(sampleIdx, set2Idx, i)));
+        }
+    }
+    if (threadIdx.x % kWarpSize == 0)
+    {
+        if (train)
+        {
+            atomicAdd(&index.counts[listOffset + listIdx], 1);
         }
         else
         {
-            RunBruteForceMatcherForNorm<NVCV_NORM_HAMMING, SrcT>(stream, set1, set2, numSet1, numSet2, matches,
-                                                                 numMatches, distances, crossCheck, matchesPerPoint);
+            index.keys[(int64_t)sampleIdx * index.set2Capacity + set2Idx] = listIdx;
         }
-        break;
+    }
+}
 
-#define CVCUDA_BFM_CASE(NORM)                                                                                         \
-    case NORM:                                                                                                        \
-        RunBruteForceMatcherForNorm<NORM, SrcT>(stream, set1, set2, numSet1, numSet2, matches, numMatches, distances, \
-                                                crossCheck, matchesPerPoint);                                         \
-        break
+// Update the center of each IVF list to the mean of its points, the center of an empty list is kept as is
+__global__ void UpdateCenters(IndexLayout index, int numDim)
+{
+    int64_t listOffset = (int64_t)blockIdx.y * index.numBuckets + blockIdx.x;
 
-        CVCUDA_BFM_CASE(NVCV_NORM_L1);
-        CVCUDA_BFM_CASE(NVCV_NORM_L2);
+    int count = index.counts[listOffset];
 
-#undef CVCUDA_BFM_CASE
+    if (count == 0)
+    {
+        return;
+    }
 
-    default:
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm type");
+    for (int i = threadIdx.x; i < numDim; i += blockDim.x)
+    {
+        index.centers[listOffset * numDim + i] = index.sums[listOffset * numDim + i] / count;
     }
 }
 
-inline void RunBruteForceMatcher(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
-                                 const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2, const nvcv::Tensor &matches,
-                                 const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, bool crossCheck,
-                                 int matchesPerPoint, NVCVNormType normType)
+// Count the valid points of set2 in each bucket (or list) of each table, counts laid out as [sample][table][key]
+__global__ void CountKeys(cuda::Tensor1DWrap<const int> numSet2, IndexLayout index)
 {
-    switch (set1.dtype())
+    int set2Idx   = blockIdx.x * blockDim.x + threadIdx.x;
+    int tableIdx  = blockIdx.y;
+    int sampleIdx = blockIdx.z;
+
+    if (set2Idx >= GetSetSize(numSet2, sampleIdx, index.set2Capacity))
     {
-#define CVCUDA_BFM_CASE(DT, T)                                                                               \
-    case nvcv::TYPE_##DT:                                                                                    \
-        RunBruteForceMatcherForType<T>(stream, set1, set2, numSet1, numSet2, matches, numMatches, distances, \
-                                       crossCheck, matchesPerPoint, normType);                               \
-        break
+        return;
+    }
 
-        CVCUDA_BFM_CASE(U8, uint8_t);
-        CVCUDA_BFM_CASE(U32, uint32_t);
-        CVCUDA_BFM_CASE(F32, float);
+    int64_t tableOffset = (int64_t)sampleIdx * index.numTables + tableIdx;
+    int     key         = index.keys[tableOffset * index.set2Capacity + set2Idx];
 
-#undef CVCUDA_BFM_CASE
+    atomicAdd(&index.counts[tableOffset * index.numBuckets + key], 1);
+}
 
-    default:
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type");
+// Scatter the valid points of set2 to entries grouped by bucket (or list), where offsets are the exclusive sum of
+// counts, the counts being decremented to place the points in any order within their bucket
+__global__ void ScatterKeys(cuda::Tensor1DWrap<const int> numSet2, IndexLayout index)
+{
+    int set2Idx   = blockIdx.x * blockDim.x + threadIdx.x;
+    int tableIdx  = blockIdx.y;
+    int sampleIdx = blockIdx.z;
+
+    if (set2Idx >= GetSetSize(numSet2, sampleIdx, index.set2Capacity))
+    {
+        return;
     }
-}
 
-} // anonymous namespace
+    int64_t tableOffset = (int64_t)sampleIdx * index.numTables + tableIdx;
+    int64_t bucketIdx   = tableOffset * index.numBuckets + index.keys[tableOffset * index.set2Capacity + set2Idx];
 
-namespace cvcuda::priv {
+    int position = atomicSub(&index.counts[bucketIdx], 1) - 1;
 
-// Constructor -----------------------------------------------------------------
+    index.entries[index.offsets[bucketIdx] + position] = set2Idx;
+}
 
-PairwiseMatcher::PairwiseMatcher(NVCVPairwiseMatcherType algoChoice)
-    : m_algoChoice(algoChoice)
+// Update the (distance, index) pair of a thread with a candidate match, ties are broken by the smallest index to
+// return the same matches as brute force regardless of the order points are stored in the buckets (or lists)
+inline __device__ void UpdateKeyValue(float &sortedDist, int &sortedIdx, float curDist, int set2Idx)
 {
-    // Support additional algorithms here (only brute force for now), they may require payload
-    if (algoChoice != NVCV_BRUTE_FORCE)
+    if (curDist < sortedDist || (curDist == sortedDist && set2Idx < sortedIdx))
     {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid algorithm choice");
+        sortedDist = curDist;
+        sortedIdx  = set2Idx;
     }
 }
 
-// Tensor operator -------------------------------------------------------------
-
-void PairwiseMatcher::operator()(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
-                                 const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2, const nvcv::Tensor &matches,
-                                 const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, bool crossCheck,
-                                 int matchesPerPoint, NVCVNormType normType)
+// LSH matcher finds closest pairs of n-dimensional points in set1 and set2 by Hamming norm, comparing each point
+// in set1 to the points in set2 whose keys, in any hash table, differ from its key by one of the first numProbes
+// masks, each point being compared once; it is instantiated by: <NB> an upper limit of each point size in bytes;
+// and <ST> source type
+template<int NB, typename ST>
+__global__ void LshMatcher(cuda::Tensor3DWrap<ST> set1, cuda::Tensor3DWrap<ST> set2,
+                           cuda::Tensor1DWrap<const int> numSet1, cuda::Tensor3DWrap<int> matches,
+                           cuda::Tensor2DWrap<float> distances, IndexLayout index, int set1Capacity, int outCapacity,
+                           int numDim, int matchesPerPoint)
 {
-    // Check each input and output tensor and their properties are conforming to what is expected
+    int set1Idx   = blockIdx.x;
+    int sampleIdx = blockIdx.y;
 
-    if (!set1 || !set2 || !matches)
+    if (set1Idx >= GetSetSize(numSet1, sampleIdx, set1Capacity))
     {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Required tensors: set1 set2 matches");
+        return;
     }
-    if (set1.rank() != 3)
+
+    __shared__ int queryKeys[kMaxTables];
+
+    if (threadIdx.x < index.numTables)
     {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input set1 must be a rank-3 tensor");
+        queryKeys[threadIdx.x] = HashPoint<ST>(set1, sampleIdx, set1Idx, index.bitPos + threadIdx.x * index.numHashBits,
+                                               index.numHashBits);
     }
-    if (set2.rank() != 3)
+
+    __syncthreads(); // wait the keys of the set1 point in all tables
+
+    PointT<ST, NB> p1, p2;
+
+    p1.load(set1, sampleIdx, set1Idx, numDim);
+
+    const int *keys = index.keys + (int64_t)sampleIdx * index.numTables * index.set2Capacity;
+
+    float sortedDist = cuda::TypeTraits<float>::max;
+    int   sortedIdx  = -1;
+
+    // Each thread probes whole buckets, as buckets hold few points for a good choice of number of bits in the key
+
+    for (int probeIdx = threadIdx.x; probeIdx < index.numTables * index.numProbes; probeIdx += kNumThreads)
+    {
+        int tableIdx = probeIdx / index.numProbes;
+        int key      = queryKeys[tableIdx] ^ index.probeMasks[probeIdx % index.numProbes];
+
+        int64_t bucketIdx = ((int64_t)sampleIdx * index.numTables + tableIdx) * index.numBuckets + key;
+
+        for (int entryIdx = index.offsets[bucketIdx]; entryIdx < index.offsets[bucketIdx + 1]; ++entryIdx)
+        {
+            int set2Idx = index.entries[entryIdx];
+
+            // Skip the point if it is in a bucket probed in a previous table, where it was compared already
+            bool probed = false;
+
+            for (int prevIdx = 0; prevIdx < tableIdx && !probed; ++prevIdx)
+            {
+                int prevKey = keys[(int64_t)prevIdx * index.set2Capacity + set2Idx];
+
+                probed = index.probeRanks[prevKey ^ queryKeys[prevIdx]] < index.numProbes;
+            }
+
+            if (!probed)
+            {
+                p2.load(set2, sampleIdx, set2Idx, numDim);
+
+                UpdateKeyValue(sortedDist, sortedIdx, PointDistance<NVCV_NORM_HAMMING>(p1, p2, numDim), set2Idx);
+            }
+        }
+    }
+
+    SelectTopN(sortedDist, sortedIdx, matchesPerPoint);
+
+    if (threadIdx.x < matchesPerPoint)
+    {
+        int matchIdx = set1Idx * matchesPerPoint + threadIdx.x;
+
+        if (matchIdx < outCapacity)
+        {
+            WriteMatch<NVCV_NORM_HAMMING>(matchIdx, set1Idx, sortedIdx, sampleIdx, sortedDist, matches, distances);
+        }
+    }
+}
+
+// IVF matcher finds closest pairs of n-dimensional points in set1 and set2 by L1 or L2 norm, comparing each point
+// in set1 to the points in set2 in the numProbes lists with nearest centers; it is instantiated by: <NB> an upper
+// limit of each point size in bytes; <NORM> type; and <ST> source type
+template<int NB, NVCVNormType NORM, typename ST>
+__global__ void IvfMatcher(cuda::Tensor3DWrap<ST> set1, cuda::Tensor3DWrap<ST> set2,
+                           cuda::Tensor1DWrap<const int> numSet1, cuda::Tensor3DWrap<int> matches,
+                           cuda::Tensor2DWrap<float> distances, IndexLayout index, int set1Capacity, int outCapacity,
+                           int numDim, int matchesPerPoint)
+{
+    int set1Idx   = blockIdx.x;
+    int sampleIdx = blockIdx.y;
+
+    if (set1Idx >= GetSetSize(numSet1, sampleIdx, set1Capacity))
+    {
+        return;
+    }
+
+    __shared__ float listDist[kMaxLists];
+    __shared__ int   probedLists[kMaxProbes];
+
+    PointT<ST, NB> p1, p2;
+
+    p1.load(set1, sampleIdx, set1Idx, numDim);
+
+    int          numLists = index.numBuckets;
+    const float *centers  = index.centers + (int64_t)sampleIdx * numLists * numDim;
+
+    for (int listIdx = threadIdx.x; listIdx < numLists; listIdx += kNumThreads)
+    {
+        listDist[listIdx] = CenterDistance(p1, centers + (int64_t)listIdx * numDim, numDim);
+    }
+
+    __syncthreads(); // wait for the distances to all list centers
+
+    // Select the lists to probe, one block-wide reduce-min per list, a selected list is excluded from the next
+    // ones by an infinite distance, as no list is selected at infinity, a list of -1 stands for none
+
+    using BlockReduce = cub::BlockReduce<KeyValueT, kNumThreads>;
+
+    __shared__ typename BlockReduce::TempStorage cubTempStorage;
+
+    for (int probeIdx = 0; probeIdx < index.numProbes; ++probeIdx)
+    {
+        KeyValueT nearest{cuda::TypeTraits<float>::max, kIntMax};
+
+        for (int listIdx = threadIdx.x; listIdx < numLists; listIdx += kNumThreads)
+        {
+            nearest = minkey(nearest, KeyValueT{listDist[listIdx], listIdx});
+        }
+
+        nearest = BlockReduce(cubTempStorage).Reduce(nearest, minkey);
+
+        if (threadIdx.x == 0)
+        {
+            probedLists[probeIdx] = nearest.idx < numLists ? nearest.idx : -1;
+
+            if (nearest.idx < numLists)
+            {
+                listDist[nearest.idx] = INFINITY;
+            }
+        }
+
+        __syncthreads(); // wait the selected list, also before reusing the CUB temporary storage
+    }
+
+    const int *offsets = index.offsets + (int64_t)sampleIdx * numLists;
+
+    float sortedDist = cuda::TypeTraits<float>::max;
+    int   sortedIdx  = -1;
+
+    // All threads scan each probed list, as lists hold many points
+
+    for (int probeIdx = 0; probeIdx < index.numProbes; ++probeIdx)
+    {
+        int listIdx = probedLists[probeIdx];
+
+        if (listIdx < 0)
+        {
+            continue;
+        }
+
+        for (int entryIdx = offsets[listIdx] + threadIdx.x; entryIdx < offsets[listIdx + 1]; entryIdx += kNumThreads)
+        {
+            int set2Idx = index.entries[entryIdx];
+
+            p2.load(set2, sampleIdx, set2Idx, numDim);
+
+            UpdateKeyValue(sortedDist, sortedIdx, PointDistance<NORM>(p1, p2, numDim), set2Idx);
+        }
+    }
+
+    SelectTopN(sortedDist, sortedIdx, matchesPerPoint);
+
+    if (threadIdx.x < matchesPerPoint)
+    {
+        int matchIdx = set1Idx * matchesPerPoint + threadIdx.x;
+
+        if (matchIdx < outCapacity)
+        {
+            WriteMatch<NORM>(matchIdx, set1Idx, sortedIdx, sampleIdx, sortedDist, matches, distances);
+        }
+    }
+}
+
+// Run functions ---------------------------------------------------------------
+
+// Run brute-force matcher, using NORM type for distance calculations and SrcT is the input source data type
+template<NVCVNormType NORM, typename SrcT>
+inline void RunBruteForceMatcherForNorm(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
+                                        const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2,
+                                        const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
+                                        const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint)
+{
+    cuda::Tensor3DWrap<const SrcT>    w_set1, w_set2; // tensor wraps of set1 and set2 and other tensors
+    cuda::Tensor1DWrap<const int32_t> w_numSet1, w_numSet2;
+    cuda::Tensor3DWrap<int32_t>       w_matches;
+    cuda::Tensor1DWrap<int32_t>       w_numMatches;
+    cuda::Tensor2DWrap<float>         w_distances;
+
+#define CVCUDA_BFM_WRAP(TENSOR)                                                                                     \
+    if (TENSOR)                                                                                                     \
+    {                                                                                                               \
+        auto data = TENSOR.exportData<nvcv::TensorDataStridedCuda>();                                               \
+        if (!data)                                                                                                  \
+        {                                                                                                           \
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, #TENSOR " tensor must be cuda-accessible"); \
+        }                                                                                                           \
+        w_##TENSOR = decltype(w_##TENSOR)(*data);                                                                   \
+    }
+
+    CVCUDA_BFM_WRAP(set1);
+    CVCUDA_BFM_WRAP(set2);
+
+    CVCUDA_BFM_WRAP(numSet1);
+    CVCUDA_BFM_WRAP(numSet2);
+
+    CVCUDA_BFM_WRAP(matches);
+    CVCUDA_BFM_WRAP(numMatches);
+
+    CVCUDA_BFM_WRAP(distances);
+
+#undef CVCUDA_BFM_WRAP
+
+    int numSamples   = set1.shape()[0];            // number of samples, where each sample is a set of points
+    int set1Capacity = set1.shape()[1];            // set capacity is the maximum allowed number of points in set1
+    int set2Capacity = set2.shape()[1];            // set capacity is the maximum allowed number of points in set2
+    int numDim       = set1.shape()[2];            // number of dimensions of each n-dimensional point in set1 and set2
+    int outCapacity  = matches.shape()[1];         // output capacity to store matches and distances
+    int minStride    = getMinStride<SrcT>(numDim); // minimum stride in sets to allow the usage of PointT class
+
+    dim3 threads(kNumThreads, 1, 1);
+    dim3 blocks1(numSamples, 1, 1);
+    dim3 blocks2(numSamples, set1Capacity, 1);
+
+    if (crossCheck)
+    {
+        // Cross check returns a varying number of matches, as a match is only valid if it is the best (closest)
+        // match from set1 to set2 and back from set2 to set1, the numMatches output starts at zero and is
+        // atomically incremented in the BruteForceMatcher kernel
+
+        NVCV_CHECK_THROW(cudaMemsetAsync(w_numMatches.ptr(0), 0, sizeof(int32_t) * numSamples, stream));
+    }
+    else
+    {
+        // Without cross check has a fixed number of matches equal to the set1 size, meaning for every point in
+        // set1 there is (are) one (or more) matche(s) (up to matchesPerPoint) in set2
+
+        if (numMatches)
+        {
+            WriteNumMatches<<<blocks1, threads, 0, stream>>>(w_numSet1, w_numMatches, set1Capacity, matchesPerPoint);
+        }
+    }
+
+    // Cache-based kernel specialization: numDim and SrcT must fit a cache in PointT class; it works for 32B and
+    // 128B descriptors, such as ORB and SIFT.  Even though it has 256 bytes spill loads/stores for NB = 128, it
+    // still gives almost 2x performance benefit.
+
+    // TODO: The caveat of below kernel specializations is that it takes time to compile (~30sec) and it does not
+    //       cover points bigger than 128B in size, incurring in low performance for big points.  It may be better
+    //       to use shared memory for those big points, given a certain maximum point dimension, and use threads to
+    //       compute per element results instead of per point.
+
+#define CVCUDA_BFM_RUN(NB)                                                                                      \
+    BruteForceMatcher<NB, NORM><<<blocks2, threads, 0, stream>>>(                                               \
+        w_set1, w_set2, w_numSet1, w_numSet2, w_matches, w_numMatches, w_distances, set1Capacity, set2Capacity, \
+        outCapacity, numDim, crossCheck, matchesPerPoint);                                                      \
+    return
+
+    if (w_set1.strides()[1] >= minStride && w_set2.strides()[1] >= minStride)
+    {
+        if (isCompatible<SrcT, 32>(numDim))
+        {
+            CVCUDA_BFM_RUN(32);
+        }
+        else if (isCompatible<SrcT, 128>(numDim))
+        {
+            CVCUDA_BFM_RUN(128);
+        }
+    }
+
+    CVCUDA_BFM_RUN(0);
+
+#undef CVCUDA_BFM_RUN
+}
+
+template<typename SrcT>
+inline void RunBruteForceMatcherForType(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
+                                        const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2,
+                                        const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
+                                        const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint,
+                                        NVCVNormType normType)
+{
+    switch (normType)
+    {
+    case NVCV_NORM_HAMMING:
+        if constexpr (std::is_floating_point_v<SrcT>)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm Hamming with float input type");
+        }
+        else
+        {
+            RunBruteForceMatcherForNorm<NVCV_NORM_HAMMING, SrcT>(stream, set1, set2, numSet1, numSet2, matches,
+                                                                 numMatches, distances, crossCheck, matchesPerPoint);
+        }
+        break;
+
+#define CVCUDA_BFM_CASE(NORM)                                                                                         \
+    case NORM:                                                                                                        \
+        RunBruteForceMatcherForNorm<NORM, SrcT>(stream, set1, set2, numSet1, numSet2, matches, numMatches, distances, \
+                                                crossCheck, matchesPerPoint);                                         \
+        break
+
+        CVCUDA_BFM_CASE(NVCV_NORM_L1);
+        CVCUDA_BFM_CASE(NVCV_NORM_L2);
+
+#undef CVCUDA_BFM_CASE
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm type");
+    }
+}
+
+inline void RunBruteForceMatcher(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
+                                 const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2, const nvcv::Tensor &matches,
+                                 const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, bool crossCheck,
+                                 int matchesPerPoint, NVCVNormType normType)
+{
+    switch (set1.dtype())
+    {
+#define CVCUDA_BFM_CASE(DT, T)                                                                               \
+    case nvcv::TYPE_##DT:                                                                                    \
+        RunBruteForceMatcherForType<T>(stream, set1, set2, numSet1, numSet2, matches, numMatches, distances, \
+                                       crossCheck, matchesPerPoint, normType);                               \
+        break
+
+        CVCUDA_BFM_CASE(U8, uint8_t);
+        CVCUDA_BFM_CASE(U32, uint32_t);
+        CVCUDA_BFM_CASE(F32, float);
+
+#undef CVCUDA_BFM_CASE
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type");
+    }
+}
+
+// Lay out the index buffers of the approximate matchers in base, or only compute the index size if base is null
+inline IndexLayout LayoutIndex(void *base, NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams &params,
+                               int numSamples, int set2Capacity, int numDim, size_t *totalSize)
+{
+    constexpr size_t kAlign = 256;
+
+    size_t offset = 0;
+
+    auto take = [&](size_t bytes)
+    {
+        void *ptr = base ? static_cast<char *>(base) + offset : nullptr;
+        offset    = util::RoundUp(offset + bytes, kAlign);
+        return ptr;
+    };
+
+    bool isLsh = algoChoice == NVCV_LSH;
+
+    IndexLayout index{};
+
+    index.numTables    = isLsh ? params.numTables : 1;
+    index.numBuckets   = isLsh ? 1 << params.numHashBits : params.numLists;
+    index.numHashBits  = isLsh ? params.numHashBits : 0;
+    index.numProbes    = params.numProbes;
+    index.set2Capacity = set2Capacity;
+
+    size_t numKeys   = static_cast<size_t>(numSamples) * index.numTables * set2Capacity;
+    size_t numCounts = static_cast<size_t>(numSamples) * index.numTables * index.numBuckets + 1;
+
+    if (numKeys >= static_cast<size_t>(kIntMax) || numCounts >= static_cast<size_t>(kIntMax))
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Too big index for set2, entries > %d", kIntMax);
+    }
+
+    if (isLsh)
+    {
+        index.bitPos     = static_cast<int *>(take(index.numTables * index.numHashBits * sizeof(int)));
+        index.probeMasks = static_cast<int *>(take(index.numProbes * sizeof(int)));
+        index.probeRanks = static_cast<int *>(take(index.numBuckets * sizeof(int)));
+    }
+    else
+    {
+        size_t numCenters = static_cast<size_t>(numSamples) * index.numBuckets * numDim;
+
+        index.centers = static_cast<float *>(take(numCenters * sizeof(float)));
+        index.sums    = static_cast<float *>(take(numCenters * sizeof(float)));
+    }
+
+    index.keys    = static_cast<int *>(take(numKeys * sizeof(int)));
+    index.counts  = static_cast<int *>(take(numCounts * sizeof(int)));
+    index.offsets = static_cast<int *>(take(numCounts * sizeof(int)));
+    index.entries = static_cast<int *>(take(numKeys * sizeof(int)));
+
+    NVCV_CHECK_THROW(cub::DeviceScan::ExclusiveSum(nullptr, index.scanStorageSize, static_cast<int *>(nullptr),
+                                                   static_cast<int *>(nullptr), static_cast<int>(numCounts)));
+
+    index.scanStorage = take(index.scanStorageSize);
+
+    *totalSize = offset;
+    return index;
+}
+
+// Group the indices of the valid points of set2 by their keys in all tables with a counting sort
+inline void GroupByKeys(cudaStream_t stream, const IndexLayout &index, cuda::Tensor1DWrap<const int32_t> numSet2,
+                        int numSamples)
+{
+    int numCounts = numSamples * index.numTables * index.numBuckets + 1;
+
+    dim3 threads(kBuildThreads, 1, 1);
+    dim3 blocks(util::DivUp(index.set2Capacity, kBuildThreads), index.numTables, numSamples);
+
+    NVCV_CHECK_THROW(cudaMemsetAsync(index.counts, 0, sizeof(int) * numCounts, stream));
+
+    CountKeys<<<blocks, threads, 0, stream>>>(numSet2, index);
+
+    size_t scanStorageSize = index.scanStorageSize;
+
+    NVCV_CHECK_THROW(cub::DeviceScan::ExclusiveSum(index.scanStorage, scanStorageSize, index.counts, index.offsets,
+                                                   numCounts, stream));
+
+    ScatterKeys<<<blocks, threads, 0, stream>>>(numSet2, index);
+
+    NVCV_CHECK_THROW(cudaGetLastError());
+}
+
+// Build the LSH index: sample the bits of the key of each table, hash set2 points and group them by bucket
+template<typename SrcT>
+inline void BuildLshIndex(cudaStream_t stream, const IndexLayout &index, int seed,
+                          cuda::Tensor3DWrap<const SrcT> set2, cuda::Tensor1DWrap<const int32_t> numSet2,
+                          int numSamples, int numDim)
+{
+    int numBits = numDim * static_cast<int>(sizeof(SrcT)) * 8;
+
+    if (index.numHashBits > numBits)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid numHashBits %d is greater than the %d bits of a point", index.numHashBits,
+                              numBits);
+    }
+
+    // Each table samples distinct bits of the points, a key being the concatenation of the sampled bits
+
+    std::mt19937                       rng(static_cast<uint32_t>(seed));
+    std::uniform_int_distribution<int> randomBit(0, numBits - 1);
+    std::vector<int>                   bitPos(index.numTables * index.numHashBits);
+
+    for (int tableIdx = 0; tableIdx < index.numTables; ++tableIdx)
+    {
+        int *tableBits = &bitPos[tableIdx * index.numHashBits];
+
+        for (int i = 0; i < index.numHashBits; ++i)
+        {
+            do
+            {
+                tableBits[i] = randomBit(rng);
+            }
+            while (std::find(tableBits, tableBits + i, tableBits[i]) != tableBits + i);
+        }
+    }
+
+    // Buckets are probed by increasing number of key bits flipped, as a sampled bit of a near point is less likely
+    // to differ, the buckets with fewer bits flipped are more likely to hold near points (multi-probe LSH)
+
+    std::vector<int> probeMasks(index.numBuckets);
+    std::vector<int> probeRanks(index.numBuckets, index.numProbes);
+
+    std::iota(probeMasks.begin(), probeMasks.end(), 0);
+    std::stable_sort(probeMasks.begin(), probeMasks.end(),
+                     [](int a, int b) { return std::bitset<32>(a).count() < std::bitset<32>(b).count(); });
+
+    for (int probeIdx = 0; probeIdx < index.numProbes; ++probeIdx)
+    {
+        probeRanks[probeMasks[probeIdx]] = probeIdx;
+    }
+
+    NVCV_CHECK_THROW(cudaMemcpyAsync(index.bitPos, bitPos.data(), sizeof(int) * bitPos.size(),
+                                     cudaMemcpyHostToDevice, stream));
+    NVCV_CHECK_THROW(cudaMemcpyAsync(index.probeMasks, probeMasks.data(), sizeof(int) * index.numProbes,
+                                     cudaMemcpyHostToDevice, stream));
+    NVCV_CHECK_THROW(cudaMemcpyAsync(index.probeRanks, probeRanks.data(), sizeof(int) * index.numBuckets,
+                                     cudaMemcpyHostToDevice, stream));
+
+    dim3 threads(kBuildThreads, 1, 1);
+    dim3 blocks(util::DivUp(index.set2Capacity, kBuildThreads), index.numTables, numSamples);
+
+    HashPoints<<<blocks, threads, 0, stream>>>(set2, numSet2, index);
+
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    GroupByKeys(stream, index, numSet2, numSamples);
+}
+
+// Build the IVF index: cluster set2 points with k-means, starting from evenly spaced points and trained on up to
+// kTrainPerList points per list, then assign all points to the list with nearest center and group them by list
+template<typename SrcT>
+inline void BuildIvfIndex(cudaStream_t stream, const IndexLayout &index, int seed,
+                          cuda::Tensor3DWrap<const SrcT> set2, cuda::Tensor1DWrap<const int32_t> numSet2,
+                          int numSamples, int numDim)
+{
+    int    numLists   = index.numBuckets;
+    int    numTrain   = std::min(index.set2Capacity, kTrainPerList * numLists);
+    size_t numCenters = static_cast<size_t>(numSamples) * numLists;
+
+    constexpr int kWarpsPerBlock = kBuildThreads / kWarpSize;
+
+    dim3 threads1(kNumThreads, 1, 1);
+    dim3 threads2(kBuildThreads, 1, 1);
+    dim3 centerBlocks(numLists, numSamples, 1);
+    dim3 trainBlocks(util::DivUp(numTrain, kWarpsPerBlock), numSamples, 1);
+    dim3 assignBlocks(util::DivUp(index.set2Capacity, kWarpsPerBlock), numSamples, 1);
+
+    InitCenters<<<centerBlocks, threads1, 0, stream>>>(set2, numSet2, index, numDim, seed);
+
+    for (int iteration = 0; iteration < kNumIterations; ++iteration)
+    {
+        NVCV_CHECK_THROW(cudaMemsetAsync(index.sums, 0, sizeof(float) * numCenters * numDim, stream));
+        NVCV_CHECK_THROW(cudaMemsetAsync(index.counts, 0, sizeof(int) * numCenters, stream));
+
+        AssignLists<<<trainBlocks, threads2, 0, stream>>>(set2, numSet2, index, numDim, numTrain, true);
+
+        UpdateCenters<<<centerBlocks, threads1, 0, stream>>>(index, numDim);
+    }
+
+    AssignLists<<<assignBlocks, threads2, 0, stream>>>(set2, numSet2, index, numDim, numTrain, false);
+
+    NVCV_CHECK_THROW(cudaGetLastError());
+
+    GroupByKeys(stream, index, numSet2, numSamples);
+}
+
+#define CVCUDA_PWM_WRAP(TENSOR)                                                                                     \
+    if (TENSOR)                                                                                                     \
+    {                                                                                                               \
+        auto data = TENSOR.exportData<nvcv::TensorDataStridedCuda>();                                               \
+        if (!data)                                                                                                  \
+        {                                                                                                           \
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, #TENSOR " tensor must be cuda-accessible"); \
+        }                                                                                                           \
+        w_##TENSOR = decltype(w_##TENSOR)(*data);                                                                   \
+    }
+
+template<typename SrcT>
+inline void BuildIndexForType(cudaStream_t stream, const IndexLayout &index, NVCVPairwiseMatcherType algoChoice,
+                              int seed, const nvcv::Tensor &set2, const nvcv::Tensor &numSet2)
+{
+    cuda::Tensor3DWrap<const SrcT>    w_set2;
+    cuda::Tensor1DWrap<const int32_t> w_numSet2;
+
+    CVCUDA_PWM_WRAP(set2);
+    CVCUDA_PWM_WRAP(numSet2);
+
+    int numSamples = set2.shape()[0];
+    int numDim     = set2.shape()[2];
+
+    if (algoChoice == NVCV_LSH)
+    {
+        if constexpr (std::is_floating_point_v<SrcT>)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid LSH matcher with float input type");
+        }
+        else
+        {
+            BuildLshIndex<SrcT>(stream, index, seed, w_set2, w_numSet2, numSamples, numDim);
+        }
+    }
+    else
+    {
+        BuildIvfIndex<SrcT>(stream, index, seed, w_set2, w_numSet2, numSamples, numDim);
+    }
+}
+
+inline void BuildIndex(cudaStream_t stream, const IndexLayout &index, NVCVPairwiseMatcherType algoChoice, int seed,
+                       const nvcv::Tensor &set2, const nvcv::Tensor &numSet2)
+{
+    switch (set2.dtype())
+    {
+#define CVCUDA_PWM_CASE(DT, T)                                                \
+    case nvcv::TYPE_##DT:                                                     \
+        BuildIndexForType<T>(stream, index, algoChoice, seed, set2, numSet2); \
+        break
+
+        CVCUDA_PWM_CASE(U8, uint8_t);
+        CVCUDA_PWM_CASE(U32, uint32_t);
+        CVCUDA_PWM_CASE(F32, float);
+
+#undef CVCUDA_PWM_CASE
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type");
+    }
+}
+
+// Run approximate matcher, LSH for Hamming NORM and IVF for the other norms, SrcT is the input source data type
+template<NVCVNormType NORM, typename SrcT>
+inline void RunApproximateMatcherForNorm(cudaStream_t stream, const IndexLayout &index, const nvcv::Tensor &set1,
+                                         const nvcv::Tensor &set2, const nvcv::Tensor &numSet1,
+                                         const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
+                                         const nvcv::Tensor &distances, int matchesPerPoint)
+{
+    cuda::Tensor3DWrap<const SrcT>    w_set1, w_set2;
+    cuda::Tensor1DWrap<const int32_t> w_numSet1;
+    cuda::Tensor3DWrap<int32_t>       w_matches;
+    cuda::Tensor1DWrap<int32_t>       w_numMatches;
+    cuda::Tensor2DWrap<float>         w_distances;
+
+    CVCUDA_PWM_WRAP(set1);
+    CVCUDA_PWM_WRAP(set2);
+
+    CVCUDA_PWM_WRAP(numSet1);
+
+    CVCUDA_PWM_WRAP(matches);
+    CVCUDA_PWM_WRAP(numMatches);
+
+    CVCUDA_PWM_WRAP(distances);
+
+    int numSamples   = set1.shape()[0];
+    int set1Capacity = set1.shape()[1];
+    int numDim       = set1.shape()[2];
+    int outCapacity  = matches.shape()[1];
+    int minStride    = getMinStride<SrcT>(numDim);
+
+    dim3 threads(kNumThreads, 1, 1);
+    dim3 blocks1(numSamples, 1, 1);
+    dim3 blocks2(set1Capacity, numSamples, 1); // set1 in the first grid dimension, as it may have many points
+
+    if (numMatches)
+    {
+        WriteNumMatches<<<blocks1, threads, 0, stream>>>(w_numSet1, w_numMatches, set1Capacity, matchesPerPoint);
+    }
+
+#define CVCUDA_PWM_RUN(NB)                                                                                        \
+    if constexpr (NORM == NVCV_NORM_HAMMING)                                                                      \
+    {                                                                                                             \
+        LshMatcher<NB><<<blocks2, threads, 0, stream>>>(w_set1, w_set2, w_numSet1, w_matches, w_distances, index, \
+                                                        set1Capacity, outCapacity, numDim, matchesPerPoint);      \
+    }                                                                                                             \
+    else                                                                                                          \
+    {                                                                                                             \
+        IvfMatcher<NB, NORM><<<blocks2, threads, 0, stream>>>(w_set1, w_set2, w_numSet1, w_matches, w_distances,  \
+                                                              index, set1Capacity, outCapacity, numDim,           \
+                                                              matchesPerPoint);                                   \
+    }                                                                                                             \
+    NVCV_CHECK_THROW(cudaGetLastError());                                                                         \
+    return
+
+    if (w_set1.strides()[1] >= minStride && w_set2.strides()[1] >= minStride)
+    {
+        if (isCompatible<SrcT, 32>(numDim))
+        {
+            CVCUDA_PWM_RUN(32);
+        }
+        else if (isCompatible<SrcT, 128>(numDim))
+        {
+            CVCUDA_PWM_RUN(128);
+        }
+    }
+
+    CVCUDA_PWM_RUN(0);
+
+#undef CVCUDA_PWM_RUN
+}
+
+#undef CVCUDA_PWM_WRAP
+
+template<typename SrcT>
+inline void RunApproximateMatcherForType(cudaStream_t stream, const IndexLayout &index, const nvcv::Tensor &set1,
+                                         const nvcv::Tensor &set2, const nvcv::Tensor &numSet1,
+                                         const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
+                                         const nvcv::Tensor &distances, int matchesPerPoint, NVCVNormType normType)
+{
+    switch (normType)
+    {
+    case NVCV_NORM_HAMMING:
+        if constexpr (std::is_floating_point_v<SrcT>)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm Hamming with float input type");
+        }
+        else
+        {
+            RunApproximateMatcherForNorm<NVCV_NORM_HAMMING, SrcT>(stream, index, set1, set2, numSet1, matches,
+                                                                  numMatches, distances, matchesPerPoint);
+        }
+        break;
+
+#define CVCUDA_PWM_CASE(NORM)                                                                                        \
+    case NORM:                                                                                                       \
+        RunApproximateMatcherForNorm<NORM, SrcT>(stream, index, set1, set2, numSet1, matches, numMatches, distances, \
+                                                 matchesPerPoint);                                                   \
+        break
+
+        CVCUDA_PWM_CASE(NVCV_NORM_L1);
+        CVCUDA_PWM_CASE(NVCV_NORM_L2);
+
+#undef CVCUDA_PWM_CASE
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm type");
+    }
+}
+
+inline void RunApproximateMatcher(cudaStream_t stream, const IndexLayout &index, const nvcv::Tensor &set1,
+                                  const nvcv::Tensor &set2, const nvcv::Tensor &numSet1, const nvcv::Tensor &matches,
+                                  const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, int matchesPerPoint,
+                                  NVCVNormType normType)
+{
+    switch (set1.dtype())
+    {
+#define CVCUDA_PWM_CASE(DT, T)                                                                              \
+    case nvcv::TYPE_##DT:                                                                                   \
+        RunApproximateMatcherForType<T>(stream, index, set1, set2, numSet1, matches, numMatches, distances, \
+                                        matchesPerPoint, normType);                                         \
+        break
+
+        CVCUDA_PWM_CASE(U8, uint8_t);
+        CVCUDA_PWM_CASE(U32, uint32_t);
+        CVCUDA_PWM_CASE(F32, float);
+
+#undef CVCUDA_PWM_CASE
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type");
+    }
+}
+
+// Check each input and output tensor and their properties are conforming to what is expected
+inline void CheckTensors(const nvcv::Tensor &set1, const nvcv::Tensor &set2, const nvcv::Tensor &numSet1,
+                         const nvcv::Tensor &numSet2, const nvcv::Tensor &matches, const nvcv::Tensor &numMatches,
+                         const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint)
+{
+    if (!set1 || !set2 || !matches)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Required tensors: set1 set2 matches");
+    }
+    if (set1.rank() != 3)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input set1 must be a rank-3 tensor");
+    }
+    if (set2.rank() != 3)
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input set2 must be a rank-3 tensor");
     }
@@ -654,12 +1522,265 @@ void PairwiseMatcher::operator()(cudaStream_t stream, const nvcv::Tensor &set1,
     {
         throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid numMatches=NULL for crossCheck=true");
     }
+}
+
+// Check the options of the approximate matchers, the tensors being checked by CheckTensors
+inline void CheckApproximate(NVCVPairwiseMatcherType algoChoice, bool crossCheck, NVCVNormType normType)
+{
+    if (crossCheck)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid crossCheck=true for approximate matcher");
+    }
+    if (algoChoice == NVCV_LSH && normType != NVCV_NORM_HAMMING)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm type for LSH matcher, not Hamming");
+    }
+    if (algoChoice == NVCV_IVF_FLAT && normType != NVCV_NORM_L1 && normType != NVCV_NORM_L2)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid norm type for IVF matcher, not L1 or L2");
+    }
+}
+
+} // anonymous namespace
+
+namespace cvcuda::priv {
+
+// Constructor -----------------------------------------------------------------
+
+PairwiseMatcher::PairwiseMatcher(NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams *params)
+    : m_algoChoice(algoChoice)
+    , m_params(params ? *params : NVCVPairwiseMatcherParams{})
+{
+    if (algoChoice != NVCV_BRUTE_FORCE && algoChoice != NVCV_LSH && algoChoice != NVCV_IVF_FLAT)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid algorithm choice");
+    }
+
+    if (algoChoice == NVCV_BRUTE_FORCE)
+    {
+        return; // brute force ignores the parameters of the approximate matchers
+    }
+
+    if (m_params.numTables < 0 || m_params.numTables > kMaxTables)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid numTables %d is not in [0, %d]",
+                              m_params.numTables, kMaxTables);
+    }
+    if (m_params.numHashBits < 0 || m_params.numHashBits > kMaxHashBits)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid numHashBits %d is not in [0, %d]",
+                              m_params.numHashBits, kMaxHashBits);
+    }
+    if (m_params.numLists < 0 || m_params.numLists > kMaxLists)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid numLists %d is not in [0, %d]",
+                              m_params.numLists, kMaxLists);
+    }
+    if (m_params.numProbes < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid numProbes %d is negative",
+                              m_params.numProbes);
+    }
+
+    // Parameters left to zero take their default values
+
+    if (algoChoice == NVCV_LSH)
+    {
+        m_params.numTables   = m_params.numTables ? m_params.numTables : kDefaultNumTables;
+        m_params.numHashBits = m_params.numHashBits ? m_params.numHashBits : kDefaultNumHashBits;
+        m_params.numProbes   = m_params.numProbes ? m_params.numProbes : 1 + m_params.numHashBits;
+
+        if (m_params.numProbes > (1 << m_params.numHashBits))
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Invalid numProbes %d is greater than the %d buckets per table", m_params.numProbes,
+                                  1 << m_params.numHashBits);
+        }
+    }
+    else
+    {
+        m_params.numLists  = m_params.numLists ? m_params.numLists : kDefaultNumLists;
+        m_params.numProbes = m_params.numProbes ? m_params.numProbes : std::min(kDefaultIvfProbes, m_params.numLists);
+
+        if (m_params.numProbes > m_params.numLists || m_params.numProbes > kMaxProbes)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Invalid numProbes %d is greater than numLists %d or %d", m_params.numProbes,
+                                  m_params.numLists, kMaxProbes);
+        }
+    }
+}
+
+// Approximate matchers index --------------------------------------------------
+
+PairwiseMatcherIndex::PairwiseMatcherIndex(NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams &params,
+                                           int numSamples, int set2Capacity, int numDim, nvcv::DataType dtype,
+                                           size_t size)
+    : algoChoice(algoChoice)
+    , params(params)
+    , numSamples(numSamples)
+    , set2Capacity(set2Capacity)
+    , numDim(numDim)
+    , dtype(dtype)
+{
+    NVCV_CHECK_THROW(cudaMalloc(&data, size));
+    if (cudaError_t err = cudaEventCreateWithFlags(&ready, cudaEventDisableTiming); err != cudaSuccess)
+    {
+        cudaFree(data);
+        NVCV_CHECK_THROW(err);
+    }
+}
+
+PairwiseMatcherIndex::~PairwiseMatcherIndex()
+{
+    // cudaFree waits for the work still reading the index, on any stream
+    cudaEventDestroy(ready);
+    cudaFree(data);
+}
+
+PairwiseMatcherIndex &ToPairwiseMatcherIndexRef(NVCVPairwiseMatcherIndexHandle handle)
+{
+    if (handle == nullptr)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Pairwise matcher index handle must not be NULL");
+    }
+    return *reinterpret_cast<PairwiseMatcherIndex *>(handle);
+}
+
+std::unique_ptr<PairwiseMatcherIndex> PairwiseMatcher::buildIndex(cudaStream_t stream, const nvcv::Tensor &set2,
+                                                                  const nvcv::Tensor &numSet2) const
+{
+    if (m_algoChoice == NVCV_BRUTE_FORCE)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Brute-force matcher does not have an index");
+    }
+    if (!set2)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Required tensor: set2");
+    }
+    if (set2.rank() != 3)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input set2 must be a rank-3 tensor");
+    }
+
+    int64_t numSamples   = set2.shape()[0];
+    int64_t set2Capacity = set2.shape()[1];
+    int64_t numDim       = set2.shape()[2];
+
+    if (numSamples > kIntMax || numDim > kIntMax || set2Capacity > kIntMax)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Too big input tensors, shape > %d", kIntMax);
+    }
+
+    if (numSet2
+        && ((numSet2.rank() != 1 && numSet2.rank() != 2) || numSet2.shape()[0] != numSamples
+            || (numSet2.rank() == 2 && numSet2.shape()[1] != 1) || numSet2.dtype() != nvcv::TYPE_S32))
+    {
+        std::ostringstream oss;
+        oss << numSet2.shape();
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid numSet2 shape %s dtype %s are not [N] or [NC]: N=%ld C=1 dtype=S32",
+                              oss.str().c_str(), nvcvDataTypeGetName(numSet2.dtype()), numSamples);
+    }
+
+    size_t indexSize = 0;
+    LayoutIndex(nullptr, m_algoChoice, m_params, numSamples, set2Capacity, numDim, &indexSize);
+
+    auto index = std::make_unique<PairwiseMatcherIndex>(m_algoChoice, m_params, numSamples, set2Capacity, numDim,
+                                                        set2.dtype(), indexSize);
+
+    IndexLayout layout = LayoutIndex(index->data, m_algoChoice, m_params, numSamples, set2Capacity, numDim, &indexSize);
+
+    BuildIndex(stream, layout, m_algoChoice, m_params.seed, set2, numSet2);
+
+    NVCV_CHECK_THROW(cudaEventRecord(index->ready, stream));
+
+    return index;
+}
+
+// Tensor operator -------------------------------------------------------------
+
+void PairwiseMatcher::operator()(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
+                                 const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2, const nvcv::Tensor &matches,
+                                 const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, bool crossCheck,
+                                 int matchesPerPoint, NVCVNormType normType) const
+{
+    CheckTensors(set1, set2, numSet1, numSet2, matches, numMatches, distances, crossCheck, matchesPerPoint);
 
     if (m_algoChoice == NVCV_BRUTE_FORCE)
     {
         RunBruteForceMatcher(stream, set1, set2, numSet1, numSet2, matches, numMatches, distances, crossCheck,
                              matchesPerPoint, normType);
+        return;
+    }
+
+    CheckApproximate(m_algoChoice, crossCheck, normType);
+
+    // The index is built for this call only, in a buffer of the stream that is reused once the matcher is done
+
+    constexpr size_t kIndexAlign = 256;
+
+    int numSamples   = set1.shape()[0];
+    int numDim       = set1.shape()[2];
+    int set2Capacity = set2.shape()[1];
+
+    NVCVWorkspaceRequirements req{};
+    LayoutIndex(nullptr, m_algoChoice, m_params, numSamples, set2Capacity, numDim, &req.cudaMem.size);
+    req.cudaMem.alignment = kIndexAlign;
+
+    ScopedWorkspace       indexBuffer(m_indexBuffers, req, stream);
+    WorkspaceMemAllocator cudaMem(indexBuffer.get().cudaMem, stream);
+
+    size_t      indexSize = 0;
+    IndexLayout index     = LayoutIndex(cudaMem.get<char>(req.cudaMem.size, kIndexAlign), m_algoChoice, m_params,
+                                        numSamples, set2Capacity, numDim, &indexSize);
+
+    BuildIndex(stream, index, m_algoChoice, m_params.seed, set2, numSet2);
+
+    RunApproximateMatcher(stream, index, set1, set2, numSet1, matches, numMatches, distances, matchesPerPoint,
+                          normType);
+}
+
+void PairwiseMatcher::operator()(cudaStream_t stream, const PairwiseMatcherIndex &index, const nvcv::Tensor &set1,
+                                 const nvcv::Tensor &set2, const nvcv::Tensor &numSet1, const nvcv::Tensor &matches,
+                                 const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, int matchesPerPoint,
+                                 NVCVNormType normType) const
+{
+    CheckTensors(set1, set2, numSet1, nvcv::Tensor{}, matches, numMatches, distances, false, matchesPerPoint);
+
+    if (m_algoChoice == NVCV_BRUTE_FORCE)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Brute-force matcher does not have an index");
+    }
+
+    CheckApproximate(m_algoChoice, false, normType);
+
+    if (index.algoChoice != m_algoChoice || index.params.numTables != m_params.numTables
+        || index.params.numHashBits != m_params.numHashBits || index.params.numLists != m_params.numLists
+        || index.params.numProbes != m_params.numProbes || index.params.seed != m_params.seed)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Index was built by a matcher with another algorithm or parameters");
+    }
+    if (set2.shape()[0] != index.numSamples || set2.shape()[1] != index.set2Capacity
+        || set2.shape()[2] != index.numDim || set2.dtype() != index.dtype)
+    {
+        std::ostringstream oss;
+        oss << set2.shape();
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Invalid set2 shape %s dtype %s are not the ones of the index: N=%d M=%d D=%d dtype=%s",
+                              oss.str().c_str(), nvcvDataTypeGetName(set2.dtype()), index.numSamples,
+                              index.set2Capacity, index.numDim, nvcvDataTypeGetName(index.dtype));
     }
+
+    NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, index.ready));
+
+    size_t      indexSize = 0;
+    IndexLayout layout    = LayoutIndex(index.data, index.algoChoice, index.params, index.numSamples,
+                                        index.set2Capacity, index.numDim, &indexSize);
+
+    RunApproximateMatcher(stream, layout, set1, set2, numSet1, matches, numMatches, distances, matchesPerPoint,
+                          normType);
 }
 
 } // namespace cvcuda::priv
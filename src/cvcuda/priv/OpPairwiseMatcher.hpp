@@ -25,23 +25,70 @@
 #define CVCUDA_PRIV_PAIRWISE_MATCHER_HPP
 
 #include "IOperator.hpp"
+#include "WorkspaceCache.hpp"
 
 #include <cvcuda/OpPairwiseMatcher.hpp>
 
+#include <memory>
+
 namespace cvcuda::priv {
 
+// Index of the 2nd set of an approximate matcher, never modified once built, with the layout it was built for
+class PairwiseMatcherIndex
+{
+public:
+    using HandleType = NVCVPairwiseMatcherIndexHandle;
+
+    PairwiseMatcherIndex(NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams &params,
+                         int numSamples, int set2Capacity, int numDim, nvcv::DataType dtype, size_t size);
+
+    ~PairwiseMatcherIndex();
+
+    PairwiseMatcherIndex(const PairwiseMatcherIndex &)            = delete;
+    PairwiseMatcherIndex &operator=(const PairwiseMatcherIndex &) = delete;
+
+    HandleType handle() const
+    {
+        return reinterpret_cast<HandleType>(const_cast<PairwiseMatcherIndex *>(this));
+    }
+
+    NVCVPairwiseMatcherType   algoChoice;
+    NVCVPairwiseMatcherParams params;
+    int                       numSamples;
+    int                       set2Capacity;
+    int                       numDim;
+    nvcv::DataType            dtype;
+
+    void       *data  = nullptr; // index buffers, see LayoutIndex
+    cudaEvent_t ready = nullptr; // recorded once the index is built
+};
+
+PairwiseMatcherIndex &ToPairwiseMatcherIndexRef(NVCVPairwiseMatcherIndexHandle handle);
+
 class PairwiseMatcher final : public IOperator
 {
 public:
-    explicit PairwiseMatcher(NVCVPairwiseMatcherType algoChoice);
+    explicit PairwiseMatcher(NVCVPairwiseMatcherType algoChoice, const NVCVPairwiseMatcherParams *params = nullptr);
+
+    std::unique_ptr<PairwiseMatcherIndex> buildIndex(cudaStream_t stream, const nvcv::Tensor &set2,
+                                                     const nvcv::Tensor &numSet2) const;
 
     void operator()(cudaStream_t stream, const nvcv::Tensor &set1, const nvcv::Tensor &set2,
                     const nvcv::Tensor &numSet1, const nvcv::Tensor &numSet2, const nvcv::Tensor &matches,
                     const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint,
-                    NVCVNormType normType);
+                    NVCVNormType normType) const;
+
+    void operator()(cudaStream_t stream, const PairwiseMatcherIndex &index, const nvcv::Tensor &set1,
+                    const nvcv::Tensor &set2, const nvcv::Tensor &numSet1, const nvcv::Tensor &matches,
+                    const nvcv::Tensor &numMatches, const nvcv::Tensor &distances, int matchesPerPoint,
+                    NVCVNormType normType) const;
 
 private:
-    NVCVPairwiseMatcherType m_algoChoice;
+    NVCVPairwiseMatcherType   m_algoChoice;
+    NVCVPairwiseMatcherParams m_params; // parameters of the approximate matchers, with defaults resolved
+
+    // Index buffers of the submissions building their own index, per stream
+    mutable WorkspaceCache m_indexBuffers{nvcv::Allocator{}, 0};
 };
 
 } // namespace cvcuda::priv
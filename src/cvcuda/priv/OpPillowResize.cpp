@@ -28,9 +28,14 @@ namespace cvcuda::priv {
 namespace leg    = nvcv::legacy;
 namespace legacy = nvcv::legacy::cuda_op;
 
-PillowResize::PillowResize()
+PillowResize::PillowResize(int32_t coeffCacheSize)
 {
-    m_legacyOp         = std::make_unique<leg::cuda_op::PillowResize>();
+    if (coeffCacheSize < 0)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Coefficient cache size must not be negative");
+    }
+
+    m_legacyOp         = std::make_unique<leg::cuda_op::PillowResize>(coeffCacheSize);
     m_legacyOpVarShape = std::make_unique<leg::cuda_op::PillowResizeVarShape>();
 }
 
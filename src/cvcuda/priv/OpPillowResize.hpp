@@ -38,7 +38,7 @@ namespace cvcuda::priv {
 class PillowResize final : public IOperator
 {
 public:
-    PillowResize();
+    explicit PillowResize(int32_t coeffCacheSize = nvcv::legacy::cuda_op::PillowResizeCoeffCache::DEFAULT_CAPACITY);
 
     WorkspaceRequirements getWorkspaceRequirements(int batchSize, const nvcv::Size2D *in_sizes,
                                                    const nvcv::Size2D *out_sizes, NVCVImageFormat fmt);
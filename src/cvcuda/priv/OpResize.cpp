@@ -17,6 +17,7 @@
 
 #include "OpResize.hpp"
 
+#include "ResizeHost.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -37,6 +38,17 @@ Resize::Resize()
 void Resize::operator()(cudaStream_t stream, const nvcv::Tensor &in, const nvcv::Tensor &out,
                         const NVCVInterpolationType interpolation) const
 {
+    // Tensors in host memory are resized on the CPU, synchronously. Pinned ones may still be
+    // written by work queued on the stream, so it's drained first.
+    auto inHostData  = in.exportData<nvcv::TensorDataStridedHost>();
+    auto outHostData = out.exportData<nvcv::TensorDataStridedHost>();
+    if (inHostData && outHostData)
+    {
+        NVCV_CHECK_THROW(cudaStreamSynchronize(stream));
+        host::Resize(*inHostData, *outHostData, interpolation);
+        return;
+    }
+
     auto inData = in.exportData<nvcv::TensorDataStridedCuda>();
     if (inData == nullptr)
     {
@@ -16,6 +16,8 @@
  */
 
 #include "OpResizeCropConvertReformat.hpp"
+
+#include "ResizeHost.hpp"
 #include "legacy/CvCudaLegacy.h"
 #include "legacy/CvCudaLegacyHelpers.hpp"
 
@@ -29,6 +31,7 @@
 #include <nvcv/TensorData.hpp>
 #include <nvcv/TensorLayout.hpp>
 #include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
 #include <nvcv/util/Math.hpp>
 
 #include <limits> // for numeric_limits
@@ -420,20 +423,35 @@ void ResizeCropConvertReformat::operator()(cudaStream_t stream, const nvcv::Tens
                                            const int2 cropPos, const NVCVChannelManip manip, float scale, float offset,
                                            bool srcCast) const
 {
-    auto srcData = src.exportData<nvcv::TensorDataStridedCuda>();
-    if (!srcData)
-    {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Input must be a cuda-accessible, pitch-linear tensor");
-    }
+    // Tensors in host memory are processed on the CPU, synchronously. Pinned ones may still be
+    // written by work queued on the stream, so it's drained first.
+    auto       srcHostData = src.exportData<nvcv::TensorDataStridedHost>();
+    auto       dstHostData = dst.exportData<nvcv::TensorDataStridedHost>();
+    const bool onHost      = srcHostData && dstHostData;
 
-    auto dstData = dst.exportData<nvcv::TensorDataStridedCuda>();
-    if (!dstData)
+    nvcv::Optional<nvcv::TensorDataStridedCuda> srcCudaData, dstCudaData;
+    if (!onHost)
     {
-        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
-                              "Output must be a cuda-accessible, pitch-linear tensor");
+        srcCudaData = src.exportData<nvcv::TensorDataStridedCuda>();
+        if (!srcCudaData)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Input must be a cuda-accessible, pitch-linear tensor");
+        }
+
+        dstCudaData = dst.exportData<nvcv::TensorDataStridedCuda>();
+        if (!dstCudaData)
+        {
+            throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                                  "Output must be a cuda-accessible, pitch-linear tensor");
+        }
     }
 
+    const nvcv::TensorDataStrided *srcData
+        = onHost ? static_cast<const nvcv::TensorDataStrided *>(&*srcHostData) : &*srcCudaData;
+    const nvcv::TensorDataStrided *dstData
+        = onHost ? static_cast<const nvcv::TensorDataStrided *>(&*dstHostData) : &*dstCudaData;
+
     auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
     auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
 
@@ -538,17 +556,25 @@ void ResizeCropConvertReformat::operator()(cudaStream_t stream, const nvcv::Tens
         } // switch
     }
 
+    if (onHost)
+    {
+        NVCV_CHECK_THROW(cudaStreamSynchronize(stream));
+        host::ResizeCropConvertReformat(*srcHostData, *dstHostData, resizeDim, interp, cropPos, manip, scale, offset,
+                                        srcCast);
+        return;
+    }
+
     if (srcType == cuda_op::kCV_8U)
     {
         if (dstType == cuda_op::kCV_8U)
         {
-            resizeCropConvertReformat<uchar3, uint8_t>(*srcData, *dstData, resizeDim, interp, cropPos, manip, scale,
-                                                       offset, srcCast, stream);
+            resizeCropConvertReformat<uchar3, uint8_t>(*srcCudaData, *dstCudaData, resizeDim, interp, cropPos, manip,
+                                                       scale, offset, srcCast, stream);
         }
         else if (dstType == cuda_op::kCV_32F)
         {
-            resizeCropConvertReformat<uchar3, float>(*srcData, *dstData, resizeDim, interp, cropPos, manip, scale,
-                                                     offset, srcCast, stream);
+            resizeCropConvertReformat<uchar3, float>(*srcCudaData, *dstCudaData, resizeDim, interp, cropPos, manip,
+                                                     scale, offset, srcCast, stream);
         }
     }
 }
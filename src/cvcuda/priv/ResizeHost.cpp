@@ -0,0 +1,834 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResizeHost.hpp"
+
+#include <cvcuda/util/ThreadPool.hpp>
+#include <nvcv/Exception.hpp>
+#include <nvcv/TensorDataAccess.hpp>
+#include <nvcv/TensorLayout.hpp>
+#include <nvcv/util/Assert.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#    include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#endif
+
+namespace cvcuda::priv::host {
+
+namespace {
+
+// SIMD ------------------------------------------------------------------------
+
+// The widest float vector available to the target the library is compiled for, the
+// filters below only use these operations so that they build unchanged everywhere.
+namespace simd {
+
+#if defined(__AVX2__)
+
+using Reg                = __m256;
+constexpr int kWidth     = 8;
+constexpr int kHasGather = true;
+
+// clang-format off
+inline Reg  Load(const float *p)       { return _mm256_loadu_ps(p); }
+inline void Store(float *p, Reg v)     { _mm256_storeu_ps(p, v); }
+inline Reg  Set1(float v)              { return _mm256_set1_ps(v); }
+inline Reg  Add(Reg a, Reg b)          { return _mm256_add_ps(a, b); }
+inline Reg  Mul(Reg a, Reg b)          { return _mm256_mul_ps(a, b); }
+inline Reg  Min(Reg a, Reg b)          { return _mm256_min_ps(a, b); }
+inline Reg  Max(Reg a, Reg b)          { return _mm256_max_ps(a, b); }
+inline Reg  Round(Reg v)               { return _mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+inline Reg Gather(const float *base, const int32_t *idx)
+{
+    return _mm256_i32gather_ps(base, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(idx)), sizeof(float));
+}
+
+// clang-format on
+
+#elif defined(__SSE2__)
+
+using Reg                = __m128;
+constexpr int kWidth     = 4;
+constexpr int kHasGather = false;
+
+// clang-format off
+inline Reg  Load(const float *p)       { return _mm_loadu_ps(p); }
+inline void Store(float *p, Reg v)     { _mm_storeu_ps(p, v); }
+inline Reg  Set1(float v)              { return _mm_set1_ps(v); }
+inline Reg  Add(Reg a, Reg b)          { return _mm_add_ps(a, b); }
+inline Reg  Mul(Reg a, Reg b)          { return _mm_mul_ps(a, b); }
+inline Reg  Min(Reg a, Reg b)          { return _mm_min_ps(a, b); }
+inline Reg  Max(Reg a, Reg b)          { return _mm_max_ps(a, b); }
+// Only used on values already clamped to the range of a 16-bit integer
+inline Reg  Round(Reg v)               { return _mm_cvtepi32_ps(_mm_cvtps_epi32(v)); }
+
+inline Reg Gather(const float *base, const int32_t *idx)
+{
+    return _mm_setr_ps(base[idx[0]], base[idx[1]], base[idx[2]], base[idx[3]]);
+}
+
+// clang-format on
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+using Reg                = float32x4_t;
+constexpr int kWidth     = 4;
+constexpr int kHasGather = false;
+
+// clang-format off
+inline Reg  Load(const float *p)       { return vld1q_f32(p); }
+inline void Store(float *p, Reg v)     { vst1q_f32(p, v); }
+inline Reg  Set1(float v)              { return vdupq_n_f32(v); }
+inline Reg  Add(Reg a, Reg b)          { return vaddq_f32(a, b); }
+inline Reg  Mul(Reg a, Reg b)          { return vmulq_f32(a, b); }
+inline Reg  Min(Reg a, Reg b)          { return vminq_f32(a, b); }
+inline Reg  Max(Reg a, Reg b)          { return vmaxq_f32(a, b); }
+inline Reg  Round(Reg v)               { return vrndnq_f32(v); }
+
+inline Reg Gather(const float *base, const int32_t *idx)
+{
+    const float v[4] = {base[idx[0]], base[idx[1]], base[idx[2]], base[idx[3]]};
+    return vld1q_f32(v);
+}
+
+// clang-format on
+
+#else
+
+using Reg                = float;
+constexpr int kWidth     = 1;
+constexpr int kHasGather = false;
+
+// clang-format off
+inline Reg  Load(const float *p)       { return *p; }
+inline void Store(float *p, Reg v)     { *p = v; }
+inline Reg  Set1(float v)              { return v; }
+inline Reg  Add(Reg a, Reg b)          { return a + b; }
+inline Reg  Mul(Reg a, Reg b)          { return a * b; }
+inline Reg  Min(Reg a, Reg b)          { return std::min(a, b); }
+inline Reg  Max(Reg a, Reg b)          { return std::max(a, b); }
+inline Reg  Round(Reg v)               { return std::nearbyint(v); }
+inline Reg  Gather(const float *base, const int32_t *idx) { return base[*idx]; }
+// clang-format on
+
+#endif
+
+} // namespace simd
+
+// Clamps to [lo, hi] and rounds half to even, as SaturateCast does on the device.
+void Saturate(float *data, int len, float lo, float hi)
+{
+    const simd::Reg vlo = simd::Set1(lo), vhi = simd::Set1(hi);
+
+    int i = 0;
+    for (; i + simd::kWidth <= len; i += simd::kWidth)
+    {
+        simd::Store(data + i, simd::Round(simd::Min(simd::Max(simd::Load(data + i), vlo), vhi)));
+    }
+    for (; i < len; ++i)
+    {
+        data[i] = std::nearbyint(std::min(std::max(data[i], lo), hi));
+    }
+}
+
+void Affine(float *data, int len, float scale, float offset)
+{
+    const simd::Reg vscale = simd::Set1(scale), voffset = simd::Set1(offset);
+
+    int i = 0;
+    for (; i + simd::kWidth <= len; i += simd::kWidth)
+    {
+        simd::Store(data + i, simd::Add(simd::Mul(simd::Load(data + i), vscale), voffset));
+    }
+    for (; i < len; ++i)
+    {
+        data[i] = data[i] * scale + offset;
+    }
+}
+
+// Filter taps ------------------------------------------------------------------
+
+// Taps of a filter along one axis: output coordinate i reads input coordinate index[k * size + i]
+// with weight weight[k * size + i], for each tap k. The input coordinates of an output are
+// consecutive and never decrease along the axis, padding taps have zero weight.
+struct Taps
+{
+    Taps(int size_, int numTaps_)
+        : size(size_)
+        , numTaps(numTaps_)
+        , index(static_cast<size_t>(size_) * numTaps_)
+        , weight(static_cast<size_t>(size_) * numTaps_)
+    {
+    }
+
+    void set(int i, int k, int32_t idx, float w)
+    {
+        index[static_cast<size_t>(k) * size + i]  = idx;
+        weight[static_cast<size_t>(k) * size + i] = w;
+    }
+
+    int32_t first() const
+    {
+        return *std::min_element(index.begin(), index.end());
+    }
+
+    int32_t last() const
+    {
+        return *std::max_element(index.begin(), index.end());
+    }
+
+    int                  size;
+    int                  numTaps;
+    std::vector<int32_t> index;
+    std::vector<float>   weight;
+};
+
+Taps NearestTaps(int srcSize, int dstSize, float scale)
+{
+    Taps taps(dstSize, 1);
+    for (int d = 0; d < dstSize; ++d)
+    {
+        int i = static_cast<int>(std::floor((d + .5f) * scale));
+        taps.set(d, 0, std::min(i, srcSize - 1), 1.f);
+    }
+    return taps;
+}
+
+Taps LinearTaps(int srcSize, int dstSize, float scale)
+{
+    Taps taps(dstSize, 2);
+    for (int d = 0; d < dstSize; ++d)
+    {
+        float s = (d + .5f) * scale - .5f;
+        int   i = static_cast<int>(std::floor(s));
+        float w = i < 0 ? 0.f : (i > srcSize - 2 ? 1.f : s - i);
+
+        i = std::max(0, std::min(i, srcSize - 2));
+
+        taps.set(d, 0, i, 1.f - w);
+        taps.set(d, 1, std::min(i + 1, srcSize - 1), w);
+    }
+    return taps;
+}
+
+// The device kernel only zeroes the fractional part near the borders horizontally.
+Taps CubicTaps(int srcSize, int dstSize, float scale, bool zeroBorderFraction)
+{
+    constexpr float A = -0.75f;
+
+    Taps taps(dstSize, 4);
+    for (int d = 0; d < dstSize; ++d)
+    {
+        float s = (d + .5f) * scale - .5f;
+        int   i = static_cast<int>(std::floor(s));
+        float f = s - i;
+
+        if (zeroBorderFraction && (i < 1 || i >= srcSize - 3))
+        {
+            f = 0;
+        }
+        i = std::max(1, std::min(i, srcSize - 3));
+
+        float w[4];
+        w[0] = ((A * (f + 1) - 5 * A) * (f + 1) + 8 * A) * (f + 1) - 4 * A;
+        w[1] = ((A + 2) * f - (A + 3)) * f * f + 1;
+        w[2] = ((A + 2) * (1 - f) - (A + 3)) * (1 - f) * (1 - f) + 1;
+        w[3] = 1.f - w[0] - w[1] - w[2];
+
+        // Images smaller than the filter support are clamped to their borders
+        for (int k = 0; k < 4; ++k)
+        {
+            taps.set(d, k, std::max(0, std::min(i - 1 + k, srcSize - 1)), w[k]);
+        }
+    }
+    return taps;
+}
+
+// Pixels partially covered by the area contribute with their coverage, pixels outside
+// of the image are zero (constant border).
+Taps AreaTaps(int srcSize, int dstSize, float scale)
+{
+    std::vector<std::vector<std::pair<int32_t, float>>> all(dstSize);
+
+    int numTaps = 1;
+    for (int d = 0; d < dstSize; ++d)
+    {
+        const float fs1  = d * scale;
+        const float fs2  = fs1 + scale;
+        const int   imin = static_cast<int>(std::ceil(fs1));
+        const int   imax = static_cast<int>(std::floor(fs2));
+        const float norm = 1.f / std::min(scale, srcSize - fs1);
+
+        auto add = [&](int i, float w)
+        {
+            if (0 <= i && i < srcSize)
+            {
+                all[d].emplace_back(i, w);
+            }
+        };
+
+        if (imin > fs1)
+        {
+            add(imin - 1, (imin - fs1) * norm);
+        }
+        for (int i = imin; i < imax; ++i)
+        {
+            add(i, norm);
+        }
+        if (imax < fs2)
+        {
+            add(imax, (fs2 - imax) * norm);
+        }
+
+        numTaps = std::max(numTaps, static_cast<int>(all[d].size()));
+    }
+
+    Taps taps(dstSize, numTaps);
+    for (int d = 0; d < dstSize; ++d)
+    {
+        const int32_t pad = all[d].empty() ? 0 : all[d][0].first;
+        for (int k = 0; k < numTaps; ++k)
+        {
+            if (k < static_cast<int>(all[d].size()))
+            {
+                taps.set(d, k, all[d][k].first, all[d][k].second);
+            }
+            else
+            {
+                taps.set(d, k, pad, 0.f);
+            }
+        }
+    }
+    return taps;
+}
+
+// ResizeCropConvertReformat maps output coordinates shifted by the crop position.
+Taps CropNearestTaps(int srcSize, int dstSize, float resize, int crop)
+{
+    Taps taps(dstSize, 1);
+    for (int d = 0; d < dstSize; ++d)
+    {
+        int i = static_cast<int>(std::floor((d + crop + .5f) * resize));
+        taps.set(d, 0, std::max(0, std::min(i, srcSize - 1)), 1.f);
+    }
+    return taps;
+}
+
+Taps CropLinearTaps(int srcSize, int dstSize, float resize, int crop)
+{
+    Taps taps(dstSize, 2);
+    for (int d = 0; d < dstSize; ++d)
+    {
+        float f  = (d + crop + .5f) * resize - .5f;
+        int   i0 = static_cast<int>(std::floor(f));
+        int   i1 = std::min(i0 + 1, srcSize - 1);
+
+        f -= i0;
+        i0 = std::max(0, i0);
+
+        taps.set(d, 0, i0, 1 - f);
+        taps.set(d, 1, std::max(i0, i1), f);
+    }
+    return taps;
+}
+
+// Horizontal taps expanded to each channel of the output row, offsets are relative
+// to the first input column read.
+struct RowTaps
+{
+    RowTaps(const Taps &taps, int channels)
+        : len(taps.size * channels)
+        , numTaps(taps.numTaps)
+        , colBegin(taps.first())
+        , colEnd(taps.last() + 1)
+        , offset(static_cast<size_t>(len) * numTaps)
+        , weight(static_cast<size_t>(len) * numTaps)
+    {
+        for (int k = 0; k < numTaps; ++k)
+        {
+            for (int x = 0; x < taps.size; ++x)
+            {
+                const size_t t = static_cast<size_t>(k) * taps.size + x;
+                for (int c = 0; c < channels; ++c)
+                {
+                    const size_t j = static_cast<size_t>(k) * len + x * channels + c;
+
+                    offset[j] = (taps.index[t] - colBegin) * channels + c;
+                    weight[j] = taps.weight[t];
+                }
+            }
+        }
+    }
+
+    int                  len;
+    int                  numTaps;
+    int                  colBegin, colEnd;
+    std::vector<int32_t> offset;
+    std::vector<float>   weight;
+};
+
+void FilterRow(const float *in, const RowTaps &taps, float *out)
+{
+    const int      len = taps.len;
+    const int32_t *off = taps.offset.data();
+    const float   *w   = taps.weight.data();
+
+    int j = 0;
+    if constexpr (simd::kHasGather)
+    {
+        for (; j + simd::kWidth <= len; j += simd::kWidth)
+        {
+            simd::Reg acc = simd::Mul(simd::Gather(in, off + j), simd::Load(w + j));
+            for (int k = 1; k < taps.numTaps; ++k)
+            {
+                const size_t t = static_cast<size_t>(k) * len + j;
+                acc            = simd::Add(acc, simd::Mul(simd::Gather(in, off + t), simd::Load(w + t)));
+            }
+            simd::Store(out + j, acc);
+        }
+    }
+    for (; j < len; ++j)
+    {
+        float acc = in[off[j]] * w[j];
+        for (int k = 1; k < taps.numTaps; ++k)
+        {
+            const size_t t = static_cast<size_t>(k) * len + j;
+            acc += in[off[t]] * w[t];
+        }
+        out[j] = acc;
+    }
+}
+
+void AccumulateRows(const float *const *rows, const float *w, int numRows, int len, float *out)
+{
+    int j = 0;
+    for (; j + simd::kWidth <= len; j += simd::kWidth)
+    {
+        simd::Reg acc = simd::Mul(simd::Load(rows[0] + j), simd::Set1(w[0]));
+        for (int k = 1; k < numRows; ++k)
+        {
+            acc = simd::Add(acc, simd::Mul(simd::Load(rows[k] + j), simd::Set1(w[k])));
+        }
+        simd::Store(out + j, acc);
+    }
+    for (; j < len; ++j)
+    {
+        float acc = rows[0][j] * w[0];
+        for (int k = 1; k < numRows; ++k)
+        {
+            acc += rows[k][j] * w[k];
+        }
+        out[j] = acc;
+    }
+}
+
+// Images ----------------------------------------------------------------------
+
+struct Image
+{
+    Image(const nvcv::TensorDataStrided &data)
+    {
+        auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(data);
+        NVCV_ASSERT(access);
+
+        base         = reinterpret_cast<std::byte *>(data.basePtr());
+        numSamples   = access->numSamples();
+        numRows      = access->numRows();
+        numCols      = access->numCols();
+        numChannels  = access->numChannels() * data.dtype().numChannels();
+        sampleStride = access->sampleStride();
+        rowStride    = access->rowStride();
+        colStride    = access->colStride();
+        chStride     = access->chStride();
+        planar       = access->numPlanes() > 1;
+    }
+
+    std::byte *row(int n, int y) const
+    {
+        return base + n * sampleStride + y * rowStride;
+    }
+
+    std::byte *base;
+    int        numSamples, numRows, numCols, numChannels;
+    int64_t    sampleStride, rowStride, colStride, chStride;
+    bool       planar;
+};
+
+// Splits the output into (sample, row range) items, enough of them to balance the pool.
+template<class Fn>
+void ForEachRowRange(int numSamples, int numRows, Fn &&fn)
+{
+    auto &pool = nvcv::util::ThreadPool::Host();
+
+    const int chunks = std::max(1, std::min(numRows, (4 * pool.numThreads() + numSamples - 1) / numSamples));
+    const int rows   = (numRows + chunks - 1) / chunks;
+    const int items  = numSamples * ((numRows + rows - 1) / rows);
+
+    pool.parallelFor(items,
+                     [&](int item)
+                     {
+                         const int perSample = (numRows + rows - 1) / rows;
+                         const int n         = item / perSample;
+                         const int y0        = (item % perSample) * rows;
+                         fn(n, y0, std::min(numRows, y0 + rows));
+                     });
+}
+
+template<typename T>
+void ReadRow(const Image &src, int n, int y, int colBegin, int colEnd, float *out)
+{
+    const std::byte *row = src.row(n, y);
+    const int        C   = src.numChannels;
+
+    if (src.colStride == static_cast<int64_t>(C * sizeof(T)))
+    {
+        const T  *in  = reinterpret_cast<const T *>(row) + static_cast<size_t>(colBegin) * C;
+        const int len = (colEnd - colBegin) * C;
+        for (int i = 0; i < len; ++i) out[i] = static_cast<float>(in[i]);
+    }
+    else
+    {
+        for (int x = colBegin; x < colEnd; ++x)
+        {
+            const T *in = reinterpret_cast<const T *>(row + x * src.colStride);
+            for (int c = 0; c < C; ++c) *out++ = static_cast<float>(in[c]);
+        }
+    }
+}
+
+// Runs the separable filter given by the horizontal and vertical taps over the input,
+// handing each filtered output row to sink(n, y, row).
+template<typename T, class Sink>
+void RunSeparable(const Image &src, int dstRows, const RowTaps &hTaps, const Taps &vTaps, Sink &&sink)
+{
+    ForEachRowRange(
+        src.numSamples, dstRows,
+        [&](int n, int y0, int y1)
+        {
+            // Horizontally filtered input rows, a ring indexed by row as the vertical taps
+            // of an output row are consecutive input rows.
+            const int numSlots = vTaps.numTaps;
+            const int inLen    = (hTaps.colEnd - hTaps.colBegin) * src.numChannels;
+
+            std::vector<float>        input(inLen), cache(static_cast<size_t>(numSlots) * hTaps.len), acc(hTaps.len);
+            std::vector<int32_t>      cached(numSlots, -1);
+            std::vector<const float *> rows(numSlots);
+            std::vector<float>         weights(numSlots);
+
+            for (int y = y0; y < y1; ++y)
+            {
+                int numRows = 0;
+                for (int k = 0; k < vTaps.numTaps; ++k)
+                {
+                    const size_t  t = static_cast<size_t>(k) * vTaps.size + y;
+                    const int32_t r = vTaps.index[t];
+                    const float   w = vTaps.weight[t];
+                    if (w == 0)
+                    {
+                        continue;
+                    }
+
+                    float *slot = cache.data() + static_cast<size_t>(r % numSlots) * hTaps.len;
+                    if (cached[r % numSlots] != r)
+                    {
+                        ReadRow<T>(src, n, r, hTaps.colBegin, hTaps.colEnd, input.data());
+                        FilterRow(input.data(), hTaps, slot);
+                        cached[r % numSlots] = r;
+                    }
+                    rows[numRows]    = slot;
+                    weights[numRows] = w;
+                    ++numRows;
+                }
+
+                if (numRows == 0)
+                {
+                    std::fill(acc.begin(), acc.end(), 0.f);
+                }
+                else
+                {
+                    AccumulateRows(rows.data(), weights.data(), numRows, hTaps.len, acc.data());
+                }
+                sink(n, y, acc.data());
+            }
+        });
+}
+
+// Resize ----------------------------------------------------------------------
+
+template<typename T>
+void StoreRow(float *acc, int len, bool absolute, T *out)
+{
+    if (absolute)
+    {
+        for (int i = 0; i < len; ++i) acc[i] = std::abs(acc[i]);
+    }
+    if constexpr (std::is_integral_v<T>)
+    {
+        Saturate(acc, len, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+    }
+    for (int i = 0; i < len; ++i) out[i] = static_cast<T>(acc[i]);
+}
+
+template<typename T>
+void ResizeNearest(const Image &src, const Image &dst, const Taps &hTaps, const Taps &vTaps)
+{
+    const int64_t pixelSize = src.numChannels * sizeof(T);
+
+    ForEachRowRange(dst.numSamples, dst.numRows,
+                    [&](int n, int y0, int y1)
+                    {
+                        for (int y = y0; y < y1; ++y)
+                        {
+                            const std::byte *in  = src.row(n, vTaps.index[y]);
+                            std::byte       *out = dst.row(n, y);
+                            for (int x = 0; x < dst.numCols; ++x)
+                            {
+                                std::memcpy(out + x * dst.colStride, in + hTaps.index[x] * src.colStride, pixelSize);
+                            }
+                        }
+                    });
+}
+
+template<typename T>
+void RunResize(const Image &src, const Image &dst, const NVCVInterpolationType interpolation)
+{
+    const float scaleX = static_cast<float>(src.numCols) / dst.numCols;
+    const float scaleY = static_cast<float>(src.numRows) / dst.numRows;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        ResizeNearest<T>(src, dst, NearestTaps(src.numCols, dst.numCols, scaleX),
+                         NearestTaps(src.numRows, dst.numRows, scaleY));
+        return;
+    }
+
+    auto run = [&](const Taps &hTaps, const Taps &vTaps, bool absolute)
+    {
+        const bool packed = dst.colStride == static_cast<int64_t>(dst.numChannels * sizeof(T));
+
+        RunSeparable<T>(src, dst.numRows, RowTaps(hTaps, src.numChannels), vTaps,
+                        [&](int n, int y, float *acc)
+                        {
+                            const int len = dst.numCols * dst.numChannels;
+                            T        *out = reinterpret_cast<T *>(dst.row(n, y));
+                            if (packed)
+                            {
+                                StoreRow(acc, len, absolute, out);
+                                return;
+                            }
+                            std::vector<T> tmp(len);
+                            StoreRow(acc, len, absolute, tmp.data());
+                            for (int x = 0; x < dst.numCols; ++x)
+                            {
+                                std::memcpy(reinterpret_cast<std::byte *>(out) + x * dst.colStride,
+                                            &tmp[x * dst.numChannels], dst.numChannels * sizeof(T));
+                            }
+                        });
+    };
+
+    switch (interpolation)
+    {
+    case NVCV_INTERP_LINEAR:
+        run(LinearTaps(src.numCols, dst.numCols, scaleX), LinearTaps(src.numRows, dst.numRows, scaleY), false);
+        break;
+
+    case NVCV_INTERP_CUBIC:
+        run(CubicTaps(src.numCols, dst.numCols, scaleX, true), CubicTaps(src.numRows, dst.numRows, scaleY, false),
+            true);
+        break;
+
+    case NVCV_INTERP_AREA:
+        run(AreaTaps(src.numCols, dst.numCols, scaleX), AreaTaps(src.numRows, dst.numRows, scaleY), false);
+        break;
+
+    default:
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid interpolation");
+    }
+}
+
+// ResizeCropConvertReformat ---------------------------------------------------
+
+template<typename DstT>
+void RunResizeCropConvertReformat(const Image &src, const Image &dst, const NVCVSize2D resizeDim,
+                                  const NVCVInterpolationType interpolation, const int2 cropPos,
+                                  const NVCVChannelManip manip, const float scale, const float offset,
+                                  const bool srcCast)
+{
+    const int C = src.numChannels;
+
+    // Byte offset of each channel within the output pixel, after the channel manipulation
+    const int64_t addC = dst.planar ? dst.chStride : static_cast<int64_t>(sizeof(DstT));
+
+    int64_t mapC[4];
+    for (int c = 0; c < C; ++c)
+    {
+        mapC[c] = (manip == NVCV_CHANNEL_REVERSE ? C - 1 - c : c) * addC;
+    }
+
+    auto store = [&](int n, int y, float *acc, bool rounded)
+    {
+        const int len = dst.numCols * C;
+        if (srcCast && !rounded)
+        {
+            Saturate(acc, len, 0, 255);
+        }
+        Affine(acc, len, scale, offset);
+        if constexpr (std::is_integral_v<DstT>)
+        {
+            Saturate(acc, len, std::numeric_limits<DstT>::min(), std::numeric_limits<DstT>::max());
+        }
+
+        std::byte *row = dst.row(n, y);
+        for (int x = 0; x < dst.numCols; ++x)
+        {
+            std::byte *px = row + x * dst.colStride;
+            for (int c = 0; c < C; ++c)
+            {
+                *reinterpret_cast<DstT *>(px + mapC[c]) = static_cast<DstT>(acc[x * C + c]);
+            }
+        }
+    };
+
+    const float resizeX = static_cast<float>(src.numCols) / resizeDim.w;
+    const float resizeY = static_cast<float>(src.numRows) / resizeDim.h;
+
+    if (interpolation == NVCV_INTERP_NEAREST)
+    {
+        Taps hTaps = CropNearestTaps(src.numCols, dst.numCols, resizeX, cropPos.x);
+        Taps vTaps = CropNearestTaps(src.numRows, dst.numRows, resizeY, cropPos.y);
+
+        ForEachRowRange(dst.numSamples, dst.numRows,
+                        [&](int n, int y0, int y1)
+                        {
+                            std::vector<float> acc(dst.numCols * C);
+                            for (int y = y0; y < y1; ++y)
+                            {
+                                const std::byte *in = src.row(n, vTaps.index[y]);
+                                for (int x = 0; x < dst.numCols; ++x)
+                                {
+                                    const uint8_t *px = reinterpret_cast<const uint8_t *>(
+                                        in + hTaps.index[x] * src.colStride);
+                                    for (int c = 0; c < C; ++c) acc[x * C + c] = px[c];
+                                }
+                                // Nearest values are never cast back to the input type
+                                store(n, y, acc.data(), true);
+                            }
+                        });
+        return;
+    }
+
+    NVCV_ASSERT(interpolation == NVCV_INTERP_LINEAR);
+
+    RunSeparable<uint8_t>(src, dst.numRows, RowTaps(CropLinearTaps(src.numCols, dst.numCols, resizeX, cropPos.x), C),
+                          CropLinearTaps(src.numRows, dst.numRows, resizeY, cropPos.y),
+                          [&](int n, int y, float *acc) { store(n, y, acc, false); });
+}
+
+} // anonymous namespace
+
+void Resize(const nvcv::TensorDataStridedHost &srcData, const nvcv::TensorDataStridedHost &dstData,
+            const NVCVInterpolationType interpolation)
+{
+    if (srcData.dtype() != dstData.dtype())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output data type are different");
+    }
+    if (srcData.layout() != dstData.layout())
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output data layout are different");
+    }
+    if (srcData.layout() != nvcv::TENSOR_HWC && srcData.layout() != nvcv::TENSOR_NHWC)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input must have (N)HWC layout");
+    }
+
+    Image src(srcData), dst(dstData);
+
+    if (src.numSamples != dst.numSamples)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output samples are different");
+    }
+    if (src.numChannels != dst.numChannels)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Input and output channels are different");
+    }
+    if (src.numChannels > 4 || src.numChannels < 1)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid number of channels");
+    }
+
+    const nvcv::DataType type = srcData.dtype().channelType(0);
+
+    if (src.numChannels == 2)
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type");
+    }
+    else if (type == nvcv::TYPE_U8)
+    {
+        RunResize<uint8_t>(src, dst, interpolation);
+    }
+    else if (type == nvcv::TYPE_U16)
+    {
+        RunResize<uint16_t>(src, dst, interpolation);
+    }
+    else if (type == nvcv::TYPE_S16)
+    {
+        RunResize<int16_t>(src, dst, interpolation);
+    }
+    else if (type == nvcv::TYPE_F32)
+    {
+        RunResize<float>(src, dst, interpolation);
+    }
+    else
+    {
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid input data type");
+    }
+}
+
+void ResizeCropConvertReformat(const nvcv::TensorDataStridedHost &srcData, const nvcv::TensorDataStridedHost &dstData,
+                               const NVCVSize2D resizeDim, const NVCVInterpolationType interpolation,
+                               const int2 cropPos, const NVCVChannelManip manip, const float scale,
+                               const float offset, const bool srcCast)
+{
+    Image src(srcData), dst(dstData);
+    NVCV_ASSERT(src.numChannels == 3 && dst.numChannels == 3);
+
+    if (dstData.dtype().channelType(0) == nvcv::TYPE_U8)
+    {
+        RunResizeCropConvertReformat<uint8_t>(src, dst, resizeDim, interpolation, cropPos, manip, scale, offset,
+                                              srcCast);
+    }
+    else
+    {
+        NVCV_ASSERT(dstData.dtype().channelType(0) == nvcv::TYPE_F32);
+        RunResizeCropConvertReformat<float>(src, dst, resizeDim, interpolation, cropPos, manip, scale, offset,
+                                            srcCast);
+    }
+}
+
+} // namespace cvcuda::priv::host
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file ResizeHost.hpp
+ *
+ * @brief Defines the CPU implementations of the resize operations, used on tensors in host memory.
+ */
+
+#ifndef CVCUDA_PRIV_RESIZE_HOST_HPP
+#define CVCUDA_PRIV_RESIZE_HOST_HPP
+
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h>
+#include <nvcv/Size.h>
+#include <nvcv/TensorData.hpp>
+
+namespace cvcuda::priv::host {
+
+/** Resizes the images of a host tensor into another host tensor on the CPU.
+ *
+ * Filters are applied separably on the threads of nvcv::util::ThreadPool::Host(), the call returns once
+ * the output is written. Interpolation coordinates, border handling and rounding follow the device
+ * implementation of Resize, results may differ by one unit in the last place on integer types as
+ * the taps are summed in a different order.
+ */
+void Resize(const nvcv::TensorDataStridedHost &srcData, const nvcv::TensorDataStridedHost &dstData,
+            const NVCVInterpolationType interpolation);
+
+/** Resizes, crops, converts and reformats a host tensor into another host tensor on the CPU.
+ *
+ * Arguments are expected to be validated by the caller, as done for the device implementation.
+ */
+void ResizeCropConvertReformat(const nvcv::TensorDataStridedHost &srcData, const nvcv::TensorDataStridedHost &dstData,
+                               const NVCVSize2D resizeDim, const NVCVInterpolationType interpolation,
+                               const int2 cropPos, const NVCVChannelManip manip, const float scale,
+                               const float offset, const bool srcCast);
+
+} // namespace cvcuda::priv::host
+
+#endif // CVCUDA_PRIV_RESIZE_HOST_HPP
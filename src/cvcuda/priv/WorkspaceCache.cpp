@@ -0,0 +1,321 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkspaceCache.hpp"
+
+#include <nvcv/Exception.hpp>
+#include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <algorithm>
+
+namespace cvcuda::priv {
+
+size_t WorkspaceSizeClass(size_t size)
+{
+    if (size <= kMinWorkspaceBlockSize)
+        return kMinWorkspaceBlockSize;
+
+    // 4 classes per power of two, so that at most 25% of a block is wasted
+    size_t pow2 = nvcv::util::RoundUpNextPowerOfTwo(size + 1) / 2;
+    return nvcv::util::RoundUp(size, pow2 / 4);
+}
+
+// WorkspaceMemPool::Block ---------------------------------
+
+void WorkspaceMemPool::Block::reset()
+{
+    if (m_owner)
+    {
+        m_owner->m_bytesCached -= m_mem.req.size;
+        m_owner->freeMem(m_mem);
+        m_owner = nullptr;
+    }
+    m_mem = {};
+}
+
+NVCVWorkspaceMem WorkspaceMemPool::Block::release()
+{
+    NVCVWorkspaceMem mem = m_mem;
+    m_mem                = {};
+    m_owner              = nullptr;
+    return mem;
+}
+
+// WorkspaceMemPool ---------------------------------
+
+WorkspaceMemPool::WorkspaceMemPool(NVCVWorkspaceMemKind kind, nvcv::Allocator alloc, bool hostOnly,
+                                   std::shared_ptr<nvcv::util::EventCache> eventCache)
+    : m_kind(kind)
+    , m_alloc(std::move(alloc))
+    , m_hostOnly(hostOnly)
+    , m_eventCache(std::move(eventCache))
+{
+}
+
+WorkspaceMemPool::~WorkspaceMemPool()
+{
+    assert(m_bytesInUse == 0 && "Workspace memory is still in use");
+    m_cache.purge();
+}
+
+void *WorkspaceMemPool::allocateMem(size_t size, size_t alignment)
+{
+    if (m_hostOnly || m_kind == NVCV_WORKSPACE_MEM_HOST)
+        return m_alloc.hostMem().alloc(size, alignment);
+    else if (m_kind == NVCV_WORKSPACE_MEM_PINNED)
+        return m_alloc.hostPinnedMem().alloc(size, alignment);
+    else
+        return m_alloc.cudaMem().alloc(size, alignment);
+}
+
+void WorkspaceMemPool::freeMem(const NVCVWorkspaceMem &mem)
+{
+    if (mem.ready)
+    {
+        // The memory may be freed right away, make sure it isn't in use anymore.
+        // This runs from ~Block when the cache is purged or trimmed, so errors are only logged;
+        // an event that failed to synchronize isn't recycled.
+        nvcv::util::CudaEvent ready(mem.ready);
+        if (NVCV_CHECK_LOG(cudaEventSynchronize(mem.ready)))
+            m_eventCache->put(std::move(ready));
+    }
+
+    if (m_hostOnly || m_kind == NVCV_WORKSPACE_MEM_HOST)
+        m_alloc.hostMem().free(mem.data, mem.req.size, mem.req.alignment);
+    else if (m_kind == NVCV_WORKSPACE_MEM_PINNED)
+        m_alloc.hostPinnedMem().free(mem.data, mem.req.size, mem.req.alignment);
+    else
+        m_alloc.cudaMem().free(mem.data, mem.req.size, mem.req.alignment);
+    m_frees++;
+}
+
+void WorkspaceMemPool::updatePeak()
+{
+    size_t total = m_bytesInUse + m_bytesCached;
+    size_t peak  = m_peakBytes.load(std::memory_order_relaxed);
+    while (peak < total && !m_peakBytes.compare_exchange_weak(peak, total, std::memory_order_relaxed))
+    {
+    }
+}
+
+NVCVWorkspaceMem WorkspaceMemPool::acquire(NVCVWorkspaceMemRequirements req, std::optional<cudaStream_t> stream)
+{
+    if (req.size == 0)
+        return NVCVWorkspaceMem{req, nullptr, nullptr};
+
+    if (req.alignment == 0 || !nvcv::util::IsPowerOfTwo(req.alignment))
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT,
+                              "Workspace memory alignment must be a power of two, not %zu", req.alignment);
+
+    size_t size      = WorkspaceSizeClass(nvcv::util::RoundUp(req.size, req.alignment));
+    size_t alignment = req.alignment;
+
+    // Larger blocks are reused as long as they're not more than twice the size needed
+    auto cached = m_cache.getIf(
+        size,
+        [=](const Block &b)
+        {
+            return StreamCachePayloadSize(b) <= 2 * size && StreamCachePayloadAlignment(b) >= alignment;
+        },
+        stream);
+    if (cached)
+    {
+        m_hits++;
+        m_bytesCached -= cached->mem().req.size;
+        m_bytesInUse += cached->mem().req.size;
+        return cached->release();
+    }
+
+    m_misses++;
+
+    size_t maxTotal = m_maxTotalBytes;
+    if (m_bytesInUse + m_bytesCached + size > maxTotal)
+    {
+        m_cache.trim([&] { return m_bytesInUse + m_bytesCached + size > maxTotal; });
+        if (m_bytesInUse + m_bytesCached + size > maxTotal)
+            throw nvcv::Exception(nvcv::Status::ERROR_OUT_OF_MEMORY,
+                                  "Allocating %zu bytes of workspace memory would exceed the limit of %zu bytes", size,
+                                  maxTotal);
+    }
+
+    NVCVWorkspaceMem mem{{size, alignment}, nullptr, nullptr};
+    try
+    {
+        mem.data = allocateMem(size, alignment);
+    }
+    catch (const nvcv::Exception &e)
+    {
+        if (e.code() != nvcv::Status::ERROR_OUT_OF_MEMORY)
+            throw;
+        // Give the cached blocks back and try again
+        m_cache.trim([] { return true; });
+        mem.data = allocateMem(size, alignment);
+    }
+
+    if (!m_hostOnly && m_kind != NVCV_WORKSPACE_MEM_HOST)
+    {
+        try
+        {
+            mem.ready = m_eventCache->get().release();
+        }
+        catch (...)
+        {
+            freeMem(mem);
+            throw;
+        }
+    }
+
+    m_bytesInUse += size;
+    updatePeak();
+    return mem;
+}
+
+void WorkspaceMemPool::release(const NVCVWorkspaceMem &mem, std::optional<cudaStream_t> stream)
+{
+    if (mem.data == nullptr)
+        return;
+
+    size_t size = mem.req.size;
+    assert(m_bytesInUse >= size);
+    m_bytesInUse -= size;
+
+    size_t maxCached = m_maxCachedBytes;
+    if (size > maxCached)
+    {
+        freeMem(mem);
+        return;
+    }
+
+    m_bytesCached += size;
+    m_cache.put(Block(mem, this), stream);
+    updatePeak();
+
+    if (m_bytesCached > maxCached)
+        trim(maxCached);
+}
+
+void WorkspaceMemPool::setLimits(const NVCVWorkspaceCacheLimits &limits)
+{
+    m_maxCachedBytes = limits.maxCachedBytes;
+    m_maxTotalBytes  = limits.maxTotalBytes;
+    trim(std::min(limits.maxCachedBytes, limits.maxTotalBytes));
+}
+
+NVCVWorkspaceCacheLimits WorkspaceMemPool::limits() const
+{
+    return {m_maxCachedBytes, m_maxTotalBytes};
+}
+
+void WorkspaceMemPool::trim(size_t maxCachedBytes)
+{
+    m_cache.trim([&] { return m_bytesCached > maxCachedBytes; });
+}
+
+NVCVWorkspaceCacheStats WorkspaceMemPool::stats() const
+{
+    NVCVWorkspaceCacheStats stats;
+    stats.hits        = m_hits;
+    stats.misses      = m_misses;
+    stats.frees       = m_frees;
+    stats.bytesInUse  = m_bytesInUse;
+    stats.bytesCached = m_bytesCached;
+    stats.peakBytes   = m_peakBytes;
+    return stats;
+}
+
+// WorkspaceCache ---------------------------------
+
+WorkspaceCache::WorkspaceCache(nvcv::Allocator alloc, uint32_t flags)
+    : m_hostOnly((flags & NVCV_WORKSPACE_CACHE_HOST_ONLY) != 0)
+    , m_eventCache(std::make_shared<nvcv::util::EventCache>())
+{
+    if (flags & ~uint32_t(NVCV_WORKSPACE_CACHE_HOST_ONLY))
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid workspace cache flags %u", flags);
+
+    if (!alloc)
+        alloc = nvcv::CustomAllocator<>{};
+
+    for (int kind = 0; kind < (int)m_pools.size(); ++kind)
+    {
+        m_pools[kind] = std::make_unique<WorkspaceMemPool>(static_cast<NVCVWorkspaceMemKind>(kind), alloc, m_hostOnly,
+                                                           m_eventCache);
+    }
+}
+
+WorkspaceMemPool &WorkspaceCache::pool(NVCVWorkspaceMemKind kind)
+{
+    if (kind < 0 || kind >= (int)m_pools.size())
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Invalid workspace memory kind %d", (int)kind);
+    return *m_pools[kind];
+}
+
+// Plain host memory is never used in stream order, the other kinds are used on the operator's stream.
+std::optional<cudaStream_t> WorkspaceCache::streamFor(NVCVWorkspaceMemKind kind, cudaStream_t stream) const
+{
+    if (m_hostOnly || kind == NVCV_WORKSPACE_MEM_HOST)
+        return std::nullopt;
+    return stream;
+}
+
+NVCVWorkspace WorkspaceCache::acquire(const NVCVWorkspaceRequirements &req, cudaStream_t stream)
+{
+    NVCVWorkspace ws{};
+    ws.hostMem = pool(NVCV_WORKSPACE_MEM_HOST).acquire(req.hostMem, streamFor(NVCV_WORKSPACE_MEM_HOST, stream));
+    try
+    {
+        ws.pinnedMem
+            = pool(NVCV_WORKSPACE_MEM_PINNED).acquire(req.pinnedMem, streamFor(NVCV_WORKSPACE_MEM_PINNED, stream));
+        ws.cudaMem = pool(NVCV_WORKSPACE_MEM_CUDA).acquire(req.cudaMem, streamFor(NVCV_WORKSPACE_MEM_CUDA, stream));
+    }
+    catch (...)
+    {
+        release(ws, stream);
+        throw;
+    }
+    return ws;
+}
+
+void WorkspaceCache::release(const NVCVWorkspace &ws, cudaStream_t stream)
+{
+    pool(NVCV_WORKSPACE_MEM_HOST).release(ws.hostMem, streamFor(NVCV_WORKSPACE_MEM_HOST, stream));
+    pool(NVCV_WORKSPACE_MEM_PINNED).release(ws.pinnedMem, streamFor(NVCV_WORKSPACE_MEM_PINNED, stream));
+    pool(NVCV_WORKSPACE_MEM_CUDA).release(ws.cudaMem, streamFor(NVCV_WORKSPACE_MEM_CUDA, stream));
+}
+
+WorkspaceCache &ToWorkspaceCacheRef(NVCVWorkspaceCacheHandle handle)
+{
+    if (handle == nullptr)
+        throw nvcv::Exception(nvcv::Status::ERROR_INVALID_ARGUMENT, "Workspace cache handle must not be NULL");
+    return *reinterpret_cast<WorkspaceCache *>(handle);
+}
+
+// ScopedWorkspace ---------------------------------
+
+ScopedWorkspace::~ScopedWorkspace()
+{
+    try
+    {
+        m_cache.release(m_ws, m_stream);
+    }
+    catch (...)
+    {
+        // The memory is lost to the cache, there's nothing else to do in a destructor
+    }
+}
+
+} // namespace cvcuda::priv
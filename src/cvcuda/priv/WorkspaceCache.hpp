@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CVCUDA_PRIV_WORKSPACE_CACHE_HPP
+#define CVCUDA_PRIV_WORKSPACE_CACHE_HPP
+
+#include <cvcuda/Workspace.hpp>
+#include <cvcuda/WorkspaceCache.h>
+#include <cvcuda/util/PerStreamCache.hpp>
+#include <nvcv/alloc/Allocator.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <optional>
+
+namespace cvcuda::priv {
+
+// Smallest workspace block, sizes above it are rounded up to quarter octave steps.
+constexpr size_t kMinWorkspaceBlockSize = 256;
+
+size_t WorkspaceSizeClass(size_t size);
+
+// Cache of one kind of workspace memory.
+class WorkspaceMemPool
+{
+public:
+    // Payload of the per-stream cache, frees its memory when destroyed.
+    class Block
+    {
+    public:
+        Block() = default;
+
+        Block(const NVCVWorkspaceMem &mem, WorkspaceMemPool *owner)
+            : m_mem(mem)
+            , m_owner(owner)
+        {
+        }
+
+        Block(Block &&other)
+        {
+            *this = std::move(other);
+        }
+
+        Block &operator=(Block &&other)
+        {
+            std::swap(m_mem, other.m_mem);
+            std::swap(m_owner, other.m_owner);
+            other.reset();
+            return *this;
+        }
+
+        ~Block()
+        {
+            reset();
+        }
+
+        void reset();
+
+        // Gives up the ownership of the memory
+        NVCVWorkspaceMem release();
+
+        const NVCVWorkspaceMem &mem() const
+        {
+            return m_mem;
+        }
+
+        friend cudaEvent_t StreamCachePayloadReady(const Block &b)
+        {
+            return b.m_mem.ready;
+        }
+
+        friend size_t StreamCachePayloadSize(const Block &b)
+        {
+            return b.m_mem.req.size;
+        }
+
+        friend size_t StreamCachePayloadAlignment(const Block &b)
+        {
+            return b.m_mem.req.alignment;
+        }
+
+    private:
+        NVCVWorkspaceMem  m_mem{};
+        WorkspaceMemPool *m_owner = nullptr;
+    };
+
+    WorkspaceMemPool(NVCVWorkspaceMemKind kind, nvcv::Allocator alloc, bool hostOnly,
+                     std::shared_ptr<nvcv::util::EventCache> eventCache);
+    ~WorkspaceMemPool();
+
+    NVCVWorkspaceMem acquire(NVCVWorkspaceMemRequirements req, std::optional<cudaStream_t> stream);
+    void             release(const NVCVWorkspaceMem &mem, std::optional<cudaStream_t> stream);
+
+    void                     setLimits(const NVCVWorkspaceCacheLimits &limits);
+    NVCVWorkspaceCacheLimits limits() const;
+
+    void trim(size_t maxCachedBytes);
+
+    NVCVWorkspaceCacheStats stats() const;
+
+private:
+    void *allocateMem(size_t size, size_t alignment);
+    void  freeMem(const NVCVWorkspaceMem &mem);
+    void  updatePeak();
+
+    NVCVWorkspaceMemKind                    m_kind;
+    nvcv::Allocator                         m_alloc;
+    bool                                    m_hostOnly;
+    std::shared_ptr<nvcv::util::EventCache> m_eventCache;
+
+    nvcv::util::PerStreamCache<Block> m_cache;
+
+    std::atomic<size_t>   m_maxCachedBytes{NVCV_WORKSPACE_CACHE_UNLIMITED};
+    std::atomic<size_t>   m_maxTotalBytes{NVCV_WORKSPACE_CACHE_UNLIMITED};
+    std::atomic<size_t>   m_bytesInUse{0}, m_bytesCached{0}, m_peakBytes{0};
+    std::atomic<uint64_t> m_hits{0}, m_misses{0}, m_frees{0};
+};
+
+class WorkspaceCache
+{
+public:
+    using HandleType = NVCVWorkspaceCacheHandle;
+
+    WorkspaceCache(nvcv::Allocator alloc, uint32_t flags);
+
+    HandleType handle() const
+    {
+        return reinterpret_cast<HandleType>(const_cast<WorkspaceCache *>(this));
+    }
+
+    NVCVWorkspace acquire(const NVCVWorkspaceRequirements &req, cudaStream_t stream);
+    void          release(const NVCVWorkspace &ws, cudaStream_t stream);
+
+    WorkspaceMemPool &pool(NVCVWorkspaceMemKind kind);
+
+private:
+    std::optional<cudaStream_t> streamFor(NVCVWorkspaceMemKind kind, cudaStream_t stream) const;
+
+    bool                                             m_hostOnly;
+    std::shared_ptr<nvcv::util::EventCache>          m_eventCache;
+    std::array<std::unique_ptr<WorkspaceMemPool>, 3> m_pools;
+};
+
+// Workspace acquired from a cache for the work scheduled on a stream, returned to it when going out of scope.
+// This is how operators keep internal scratch memory per stream: they own a WorkspaceCache and take a
+// ScopedWorkspace from it in each call. The memory comes with its ready events, honored by a
+// WorkspaceMemAllocator destroyed before this.
+class ScopedWorkspace
+{
+public:
+    ScopedWorkspace(WorkspaceCache &cache, const NVCVWorkspaceRequirements &req, cudaStream_t stream)
+        : m_cache(cache)
+        , m_stream(stream)
+        , m_ws(cache.acquire(req, stream))
+    {
+    }
+
+    ScopedWorkspace(const ScopedWorkspace &)            = delete;
+    ScopedWorkspace &operator=(const ScopedWorkspace &) = delete;
+
+    ~ScopedWorkspace();
+
+    const NVCVWorkspace &get() const
+    {
+        return m_ws;
+    }
+
+private:
+    WorkspaceCache &m_cache;
+    cudaStream_t    m_stream;
+    NVCVWorkspace   m_ws;
+};
+
+WorkspaceCache &ToWorkspaceCacheRef(NVCVWorkspaceCacheHandle handle);
+
+} // namespace cvcuda::priv
+
+#endif // CVCUDA_PRIV_WORKSPACE_CACHE_HPP
@@ -19,6 +19,7 @@
 #define CV_CUDA_LEGACY_H
 
 #include "CvCudaOSD.hpp"
+#include "pillow_resize_coeffs.hpp"
 
 #include <cuda_runtime.h>
 #include <curand_kernel.h>
@@ -655,8 +656,7 @@ public:
 class Morphology : public CudaBaseOp
 {
 public:
-    Morphology()          = default;
-    virtual ~Morphology() = default;
+    Morphology() = default;
 
     /**
      * @brief Dilates/Erodes an image
@@ -710,11 +710,19 @@ public:
      * @param anchor anchor to use for the kernel (-1,-1) will use center of kernel
      * @param noop if 0 this will be a copy operation
      * @param borderMode the border mode to use when accessing data outside of source
+     * @param rowBuffer device buffer of rowBufferSize bytes for the row pass of large kernels, may be null
+     *                  to always use the direct kernel
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                     NVCVMorphologyType morph_type, Size2D mask_size, int2 anchor, bool noop,
-                    const NVCVBorderType borderMode, cudaStream_t stream);
+                    const NVCVBorderType borderMode, void *rowBuffer, cudaStream_t stream);
+
+    /**
+     * @brief Returns the size of the row buffer infer needs to run the mask as separable passes, 0 if it doesn't
+     */
+    size_t rowBufferSize(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                         Size2D mask_size) const;
 };
 
 class MorphologyVarShape : public CudaBaseOp
@@ -1000,13 +1008,20 @@ public:
      * data_type.
      * @param workspace gpu pointer, gpu memory used to store the temporary variables.
      * @param ksize median blur kernel size.
+     * @param histBuffer device buffer of histBufferSize bytes for the column histograms of large 8bit kernels,
+     * may be null to always select per pixel.
      * @param input_shape shape of the input images.
      * @param format format of the input images, e.g. kNHWC.
      * @param data_type data type of the input images, e.g. kCV_32F.
      * @param stream for the asynchronous execution.
      */
     ErrorCode infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData, const nvcv::Size2D ksize,
-                    cudaStream_t stream);
+                    void *histBuffer, cudaStream_t stream);
+
+    /**
+     * @brief Returns the size of the histogram buffer infer needs for the given input and kernel, 0 if it doesn't
+     */
+    size_t histBufferSize(const TensorDataStridedCuda &inData, const nvcv::Size2D ksize) const;
 };
 
 class NormalizeVarShape : public CudaBaseOp
@@ -2048,10 +2063,21 @@ class OSD : public CudaBaseOp
 public:
     OSD() = delete;
 
-    OSD(DataShape max_input_shape, DataShape max_output_shape);
+    /**
+     * @param num_raster_threads Threads rasterizing new text glyphs, <= 0 selects the default.
+     */
+    OSD(DataShape max_input_shape, DataShape max_output_shape, int num_raster_threads = 0);
 
     ~OSD();
 
+    /**
+     * @brief Rasterize the glyphs of the given characters ahead of time, waits for their upload on stream.
+     * @param utf8_text Characters to prepare, whitespace is ignored.
+     * @param font Font name, \ref NVCVText.
+     * @param font_size Font size, \ref NVCVText.
+     */
+    ErrorCode prewarm(const char *utf8_text, const char *font, int font_size, cudaStream_t stream);
+
     /**
      * @brief Draw OSD elements onto input tensor, then return back output tensor.
      * @param inData Input tensor.
@@ -2386,6 +2412,13 @@ public:
 class PillowResize : public CudaBaseOp
 {
 public:
+    /**
+     * @brief Coefficient tables are cached across calls and streams.
+     * @param coeff_cache_size how many tables are kept, 0 disables the cache and computes them on the device
+     * at each call.
+     */
+    explicit PillowResize(int coeff_cache_size);
+
     /**
      * @brief Resizes the input images. The function resize resizes the image down to or up to the specified size.
      * @param inputs gpu pointer, inputs[0] are batched input images, whose shape is input_shape and type is data_type.
@@ -2405,6 +2438,9 @@ public:
 
     NVCVWorkspaceRequirements getWorkspaceRequirements(DataShape max_input_shape, DataShape max_output_shape,
                                                        DataType max_data_type);
+
+private:
+    std::unique_ptr<PillowResizeCoeffCache> m_coeffCache;
 };
 
 class PillowResizeVarShape : public CudaBaseOp
@@ -2694,6 +2730,21 @@ public:
      */
     ErrorCode infer(const TensorDataStridedCuda &inData, OptionalTensorConstRef mask,
                     const TensorDataStridedCuda &histogram, cudaStream_t stream);
+
+    /**
+     * @brief Histogram of 8-bit, 16-bit or float images binned over value ranges
+     * @param inData input tensor kNHWC/HWC tensor representing the input image(s)
+     * @param mask mask tensor of the same size as the input image(s). Only non-zero values are counted for histogram.
+     * @param histogram output tensor, HWC of one row per image and one channel per input channel when per-channel,
+     * NHW of one 2D histogram per image when joint.
+     * @param mode per-channel or joint 2D histogram.
+     * @param ranges ranges of values binned along the histogram axes, one per axis or one for all of them.
+     * @param numRanges number of ranges, the type range is used if 0.
+     * @param stream for the asynchronous execution.
+     */
+    ErrorCode infer(const TensorDataStridedCuda &inData, OptionalTensorConstRef mask,
+                    const TensorDataStridedCuda &histogram, NVCVHistogramMode mode, const NVCVHistogramRange *ranges,
+                    int numRanges, cudaStream_t stream);
 };
 
 class Inpaint : public CudaBaseOp
@@ -18,14 +18,19 @@
 #ifndef CV_CUDA_OSD_HPP
 #define CV_CUDA_OSD_HPP
 
+#include "osd_binning.hpp"
 #include "textbackend/backend.hpp"
 
 #include <cuda_runtime.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace nvcv::cuda { namespace osd {
@@ -97,6 +102,35 @@ public:
         size_ = size;
     }
 
+    // Grows to hold at least capacity elements, keeping the host contents.
+    void reserve(size_t capacity)
+    {
+        if (capacity_ >= capacity)
+            return;
+
+        T *host   = nullptr;
+        T *device = nullptr;
+        checkRuntime(cudaMallocHost(&host, capacity * sizeof(T)));
+        checkRuntime(cudaMalloc(&device, capacity * sizeof(T)));
+        if (host_ && size_ > 0)
+            memcpy(host, host_, bytes());
+
+        size_t size = size_;
+        free_memory();
+        host_     = host;
+        device_   = device;
+        capacity_ = capacity;
+        size_     = size;
+    }
+
+    // Like alloc_or_resize_to, but keeps the host contents and grows geometrically.
+    void resize(size_t size)
+    {
+        if (capacity_ < size)
+            reserve(std::max(size, capacity_ * 2));
+        size_ = size;
+    }
+
     void free_memory()
     {
         if (host_ || device_)
@@ -160,7 +194,7 @@ enum class CommandType : int
 struct TextLocation
 {
     int image_x, image_y;
-    int text_x;
+    int text_x, text_y;
     int text_w, text_h;
 };
 
@@ -264,11 +298,12 @@ struct BoxBlurCommand
 };
 
 // TextCommand:
-// text_line_size && ilocation are inner attribute for text memory management
+// text_line_size && ilocation are inner attribute for text memory management,
+// the glyph locations of the line are text_location[ilocation, ilocation + text_line_size)
 struct TextCommand : cuOSDContextCommand
 {
-    int text_line_size;
-    int ilocation;
+    int text_line_size = 0;
+    int ilocation      = 0;
 
     TextCommand() = default;
 
@@ -285,46 +320,122 @@ struct TextCommand : cuOSDContextCommand
     }
 };
 
-struct TextHostCommand : cuOSDContextCommand
+// TextHostCommand:
+// host only part of a text command, its TextCommand is commands[command] in the arena
+// and gets its glyph locations and bounding box once the glyphs are ready
+struct TextHostCommand
 {
-    TextCommand                    gputile;
+    int                            command;
     std::vector<unsigned long int> text;
     unsigned short                 font_size;
     std::string                    font_name;
     int                            x, y;
 
-    TextHostCommand(int batch_idx, const std::vector<unsigned long int> &text, unsigned short font_size,
-                    const char *font, int x, int y, unsigned char c0, unsigned char c1, unsigned char c2,
-                    unsigned char c3)
+    TextHostCommand(int command, std::vector<unsigned long int> text, unsigned short font_size, const char *font,
+                    int x, int y)
+        : command(command)
+        , text(std::move(text))
+        , font_size(font_size)
+        , font_name(font)
+        , x(x)
+        , y(y)
     {
-        this->batch_index = batch_idx;
-        this->text        = text;
-        this->font_size   = font_size;
-        this->font_name   = font;
-        this->x           = x;
-        this->y           = y;
-        this->c0          = c0;
-        this->c1          = c1;
-        this->c2          = c2;
-        this->c3          = c3;
-        this->type        = CommandType::Text;
     }
 };
 
+// CommandArena:
+// append only stream of the commands of a frame, serialized in the pinned host buffer
+// in the layout the render kernel reads them, with the byte offset of each command.
+// It's cleared after every frame and keeps its buffers for the next one.
+// Pointers returned by emplace and at are only valid until the next emplace.
+class CommandArena
+{
+public:
+    CommandArena()                                = default;
+    CommandArena(const CommandArena &)            = delete;
+    CommandArena &operator=(const CommandArena &) = delete;
+
+    // Makes room for num_commands commands taking bytes in total.
+    void reserve(size_t num_commands, size_t bytes)
+    {
+        offsets_.reserve(num_commands);
+        data_.reserve(bytes);
+    }
+
+    template<class Command, class... Args>
+    Command *emplace(Args &&...args)
+    {
+        static_assert(std::is_base_of<cuOSDContextCommand, Command>::value, "Command must be a cuOSDContextCommand");
+        static_assert(std::is_trivially_destructible<Command>::value, "Commands are never destroyed");
+
+        size_t offset = (data_.size() + alignof(Command) - 1) / alignof(Command) * alignof(Command);
+        data_.resize(offset + sizeof(Command));
+        offsets_.resize(offsets_.size() + 1);
+        offsets_.host()[offsets_.size() - 1] = offset;
+        return new (data_.host() + offset) Command(std::forward<Args>(args)...);
+    }
+
+    int size() const
+    {
+        return (int)offsets_.size();
+    }
+
+    bool empty() const
+    {
+        return offsets_.size() == 0;
+    }
+
+    template<class Command = cuOSDContextCommand>
+    Command *at(int i) const
+    {
+        return reinterpret_cast<Command *>(data_.host() + offsets_.host()[i]);
+    }
+
+    const unsigned char *device_data() const
+    {
+        return data_.device();
+    }
+
+    const int *device_offsets() const
+    {
+        return offsets_.device();
+    }
+
+    void upload(cudaStream_t stream)
+    {
+        data_.copy_host_to_device(stream);
+        offsets_.copy_host_to_device(stream);
+    }
+
+    void clear()
+    {
+        data_.resize(0);
+        offsets_.resize(0);
+    }
+
+private:
+    Memory<unsigned char> data_;
+    Memory<int>           offsets_;
+};
+
 struct cuOSDContext
 {
     std::unique_ptr<Memory<TextLocation>> text_location;
-    std::unique_ptr<Memory<int>>          line_location_base;
 
-    std::vector<std::shared_ptr<cuOSDContextCommand>> commands;
-    std::unique_ptr<Memory<unsigned char>>            gpu_commands;
-    std::unique_ptr<Memory<int>>                      gpu_commands_offset;
+    CommandArena                 commands;
+    std::vector<TextHostCommand> text_commands;
+
+    // commands binned into screen tiles, see bin_commands
+    CommandBins                  bins;
+    std::unique_ptr<Memory<int>> gpu_tile_offsets;
+    std::unique_ptr<Memory<int>> gpu_tile_commands;
 
     std::vector<std::shared_ptr<BoxBlurCommand>> blur_commands;
     std::unique_ptr<Memory<BoxBlurCommand>>      gpu_blur_commands;
 
     std::shared_ptr<TextBackend> text_backend;
     cuOSDTextBackend             text_backend_type = cuOSDTextBackend::StbTrueType;
+    int                          raster_threads    = 0; // <= 0 selects the default
 
     bool have_rotate_msaa = false;
     int  bounding_left    = 0;
@@ -26,6 +26,8 @@
 #include <cvcuda/cuda_tools/MathWrappers.hpp>
 #include <cvcuda/cuda_tools/SaturateCast.hpp>
 
+#include <cmath>
+
 using namespace nvcv::legacy::helpers;
 using namespace nvcv::legacy::cuda_op;
 
@@ -95,6 +97,159 @@ __global__ void calc_hist_kernel(const SrcWrapper src, DstWrapper histogram, Mas
     }
 }
 
+#define BINNED_HIST_BLOCK      256         // threads per block of the binned histogram
+#define BINNED_HIST_PIXELS     8           // pixels binned by each thread
+#define BINNED_HIST_SMEM_LIMIT (48 * 1024) // shared memory for the copies of the histogram of a block
+
+// Binning of the histogram axes, one axis per channel, or the first two channels when joint.
+struct HistogramAxes
+{
+    int   numBins[4];
+    float lowerBound[4];
+    float upperBound[4];
+    float scale[4]; // numBins / (upperBound - lowerBound)
+};
+
+// Counts every pixel when no mask is given.
+struct HistogramNoMask
+{
+    __device__ uchar operator[](int3) const
+    {
+        return 1;
+    }
+};
+
+// Bin of the value along the axis, -1 if out of the range of the axis.
+template<typename T>
+__device__ __forceinline__ int binned_hist_bin(T value, const HistogramAxes &axes, int axis)
+{
+    float v = static_cast<float>(value);
+    if (!(v >= axes.lowerBound[axis] && v < axes.upperBound[axis]))
+    {
+        return -1;
+    }
+    return min(static_cast<int>((v - axes.lowerBound[axis]) * axes.scale[axis]), axes.numBins[axis] - 1);
+}
+
+/**
+ * Each thread bins BINNED_HIST_PIXELS pixels into a sub-histogram in shared memory. Each warp has its own copy of
+ * the histogram when they fit in BINNED_HIST_SMEM_LIMIT, otherwise warps share the copies that fit, and bins are
+ * counted directly in the output when not even one does. The copies are then summed into the output.
+ */
+template<bool Joint, class SrcWrapper, class MaskWrapper, class DstWrapper>
+__global__ void binned_hist_kernel(const SrcWrapper src, MaskWrapper mask, DstWrapper histogram,
+                                   const HistogramAxes axes, int channels, int numPixels, int width, int totalBins,
+                                   int numCopies)
+{
+    extern __shared__ int shist[]; // numCopies * totalBins * sizeof(int)
+
+    int  batch_idx = get_batch_idx();
+    int *hist      = numCopies > 0 ? shist + (threadIdx.x / 32) % numCopies * totalBins : nullptr;
+
+    for (int i = threadIdx.x; i < numCopies * totalBins; i += blockDim.x)
+    {
+        shist[i] = 0;
+    }
+    __syncthreads();
+
+    auto count = [&](int bin)
+    {
+        if (hist != nullptr)
+        {
+            atomicAdd(&hist[bin], 1);
+        }
+        else
+        {
+            atomicAdd(histogram.ptr(batch_idx, bin), 1);
+        }
+    };
+
+    int tid = blockIdx.x * blockDim.x * BINNED_HIST_PIXELS + threadIdx.x;
+    for (int i = 0; i < BINNED_HIST_PIXELS && tid < numPixels; i++, tid += blockDim.x)
+    {
+        int x = tid % width;
+        int y = tid / width;
+        if (!mask[int3{x, y, batch_idx}])
+        {
+            continue;
+        }
+
+        if constexpr (Joint)
+        {
+            int bin0 = binned_hist_bin(*src.ptr(batch_idx, y, x, 0), axes, 0);
+            int bin1 = binned_hist_bin(*src.ptr(batch_idx, y, x, 1), axes, 1);
+            if (bin0 >= 0 && bin1 >= 0)
+            {
+                count(bin0 * axes.numBins[1] + bin1);
+            }
+        }
+        else
+        {
+            for (int c = 0; c < channels; c++)
+            {
+                int bin = binned_hist_bin(*src.ptr(batch_idx, y, x, c), axes, c);
+                if (bin >= 0)
+                {
+                    count(bin * channels + c);
+                }
+            }
+        }
+    }
+    __syncthreads();
+
+    for (int i = threadIdx.x; numCopies > 0 && i < totalBins; i += blockDim.x)
+    {
+        int hist_val = 0;
+        for (int k = 0; k < numCopies; k++)
+        {
+            hist_val += shist[k * totalBins + i];
+        }
+        if (hist_val > 0)
+        {
+            atomicAdd(histogram.ptr(batch_idx, i), hist_val);
+        }
+    }
+}
+
+template<typename T>
+void binned_hist(const TensorDataStridedCuda &inData, const TensorDataStridedCuda *maskData,
+                 const TensorDataStridedCuda &histogram, const HistogramAxes &axes, bool joint, int batch,
+                 int channels, int rows, int cols, int totalBins, cudaStream_t stream)
+{
+    auto src   = nvcv::cuda::CreateTensorWrapNHWC<T>(inData);
+    auto histo = nvcv::cuda::Tensor2DWrap<int>(reinterpret_cast<int *>(histogram.basePtr()),
+                                               static_cast<int>(histogram.stride(0)));
+
+    int numCopies = std::min(BINNED_HIST_BLOCK / 32, BINNED_HIST_SMEM_LIMIT / (totalBins * (int)sizeof(int)));
+    int smem_size = numCopies * totalBins * sizeof(int);
+
+    dim3 grid_size(divUp(rows * cols, BINNED_HIST_BLOCK * BINNED_HIST_PIXELS), 1, batch);
+
+    auto launch = [&](auto mask)
+    {
+        if (joint)
+        {
+            binned_hist_kernel<true><<<grid_size, BINNED_HIST_BLOCK, smem_size, stream>>>(
+                src, mask, histo, axes, channels, rows * cols, cols, totalBins, numCopies);
+        }
+        else
+        {
+            binned_hist_kernel<false><<<grid_size, BINNED_HIST_BLOCK, smem_size, stream>>>(
+                src, mask, histo, axes, channels, rows * cols, cols, totalBins, numCopies);
+        }
+        checkKernelErrors();
+    };
+
+    if (maskData == nullptr)
+    {
+        launch(HistogramNoMask{});
+    }
+    else
+    {
+        launch(nvcv::cuda::CreateTensorWrapNHW<uchar>(*maskData));
+    }
+}
+
 namespace nvcv::legacy::cuda_op {
 
 ErrorCode Histogram::infer(const TensorDataStridedCuda &inData, OptionalTensorConstRef mask,
@@ -191,4 +346,129 @@ ErrorCode Histogram::infer(const TensorDataStridedCuda &inData, OptionalTensorCo
     return ErrorCode::SUCCESS;
 }
 
+ErrorCode Histogram::infer(const TensorDataStridedCuda &inData, OptionalTensorConstRef mask,
+                           const TensorDataStridedCuda &histogram, NVCVHistogramMode mode,
+                           const NVCVHistogramRange *ranges, int numRanges, cudaStream_t stream)
+{
+    DataFormat input_format = GetLegacyDataFormat(inData.layout());
+    DataType   data_type    = GetLegacyDataType(inData.dtype());
+
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    NVCV_ASSERT(inAccess);
+
+    if (!(input_format == kNHWC || input_format == kHWC))
+    {
+        LOG_ERROR("Invalid input DataFormat for calculating histogram " << input_format);
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (!(data_type == kCV_8U || data_type == kCV_16U || data_type == kCV_32F))
+    {
+        LOG_ERROR("Invalid DataType for calculating histogram " << data_type);
+        return ErrorCode::INVALID_DATA_TYPE;
+    }
+
+    if (!(mode == NVCV_HISTOGRAM_PER_CHANNEL || mode == NVCV_HISTOGRAM_JOINT_2D))
+    {
+        LOG_ERROR("Invalid histogram mode " << mode);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    DataShape input_shape = GetLegacyDataShape(inAccess->infoShape());
+
+    int  batch    = input_shape.N;
+    int  channels = input_shape.C;
+    int  rows     = input_shape.H;
+    int  cols     = input_shape.W;
+    bool joint    = mode == NVCV_HISTOGRAM_JOINT_2D;
+    int  numAxes  = joint ? 2 : channels;
+
+    if (channels < 1 || channels > 4 || channels < numAxes)
+    {
+        LOG_ERROR("Invalid channel number " << channels);
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    // Per-channel histograms are the rows of an HWC tensor, bins interleaving channels, joint histograms are the
+    // samples of an NHW tensor. The bins of each histogram must be packed.
+    if (histogram.layout() != (joint ? nvcv::TENSOR_NHW : nvcv::TENSOR_HWC)
+        || !(histogram.dtype() == nvcv::TYPE_S32 || histogram.dtype() == nvcv::TYPE_U32))
+    {
+        LOG_ERROR("Invalid histogram tensor " << histogram.layout() << " " << histogram.dtype());
+        return ErrorCode::INVALID_DATA_FORMAT;
+    }
+
+    if (histogram.shape(0) != batch || (!joint && histogram.shape(2) != channels) || histogram.shape(1) < 1
+        || histogram.shape(2) < 1 || histogram.stride(2) != (int64_t)sizeof(int)
+        || histogram.stride(1) != histogram.shape(2) * (int64_t)sizeof(int))
+    {
+        LOG_ERROR("Invalid histogram tensor shape " << histogram.shape() << " for an input of " << batch
+                                                     << " samples of " << channels << " channels");
+        return ErrorCode::INVALID_DATA_SHAPE;
+    }
+
+    if (!(numRanges == 0 || numRanges == 1 || numRanges == numAxes))
+    {
+        LOG_ERROR("Invalid number of histogram ranges " << numRanges << ", expected 0, 1 or " << numAxes);
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    NVCVHistogramRange typeRange{0.f, data_type == kCV_8U ? 256.f : (data_type == kCV_16U ? 65536.f : 1.f)};
+
+    HistogramAxes axes;
+    for (int i = 0; i < numAxes; i++)
+    {
+        NVCVHistogramRange range = numRanges == 0 ? typeRange : ranges[numRanges == 1 ? 0 : i];
+        if (!(std::isfinite(range.lowerBound) && std::isfinite(range.upperBound)
+              && range.lowerBound < range.upperBound))
+        {
+            LOG_ERROR("Invalid histogram range [" << range.lowerBound << ", " << range.upperBound << ")");
+            return ErrorCode::INVALID_PARAMETER;
+        }
+
+        axes.numBins[i]    = static_cast<int>(joint ? histogram.shape(1 + i) : histogram.shape(1));
+        axes.lowerBound[i] = range.lowerBound;
+        axes.upperBound[i] = range.upperBound;
+        axes.scale[i]      = axes.numBins[i] / (range.upperBound - range.lowerBound);
+    }
+
+    int totalBins = histogram.shape(1) * histogram.shape(2);
+
+    Optional<TensorDataStridedCuda> maskTensorData;
+    if (mask != nullptr)
+    {
+        maskTensorData = mask->get().exportData<nvcv::TensorDataStridedCuda>();
+        NVCV_ASSERT(maskTensorData);
+        auto inMask = nvcv::TensorDataAccessStridedImagePlanar::Create(*maskTensorData);
+        NVCV_ASSERT(inMask);
+
+        DataShape mask_shape = GetLegacyDataShape(inMask->infoShape());
+        if (mask_shape.N != batch || mask_shape.H != rows || mask_shape.W != cols || mask_shape.C != 1)
+        {
+            LOG_ERROR("Mask tensor does not match input tensor shape");
+            return ErrorCode::INVALID_DATA_SHAPE;
+        }
+    }
+
+    checkCudaErrors(
+        cudaMemset2DAsync(histogram.basePtr(), histogram.stride(0), 0, totalBins * sizeof(int), batch, stream));
+
+    typedef void (*binned_hist_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda *maskData,
+                                  const TensorDataStridedCuda &histogram, const HistogramAxes &axes, bool joint,
+                                  int batch, int channels, int rows, int cols, int totalBins, cudaStream_t stream);
+
+    static const binned_hist_t funcs[6] = {
+        binned_hist<uchar>, 0, binned_hist<ushort>, 0, 0, binned_hist<float>,
+    };
+
+    funcs[data_type](inData, maskTensorData ? &*maskTensorData : nullptr, histogram, axes, joint, batch, channels,
+                     rows, cols, totalBins, stream);
+
+    return ErrorCode::SUCCESS;
+}
+
 } // namespace nvcv::legacy::cuda_op
+
+#undef BINNED_HIST_BLOCK
+#undef BINNED_HIST_PIXELS
+#undef BINNED_HIST_SMEM_LIMIT
@@ -26,6 +26,14 @@
 #define GENERAL_KERNEL_BLOCK 32
 #define SMALL_KERNEL_BLOCK   16
 
+#define HIST_TILE_WIDTH  32    // output columns of a histogram tile
+#define HIST_TILE_HEIGHT 64    // output rows of a histogram tile
+#define HIST_WARPS       4     // warps per block of the histogram median, each works on its own tile
+#define HIST_MAX_BLOCKS  512   // bounds the column histogram workspace
+#define HIST_BINS        256   // bins per histogram, 8 per lane
+#define HIST_MIN_AREA    121   // smallest window selected with histograms
+#define HIST_MAX_HEIGHT  65535 // column histograms count in 16 bits
+
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
 
@@ -328,6 +336,265 @@ __global__ void medianForSmallKernel(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, c
 #undef fetch_
 #undef fetchAs1d
 
+// Histogram bin of a pixel, 16-bit pixels are binned by their high byte first and then by their low byte.
+template<typename T>
+__device__ __forceinline__ int histBin(T v)
+{
+    return sizeof(T) == 1 ? v : (v >> 8);
+}
+
+// Adds the 8 bins of a column histogram that belong to the calling lane, or subtracts them if Sign is -1.
+template<int Sign>
+__device__ __forceinline__ void addHistBins(int (&hist)[8], const ushort *colHist)
+{
+    const uint4   bins = reinterpret_cast<const uint4 *>(colHist)[threadIdx.x];
+    const ushort *b    = reinterpret_cast<const ushort *>(&bins);
+#pragma unroll
+    for (int i = 0; i < 8; i++)
+    {
+        hist[i] += Sign * b[i];
+    }
+}
+
+/**
+ * Finds the bin of a histogram spread over a warp that holds the element of the given rank.
+ * Lane l holds bins [8l, 8l + 8).
+ * @param hist the bins of the calling lane.
+ * @param rank rank of the element, on return its rank among the elements of the found bin.
+ * @return the index of the found bin, the same on all lanes.
+ */
+__device__ __forceinline__ int selectHistBin(const int (&hist)[8], int &rank)
+{
+    const int lane = threadIdx.x;
+
+    int sum = 0;
+#pragma unroll
+    for (int i = 0; i < 8; i++)
+    {
+        sum += hist[i];
+    }
+
+    int incl = sum;
+#pragma unroll
+    for (int offset = 1; offset < 32; offset *= 2)
+    {
+        int n = __shfl_up_sync(0xffffffff, incl, offset);
+        if (lane >= offset)
+        {
+            incl += n;
+        }
+    }
+    int below = incl - sum;
+    int owner = __ffs(__ballot_sync(0xffffffff, below <= rank && rank < incl)) - 1;
+
+    int bin = 0;
+#pragma unroll
+    for (int i = 0; i < 8; i++)
+    {
+        if (bin == i && below + hist[i] <= rank)
+        {
+            below += hist[i];
+            bin = i + 1;
+        }
+    }
+    rank -= __shfl_sync(0xffffffff, below, owner);
+    return __shfl_sync(0xffffffff, lane * 8 + bin, owner);
+}
+
+/**
+ * Adds the window pixels of an input column that fall in a coarse bin to the fine histogram of their low byte,
+ * or subtracts them if sign is -1. The lanes of the warp split the column.
+ * @param fine fine histogram of the warp, in shared memory.
+ * @param gx input column, replicated at the border.
+ * @param y output row, the window spans rows [y - ry, y + ry].
+ * @param coarseBin high byte of the pixels to count.
+ */
+__device__ __forceinline__ void addFineColumn(int *fine, const Ptr2dNHWC<ushort> &src, int batchIdx, int channel,
+                                              int gx, int y, int ry, int coarseBin, int sign)
+{
+    gx = min(max(gx, 0), src.cols - 1);
+    for (int j = (int)threadIdx.x - ry; j <= ry; j += 32)
+    {
+        const ushort v = *src.ptr(batchIdx, min(max(y + j, 0), src.rows - 1), gx, channel);
+        if (histBin(v) == coarseBin)
+        {
+            atomicAdd(&fine[v & 0xff], sign);
+        }
+    }
+}
+
+/**
+ * Perform median filter on the image with sliding histograms (Perreault & Hebert).
+ * Each warp filters tiles of HIST_TILE_WIDTH x HIST_TILE_HEIGHT pixels of one channel, row by row. It keeps one
+ * histogram per input column of the tile over the kernel height, slides them down a row by removing and adding a
+ * pixel, and slides the kernel histogram along the row by adding and removing a column histogram, so the cost per
+ * pixel does not depend on the kernel size. 8-bit pixels are selected out of the 256-bin histograms.
+ * 16-bit pixels are binned by their high byte in the column histograms. The low byte is then selected out of a fine
+ * histogram of the window pixels of the coarse bin that holds the median. It is slid along the row with the kernel by
+ * adding and removing an input column, and only refilled from the whole window when the median moves to another
+ * coarse bin.
+ * @tparam T The type of the pixels stored, uchar or ushort.
+ * @param src a Ptr2dNHWC <T> stored in global memory.
+ * @param dst a Ptr2dNHWC <T> stored in global memory.
+ * @param kWidth width of the kernel.
+ * @param kHeight height of the kernel.
+ * @param colHists workspace of (HIST_TILE_WIDTH + kWidth - 1) column histograms per warp.
+ * @param tilesX number of tiles along the width.
+ * @param tilesY number of tiles along the height.
+ */
+template<typename T>
+__global__ void medianHistogram(const Ptr2dNHWC<T> src, Ptr2dNHWC<T> dst, const int kWidth, const int kHeight,
+                                ushort *colHists, const int tilesX, const int tilesY)
+{
+    // Fine histograms of the 16-bit low bytes, one per warp
+    __shared__ int fineHists[HIST_WARPS][sizeof(T) > 1 ? HIST_BINS : 1];
+
+    const int lane     = threadIdx.x;
+    const int warp     = blockIdx.x * blockDim.y + threadIdx.y;
+    const int h        = src.rows, w = src.cols;
+    const int rx       = kWidth / 2, ry = kHeight / 2;
+    const int numTiles = tilesX * tilesY * dst.ch * dst.batches;
+
+    ushort *hists = colHists + (size_t)warp * (HIST_TILE_WIDTH + kWidth - 1) * HIST_BINS;
+    int    *fine  = fineHists[threadIdx.y];
+
+    for (int tile = warp; tile < numTiles; tile += gridDim.x * blockDim.y)
+    {
+        const int channel  = tile / (tilesX * tilesY) % dst.ch;
+        const int batchIdx = tile / (tilesX * tilesY) / dst.ch;
+        const int x0       = tile % tilesX * HIST_TILE_WIDTH;
+        const int y0       = tile / tilesX % tilesY * HIST_TILE_HEIGHT;
+        const int x1       = min(x0 + HIST_TILE_WIDTH, w);
+        const int y1       = min(y0 + HIST_TILE_HEIGHT, h);
+        const int cols     = x1 - x0 + kWidth - 1; // column histogram c is centered on x0 - rx + c
+
+        // Column histograms of the first row, replicating the border.
+        for (int i = lane; i < cols * HIST_BINS / 8; i += 32)
+        {
+            reinterpret_cast<uint4 *>(hists)[i] = make_uint4(0, 0, 0, 0);
+        }
+        __syncwarp();
+        for (int c = lane; c < cols; c += 32)
+        {
+            const int gx = min(max(x0 - rx + c, 0), w - 1);
+            for (int gy = y0 - ry; gy <= y0 + ry; gy++)
+            {
+                hists[c * HIST_BINS + histBin(*src.ptr(batchIdx, min(max(gy, 0), h - 1), gx, channel))]++;
+            }
+        }
+        __syncwarp();
+
+        for (int y = y0; y < y1; y++)
+        {
+            if (y > y0)
+            {
+                const int outY = max(y - 1 - ry, 0), inY = min(y + ry, h - 1);
+                for (int c = lane; c < cols; c += 32)
+                {
+                    const int gx = min(max(x0 - rx + c, 0), w - 1);
+                    hists[c * HIST_BINS + histBin(*src.ptr(batchIdx, outY, gx, channel))]--;
+                    hists[c * HIST_BINS + histBin(*src.ptr(batchIdx, inY, gx, channel))]++;
+                }
+                __syncwarp();
+            }
+
+            int hist[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+            for (int c = 0; c < kWidth; c++)
+            {
+                addHistBins<1>(hist, hists + c * HIST_BINS);
+            }
+
+            int fineBin = -1; // coarse bin counted by the fine histogram
+
+            for (int x = x0; x < x1; x++)
+            {
+                if (x > x0)
+                {
+                    addHistBins<1>(hist, hists + (x - x0 + kWidth - 1) * HIST_BINS);
+                    addHistBins<-1>(hist, hists + (x - x0 - 1) * HIST_BINS);
+                }
+
+                int rank = (kWidth * kHeight) / 2;
+                int bin  = selectHistBin(hist, rank);
+
+                if constexpr (sizeof(T) > 1)
+                {
+                    if (bin != fineBin)
+                    {
+                        // New row or the median moved to another coarse bin, count its pixels in the whole window
+#pragma unroll
+                        for (int i = 0; i < 8; i++)
+                        {
+                            fine[lane * 8 + i] = 0;
+                        }
+                        __syncwarp();
+                        for (int c = -rx; c <= rx; c++)
+                        {
+                            addFineColumn(fine, src, batchIdx, channel, x + c, y, ry, bin, 1);
+                        }
+                        fineBin = bin;
+                    }
+                    else
+                    {
+                        addFineColumn(fine, src, batchIdx, channel, x - rx - 1, y, ry, bin, -1);
+                        addFineColumn(fine, src, batchIdx, channel, x + rx, y, ry, bin, 1);
+                    }
+                    __syncwarp();
+
+                    int fineHist[8];
+#pragma unroll
+                    for (int i = 0; i < 8; i++)
+                    {
+                        fineHist[i] = fine[lane * 8 + i];
+                    }
+                    bin = (bin << 8) | selectHistBin(fineHist, rank);
+                    __syncwarp();
+                }
+
+                if (lane == 0)
+                {
+                    *dst.ptr(batchIdx, y, x, channel) = bin;
+                }
+            }
+        }
+        __syncwarp();
+    }
+}
+
+// Number of blocks of the histogram median, warps past the number of tiles loop over them.
+static int medianHistogramBlocks(const DataShape &shape)
+{
+    int tiles = divUp(shape.W, HIST_TILE_WIDTH) * divUp(shape.H, HIST_TILE_HEIGHT) * shape.C * shape.N;
+    return std::min(divUp(tiles, HIST_WARPS), HIST_MAX_BLOCKS);
+}
+
+static size_t medianHistogramWorkspaceSize(const DataShape &shape, int kWidth)
+{
+    return (size_t)medianHistogramBlocks(shape) * HIST_WARPS * (HIST_TILE_WIDTH + kWidth - 1) * HIST_BINS
+         * sizeof(ushort);
+}
+
+template<typename T>
+void medianHistogram(const nvcv::TensorDataAccessStridedImagePlanar &inData,
+                     const nvcv::TensorDataAccessStridedImagePlanar &outData, const DataShape &shape, int kWidth,
+                     int kHeight, void *workspace, cudaStream_t stream)
+{
+    Ptr2dNHWC<T> src(inData);
+    Ptr2dNHWC<T> dst(outData);
+
+    dim3 block(32, HIST_WARPS);
+    dim3 grid(medianHistogramBlocks(shape));
+    medianHistogram<T><<<grid, block, 0, stream>>>(src, dst, kWidth, kHeight, static_cast<ushort *>(workspace),
+                                                    divUp(dst.cols, HIST_TILE_WIDTH),
+                                                    divUp(dst.rows, HIST_TILE_HEIGHT));
+    checkKernelErrors();
+
+#ifdef CUDA_DEBUG_LOG
+    checkCudaErrors(cudaStreamSynchronize(stream));
+    checkCudaErrors(cudaGetLastError());
+#endif
+}
+
 template<typename T>
 void median(const nvcv::TensorDataAccessStridedImagePlanar &inData,
             const nvcv::TensorDataAccessStridedImagePlanar &outData, int kWidth, int kHeight, cudaStream_t stream)
@@ -363,8 +630,25 @@ void median(const nvcv::TensorDataAccessStridedImagePlanar &inData,
 
 namespace nvcv::legacy::cuda_op {
 
+size_t MedianBlur::histBufferSize(const TensorDataStridedCuda &inData, const nvcv::Size2D ksize) const
+{
+    cuda_op::DataType dataType = GetLegacyDataType(inData.dtype());
+    if ((dataType != kCV_8U && dataType != kCV_16U) || ksize.w <= 0 || ksize.h <= 0
+        || ksize.w * ksize.h < HIST_MIN_AREA || ksize.h > HIST_MAX_HEIGHT)
+    {
+        return 0;
+    }
+
+    auto inAccess = TensorDataAccessStridedImagePlanar::Create(inData);
+    if (!inAccess)
+    {
+        return 0;
+    }
+    return medianHistogramWorkspaceSize(GetLegacyDataShape(inAccess->infoShape()), ksize.w);
+}
+
 ErrorCode MedianBlur::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                            const nvcv::Size2D ksize, cudaStream_t stream)
+                            const nvcv::Size2D ksize, void *histBuffer, cudaStream_t stream)
 {
     DataFormat input_format  = GetLegacyDataFormat(inData.layout());
     DataFormat output_format = GetLegacyDataFormat(outData.layout());
@@ -412,6 +696,19 @@ ErrorCode MedianBlur::infer(const TensorDataStridedCuda &inData, const TensorDat
         return ErrorCode::INVALID_DATA_SHAPE;
     }
 
+    if (histBuffer != nullptr && histBufferSize(inData, ksize) > 0)
+    {
+        if (data_type == kCV_8U)
+        {
+            medianHistogram<uchar>(*inAccess, *outAccess, input_shape, ksize.w, ksize.h, histBuffer, stream);
+        }
+        else
+        {
+            medianHistogram<ushort>(*inAccess, *outAccess, input_shape, ksize.w, ksize.h, histBuffer, stream);
+        }
+        return SUCCESS;
+    }
+
     typedef void (*median_t)(const nvcv::TensorDataAccessStridedImagePlanar &inData,
                              const nvcv::TensorDataAccessStridedImagePlanar &outData, int kWidth, int kHeight,
                              cudaStream_t stream);
@@ -428,3 +725,10 @@ ErrorCode MedianBlur::infer(const TensorDataStridedCuda &inData, const TensorDat
 
 #undef GENERAL_KERNEL_BLOCK
 #undef SMALL_KERNEL_BLOCK
+#undef HIST_TILE_WIDTH
+#undef HIST_TILE_HEIGHT
+#undef HIST_WARPS
+#undef HIST_MAX_BLOCKS
+#undef HIST_BINS
+#undef HIST_MIN_AREA
+#undef HIST_MAX_HEIGHT
@@ -85,6 +85,144 @@ __global__ void erode(SrcWrapper src, DstWrapper dst, Size2D dstSize, Size2D ker
     *dst.ptr(batch_idx, y, x) = cuda::SaturateCast<T>(res);
 }
 
+// Rectangular kernels at least this large are applied as a row pass and a column pass.
+constexpr int kMorphSeparableMinArea = 25;
+// Outputs computed per block by the row pass.
+constexpr int kMorphRowTile = 256;
+// Shared memory limit of the row pass, larger kernels use the direct 2D kernels.
+constexpr size_t kMorphRowSmemLimit = 48 * 1024;
+
+struct MorphMax
+{
+    template<typename T>
+    __device__ T operator()(const T &a, const T &b) const
+    {
+        return cuda::max(a, b);
+    }
+};
+
+struct MorphMin
+{
+    template<typename T>
+    __device__ T operator()(const T &a, const T &b) const
+    {
+        return cuda::min(a, b);
+    }
+};
+
+// The passes use the van Herk/Gil-Werman algorithm: the input span is cut in segments of ksize
+// elements, and the window of an output covers the end of one segment and the start of the next,
+// so it's the combination of a suffix scan of the first and a prefix scan of the second. That's 3
+// comparisons per output whatever the kernel size. Output x reads the span element x to x + ksize - 1,
+// span element i being the input at i - anchor.
+
+template<class Op, class SrcWrapper, class DstWrapper>
+__global__ void morph_row_pass(SrcWrapper src, DstWrapper dst, Size2D size, int ksize, int anchor)
+{
+    using T = typename DstWrapper::ValueType;
+
+    extern __shared__ __align__(16) unsigned char morph_row_smem[];
+
+    const int span      = kMorphRowTile + ksize - 1;
+    T        *prefix    = reinterpret_cast<T *>(morph_row_smem);
+    T        *suffix    = prefix + span;
+    const int x0        = blockIdx.x * kMorphRowTile;
+    const int batch_idx = get_batch_idx();
+    Op        op;
+
+    for (int y = blockIdx.y; y < size.h; y += gridDim.y)
+    {
+        int3 coord{0, y, batch_idx};
+        for (int i = threadIdx.x; i < span; i += blockDim.x)
+        {
+            coord.x   = x0 - anchor + i;
+            prefix[i] = src[coord];
+            suffix[i] = prefix[i];
+        }
+        __syncthreads();
+
+        for (int first = threadIdx.x * ksize; first < span; first += blockDim.x * ksize)
+        {
+            const int last = min(first + ksize, span) - 1;
+            for (int i = first + 1; i <= last; ++i)
+            {
+                prefix[i] = op(prefix[i - 1], prefix[i]);
+            }
+            for (int i = last - 1; i >= first; --i)
+            {
+                suffix[i] = op(suffix[i + 1], suffix[i]);
+            }
+        }
+        __syncthreads();
+
+        for (int i = threadIdx.x; i < kMorphRowTile && x0 + i < size.w; i += blockDim.x)
+        {
+            *dst.ptr(batch_idx, y, x0 + i) = op(suffix[i], prefix[i + ksize - 1]);
+        }
+        __syncthreads();
+    }
+}
+
+// Each thread handles ksize rows of one column. The suffix scan of its segment is stored in the
+// output, then merged with the running prefix of the next segment, so the column is read about twice
+// and written twice whatever the kernel size, and reads stay coalesced across the warp.
+template<class Op, class SrcWrapper, class DstWrapper>
+__global__ void morph_col_pass(SrcWrapper src, DstWrapper dst, Size2D size, int ksize, int anchor)
+{
+    using T = typename DstWrapper::ValueType;
+
+    const int x         = blockIdx.x * blockDim.x + threadIdx.x;
+    const int first     = (blockIdx.y * blockDim.y + threadIdx.y) * ksize;
+    const int batch_idx = get_batch_idx();
+    Op        op;
+
+    if (x >= size.w || first >= size.h)
+        return;
+
+    int3 coord{x, 0, batch_idx};
+
+    T acc;
+    for (int i = first + ksize - 1; i >= first; --i)
+    {
+        coord.y = i - anchor;
+        acc     = (i == first + ksize - 1) ? src[coord] : op(acc, src[coord]);
+        if (i < size.h)
+        {
+            *dst.ptr(batch_idx, i, x) = acc;
+        }
+    }
+
+    for (int i = first + ksize, y = first + 1; i < first + 2 * ksize - 1 && y < size.h; ++i, ++y)
+    {
+        coord.y = i - anchor;
+        acc     = (i == first + ksize) ? src[coord] : op(acc, src[coord]);
+
+        T *out = dst.ptr(batch_idx, y, x);
+        *out   = op(*out, acc);
+    }
+}
+
+template<class Op, class SrcWrapper, class TmpWrapper, class DstWrapper>
+void MorphSeparableCaller(const SrcWrapper &src, const TmpWrapper &tmpIn, const DstWrapper &tmpOut,
+                          const DstWrapper &dst, Size2D kernelSize, int2 kernelAnchor, Size2D dstSize, int numSamples,
+                          cudaStream_t stream)
+{
+    using T = typename DstWrapper::ValueType;
+
+    dim3   rowBlock(128);
+    dim3   rowGrid(divUp(dstSize.w, kMorphRowTile), std::min(dstSize.h, 65535), numSamples);
+    size_t rowSmem = 2 * (kMorphRowTile + kernelSize.w - 1) * sizeof(T);
+
+    morph_row_pass<Op><<<rowGrid, rowBlock, rowSmem, stream>>>(src, tmpOut, dstSize, kernelSize.w, kernelAnchor.x);
+    checkKernelErrors();
+
+    dim3 colBlock(32, 4);
+    dim3 colGrid(divUp(dstSize.w, colBlock.x), divUp(divUp(dstSize.h, kernelSize.h), colBlock.y), numSamples);
+
+    morph_col_pass<Op><<<colGrid, colBlock, 0, stream>>>(tmpIn, dst, dstSize, kernelSize.h, kernelAnchor.y);
+    checkKernelErrors();
+}
+
 template<typename BT, typename SrcWrapper, typename DstWrapper>
 void MorphFilter2DCaller(const SrcWrapper &src, const DstWrapper &dst, NVCVMorphologyType morph_type, Size2D kernelSize,
                          int2 kernelAnchor, BT maxmin, Size2D dstSize, int numSamples, cudaStream_t stream)
@@ -115,7 +253,8 @@ void MorphFilter2DCaller(const SrcWrapper &src, const DstWrapper &dst, NVCVMorph
 
 template<typename D, NVCVBorderType B>
 ErrorCode MorphFilter2DCaller(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
-                              NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor, cudaStream_t stream)
+                              NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor, void *rowBuffer,
+                              cudaStream_t stream)
 {
     using BT = cuda::BaseType<D>;
 
@@ -137,7 +276,36 @@ ErrorCode MorphFilter2DCaller(const TensorDataStridedCuda &inData, const TensorD
         auto src = cuda::CreateBorderWrapNHW<const D, B, int32_t>(inData, cuda::SetAll<D>(val));
         auto dst = cuda::CreateTensorWrapNHW<D, int32_t>(outData);
 
-        MorphFilter2DCaller(src, dst, morph_type, kernelSize, kernelAnchor, val, dstSize, numSamples, stream);
+        if (rowBuffer != nullptr)
+        {
+            // The border value is the identity of min/max, and the other borders remap rows and columns
+            // independently, so the rectangle is the row pass followed by the column pass.
+            NVCVTensorBufferStrided rowBuf{};
+            for (int i = 0; i < outData.rank(); ++i)
+            {
+                rowBuf.strides[i] = outData.stride(i);
+            }
+            rowBuf.basePtr = reinterpret_cast<NVCVByte *>(rowBuffer);
+            TensorDataStridedCuda rowData(outData.shape(), outData.dtype(), rowBuf);
+
+            auto tmpIn  = cuda::CreateBorderWrapNHW<const D, B, int32_t>(rowData, cuda::SetAll<D>(val));
+            auto tmpOut = cuda::CreateTensorWrapNHW<D, int32_t>(rowData);
+
+            if (morph_type == NVCVMorphologyType::NVCV_DILATE)
+            {
+                MorphSeparableCaller<MorphMax>(src, tmpIn, tmpOut, dst, kernelSize, kernelAnchor, dstSize, numSamples,
+                                               stream);
+            }
+            else
+            {
+                MorphSeparableCaller<MorphMin>(src, tmpIn, tmpOut, dst, kernelSize, kernelAnchor, dstSize, numSamples,
+                                               stream);
+            }
+        }
+        else
+        {
+            MorphFilter2DCaller(src, dst, morph_type, kernelSize, kernelAnchor, val, dstSize, numSamples, stream);
+        }
     }
     else
     {
@@ -150,13 +318,14 @@ ErrorCode MorphFilter2DCaller(const TensorDataStridedCuda &inData, const TensorD
 template<typename D>
 ErrorCode MorphFilter2D(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                         NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor, NVCVBorderType borderMode,
-                        cudaStream_t stream)
+                        void *rowBuffer, cudaStream_t stream)
 {
     switch (borderMode)
     {
-#define NVCV_MORPH_CASE(BORDERTYPE) \
-    case BORDERTYPE:                \
-        return MorphFilter2DCaller<D, BORDERTYPE>(inData, outData, morph_type, kernelSize, kernelAnchor, stream);
+#define NVCV_MORPH_CASE(BORDERTYPE)                                                                                  \
+    case BORDERTYPE:                                                                                                 \
+        return MorphFilter2DCaller<D, BORDERTYPE>(inData, outData, morph_type, kernelSize, kernelAnchor, rowBuffer, \
+                                                  stream);
 
         NVCV_MORPH_CASE(NVCV_BORDER_CONSTANT);
         NVCV_MORPH_CASE(NVCV_BORDER_REPLICATE);
@@ -172,9 +341,34 @@ ErrorCode MorphFilter2D(const TensorDataStridedCuda &inData, const TensorDataStr
     return ErrorCode::SUCCESS;
 }
 
+// Large kernels run as separable passes, through a row buffer with the layout of the output.
+size_t Morphology::rowBufferSize(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
+                                 Size2D mask_size) const
+{
+    if (mask_size.w == -1 || mask_size.h == -1)
+    {
+        return 0;
+    }
+
+    auto inAccess  = nvcv::TensorDataAccessStridedImagePlanar::Create(inData);
+    auto outAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(outData);
+    if (!inAccess || !outAccess)
+    {
+        return 0;
+    }
+
+    size_t rowSmem = 2 * (kMorphRowTile + mask_size.w - 1) * static_cast<size_t>(outAccess->colStride());
+    if (mask_size.w * mask_size.h >= kMorphSeparableMinArea && rowSmem <= kMorphRowSmemLimit
+        && inAccess->numCols() == outAccess->numCols() && inAccess->numRows() == outAccess->numRows())
+    {
+        return outData.stride(0) * outData.shape(0);
+    }
+    return 0;
+}
+
 ErrorCode Morphology::infer(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                             NVCVMorphologyType morph_type, Size2D mask_size, int2 anchor, bool noop,
-                            const NVCVBorderType borderMode, cudaStream_t stream)
+                            const NVCVBorderType borderMode, void *rowBuffer, cudaStream_t stream)
 {
     DataFormat input_format  = GetLegacyDataFormat(inData.layout());
     DataFormat output_format = GetLegacyDataFormat(outData.layout());
@@ -255,9 +449,14 @@ ErrorCode Morphology::infer(const TensorDataStridedCuda &inData, const TensorDat
         return SUCCESS;
     }
 
+    if (rowBufferSize(inData, outData, mask_size_) == 0)
+    {
+        rowBuffer = nullptr;
+    }
+
     typedef ErrorCode (*filter2D_t)(const TensorDataStridedCuda &inData, const TensorDataStridedCuda &outData,
                                     NVCVMorphologyType morph_type, Size2D kernelSize, int2 kernelAnchor,
-                                    NVCVBorderType borderMode, cudaStream_t stream);
+                                    NVCVBorderType borderMode, void *rowBuffer, cudaStream_t stream);
 
     static const filter2D_t funcs[6][4] = {
         { MorphFilter2D<uchar>, 0,  MorphFilter2D<uchar3>,  MorphFilter2D<uchar4>},
@@ -268,7 +467,8 @@ ErrorCode Morphology::infer(const TensorDataStridedCuda &inData, const TensorDat
         { MorphFilter2D<float>, 0,  MorphFilter2D<float3>,  MorphFilter2D<float4>},
     };
 
-    return funcs[data_type][channels - 1](inData, outData, morph_type, mask_size_, anchor_, borderMode, stream);
+    return funcs[data_type][channels - 1](inData, outData, morph_type, mask_size_, anchor_, borderMode, rowBuffer,
+                                          stream);
 }
 
 } // namespace nvcv::legacy::cuda_op
@@ -28,10 +28,13 @@
 #include <nvcv/ImageData.hpp>
 #include <nvcv/TensorData.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <ctime>
 #include <iomanip>
+#include <sstream>
+#include <string>
 
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -98,6 +101,15 @@ static TextBackendType convert_to_text_backend_type(cuOSDTextBackend backend)
     }
 }
 
+// Adds a text command, its glyph locations and bounding box are filled by cuosd_text_prepare.
+static void cuosd_add_text(cuOSDContext_t context, int batch_idx, std::vector<unsigned long int> words, int font_size,
+                           const char *font, int x, int y, cuOSDColor color)
+{
+    auto cmd         = context->commands.emplace<TextCommand>(0, 0, color.r, color.g, color.b, color.a);
+    cmd->batch_index = batch_idx;
+    context->text_commands.emplace_back(context->commands.size() - 1, std::move(words), font_size, font, x, y);
+}
+
 static void cuosd_draw_line(cuOSDContext_t context, int batch_idx, int x0, int y0, int x1, int y1, int thickness,
                             cuOSDColor color, bool interpolation)
 {
@@ -110,7 +122,7 @@ static void cuosd_draw_line(cuOSDContext_t context, int batch_idx, int x0, int y
     // upline
     // a    b
     // d    c
-    auto cmd         = std::make_shared<RectangleCommand>();
+    auto cmd         = context->commands.emplace<RectangleCommand>();
     cmd->batch_index = batch_idx;
     cmd->ax1         = -half_thickness * cos_angle + x0 - sin_angle * half_thickness;
     cmd->ay1         = -half_thickness * sin_angle + cos_angle * half_thickness + y0;
@@ -140,7 +152,6 @@ static void cuosd_draw_line(cuOSDContext_t context, int batch_idx, int x0, int y
     cmd->bounding_right  = ceil(max(max(max(cmd->ax1, cmd->bx1), cmd->cx1), cmd->dx1));
     cmd->bounding_top    = min(min(min(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1);
     cmd->bounding_bottom = ceil(max(max(max(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1));
-    context->commands.emplace_back(cmd);
 }
 
 static void cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int left, int top, int right, int bottom,
@@ -164,7 +175,7 @@ static void cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int left
             bgColor = borderColor;
         }
 
-        auto cmd           = std::make_shared<RectangleCommand>();
+        auto cmd           = context->commands.emplace<RectangleCommand>();
         cmd->batch_index   = batch_idx;
         cmd->thickness     = -1;
         cmd->interpolation = false;
@@ -187,12 +198,11 @@ static void cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int left
         cmd->bounding_right  = right;
         cmd->bounding_top    = top;
         cmd->bounding_bottom = bottom;
-        context->commands.emplace_back(cmd);
     }
     if (thickness == -1)
         return;
 
-    auto cmd           = std::make_shared<RectangleCommand>();
+    auto cmd           = context->commands.emplace<RectangleCommand>();
     cmd->batch_index   = batch_idx;
     cmd->thickness     = thickness;
     cmd->interpolation = false;
@@ -227,14 +237,14 @@ static void cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int left
     cmd->bounding_right  = right + int_half;
     cmd->bounding_top    = top - int_half;
     cmd->bounding_bottom = bottom + int_half;
-    context->commands.emplace_back(cmd);
 }
 
 static void cuosd_draw_text(cuOSDContext_t context, int batch_idx, const char *utf8_text, int font_size,
                             const char *font, int x, int y, cuOSDColor borderColor, cuOSDColor bgColor)
 {
     if (context->text_backend == nullptr)
-        context->text_backend = create_text_backend(convert_to_text_backend_type(context->text_backend_type));
+        context->text_backend = create_text_backend(convert_to_text_backend_type(context->text_backend_type),
+                                                    context->raster_threads);
 
     if (context->text_backend == nullptr)
     {
@@ -267,111 +277,95 @@ static void cuosd_draw_text(cuOSDContext_t context, int batch_idx, const char *u
         cuosd_draw_rectangle(context, batch_idx, x, y, x + width + 2 * xmargin - 1, y + height + 2 * ymargin - 1, -1,
                              *(cuOSDColor *)(&bgColor), {0, 0, 0, 0});
     }
-    context->commands.emplace_back(std::make_shared<TextHostCommand>(batch_idx, words, font_size, font, x + xmargin,
-                                                                     y + ymargin - yoffset, borderColor.r,
-                                                                     borderColor.g, borderColor.b, borderColor.a));
+    cuosd_add_text(context, batch_idx, std::move(words), font_size, font, x + xmargin, y + ymargin - yoffset,
+                   borderColor);
 }
 
 static void cuosd_text_prepare(cuOSDContext_t context, int width, int height, cudaStream_t stream)
 {
-    if (context->commands.empty() || context->text_backend == nullptr)
+    if (context->text_commands.empty() || context->text_backend == nullptr)
         return;
-    for (auto &cmd : context->commands)
+    for (auto &text_cmd : context->text_commands)
     {
-        if (cmd->type == CommandType::Text)
-        {
-            auto text_cmd = std::static_pointer_cast<TextHostCommand>(cmd);
-            context->text_backend->add_build_text(text_cmd->text, text_cmd->font_size, text_cmd->font_name.c_str());
-        }
+        context->text_backend->add_build_text(text_cmd.text, text_cmd.font_size, text_cmd.font_name.c_str());
     }
     context->text_backend->build_bitmap((void *)stream);
 
     std::vector<std::vector<TextLocation>> locations;
     int                                    total_locations = 0;
-    for (auto &cmd : context->commands)
+    for (auto &text_cmd : context->text_commands)
     {
-        if (cmd->type == CommandType::Text)
+        auto gputile = context->commands.at<TextCommand>(text_cmd.command);
+        int  draw_x  = text_cmd.x;
+
+        // Nothing to draw until some of its glyphs are found in the image.
+        gputile->type            = CommandType::None;
+        gputile->bounding_left   = text_cmd.x;
+        gputile->bounding_bottom = text_cmd.y + text_cmd.font_size;
+        gputile->bounding_top    = gputile->bounding_bottom;
+
+        auto glyph_map = context->text_backend->query(text_cmd.font_name.c_str(), text_cmd.font_size);
+        if (glyph_map == nullptr)
+            continue;
+
+        std::vector<TextLocation> textline_locations;
+        int                       max_glyph_height = 0;
+        for (auto &word : text_cmd.text)
         {
-            auto text_cmd                     = std::static_pointer_cast<TextHostCommand>(cmd);
-            int  draw_x                       = text_cmd->x;
-            text_cmd->gputile.batch_index     = text_cmd->batch_index;
-            text_cmd->gputile.bounding_left   = text_cmd->x;
-            text_cmd->gputile.bounding_bottom = text_cmd->y + text_cmd->font_size;
-            text_cmd->gputile.bounding_top    = text_cmd->gputile.bounding_bottom;
-
-            auto glyph_map = context->text_backend->query(text_cmd->font_name.c_str(), text_cmd->font_size);
-            if (glyph_map == nullptr)
+            auto meta = glyph_map->query(word);
+            if (meta == nullptr)
                 continue;
 
-            std::vector<TextLocation> textline_locations;
-            int                       max_glyph_height = 0;
-            for (auto &word : text_cmd->text)
-            {
-                auto meta = glyph_map->query(word);
-                if (meta == nullptr)
-                    continue;
+            max_glyph_height = max(max_glyph_height, meta->height());
+        }
 
-                max_glyph_height = max(max_glyph_height, meta->height());
+        for (auto &word : text_cmd.text)
+        {
+            auto meta = glyph_map->query(word);
+            if (meta == nullptr)
+                continue;
+
+            int w        = meta->width();
+            int h        = meta->height();
+            int xadvance = meta->xadvance(text_cmd.font_size);
+            if (w < 1 || h < 1)
+            {
+                draw_x += meta->xadvance(text_cmd.font_size, true);
+                continue;
             }
 
-            for (auto &word : text_cmd->text)
+            TextLocation location;
+            location.image_x = draw_x;
+            location.image_y
+                = text_cmd.y + context->text_backend->compute_y_offset(max_glyph_height, h, meta, text_cmd.font_size);
+            location.text_x = meta->x_offset_on_bitmap();
+            location.text_y = meta->y_offset_on_bitmap();
+            location.text_w = w;
+            location.text_h = h;
+
+            // Ignore if out of image area.
+            if (location.image_x + location.text_w < 0 || location.image_x >= (int)width
+                || location.image_y + location.text_h < 0 || location.image_y >= (int)height)
             {
-                auto meta = glyph_map->query(word);
-                if (meta == nullptr)
-                    continue;
-
-                int w        = meta->width();
-                int h        = meta->height();
-                int xadvance = meta->xadvance(text_cmd->font_size);
-                if (w < 1 || h < 1)
-                {
-                    draw_x += meta->xadvance(text_cmd->font_size, true);
-                    continue;
-                }
-
-                TextLocation location;
-                location.image_x = draw_x;
-                location.image_y
-                    = text_cmd->y
-                    + context->text_backend->compute_y_offset(max_glyph_height, h, meta, text_cmd->font_size);
-                location.text_x = meta->x_offset_on_bitmap();
-                location.text_w = w;
-                location.text_h = h;
-
-                // Ignore if out of image area.
-                if (location.image_x + location.text_w < 0 || location.image_x >= (int)width
-                    || location.image_y + location.text_h < 0 || location.image_y >= (int)height)
-                {
-                    draw_x += xadvance;
-                    continue;
-                }
-
-                textline_locations.emplace_back(location);
                 draw_x += xadvance;
-                text_cmd->gputile.bounding_bottom
-                    = max(text_cmd->gputile.bounding_bottom, location.image_y + location.text_h);
-                text_cmd->gputile.bounding_top = min(text_cmd->gputile.bounding_top, location.image_y);
+                continue;
             }
 
-            text_cmd->gputile.bounding_right = draw_x;
-            text_cmd->gputile.bounding_left  = text_cmd->gputile.bounding_left;
+            textline_locations.emplace_back(location);
+            draw_x += xadvance;
+            gputile->bounding_bottom = max(gputile->bounding_bottom, location.image_y + location.text_h);
+            gputile->bounding_top    = min(gputile->bounding_top, location.image_y);
+        }
 
-            if (!textline_locations.empty())
-            {
-                text_cmd->gputile.text_line_size = textline_locations.size();
-                text_cmd->gputile.ilocation      = total_locations;
-                text_cmd->gputile.c0             = cmd->c0;
-                text_cmd->gputile.c1             = cmd->c1;
-                text_cmd->gputile.c2             = cmd->c2;
-                text_cmd->gputile.c3             = cmd->c3;
-                text_cmd->gputile.type           = CommandType::Text;
-                text_cmd->bounding_left          = text_cmd->gputile.bounding_left;
-                text_cmd->bounding_top           = text_cmd->gputile.bounding_top;
-                text_cmd->bounding_right         = text_cmd->gputile.bounding_right;
-                text_cmd->bounding_bottom        = text_cmd->gputile.bounding_bottom;
-                locations.emplace_back(textline_locations);
-                total_locations += textline_locations.size();
-            }
+        gputile->bounding_right = draw_x;
+
+        if (!textline_locations.empty())
+        {
+            gputile->text_line_size = textline_locations.size();
+            gputile->ilocation      = total_locations;
+            gputile->type           = CommandType::Text;
+            locations.emplace_back(textline_locations);
+            total_locations += textline_locations.size();
         }
     }
     if (locations.empty())
@@ -379,27 +373,51 @@ static void cuosd_text_prepare(cuOSDContext_t context, int width, int height, cu
 
     if (context->text_location == nullptr)
         context->text_location.reset(new Memory<TextLocation>());
-    if (context->line_location_base == nullptr)
-        context->line_location_base.reset(new Memory<int>());
     context->text_location->alloc_or_resize_to(total_locations);
-    context->line_location_base->alloc_or_resize_to(locations.size() + 1);
-
-    int ilocation                          = 0;
-    context->line_location_base->host()[0] = 0;
 
-    for (int i = 0; i < (int)locations.size(); ++i)
+    int ilocation = 0;
+    for (auto &text_line : locations)
     {
-        auto &text_line = locations[i];
         memcpy(context->text_location->host() + ilocation, text_line.data(), sizeof(TextLocation) * text_line.size());
         ilocation += text_line.size();
-        context->line_location_base->host()[i + 1] = ilocation;
     }
 
-    context->line_location_base->copy_host_to_device(stream);
     context->text_location->copy_host_to_device(stream);
 }
 
-static void cuosd_apply(cuOSDContext_t context, int width, int height, cuOSDImageFormat format, cudaStream_t stream)
+// Bins the commands into screen tiles and uploads the per tile command lists.
+static void cuosd_upload_bins(cuOSDContext_t context, int width, int height, int batch, cudaStream_t stream)
+{
+    std::vector<CommandBox> boxes(context->commands.size());
+    for (int i = 0; i < context->commands.size(); ++i)
+    {
+        auto cmd = context->commands.at(i);
+        boxes[i] = {cmd->bounding_left, cmd->bounding_top, cmd->bounding_right, cmd->bounding_bottom, cmd->batch_index};
+
+        // Text without any visible glyph is left as an empty command, there is no need to visit it.
+        if (cmd->type == CommandType::None)
+            boxes[i].batch_index = -1;
+    }
+
+    bin_commands(boxes, width, height, batch, context->bins);
+
+    if (context->gpu_tile_offsets == nullptr)
+        context->gpu_tile_offsets.reset(new Memory<int>());
+    if (context->gpu_tile_commands == nullptr)
+        context->gpu_tile_commands.reset(new Memory<int>());
+
+    // Never empty, so that the kernel always gets valid pointers.
+    const CommandBins &bins = context->bins;
+    context->gpu_tile_offsets->alloc_or_resize_to(bins.offsets.size());
+    context->gpu_tile_commands->alloc_or_resize_to(std::max<size_t>(bins.commands.size(), 1));
+    memcpy(context->gpu_tile_offsets->host(), bins.offsets.data(), sizeof(int) * bins.offsets.size());
+    memcpy(context->gpu_tile_commands->host(), bins.commands.data(), sizeof(int) * bins.commands.size());
+    context->gpu_tile_offsets->copy_host_to_device(stream);
+    context->gpu_tile_commands->copy_host_to_device(stream);
+}
+
+static void cuosd_apply(cuOSDContext_t context, int width, int height, int batch, cuOSDImageFormat format,
+                        cudaStream_t stream)
 {
     if (context->commands.empty())
     {
@@ -416,67 +434,21 @@ static void cuosd_apply(cuOSDContext_t context, int width, int height, cuOSDImag
         context->bounding_right  = 0;
         context->bounding_bottom = 0;
 
-        size_t                    byte_of_commands = 0;
-        std::vector<unsigned int> cmd_offset(context->commands.size());
-        for (int i = 0; i < (int)context->commands.size(); ++i)
+        for (int i = 0; i < context->commands.size(); ++i)
         {
-            auto &cmd     = context->commands[i];
-            cmd_offset[i] = byte_of_commands;
+            auto cmd = context->commands.at(i);
+            if (cmd->type == CommandType::None)
+                continue;
 
             context->bounding_left   = min(context->bounding_left, cmd->bounding_left);
             context->bounding_top    = min(context->bounding_top, cmd->bounding_top);
             context->bounding_right  = max(context->bounding_right, cmd->bounding_right);
             context->bounding_bottom = max(context->bounding_bottom, cmd->bounding_bottom);
-
-            if (cmd->type == CommandType::Text)
-                byte_of_commands += sizeof(TextCommand);
-            else if (cmd->type == CommandType::Rectangle)
-                byte_of_commands += sizeof(RectangleCommand);
-            else if (cmd->type == CommandType::Circle)
-                byte_of_commands += sizeof(CircleCommand);
-            else if (cmd->type == CommandType::Segment)
-                byte_of_commands += sizeof(SegmentCommand);
-            else if (cmd->type == CommandType::PolyFill)
-                byte_of_commands += sizeof(PolyFillCommand);
         }
 
-        if (context->gpu_commands == nullptr)
-            context->gpu_commands.reset(new Memory<unsigned char>());
-        if (context->gpu_commands_offset == nullptr)
-            context->gpu_commands_offset.reset(new Memory<int>());
-
-        context->gpu_commands->alloc_or_resize_to(byte_of_commands);
-        context->gpu_commands_offset->alloc_or_resize_to(cmd_offset.size());
-        memcpy(context->gpu_commands_offset->host(), cmd_offset.data(), sizeof(int) * cmd_offset.size());
-
-        for (int i = 0; i < (int)context->commands.size(); ++i)
-        {
-            auto          &cmd    = context->commands[i];
-            unsigned char *pg_cmd = context->gpu_commands->host() + cmd_offset[i];
-
-            if (cmd->type == CommandType::Text)
-            {
-                memcpy(pg_cmd, (&(std::static_pointer_cast<TextHostCommand>(cmd)->gputile)), sizeof(TextCommand));
-            }
-            else if (cmd->type == CommandType::Rectangle)
-            {
-                memcpy(pg_cmd, cmd.get(), sizeof(RectangleCommand));
-            }
-            else if (cmd->type == CommandType::Circle)
-            {
-                memcpy(pg_cmd, cmd.get(), sizeof(CircleCommand));
-            }
-            else if (cmd->type == CommandType::Segment)
-            {
-                memcpy(pg_cmd, cmd.get(), sizeof(SegmentCommand));
-            }
-            else if (cmd->type == CommandType::PolyFill)
-            {
-                memcpy(pg_cmd, cmd.get(), sizeof(PolyFillCommand));
-            }
-        }
-        context->gpu_commands->copy_host_to_device(stream);
-        context->gpu_commands_offset->copy_host_to_device(stream);
+        // The commands are already laid out in the pinned buffer, upload them as they are.
+        context->commands.upload(stream);
+        cuosd_upload_bins(context, width, height, batch, stream);
     }
 }
 
@@ -491,18 +463,19 @@ static __device__ bool render_text(int ix, int iy, const TextLocation &location,
     int           fx     = ix - location.image_x;
     int           fy     = iy - location.image_y;
     int           bfx    = fx + location.text_x;
+    int           bfy    = fy + location.text_y;
     unsigned char alpha0 = fx < 0 || fy < 0 || fx >= location.text_w || fy >= location.text_h
                              ? 0
-                             : ((text_bitmap[fy * text_bitmap_width + bfx + 0] * (int)a) >> 8);
+                             : ((text_bitmap[bfy * text_bitmap_width + bfx + 0] * (int)a) >> 8);
     unsigned char alpha1 = fx + 1 < 0 || fy < 0 || fx + 1 >= location.text_w || fy >= location.text_h
                              ? 0
-                             : ((text_bitmap[fy * text_bitmap_width + bfx + 1] * (int)a) >> 8);
+                             : ((text_bitmap[bfy * text_bitmap_width + bfx + 1] * (int)a) >> 8);
     unsigned char alpha2 = fx < 0 || fy + 1 < 0 || fx >= location.text_w || fy + 1 >= location.text_h
                              ? 0
-                             : ((text_bitmap[(fy + 1) * text_bitmap_width + bfx + 0] * (int)a) >> 8);
+                             : ((text_bitmap[(bfy + 1) * text_bitmap_width + bfx + 0] * (int)a) >> 8);
     unsigned char alpha3 = fx + 1 < 0 || fy + 1 < 0 || fx + 1 >= location.text_w || fy + 1 >= location.text_h
                              ? 0
-                             : ((text_bitmap[(fy + 1) * text_bitmap_width + bfx + 1] * (int)a) >> 8);
+                             : ((text_bitmap[(bfy + 1) * text_bitmap_width + bfx + 1] * (int)a) >> 8);
 
     if (alpha0)
     {
@@ -1004,32 +977,32 @@ template<cuOSDImageFormat format, bool have_rotate_msaa, class SrcWrapper, class
          typename T = typename DstWrapper::ValueType>
 static __global__ void render_elements_kernel(int bx, int by, const TextLocation *text_locations,
                                               const unsigned char *text_bitmap, int text_bitmap_width,
-                                              const int *line_location_base, const unsigned char *commands,
-                                              const int *command_offsets, int num_command, SrcWrapper src,
-                                              DstWrapper dst, int image_width, int stride, int image_height,
-                                              bool inplace)
+                                              const unsigned char *commands, const int *command_offsets,
+                                              const int *tile_offsets, const int *tile_commands, int tiles_x,
+                                              int tiles_y, SrcWrapper src, DstWrapper dst, int image_width, int stride,
+                                              int image_height, bool inplace)
 {
     int ix = ((blockDim.x * blockIdx.x + threadIdx.x) << 1) + bx;
     int iy = ((blockDim.y * blockIdx.y + threadIdx.y) << 1) + by;
     if (ix < 0 || iy < 0 || ix >= image_width - 1 || iy >= image_height - 1)
         return;
 
-    int       itext_line       = 0;
     uchar4    context_color[4] = {0};
     const int batch_idx        = get_batch_idx();
 
-    for (int i = 0; i < num_command; ++i)
+    // ix is even, both columns of the quad fall in the same tile
+    const int tile  = (batch_idx * tiles_y + (iy >> OSD_TILE_SHIFT)) * tiles_x + (ix >> OSD_TILE_SHIFT);
+    const int begin = tile_offsets[tile];
+    const int end   = tile_offsets[tile + 1];
+
+    for (int i = begin; i < end; ++i)
     {
-        cuOSDContextCommand *pcommand = (cuOSDContextCommand *)(commands + command_offsets[i]);
+        cuOSDContextCommand *pcommand = (cuOSDContextCommand *)(commands + command_offsets[tile_commands[i]]);
 
         // because there is four pixel to operator
-        if (pcommand->batch_index != batch_idx || ix + 1 < pcommand->bounding_left || ix > pcommand->bounding_right
-            || iy + 1 < pcommand->bounding_top || iy > pcommand->bounding_bottom)
-        {
-            if (pcommand->type == CommandType::Text)
-                itext_line++;
+        if (ix + 1 < pcommand->bounding_left || ix > pcommand->bounding_right || iy + 1 < pcommand->bounding_top
+            || iy > pcommand->bounding_bottom)
             continue;
-        }
 
         switch (pcommand->type)
         {
@@ -1041,9 +1014,9 @@ static __global__ void render_elements_kernel(int bx, int by, const TextLocation
         }
         case CommandType::Text:
         {
-            int ilocation_begin = line_location_base[itext_line];
-            int ilocation_end   = line_location_base[itext_line + 1];
-            itext_line++;
+            TextCommand *text_cmd        = (TextCommand *)pcommand;
+            int          ilocation_begin = text_cmd->ilocation;
+            int          ilocation_end   = text_cmd->ilocation + text_cmd->text_line_size;
 
             for (int j = ilocation_begin; j < ilocation_end; ++j)
             {
@@ -1104,22 +1077,24 @@ static void cuosd_clear(cuOSDContext_t context)
     if (context)
     {
         context->commands.clear();
+        context->text_commands.clear();
         context->blur_commands.clear();
     }
 }
 
 typedef void (*cuosd_launch_kernel_impl_fptr)(void *src, void *dst, int width, int stride, int height,
                                               const TextLocation *text_location, const unsigned char *text_bitmap,
-                                              int text_bitmap_width, const int *line_location_base,
-                                              const unsigned char *commands, const int *commands_offset,
-                                              int num_commands, int bounding_left, int bounding_top, int bounding_right,
-                                              int bounding_bottom, bool inplace, int batch, void *_stream);
+                                              int text_bitmap_width, const unsigned char *commands,
+                                              const int *commands_offset, const int *tile_offsets,
+                                              const int *tile_commands, int tiles_x, int tiles_y, int bounding_left,
+                                              int bounding_top, int bounding_right, int bounding_bottom, bool inplace,
+                                              int batch, void *_stream);
 
 template<class SrcWrapper, class DstWrapper, cuOSDImageFormat format, bool have_rotate_msaa>
 static void cuosd_launch_kernel_impl(void *src, void *dst, int width, int stride, int height,
                                      const TextLocation *text_location, const unsigned char *text_bitmap,
-                                     int text_bitmap_width, const int *line_location_base,
-                                     const unsigned char *commands, const int *commands_offset, int num_commands,
+                                     int text_bitmap_width, const unsigned char *commands, const int *commands_offset,
+                                     const int *tile_offsets, const int *tile_commands, int tiles_x, int tiles_y,
                                      int bounding_left, int bounding_top, int bounding_right, int bounding_bottom,
                                      bool inplace, int batch, void *_stream)
 {
@@ -1146,8 +1121,8 @@ static void cuosd_launch_kernel_impl(void *src, void *dst, int width, int stride
 
     render_elements_kernel<format, have_rotate_msaa, SrcWrapper, DstWrapper><<<gridSize, blockSize, 0, stream>>>(
         inplace ? bounding_left : 0, inplace ? bounding_top : 0, text_location, text_bitmap, text_bitmap_width,
-        line_location_base, commands, commands_offset, num_commands, *(SrcWrapper *)src, *(DstWrapper *)dst, width,
-        stride, height, inplace);
+        commands, commands_offset, tile_offsets, tile_commands, tiles_x, tiles_y, *(SrcWrapper *)src,
+        *(DstWrapper *)dst, width, stride, height, inplace);
     cudaError_t code = cudaPeekAtLastError();
     if (code != cudaSuccess)
     {
@@ -1158,9 +1133,10 @@ static void cuosd_launch_kernel_impl(void *src, void *dst, int width, int stride
 template<class SrcWrapper, class DstWrapper>
 void cuosd_launch_kernel(SrcWrapper src, DstWrapper dst, int width, int stride, int height, cuOSDImageFormat format,
                          const TextLocation *text_location, const unsigned char *text_bitmap, int text_bitmap_width,
-                         const int *line_location_base, const unsigned char *commands, const int *commands_offset,
-                         int num_commands, int bounding_left, int bounding_top, int bounding_right, int bounding_bottom,
-                         bool have_rotate_msaa, bool inplace, int batch, void *_stream)
+                         const unsigned char *commands, const int *commands_offset, int num_commands,
+                         const int *tile_offsets, const int *tile_commands, int tiles_x, int tiles_y, int bounding_left,
+                         int bounding_top, int bounding_right, int bounding_bottom, bool have_rotate_msaa, bool inplace,
+                         int batch, void *_stream)
 {
     if (num_commands > 0)
     {
@@ -1179,8 +1155,8 @@ void cuosd_launch_kernel(SrcWrapper src, DstWrapper dst, int width, int stride,
         }
 
         func_list[index]((void *)(&src), (void *)(&dst), width, stride, height, text_location, text_bitmap,
-                         text_bitmap_width, line_location_base, commands, commands_offset, num_commands, bounding_left,
-                         bounding_top, bounding_right, bounding_bottom, inplace, batch, _stream);
+                         text_bitmap_width, commands, commands_offset, tile_offsets, tile_commands, tiles_x, tiles_y,
+                         bounding_left, bounding_top, bounding_right, bounding_bottom, inplace, batch, _stream);
     }
 }
 
@@ -1202,13 +1178,22 @@ void cuosd_launch(cuOSDContext_t context, SrcWrapper src, DstWrapper dst, int wi
         text_bitmap_width = context->text_backend->bitmap_width();
     }
 
+    // The tile lists were built for the image size and batch given to cuosd_apply.
+    if (context->bins.tiles_x != divUp(width, OSD_TILE_SIZE) || context->bins.tiles_y != divUp(height, OSD_TILE_SIZE)
+        || context->bins.batch != batch)
+    {
+        LOG_ERROR("Commands were binned for another image size, cuosd_apply must be called first\n");
+        return;
+    }
+
     cuosd_launch_kernel(
         src, dst, width, stride, height, format, context->text_location ? context->text_location->device() : nullptr,
-        text_bitmap, text_bitmap_width, context->line_location_base ? context->line_location_base->device() : nullptr,
-        context->gpu_commands ? context->gpu_commands->device() : nullptr,
-        context->gpu_commands_offset ? context->gpu_commands_offset->device() : nullptr, context->commands.size(),
-        context->bounding_left, context->bounding_top, context->bounding_right, context->bounding_bottom,
-        context->have_rotate_msaa, inplace, batch, stream);
+        text_bitmap, text_bitmap_width, context->commands.device_data(), context->commands.device_offsets(),
+        context->commands.size(),
+        context->gpu_tile_offsets ? context->gpu_tile_offsets->device() : nullptr,
+        context->gpu_tile_commands ? context->gpu_tile_commands->device() : nullptr, context->bins.tiles_x,
+        context->bins.tiles_y, context->bounding_left, context->bounding_top, context->bounding_right,
+        context->bounding_bottom, context->have_rotate_msaa, inplace, batch, stream);
     checkRuntime(cudaPeekAtLastError());
 }
 
@@ -1223,7 +1208,8 @@ static ErrorCode cuosd_draw_text(cuOSDContext_t context, int batch_idx, NVCVText
     cuOSDColor  bgColor     = *(cuOSDColor *)(&text.bgColor);
 
     if (context->text_backend == nullptr)
-        context->text_backend = create_text_backend(convert_to_text_backend_type(context->text_backend_type));
+        context->text_backend = create_text_backend(convert_to_text_backend_type(context->text_backend_type),
+                                                    context->raster_threads);
 
     if (context->text_backend == nullptr)
     {
@@ -1256,9 +1242,8 @@ static ErrorCode cuosd_draw_text(cuOSDContext_t context, int batch_idx, NVCVText
         cuosd_draw_rectangle(context, batch_idx, x, y, x + width + 2 * xmargin - 1, y + height + 2 * ymargin - 1, -1,
                              bgColor, {0, 0, 0, 0});
     }
-    context->commands.emplace_back(std::make_shared<TextHostCommand>(batch_idx, words, font_size, font, x + xmargin,
-                                                                     y + ymargin - yoffset, borderColor.r,
-                                                                     borderColor.g, borderColor.b, borderColor.a));
+    cuosd_add_text(context, batch_idx, std::move(words), font_size, font, x + xmargin, y + ymargin - yoffset,
+                   borderColor);
 
     return ErrorCode::SUCCESS;
 }
@@ -1289,7 +1274,7 @@ static ErrorCode cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int
             bbox.fillColor = bbox.borderColor;
         }
 
-        auto cmd           = std::make_shared<RectangleCommand>();
+        auto cmd           = context->commands.emplace<RectangleCommand>();
         cmd->batch_index   = batch_idx;
         cmd->thickness     = -1;
         cmd->interpolation = false;
@@ -1312,14 +1297,13 @@ static ErrorCode cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int
         cmd->bounding_right  = right;
         cmd->bounding_top    = top;
         cmd->bounding_bottom = bottom;
-        context->commands.emplace_back(cmd);
     }
     if (bbox.thickness == -1)
     {
         return ErrorCode::SUCCESS;
     }
 
-    auto cmd           = std::make_shared<RectangleCommand>();
+    auto cmd           = context->commands.emplace<RectangleCommand>();
     cmd->batch_index   = batch_idx;
     cmd->thickness     = bbox.thickness;
     cmd->interpolation = false;
@@ -1354,7 +1338,6 @@ static ErrorCode cuosd_draw_rectangle(cuOSDContext_t context, int batch_idx, int
     cmd->bounding_right  = right + int_half;
     cmd->bounding_top    = top - int_half;
     cmd->bounding_bottom = bottom + int_half;
-    context->commands.emplace_back(cmd);
 
     return ErrorCode::SUCCESS;
 }
@@ -1379,7 +1362,7 @@ static ErrorCode cuosd_draw_segmentmask(cuOSDContext_t context, int batch_idx, i
 
     if (segment.borderColor.a && segment.thickness > 0)
     {
-        auto cmd           = std::make_shared<RectangleCommand>();
+        auto cmd           = context->commands.emplace<RectangleCommand>();
         cmd->batch_index   = batch_idx;
         cmd->thickness     = segment.thickness;
         cmd->interpolation = false;
@@ -1412,10 +1395,9 @@ static ErrorCode cuosd_draw_segmentmask(cuOSDContext_t context, int batch_idx, i
         cmd->bounding_right  = right + int_half;
         cmd->bounding_top    = top - int_half;
         cmd->bounding_bottom = bottom + int_half;
-        context->commands.emplace_back(cmd);
     }
 
-    auto cmd         = std::make_shared<SegmentCommand>();
+    auto cmd         = context->commands.emplace<SegmentCommand>();
     cmd->batch_index = batch_idx;
 
     cmd->dSeg      = segment.dSeg;
@@ -1436,8 +1418,6 @@ static ErrorCode cuosd_draw_segmentmask(cuOSDContext_t context, int batch_idx, i
     cmd->bounding_top    = top - int_half + 1;
     cmd->bounding_bottom = bottom + int_half;
 
-    context->commands.emplace_back(cmd);
-
     return ErrorCode::SUCCESS;
 }
 
@@ -1445,21 +1425,20 @@ static ErrorCode cuosd_draw_circle(cuOSDContext_t context, int batch_idx, NVCVCi
 {
     if (circle.bgColor.a && circle.thickness > 0)
     {
-        context->commands.emplace_back(std::make_shared<CircleCommand>(
-            batch_idx, circle.centerPos.x, circle.centerPos.y, circle.radius, -circle.thickness, circle.bgColor.r,
-            circle.bgColor.g, circle.bgColor.b, circle.bgColor.a));
+        context->commands.emplace<CircleCommand>(batch_idx, circle.centerPos.x, circle.centerPos.y, circle.radius,
+                                                 -circle.thickness, circle.bgColor.r, circle.bgColor.g,
+                                                 circle.bgColor.b, circle.bgColor.a);
     }
-    context->commands.emplace_back(std::make_shared<CircleCommand>(
-        batch_idx, circle.centerPos.x, circle.centerPos.y, circle.radius, circle.thickness, circle.borderColor.r,
-        circle.borderColor.g, circle.borderColor.b, circle.borderColor.a));
+    context->commands.emplace<CircleCommand>(batch_idx, circle.centerPos.x, circle.centerPos.y, circle.radius,
+                                             circle.thickness, circle.borderColor.r, circle.borderColor.g,
+                                             circle.borderColor.b, circle.borderColor.a);
     return ErrorCode::SUCCESS;
 }
 
 static ErrorCode cuosd_draw_point(cuOSDContext_t context, int batch_idx, NVCVPoint point)
 {
-    context->commands.emplace_back(std::make_shared<CircleCommand>(batch_idx, point.centerPos.x, point.centerPos.y,
-                                                                   point.radius, -1, point.color.r, point.color.g,
-                                                                   point.color.b, point.color.a));
+    context->commands.emplace<CircleCommand>(batch_idx, point.centerPos.x, point.centerPos.y, point.radius, -1,
+                                             point.color.r, point.color.g, point.color.b, point.color.a);
     return ErrorCode::SUCCESS;
 }
 
@@ -1475,7 +1454,7 @@ static ErrorCode cuosd_draw_line(cuOSDContext_t context, int batch_idx, NVCVLine
     // upline
     // a    b
     // d    c
-    auto cmd         = std::make_shared<RectangleCommand>();
+    auto cmd         = context->commands.emplace<RectangleCommand>();
     cmd->batch_index = batch_idx;
     cmd->ax1         = -half_thickness * cos_angle + line.pos0.x - sin_angle * half_thickness;
     cmd->ay1         = -half_thickness * sin_angle + cos_angle * half_thickness + line.pos0.y;
@@ -1505,7 +1484,6 @@ static ErrorCode cuosd_draw_line(cuOSDContext_t context, int batch_idx, NVCVLine
     cmd->bounding_right  = ceil(max(max(max(cmd->ax1, cmd->bx1), cmd->cx1), cmd->dx1));
     cmd->bounding_top    = min(min(min(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1);
     cmd->bounding_bottom = ceil(max(max(max(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1));
-    context->commands.emplace_back(cmd);
 
     return ErrorCode::SUCCESS;
 }
@@ -1515,53 +1493,47 @@ static ErrorCode cuosd_draw_polyline(cuOSDContext_t context, int batch_idx, cons
     if (pl.numPoints < 2)
         return ErrorCode::INVALID_PARAMETER;
 
-    int bleft   = pl.hPoints[0];
-    int bright  = pl.hPoints[0];
-    int btop    = pl.hPoints[1];
-    int bbottom = pl.hPoints[1];
-    int nline   = 0;
-
-    for (int i = 1; i < pl.numPoints; i++)
+    // Fill poly if alpha is not 0 and point num > 2, drawn below its lines
+    if (pl.numPoints > 2 && pl.fillColor.a)
     {
-        int x = pl.hPoints[2 * i];
-        int y = pl.hPoints[2 * i + 1];
+        int bleft   = pl.hPoints[0];
+        int bright  = pl.hPoints[0];
+        int btop    = pl.hPoints[1];
+        int bbottom = pl.hPoints[1];
+
+        for (int i = 1; i < pl.numPoints; i++)
+        {
+            bleft   = min(pl.hPoints[2 * i], bleft);
+            bright  = max(pl.hPoints[2 * i], bright);
+            btop    = min(pl.hPoints[2 * i + 1], btop);
+            bbottom = max(pl.hPoints[2 * i + 1], bbottom);
+        }
 
-        bleft   = min(x, bleft);
-        bright  = max(x, bright);
-        btop    = min(y, btop);
-        bbottom = max(y, bbottom);
-        cuosd_draw_line(context, batch_idx, pl.hPoints[2 * i - 2], pl.hPoints[2 * i - 1], x, y, pl.thickness,
-                        *(cuOSDColor *)(&pl.borderColor), pl.interpolation);
-        nline++;
+        auto cmd             = context->commands.emplace<PolyFillCommand>();
+        cmd->batch_index     = batch_idx;
+        cmd->dPoints         = pl.dPoints;
+        cmd->numPoints       = pl.numPoints;
+        cmd->bounding_left   = bleft;
+        cmd->bounding_right  = bright;
+        cmd->bounding_top    = btop;
+        cmd->bounding_bottom = bbottom;
+        cmd->c0              = pl.fillColor.r;
+        cmd->c1              = pl.fillColor.g;
+        cmd->c2              = pl.fillColor.b;
+        cmd->c3              = pl.fillColor.a;
     }
 
-    if (pl.numPoints > 2)
+    for (int i = 1; i < pl.numPoints; i++)
     {
-        if (pl.isClosed)
-        {
-            cuosd_draw_line(context, batch_idx, pl.hPoints[0], pl.hPoints[1], pl.hPoints[2 * pl.numPoints - 2],
-                            pl.hPoints[2 * pl.numPoints - 1], pl.thickness, *(cuOSDColor *)(&pl.borderColor),
-                            pl.interpolation);
-            nline++;
-        }
+        cuosd_draw_line(context, batch_idx, pl.hPoints[2 * i - 2], pl.hPoints[2 * i - 1], pl.hPoints[2 * i],
+                        pl.hPoints[2 * i + 1], pl.thickness, *(cuOSDColor *)(&pl.borderColor), pl.interpolation);
+    }
 
-        // Fill poly if alpha is not 0 and point num > 2
-        if (pl.fillColor.a)
-        {
-            auto cmd             = std::make_shared<PolyFillCommand>();
-            cmd->batch_index     = batch_idx;
-            cmd->dPoints         = pl.dPoints;
-            cmd->numPoints       = pl.numPoints;
-            cmd->bounding_left   = bleft;
-            cmd->bounding_right  = bright;
-            cmd->bounding_top    = btop;
-            cmd->bounding_bottom = bbottom;
-            cmd->c0              = pl.fillColor.r;
-            cmd->c1              = pl.fillColor.g;
-            cmd->c2              = pl.fillColor.b;
-            cmd->c3              = pl.fillColor.a;
-            context->commands.insert(context->commands.end() - nline, cmd);
-        }
+    if (pl.numPoints > 2 && pl.isClosed)
+    {
+        cuosd_draw_line(context, batch_idx, pl.hPoints[0], pl.hPoints[1], pl.hPoints[2 * pl.numPoints - 2],
+                        pl.hPoints[2 * pl.numPoints - 1], pl.thickness, *(cuOSDColor *)(&pl.borderColor),
+                        pl.interpolation);
     }
 
     return ErrorCode::SUCCESS;
@@ -1629,7 +1601,7 @@ static ErrorCode cuosd_draw_rotationbox(cuOSDContext_t context, int batch_idx, N
             rb.bgColor = rb.borderColor;
         }
 
-        auto cmd           = std::make_shared<RectangleCommand>();
+        auto cmd           = context->commands.emplace<RectangleCommand>();
         cmd->batch_index   = batch_idx;
         cmd->thickness     = -1;
         cmd->interpolation = rb.interpolation;
@@ -1655,12 +1627,11 @@ static ErrorCode cuosd_draw_rotationbox(cuOSDContext_t context, int batch_idx, N
         cmd->bounding_right  = ceil(max(max(max(cmd->ax1, cmd->bx1), cmd->cx1), cmd->dx1));
         cmd->bounding_top    = min(min(min(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1);
         cmd->bounding_bottom = ceil(max(max(max(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1));
-        context->commands.emplace_back(cmd);
     }
     if (rb.thickness == -1)
         return ErrorCode::INVALID_PARAMETER;
 
-    auto cmd         = std::make_shared<RectangleCommand>();
+    auto cmd         = context->commands.emplace<RectangleCommand>();
     cmd->batch_index = batch_idx;
     cmd->thickness   = rb.thickness;
     cmd->c0          = rb.borderColor.r;
@@ -1691,7 +1662,6 @@ static ErrorCode cuosd_draw_rotationbox(cuOSDContext_t context, int batch_idx, N
     cmd->bounding_right  = ceil(max(max(max(cmd->ax1, cmd->bx1), cmd->cx1), cmd->dx1));
     cmd->bounding_top    = min(min(min(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1);
     cmd->bounding_bottom = ceil(max(max(max(cmd->ay1, cmd->by1), cmd->cy1), cmd->dy1));
-    context->commands.emplace_back(cmd);
 
     return ErrorCode::SUCCESS;
 }
@@ -1724,8 +1694,19 @@ static ErrorCode cuosd_draw_clock(cuOSDContext_t context, int batch_idx, NVCVClo
     return ErrorCode::SUCCESS;
 }
 
+// Most elements end up as a border and a fill rectangle, sizing the arena for that up front
+// spares growing it while drawing. Anything beyond still fits, the arena grows as needed.
+static void cuosd_reserve(cuOSDContext_t context, size_t num_elements)
+{
+    context->commands.reserve(2 * num_elements, 2 * num_elements * sizeof(RectangleCommand));
+}
+
 static ErrorCode cuosd_draw_elements(cuOSDContext_t context, int width, int height, NVCVElementsImpl *ctx)
 {
+    size_t num_elements = 0;
+    for (int n = 0; n < ctx->batch(); n++) num_elements += ctx->numElementsAt(n);
+    cuosd_reserve(context, num_elements);
+
     for (int n = 0; n < ctx->batch(); n++)
     {
         auto numElements = ctx->numElementsAt(n);
@@ -1801,6 +1782,10 @@ static ErrorCode cuosd_draw_elements(cuOSDContext_t context, int width, int heig
 
 static ErrorCode cuosd_draw_bndbox(cuOSDContext_t context, int width, int height, NVCVBndBoxesImpl *bboxes)
 {
+    size_t num_boxes = 0;
+    for (int n = 0; n < bboxes->batch(); n++) num_boxes += bboxes->numBoxesAt(n);
+    cuosd_reserve(context, num_boxes);
+
     for (int n = 0; n < bboxes->batch(); n++)
     {
         auto numBoxes = bboxes->numBoxesAt(n);
@@ -1814,10 +1799,41 @@ static ErrorCode cuosd_draw_bndbox(cuOSDContext_t context, int width, int height
     return ErrorCode::SUCCESS;
 }
 
-OSD::OSD(DataShape max_input_shape, DataShape max_output_shape)
+// Rasterizes the characters of a UTF-8 text ahead of time, font_size as in NVCVText.
+static ErrorCode cuosd_prewarm_text(cuOSDContext_t context, const char *utf8_text, const char *font, int font_size,
+                                    cudaStream_t stream)
+{
+    if (context->text_backend == nullptr)
+        context->text_backend = create_text_backend(convert_to_text_backend_type(context->text_backend_type),
+                                                    context->raster_threads);
+
+    if (context->text_backend == nullptr)
+    {
+        LOG_ERROR("There are no valid backend, please make sure your settings\n");
+        return ErrorCode::INVALID_PARAMETER;
+    }
+
+    auto words = split_charset(context->text_backend.get(), utf8_text);
+    if (words.empty())
+        return ErrorCode::SUCCESS;
+
+    font_size = context->text_backend->uniform_font_size(font_size);
+    font_size = std::max(10, std::min(MAX_FONT_SIZE, font_size));
+    context->text_backend->prewarm(words, font_size, font, stream);
+    return ErrorCode::SUCCESS;
+}
+
+OSD::OSD(DataShape max_input_shape, DataShape max_output_shape, int num_raster_threads)
     : CudaBaseOp(max_input_shape, max_output_shape)
 {
-    m_context = new cuOSDContext();
+    cuOSDContext *context   = new cuOSDContext();
+    context->raster_threads = num_raster_threads;
+    m_context               = context;
+}
+
+ErrorCode OSD::prewarm(const char *utf8_text, const char *font, int font_size, cudaStream_t stream)
+{
+    return cuosd_prewarm_text((cuOSDContext_t)m_context, utf8_text, font, font_size, stream);
 }
 
 OSD::~OSD()
@@ -1908,7 +1924,7 @@ ErrorCode OSD::infer(const nvcv::TensorDataStridedCuda &inData, const nvcv::Tens
     if (inputShape.C == 3)
         format = cuOSDImageFormat::RGB;
 
-    cuosd_apply(m_context, inputShape.W, inputShape.H, format, stream);
+    cuosd_apply(m_context, inputShape.W, inputShape.H, inputShape.N, format, stream);
 
     auto src     = nvcv::cuda::CreateTensorWrapNHWC<uint8_t>(inData);
     auto dst     = nvcv::cuda::CreateTensorWrapNHWC<uint8_t>(outData);
@@ -1994,7 +2010,7 @@ ErrorCode OSD::inferBox(const nvcv::TensorDataStridedCuda &inData, const nvcv::T
     if (inputShape.C == 3)
         format = cuOSDImageFormat::RGB;
 
-    cuosd_apply(m_context, inputShape.W, inputShape.H, format, stream);
+    cuosd_apply(m_context, inputShape.W, inputShape.H, inputShape.N, format, stream);
 
     auto src     = nvcv::cuda::CreateTensorWrapNHWC<uint8_t>(inData);
     auto dst     = nvcv::cuda::CreateTensorWrapNHWC<uint8_t>(outData);
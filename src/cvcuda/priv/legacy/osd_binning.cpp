@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "osd_binning.hpp"
+
+#include <algorithm>
+
+namespace nvcv::cuda { namespace osd {
+
+namespace {
+
+// Range of tiles covered by a box, false when it doesn't touch the image.
+bool tile_range(const CommandBox &box, int width, int height, int batch, int &tx0, int &ty0, int &tx1, int &ty1)
+{
+    if (box.batch_index < 0 || box.batch_index >= batch)
+        return false;
+
+    // Quads start at even coordinates, a box starting right after one doesn't touch it.
+    int x0 = std::max(box.left - 1, 0);
+    int y0 = std::max(box.top - 1, 0);
+    x0 += x0 & 1;
+    y0 += y0 & 1;
+    int x1 = std::min(box.right, width - 1);
+    int y1 = std::min(box.bottom, height - 1);
+    if (x0 > x1 || y0 > y1)
+        return false;
+
+    tx0 = x0 >> OSD_TILE_SHIFT;
+    ty0 = y0 >> OSD_TILE_SHIFT;
+    tx1 = x1 >> OSD_TILE_SHIFT;
+    ty1 = y1 >> OSD_TILE_SHIFT;
+    return true;
+}
+
+} // namespace
+
+void bin_commands(const std::vector<CommandBox> &boxes, int width, int height, int batch, CommandBins &bins)
+{
+    bins.tiles_x = (std::max(width, 0) + OSD_TILE_SIZE - 1) >> OSD_TILE_SHIFT;
+    bins.tiles_y = (std::max(height, 0) + OSD_TILE_SIZE - 1) >> OSD_TILE_SHIFT;
+    bins.batch   = std::max(batch, 0);
+    bins.offsets.assign(bins.num_tiles() + 1, 0);
+
+    // First pass counts the commands of each tile, second one fills the lists.
+    int tx0, ty0, tx1, ty1;
+    for (const CommandBox &box : boxes)
+    {
+        if (!tile_range(box, width, height, bins.batch, tx0, ty0, tx1, ty1))
+            continue;
+
+        for (int ty = ty0; ty <= ty1; ++ty)
+            for (int tx = tx0; tx <= tx1; ++tx) bins.offsets[bins.tile_index(box.batch_index, tx, ty) + 1]++;
+    }
+
+    for (int t = 0; t < bins.num_tiles(); ++t) bins.offsets[t + 1] += bins.offsets[t];
+    bins.commands.resize(bins.offsets.back());
+
+    std::vector<int> cursor(bins.offsets.begin(), bins.offsets.end() - 1);
+    for (int i = 0; i < (int)boxes.size(); ++i)
+    {
+        if (!tile_range(boxes[i], width, height, bins.batch, tx0, ty0, tx1, ty1))
+            continue;
+
+        for (int ty = ty0; ty <= ty1; ++ty)
+        {
+            for (int tx = tx0; tx <= tx1; ++tx)
+            {
+                int tile                      = bins.tile_index(boxes[i].batch_index, tx, ty);
+                bins.commands[cursor[tile]++] = i;
+            }
+        }
+    }
+}
+
+}} // namespace nvcv::cuda::osd
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_OSD_BINNING_HPP
+#define CV_CUDA_OSD_BINNING_HPP
+
+#include <vector>
+
+namespace nvcv::cuda { namespace osd {
+
+// Commands are binned into square screen tiles of (1 << OSD_TILE_SHIFT) pixels.
+constexpr int OSD_TILE_SHIFT = 6;
+constexpr int OSD_TILE_SIZE  = 1 << OSD_TILE_SHIFT;
+
+// Inclusive pixel rectangle a command may touch, as in cuOSDContextCommand::bounding_*.
+struct CommandBox
+{
+    int left, top, right, bottom;
+    int batch_index;
+};
+
+// Per tile lists of command indices, stored as offsets into one array. The commands
+// of tile t are commands[offsets[t]] to commands[offsets[t + 1] - 1], in submission
+// order so that blending stays the same as when walking all the commands.
+struct CommandBins
+{
+    int              tiles_x = 0;
+    int              tiles_y = 0;
+    int              batch   = 0;
+    std::vector<int> offsets;
+    std::vector<int> commands;
+
+    int num_tiles() const
+    {
+        return tiles_x * tiles_y * batch;
+    }
+
+    int tile_index(int batch_index, int tile_x, int tile_y) const
+    {
+        return (batch_index * tiles_y + tile_y) * tiles_x + tile_x;
+    }
+};
+
+// Assigns each command to the tiles of its batch image overlapped by its box. The render
+// kernel works on 2x2 pixel quads starting at even (ix, iy) and draws a command on a quad
+// when ix is in [left - 1, right] and iy in [top - 1, bottom], the binning follows the same rule.
+// Commands outside the image or with a batch index outside [0, batch) are dropped.
+void bin_commands(const std::vector<CommandBox> &boxes, int width, int height, int batch, CommandBins &bins);
+
+}} // namespace nvcv::cuda::osd
+
+#endif // CV_CUDA_OSD_BINNING_HPP
@@ -26,6 +26,9 @@
 
 #include <nvcv/Rect.h>
 
+#include <algorithm>
+#include <memory>
+
 using namespace nvcv;
 using namespace nvcv::legacy::cuda_op;
 using namespace nvcv::legacy::helpers;
@@ -125,6 +128,55 @@ __global__ void _precomputeCoeffs(int in_size, int in0, work_type scale, work_ty
     }
 }
 
+// Host version of _precomputeCoeffs, in double precision as Pillow's precompute_coeffs.
+template<class Filter>
+void precompute_coeffs_host(int in_size, int out_size, bool normalize_coeff, PillowResizeCoeffs &coeffs)
+{
+    Filter filterp;
+
+    const double half_pixel  = 0.5;
+    const double scale       = static_cast<double>(in_size) / out_size;
+    const double filterscale = scale < 1.0 ? 1.0 : scale;
+    const double support     = filterp.support() * filterscale;
+    const double ss          = 1.0 / filterscale;
+
+    const int k_size = static_cast<int>(ceil(support)) * 2 + 1;
+
+    coeffs.k_size = k_size;
+    coeffs.kk.assign(static_cast<size_t>(out_size) * k_size, 0.f);
+    coeffs.bounds.resize(static_cast<size_t>(out_size) * 2);
+
+    std::vector<double> k(k_size);
+    for (int xx = 0; xx < out_size; ++xx)
+    {
+        double center = (xx + half_pixel) * scale;
+        double ww     = 0.0;
+
+        int xmin = std::max(static_cast<int>(center - support + half_pixel), 0);
+        int xmax = std::min(static_cast<int>(center + support + half_pixel), in_size) - xmin;
+
+        for (int x = 0; x < xmax; ++x)
+        {
+            k[x] = filterp.filter((x + xmin - center + half_pixel) * ss);
+            ww += k[x];
+        }
+
+        float *kk = &coeffs.kk[static_cast<size_t>(xx) * k_size];
+        for (int x = 0; x < xmax; ++x)
+        {
+            double val = std::fabs(ww) > 1e-5 ? k[x] / ww : k[x];
+            if (normalize_coeff)
+            {
+                val = static_cast<int>((val < 0 ? -half_pixel : half_pixel) + val * (1U << precision_bits));
+            }
+            kk[x] = static_cast<float>(val);
+        }
+
+        coeffs.bounds[xx * 2]     = xmin;
+        coeffs.bounds[xx * 2 + 1] = xmax;
+    }
+}
+
 template<class T, class Filter>
 __global__ void horizontal_pass(const cuda_op::Ptr2dNHWC<T> src, cuda_op::Ptr2dNHWC<T> dst, NVCVRectI roi,
                                 Filter &filterp, int h_ksize, int v_ksize, int *h_bounds, work_type *h_kk,
@@ -231,7 +283,8 @@ __global__ void vertical_pass(const cuda_op::Ptr2dNHWC<T> src, cuda_op::Ptr2dNHW
 template<typename Filter, typename elem_type>
 void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
                       const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace, bool normalize_coeff,
-                      work_type init_buffer, bool round_up, cudaStream_t stream)
+                      work_type init_buffer, bool round_up, PillowResizeCoeffCache *coeff_cache,
+                      NVCVInterpolationType interpolation, cudaStream_t stream)
 {
     cuda_op::DataShape   input_shape = GetLegacyDataShape(inData.infoShape());
     Ptr2dNHWC<elem_type> src_ptr(inData);
@@ -271,6 +324,31 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
 
     Ptr2dNHWC<elem_type> h_ptr(input_shape.N, input_shape.H, out_width, input_shape.C, (elem_type *)d_h_data);
 
+    // The cached tables replace the ones in the workspace, which only keeps the horizontal pass output.
+    std::shared_ptr<const PillowResizeCoeffTable> h_table, v_table;
+    if (coeff_cache != nullptr && coeff_cache->capacity() > 0)
+    {
+        int device = 0;
+        checkCudaErrors(cudaGetDevice(&device));
+
+        PillowResizeCoeffKey h_key{device, interpolation, src_ptr.cols, dst_ptr.cols, normalize_coeff};
+        PillowResizeCoeffKey v_key{device, interpolation, src_ptr.rows, dst_ptr.rows, normalize_coeff};
+
+        auto compute = [](const PillowResizeCoeffKey &key, PillowResizeCoeffs &coeffs)
+        {
+            precompute_coeffs_host<Filter>(key.in_size, key.out_size, key.normalize_coeff, coeffs);
+        };
+        h_table = coeff_cache->get(h_key, stream, compute);
+        v_table = coeff_cache->get(v_key, stream, compute);
+
+        h_k_size = h_table->k_size;
+        v_k_size = v_table->k_size;
+        h_kk     = h_table->kk;
+        v_kk     = v_table->kk;
+        h_bounds = h_table->bounds;
+        v_bounds = v_table->bounds;
+    }
+
     dim3 blockSize(BLOCK, BLOCK / 4, 1);
     dim3 gridSizeH(divUp(out_width, blockSize.x), divUp(input_shape.H, blockSize.y), input_shape.N);
     dim3 gridSizeV(divUp(out_width, blockSize.x), divUp(out_height, blockSize.y), input_shape.N);
@@ -300,27 +378,30 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
         hv_sm_size1 = 0;
         hv_sm_size2 = 0;
     }
-    // compute horizental coef
-    _precomputeCoeffs<Filter><<<h_coef_grid, coef_block, h_sm_size, stream>>>(
-        src_ptr.cols, roi.x, h_scale, h_filterscale, h_support, dst_ptr.cols, h_k_size, filterp, h_bounds, h_kk,
-        normalize_coeff, h_use_share_mem);
+    if (!h_table)
+    {
+        // compute horizental coef
+        _precomputeCoeffs<Filter><<<h_coef_grid, coef_block, h_sm_size, stream>>>(
+            src_ptr.cols, roi.x, h_scale, h_filterscale, h_support, dst_ptr.cols, h_k_size, filterp, h_bounds, h_kk,
+            normalize_coeff, h_use_share_mem);
 
-    checkKernelErrors();
+        checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
+        checkCudaErrors(cudaStreamSynchronize(stream));
+        checkCudaErrors(cudaGetLastError());
 #endif
 
-    // compute vertical coef
-    _precomputeCoeffs<Filter><<<v_coef_grid, coef_block, v_sm_size, stream>>>(
-        src_ptr.rows, roi.y, v_scale, v_filterscale, v_support, dst_ptr.rows, v_k_size, filterp, v_bounds, v_kk,
-        normalize_coeff, v_use_share_mem);
+        // compute vertical coef
+        _precomputeCoeffs<Filter><<<v_coef_grid, coef_block, v_sm_size, stream>>>(
+            src_ptr.rows, roi.y, v_scale, v_filterscale, v_support, dst_ptr.rows, v_k_size, filterp, v_bounds, v_kk,
+            normalize_coeff, v_use_share_mem);
 
-    checkKernelErrors();
+        checkKernelErrors();
 #ifdef CUDA_DEBUG_LOG
-    checkCudaErrors(cudaStreamSynchronize(stream));
-    checkCudaErrors(cudaGetLastError());
+        checkCudaErrors(cudaStreamSynchronize(stream));
+        checkCudaErrors(cudaGetLastError());
 #endif
+    }
 
     horizontal_pass<elem_type, Filter>
         <<<gridSizeH, blockSize, hv_sm_size1, stream>>>(src_ptr, h_ptr, roi, filterp, h_k_size, v_k_size, h_bounds,
@@ -340,34 +421,46 @@ void pillow_resize_v2(const TensorDataAccessStridedImagePlanar &inData,
 template<typename Filter>
 void pillow_resize_filter(const TensorDataAccessStridedImagePlanar &inData,
                           const TensorDataAccessStridedImagePlanar &outData, void *gpu_workspace,
-                          NVCVInterpolationType interpolation, cudaStream_t stream)
+                          NVCVInterpolationType interpolation, PillowResizeCoeffCache *coeff_cache,
+                          cudaStream_t stream)
 {
     cuda_op::DataType data_type = GetLegacyDataType(inData.dtype());
     switch (data_type)
     {
     case kCV_8U:
-        pillow_resize_v2<Filter, unsigned char>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, unsigned char>(inData, outData, gpu_workspace, false, 0., false, coeff_cache,
+                                                interpolation, stream);
         break;
     case kCV_8S:
-        pillow_resize_v2<Filter, signed char>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, signed char>(inData, outData, gpu_workspace, false, 0., true, coeff_cache,
+                                              interpolation, stream);
         break;
     case kCV_16U:
-        pillow_resize_v2<Filter, std::uint16_t>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, std::uint16_t>(inData, outData, gpu_workspace, false, 0., false, coeff_cache,
+                                                interpolation, stream);
         break;
     case kCV_16S:
-        pillow_resize_v2<Filter, std::int16_t>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, std::int16_t>(inData, outData, gpu_workspace, false, 0., true, coeff_cache,
+                                               interpolation, stream);
         break;
     case kCV_32S:
-        pillow_resize_v2<Filter, int>(inData, outData, gpu_workspace, false, 0., true, stream);
+        pillow_resize_v2<Filter, int>(inData, outData, gpu_workspace, false, 0., true, coeff_cache,
+                                      interpolation, stream);
         break;
     case kCV_32F:
-        pillow_resize_v2<Filter, float>(inData, outData, gpu_workspace, false, 0., false, stream);
+        pillow_resize_v2<Filter, float>(inData, outData, gpu_workspace, false, 0., false, coeff_cache,
+                                        interpolation, stream);
         break;
     default:
         break;
     }
 }
 
+PillowResize::PillowResize(int coeff_cache_size)
+    : m_coeffCache(std::make_unique<PillowResizeCoeffCache>(coeff_cache_size))
+{
+}
+
 WorkspaceRequirements PillowResize::getWorkspaceRequirements(DataShape max_input_shape, DataShape max_output_shape,
                                                              DataType max_data_type)
 {
@@ -435,19 +528,24 @@ ErrorCode PillowResize::infer(const TensorDataStridedCuda &inData, const TensorD
     switch (interpolation)
     {
     case NVCV_INTERP_LINEAR:
-        pillow_resize_filter<BilinearFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
+        pillow_resize_filter<BilinearFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, m_coeffCache.get(),
+                                             stream);
         break;
     case NVCV_INTERP_CUBIC:
-        pillow_resize_filter<BicubicFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
+        pillow_resize_filter<BicubicFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, m_coeffCache.get(),
+                                            stream);
         break;
     case NVCV_INTERP_LANCZOS:
-        pillow_resize_filter<LanczosFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
+        pillow_resize_filter<LanczosFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, m_coeffCache.get(),
+                                            stream);
         break;
     case NVCV_INTERP_BOX:
-        pillow_resize_filter<BoxFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
+        pillow_resize_filter<BoxFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, m_coeffCache.get(),
+                                        stream);
         break;
     case NVCV_INTERP_HAMMING:
-        pillow_resize_filter<HammingFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, stream);
+        pillow_resize_filter<HammingFilter>(*inAccess, *outAccess, gpu_workspace, interpolation, m_coeffCache.get(),
+                                            stream);
         break;
     default:
         LOG_ERROR("Unsupported interpolation method " << interpolation);
@@ -48,7 +48,8 @@ public:
     __host__ __device__ BilinearFilter()
         : _support(bilinear_filter_support){};
 
-    __host__ __device__ work_type filter(work_type x)
+    template<typename T>
+    __host__ __device__ T filter(T x)
     {
         if (x < 0.0)
         {
@@ -76,7 +77,8 @@ public:
     __host__ __device__ BoxFilter()
         : _support(box_filter_support){};
 
-    __host__ __device__ work_type filter(work_type x)
+    template<typename T>
+    __host__ __device__ T filter(T x)
     {
         const float half_pixel = 0.5;
         if (x > -half_pixel && x <= half_pixel)
@@ -101,7 +103,8 @@ public:
     __host__ __device__ HammingFilter()
         : _support(hamming_filter_support){};
 
-    __host__ __device__ work_type filter(work_type x)
+    template<typename T>
+    __host__ __device__ T filter(T x)
     {
         if (x < 0.0)
         {
@@ -134,7 +137,8 @@ public:
     __host__ __device__ BicubicFilter()
         : _support(bicubic_filter_support){};
 
-    __host__ __device__ work_type filter(work_type x)
+    template<typename T>
+    __host__ __device__ T filter(T x)
     {
         const float a = -0.5f;
         if (x < 0.0)
@@ -167,7 +171,8 @@ public:
     __host__ __device__ LanczosFilter()
         : _support(lanczos_filter_support){};
 
-    __host__ __device__ work_type _sincFilter(work_type x)
+    template<typename T>
+    __host__ __device__ T _sincFilter(T x)
     {
         if (x == 0.0)
         {
@@ -177,7 +182,8 @@ public:
         return sin(x) / x;
     }
 
-    __host__ __device__ work_type filter(work_type x)
+    template<typename T>
+    __host__ __device__ T filter(T x)
     {
         const float lanczos_a_param = 3.0;
         if (-lanczos_a_param <= x && x < lanczos_a_param)
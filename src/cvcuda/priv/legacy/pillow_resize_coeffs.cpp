@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pillow_resize_coeffs.hpp"
+
+#include <nvcv/util/CheckError.hpp>
+
+#include <iterator>
+
+namespace nvcv::legacy::cuda_op {
+
+PillowResizeCoeffTable::PillowResizeCoeffTable(const PillowResizeCoeffs &coeffs, cudaStream_t stream)
+    : k_size(coeffs.k_size)
+    , kk(nullptr)
+    , bounds(nullptr)
+    , ready(nullptr)
+{
+    size_t kkBytes     = coeffs.kk.size() * sizeof(float);
+    size_t boundsBytes = coeffs.bounds.size() * sizeof(int);
+
+    NVCV_CHECK_THROW(cudaMalloc(&kk, kkBytes + boundsBytes));
+    bounds = reinterpret_cast<int *>(reinterpret_cast<char *>(kk) + kkBytes);
+
+    try
+    {
+        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&ready, cudaEventDisableTiming));
+        NVCV_CHECK_THROW(cudaMemcpyAsync(kk, coeffs.kk.data(), kkBytes, cudaMemcpyHostToDevice, stream));
+        NVCV_CHECK_THROW(cudaMemcpyAsync(bounds, coeffs.bounds.data(), boundsBytes, cudaMemcpyHostToDevice, stream));
+        NVCV_CHECK_THROW(cudaEventRecord(ready, stream));
+    }
+    catch (...)
+    {
+        if (ready != nullptr)
+        {
+            cudaEventDestroy(ready);
+        }
+        cudaFree(kk);
+        throw;
+    }
+}
+
+PillowResizeCoeffTable::~PillowResizeCoeffTable()
+{
+    // cudaFree waits for the kernels still reading the table.
+    NVCV_CHECK_LOG(cudaEventDestroy(ready));
+    NVCV_CHECK_LOG(cudaFree(kk));
+}
+
+PillowResizeCoeffCache::PillowResizeCoeffCache(int capacity)
+    : m_capacity(capacity < 0 ? 0 : capacity)
+{
+}
+
+std::shared_ptr<const PillowResizeCoeffTable> PillowResizeCoeffCache::get(const PillowResizeCoeffKey &key,
+                                                                          cudaStream_t stream, const ComputeFn &compute)
+{
+    auto find = [this, &key]()
+    {
+        auto it = m_entries.begin();
+        while (it != m_entries.end() && !(it->first == key))
+        {
+            ++it;
+        }
+        return it;
+    };
+
+    std::shared_ptr<const PillowResizeCoeffTable> table;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = find();
+        if (it != m_entries.end())
+        {
+            m_entries.splice(m_entries.begin(), m_entries, it);
+            table = it->second;
+        }
+    }
+
+    if (!table)
+    {
+        // Computed and uploaded out of the lock, so that a miss doesn't hold back the callers on other streams.
+        PillowResizeCoeffs coeffs;
+        compute(key, coeffs);
+        std::shared_ptr<const PillowResizeCoeffTable> built
+            = std::make_shared<const PillowResizeCoeffTable>(coeffs, stream);
+
+        // Released out of the lock, cudaFree may have to wait for the device.
+        std::list<Entry> dropped;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto it = find();
+            if (it != m_entries.end())
+            {
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                table = it->second;
+                dropped.emplace_front(key, std::move(built));
+            }
+            else
+            {
+                table = built;
+                m_entries.emplace_front(key, std::move(built));
+                while (static_cast<int>(m_entries.size()) > m_capacity)
+                {
+                    dropped.splice(dropped.begin(), m_entries, std::prev(m_entries.end()));
+                }
+            }
+        }
+    }
+
+    NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, table->ready));
+    return table;
+}
+
+} // namespace nvcv::legacy::cuda_op
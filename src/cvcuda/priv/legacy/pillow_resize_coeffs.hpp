@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CV_CUDA_PILLOW_RESIZE_COEFFS_HPP
+#define CV_CUDA_PILLOW_RESIZE_COEFFS_HPP
+
+#include <cuda_runtime.h>
+#include <cvcuda/Types.h>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nvcv::legacy::cuda_op {
+
+// Identifies the resampling coefficients of one axis, they only depend on the input and
+// output sizes along the axis and on the filter, as the whole input image is resampled.
+struct PillowResizeCoeffKey
+{
+    int                   device;
+    NVCVInterpolationType filter;
+    int                   in_size;
+    int                   out_size;
+    bool                  normalize_coeff;
+
+    bool operator==(const PillowResizeCoeffKey &that) const
+    {
+        return device == that.device && filter == that.filter && in_size == that.in_size && out_size == that.out_size
+            && normalize_coeff == that.normalize_coeff;
+    }
+};
+
+// Coefficients and bounds of one axis, laid out as written by _precomputeCoeffs: out_size rows
+// of k_size weights, and (xmin, xmax) pairs per output pixel.
+struct PillowResizeCoeffs
+{
+    int                k_size = 0;
+    std::vector<float> kk;
+    std::vector<int>   bounds;
+};
+
+// Device copy of a coefficient table. 'ready' is recorded after the upload, streams other than
+// the one that uploaded the table must wait on it before reading kk and bounds.
+struct PillowResizeCoeffTable
+{
+    PillowResizeCoeffTable(const PillowResizeCoeffs &coeffs, cudaStream_t stream);
+    ~PillowResizeCoeffTable();
+
+    PillowResizeCoeffTable(const PillowResizeCoeffTable &)            = delete;
+    PillowResizeCoeffTable &operator=(const PillowResizeCoeffTable &) = delete;
+
+    int         k_size;
+    float      *kk;
+    int        *bounds;
+    cudaEvent_t ready;
+};
+
+// Bounded LRU cache of device coefficient tables, shared by all the streams the operator
+// is called on. Tables are computed on the host by the callback given to get() on a miss
+// and uploaded on the stream of the call that missed, without holding the cache lock.
+class PillowResizeCoeffCache
+{
+public:
+    using ComputeFn = std::function<void(const PillowResizeCoeffKey &key, PillowResizeCoeffs &coeffs)>;
+
+    // Number of tables kept by default, 0 disables the cache.
+    static constexpr int DEFAULT_CAPACITY = 64;
+
+    explicit PillowResizeCoeffCache(int capacity);
+
+    int capacity() const
+    {
+        return m_capacity;
+    }
+
+    // Returns the table for 'key', computing and uploading it on 'stream' if it isn't cached.
+    // 'stream' is made to wait for the upload of the returned table. When concurrent misses
+    // build the same table, the first one inserted is kept and the others are dropped.
+    std::shared_ptr<const PillowResizeCoeffTable> get(const PillowResizeCoeffKey &key, cudaStream_t stream,
+                                                      const ComputeFn &compute);
+
+private:
+    using Entry = std::pair<PillowResizeCoeffKey, std::shared_ptr<const PillowResizeCoeffTable>>;
+
+    int              m_capacity;
+    std::mutex       m_mutex;
+    std::list<Entry> m_entries; // most recently used first
+};
+
+} // namespace nvcv::legacy::cuda_op
+
+#endif // CV_CUDA_PILLOW_RESIZE_COEFFS_HPP
@@ -0,0 +1,242 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "atlas.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <map>
+
+// Shelf heights are rounded up so that glyphs of slightly different heights can share them.
+static int align_shelf_height(int h)
+{
+    return (h + 3) & ~3;
+}
+
+GlyphAtlas::GlyphAtlas(int width, int initial_height, size_t max_bytes)
+    : width_(width)
+    , height_(initial_height)
+    , max_height_(std::max<int>(initial_height, max_bytes / width))
+    , pixels_((size_t)width * initial_height, 0)
+{
+    assert(width > 0 && initial_height > 0);
+}
+
+void GlyphAtlas::begin_frame()
+{
+    ++frame_;
+}
+
+int GlyphAtlas::allocate(int w, int h, std::vector<int> &evicted)
+{
+    if (w < 1 || h < 1 || w > width_ || h > max_height_)
+        return -1;
+
+    int shelf = find_shelf(w, h);
+    if (shelf < 0)
+        shelf = open_shelf(h);
+    if (shelf < 0)
+        shelf = evict_for(h, evicted);
+    if (shelf < 0)
+        return -1;
+
+    return place(shelf, w, h);
+}
+
+void GlyphAtlas::touch(int slot)
+{
+    assert(0 <= slot && slot < (int)slots_.size() && slots_[slot].live);
+
+    int  y  = slots_[slot].rect.y;
+    auto it = std::upper_bound(shelves_.begin(), shelves_.end(), y,
+                               [](int v, const Shelf &shelf) { return v < shelf.y; });
+    assert(it != shelves_.begin());
+    std::prev(it)->last_use = frame_;
+}
+
+const AtlasRect &GlyphAtlas::rect(int slot) const
+{
+    assert(0 <= slot && slot < (int)slots_.size() && slots_[slot].live);
+    return slots_[slot].rect;
+}
+
+std::vector<AtlasRect> GlyphAtlas::take_dirty_rects(bool &resized)
+{
+    // Glyphs are appended left to right in their shelves, merge them in one rect per shelf.
+    std::map<int, AtlasRect> per_shelf;
+    for (const AtlasRect &r : dirty_)
+    {
+        auto it = per_shelf.find(r.y);
+        if (it == per_shelf.end())
+        {
+            per_shelf.emplace(r.y, r);
+            continue;
+        }
+
+        AtlasRect &m = it->second;
+        int        x1 = std::max(m.x + m.w, r.x + r.w);
+        m.x           = std::min(m.x, r.x);
+        m.w           = x1 - m.x;
+        m.h           = std::max(m.h, r.h);
+    }
+
+    std::vector<AtlasRect> out;
+    out.reserve(per_shelf.size());
+    for (auto &item : per_shelf) out.push_back(item.second);
+
+    resized  = resized_;
+    resized_ = false;
+    dirty_.clear();
+    return out;
+}
+
+int GlyphAtlas::find_shelf(int w, int h) const
+{
+    // Best fit on height, not wasting more than about a third of the shelf.
+    int best = -1;
+    for (int i = 0; i < (int)shelves_.size(); ++i)
+    {
+        const Shelf &shelf = shelves_[i];
+        if (shelf.height < h || shelf.height > h + h / 2 + 4 || shelf.x_end + w > width_)
+            continue;
+        if (best < 0 || shelf.height < shelves_[best].height)
+            best = i;
+    }
+    return best;
+}
+
+int GlyphAtlas::open_shelf(int h)
+{
+    int shelf_height = std::min(align_shelf_height(h), max_height_ - next_y_);
+    if (shelf_height < h)
+        return -1;
+
+    if (next_y_ + shelf_height > height_)
+    {
+        int new_height = height_;
+        while (new_height < next_y_ + shelf_height) new_height *= 2;
+        new_height = std::min(new_height, max_height_);
+
+        pixels_.resize((size_t)width_ * new_height, 0);
+        height_  = new_height;
+        resized_ = true;
+    }
+
+    shelves_.push_back(Shelf{next_y_, shelf_height, 0, frame_, {}});
+    next_y_ += shelf_height;
+    return (int)shelves_.size() - 1;
+}
+
+int GlyphAtlas::evict_for(int h, std::vector<int> &evicted)
+{
+    // Look for the run of adjacent shelves not used by this frame, tall enough to hold h
+    // once merged, whose most recent use is the oldest. The unused space at the bottom
+    // can complete a run that ends at the last shelf.
+    int      best_first = -1, best_last = -1;
+    uint64_t best_use   = 0;
+    int      tail       = height_ - next_y_;
+    for (int i = 0; i < (int)shelves_.size(); ++i)
+    {
+        int      total    = 0;
+        uint64_t last_use = 0;
+        for (int j = i; j < (int)shelves_.size() && shelves_[j].last_use < frame_; ++j)
+        {
+            total += shelves_[j].height;
+            last_use = std::max(last_use, shelves_[j].last_use);
+
+            bool is_last = j == (int)shelves_.size() - 1;
+            if (total >= h || (is_last && total + tail >= h))
+            {
+                if (best_first < 0 || last_use < best_use)
+                {
+                    best_first = i;
+                    best_last  = j;
+                    best_use   = last_use;
+                }
+                break;
+            }
+        }
+    }
+
+    if (best_first < 0)
+        return -1;
+
+    int y     = shelves_[best_first].y;
+    int total = 0;
+    for (int k = best_first; k <= best_last; ++k)
+    {
+        for (int slot : shelves_[k].slots)
+        {
+            slots_[slot].live = false;
+            free_slots_.push_back(slot);
+            evicted.push_back(slot);
+        }
+        total += shelves_[k].height;
+    }
+
+    bool uses_tail    = best_last == (int)shelves_.size() - 1;
+    int  shelf_height = std::max(h, std::min(align_shelf_height(h), uses_tail ? height_ - y : total));
+
+    shelves_.erase(shelves_.begin() + best_first, shelves_.begin() + best_last + 1);
+    shelves_.insert(shelves_.begin() + best_first, Shelf{y, shelf_height, 0, frame_, {}});
+    if (uses_tail)
+    {
+        next_y_ = y + shelf_height;
+    }
+    else if (total > shelf_height)
+    {
+        // What's left becomes an empty shelf, available for shorter glyphs.
+        shelves_.insert(shelves_.begin() + best_first + 1, Shelf{y + shelf_height, total - shelf_height, 0, 0, {}});
+    }
+    return best_first;
+}
+
+int GlyphAtlas::place(int shelf_index, int w, int h)
+{
+    Shelf &shelf = shelves_[shelf_index];
+
+    int slot;
+    if (!free_slots_.empty())
+    {
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    else
+    {
+        slot = (int)slots_.size();
+        slots_.emplace_back();
+    }
+
+    AtlasRect r{shelf.x_end, shelf.y, w, h};
+    slots_[slot] = Slot{r, true};
+    shelf.slots.push_back(slot);
+    shelf.x_end += w;
+    shelf.last_use = frame_;
+
+    // Evicted glyphs might have left pixels behind.
+    for (int y = r.y; y < r.y + r.h; ++y) memset(pixels_.data() + (size_t)y * width_ + r.x, 0, r.w);
+
+    dirty_.push_back(r);
+    return slot;
+}
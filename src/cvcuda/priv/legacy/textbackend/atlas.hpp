@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef TEXT_BACKEND_ATLAS_HPP
+#define TEXT_BACKEND_ATLAS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct AtlasRect
+{
+    int x, y, w, h;
+};
+
+// Host side glyph atlas. Glyphs are packed into horizontal shelves of a fixed
+// width atlas, whose height grows on demand up to max_bytes. Once it can't grow
+// anymore, the least recently used shelves whose glyphs aren't needed by the
+// current frame are evicted to make room.
+//
+// Pixels live in host memory, the regions allocated since the last upload are
+// tracked so that only those need to be copied to the device.
+class GlyphAtlas
+{
+public:
+    GlyphAtlas(int width, int initial_height, size_t max_bytes);
+
+    // Starts a new frame. Slots allocated or touched from now on won't be evicted until the next frame.
+    void begin_frame();
+
+    // Reserves a zeroed w x h region and returns its slot, or -1 if it doesn't fit even after
+    // evicting cold shelves. Slots evicted to make room are appended to evicted, their owners
+    // must forget about them.
+    int allocate(int w, int h, std::vector<int> &evicted);
+
+    // Marks the slot as used by the current frame.
+    void touch(int slot);
+
+    const AtlasRect &rect(int slot) const;
+
+    // Regions allocated since the last call, merged per shelf. If the atlas was
+    // resized meanwhile, resized is set and the whole atlas must be uploaded.
+    std::vector<AtlasRect> take_dirty_rects(bool &resized);
+
+    unsigned char *pixels()
+    {
+        return pixels_.data();
+    }
+
+    int width() const
+    {
+        return width_;
+    }
+
+    int height() const
+    {
+        return height_;
+    }
+
+    size_t bytes() const
+    {
+        return pixels_.size();
+    }
+
+    int num_live_slots() const
+    {
+        return (int)(slots_.size() - free_slots_.size());
+    }
+
+private:
+    struct Shelf
+    {
+        int              y, height;
+        int              x_end; // where the next glyph goes
+        uint64_t         last_use;
+        std::vector<int> slots;
+    };
+
+    struct Slot
+    {
+        AtlasRect rect;
+        bool      live;
+    };
+
+    int      width_, height_, max_height_;
+    int      next_y_  = 0; // top of the area not covered by any shelf
+    bool     resized_ = true;
+    uint64_t frame_   = 1;
+
+    std::vector<unsigned char> pixels_;
+    std::vector<Shelf>         shelves_; // sorted by y, tiling [0, next_y_)
+    std::vector<Slot>          slots_;
+    std::vector<int>           free_slots_;
+    std::vector<AtlasRect>     dirty_;
+
+    int find_shelf(int w, int h) const;
+    int open_shelf(int h);
+    int evict_for(int h, std::vector<int> &evicted);
+    int place(int shelf, int w, int h);
+};
+
+#endif // TEXT_BACKEND_ATLAS_HPP
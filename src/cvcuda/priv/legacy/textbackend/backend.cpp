@@ -28,8 +28,21 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 
+#include <algorithm>
 #include <sstream>
+#include <thread>
+
+static int resolve_raster_threads(int raster_threads)
+{
+    const char *env = getenv("CVCUDA_OSD_RASTER_THREADS");
+    if (env && atoi(env) > 0)
+        return atoi(env);
+    if (raster_threads > 0)
+        return raster_threads;
+    return std::max(1, std::min<int>(TEXT_RASTER_MAX_THREADS, std::thread::hardware_concurrency()));
+}
 
 const char *text_backend_type_name(TextBackendType backend)
 {
@@ -42,13 +55,17 @@ const char *text_backend_type_name(TextBackendType backend)
     }
 }
 
-std::shared_ptr<TextBackend> create_text_backend(TextBackendType backend)
+std::shared_ptr<TextBackend> create_text_backend(TextBackendType backend, int raster_threads)
 {
     switch (backend)
     {
 #ifdef ENABLE_TEXT_BACKEND_STB
     case TextBackendType::StbTrueType:
-        return create_stb_backend();
+    {
+        auto output = create_stb_backend();
+        output->set_raster_threads(resolve_raster_threads(raster_threads));
+        return output;
+    }
 #endif
 
     default:
@@ -65,3 +82,13 @@ std::string concat_font_name_size(const char *name, int size)
     ss << size;
     return ss.str();
 }
+
+std::vector<unsigned long int> split_charset(TextBackend *backend, const char *utf8_text)
+{
+    auto words = backend->split_utf8(utf8_text);
+    words.erase(std::remove_if(words.begin(), words.end(), [](unsigned long int word) { return word <= ' '; }),
+                words.end());
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    return words;
+}
@@ -25,11 +25,22 @@
 #define TEXT_BACKEND_HPP
 
 #include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
 #define MAX_FONT_SIZE 200
 
+// Glyph atlas geometry, its height grows on demand until it takes TEXT_ATLAS_MAX_BYTES.
+#define TEXT_ATLAS_WIDTH          1024
+#define TEXT_ATLAS_INITIAL_HEIGHT 64
+#define TEXT_ATLAS_MAX_BYTES      (16 << 20)
+
+// Glyphs are rasterized by up to TEXT_RASTER_MAX_THREADS threads by default, smaller batches
+// are rasterized inline.
+#define TEXT_RASTER_MAX_THREADS         8
+#define TEXT_RASTER_MIN_PARALLEL_GLYPHS 16
+
 enum class TextBackendType : int
 {
     None        = 0,
@@ -42,6 +53,7 @@ public:
     virtual int width() const                                     = 0;
     virtual int height() const                                    = 0;
     virtual int x_offset_on_bitmap() const                        = 0;
+    virtual int y_offset_on_bitmap() const                        = 0;
     virtual int xadvance(int font_size, bool empty = false) const = 0;
 };
 
@@ -66,10 +78,23 @@ public:
     virtual int             bitmap_width() const                                                               = 0;
     virtual int             compute_y_offset(int max_glyph_height, int h, WordMeta *word, int font_size) const = 0;
     virtual int             uniform_font_size(int size) const                                                  = 0;
+
+    // Number of threads rasterizing new glyphs in build_bitmap, the calling thread included.
+    virtual void set_raster_threads(int num_threads) = 0;
+
+    // Rasterizes the words for the given font and size and uploads them, so that the
+    // first frame drawing them doesn't pay for it. Returns once the upload is done.
+    virtual void prewarm(const std::vector<unsigned long int> &words, unsigned int font_size, const char *font,
+                         void *stream = nullptr)
+        = 0;
 };
 
 const char                  *text_backend_type_name(TextBackendType backend);
-std::shared_ptr<TextBackend> create_text_backend(TextBackendType backend);
+// raster_threads <= 0 selects the default, the CVCUDA_OSD_RASTER_THREADS environment variable overrides it.
+std::shared_ptr<TextBackend> create_text_backend(TextBackendType backend, int raster_threads = 0);
 std::string                  concat_font_name_size(const char *name, int size);
 
+// Distinct characters of a UTF-8 text, whitespace excluded.
+std::vector<unsigned long int> split_charset(TextBackend *backend, const char *utf8_text);
+
 #endif // TEXT_BACKEND_HPP
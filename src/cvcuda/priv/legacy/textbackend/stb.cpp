@@ -25,7 +25,9 @@
 
 #ifdef ENABLE_TEXT_BACKEND_STB
 
+#    include "atlas.hpp"
 #    include "memory.hpp"
+#    include "worker_pool.hpp"
 
 #    include <dirent.h>
 #    include <stdarg.h>
@@ -51,7 +53,8 @@ using namespace std;
 class StbWordMeta : public WordMeta
 {
 public:
-    int   x0, y0, x1, y1, advance, glyph, offset_x;
+    int   x0, y0, x1, y1, advance, glyph, offset_x, offset_y;
+    int   slot = -1; // in the glyph atlas, -1 if the glyph has no pixels
     float scale;
 
     virtual int width() const override
@@ -69,6 +72,11 @@ public:
         return offset_x;
     }
 
+    virtual int y_offset_on_bitmap() const override
+    {
+        return offset_y;
+    }
+
     virtual int xadvance(int font_size, bool empty) const override
     {
         (void)font_size;
@@ -81,7 +89,7 @@ public:
 
     StbWordMeta() = default;
 
-    StbWordMeta(int x0, int y0, int x1, int y1, float scale, int advance, int glyph, int offset_x)
+    StbWordMeta(int x0, int y0, int x1, int y1, float scale, int advance, int glyph, int offset_x, int offset_y)
     {
         this->x0       = x0;
         this->y0       = y0;
@@ -91,6 +99,7 @@ public:
         this->advance  = advance;
         this->glyph    = glyph;
         this->offset_x = offset_x;
+        this->offset_y = offset_y;
     }
 };
 
@@ -299,18 +308,35 @@ static TrueTypeFontInternal *create_cuda_font(const char *font_file_or_family)
 class StbTrueTypeBackend : public TextBackend
 {
 private:
-    unique_ptr<Memory<unsigned char>>             text_bitmap;
+    struct GlyphOwner
+    {
+        StbWordMetaMapperImpl *glyph_map;
+        unsigned long int      word;
+    };
+
+    struct RasterJob
+    {
+        const stbtt_fontinfo *font;
+        StbWordMeta           glyph;
+    };
+
     unique_ptr<Memory<unsigned char>>             single_word_bitmap;
     map<string, StbWordMetaMapperImpl>            glyph_sets;
     map<string, vector<unsigned long int>>        build_use_textes;
-    int                                           text_bitmap_width  = 0;
-    int                                           text_bitmap_height = 0;
-    int                                           temp_size          = 0;
+    GlyphAtlas                                    atlas;
+    vector<GlyphOwner>                            atlas_slot_owners;
+    unsigned char                                *device_bitmap       = nullptr;
+    size_t                                        device_bitmap_bytes = 0;
+    int                                           temp_size           = 0;
     map<string, shared_ptr<TrueTypeFontInternal>> font_map;
     bool                                          has_new_text_need_build_bitmap = false;
+    vector<RasterJob>                             raster_jobs;
+    unique_ptr<WorkerPool>                        raster_pool;
+    int                                           raster_threads = 1;
 
 public:
     StbTrueTypeBackend()
+        : atlas(TEXT_ATLAS_WIDTH, TEXT_ATLAS_INITIAL_HEIGHT, TEXT_ATLAS_MAX_BYTES)
     {
         int temp_size   = MAX_FONT_SIZE * 2;
         this->temp_size = temp_size;
@@ -319,7 +345,11 @@ public:
         memset(this->single_word_bitmap->host(), 0, this->single_word_bitmap->bytes());
     }
 
-    virtual ~StbTrueTypeBackend() {}
+    virtual ~StbTrueTypeBackend()
+    {
+        if (this->device_bitmap)
+            checkRuntime(cudaFree(this->device_bitmap));
+    }
 
     virtual vector<unsigned long int> split_utf8(const char *utf8_text) override
     {
@@ -469,8 +499,14 @@ public:
         auto &glyph_map     = this->glyph_sets[font_and_size];
         for (auto &word : words)
         {
-            if (glyph_map.find(word) != glyph_map.end())
+            auto iter = glyph_map.find(word);
+            if (iter != glyph_map.end())
+            {
+                // Keep it in the atlas while this frame is being built
+                if (iter->second.slot >= 0)
+                    this->atlas.touch(iter->second.slot);
                 continue;
+            }
             maps.insert(maps.end(), word);
             has_new_text_need_build_bitmap = true;
         }
@@ -489,130 +525,169 @@ public:
     {
         cudaStream_t stream = (cudaStream_t)_stream;
 
-        // 1. collect all word shape.
-        if (!has_new_text_need_build_bitmap)
-        {
-            has_new_text_need_build_bitmap = false;
-            build_use_textes.clear();
-            return;
-        }
-
-        for (auto &textes : build_use_textes)
+        if (has_new_text_need_build_bitmap)
         {
-            auto  &glyph_map          = this->glyph_sets[textes.first];
-            auto  &words              = textes.second;
-            string font_name_and_size = textes.first;
-            int    p                  = font_name_and_size.rfind(' ');
-            font_name_and_size[p]     = 0;
-            int         font_size     = std::atoi(font_name_and_size.c_str() + p + 1);
-            const char *font_name     = font_name_and_size.c_str();
-            auto        font          = get_font(font_name);
-            if (font == nullptr)
-                continue;
-
-            auto pfont = &font->font;
-            int  x0, y0, x1, y1, advance;
-
-            for (auto &word : words)
+            // Only the glyphs seen for the first time are rasterized, into the atlas' host pixels.
+            // Atlas slots are assigned here, the rasterization itself runs afterwards in parallel:
+            // slots don't overlap and slots allocated by this frame can't be evicted by it.
+            vector<int> evicted;
+            this->raster_jobs.clear();
+            for (auto &textes : build_use_textes)
             {
-                if (glyph_map.find(word) != glyph_map.end())
+                auto  &glyph_map          = this->glyph_sets[textes.first];
+                auto  &words              = textes.second;
+                string font_name_and_size = textes.first;
+                int    p                  = font_name_and_size.rfind(' ');
+                font_name_and_size[p]     = 0;
+                int         font_size     = std::atoi(font_name_and_size.c_str() + p + 1);
+                const char *font_name     = font_name_and_size.c_str();
+                auto        font          = get_font(font_name);
+                if (font == nullptr)
                     continue;
 
-                int   glyph = stbtt_FindGlyphIndex(pfont, word);
-                float scale = stbtt_ScaleForPixelHeight(pfont, font_size);
-                stbtt_GetGlyphHMetrics(pfont, glyph, &advance, nullptr);
-                stbtt_GetGlyphBitmapBoxSubpixel(pfont, glyph, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
-                glyph_map.insert(make_pair(word, StbWordMeta(x0, y0, x1, y1, scale, advance, glyph, 0)));
-            }
-
-            const char *default_words
-                = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789:-&./&^%$#@!+=\\[];,'\"?` ";
-            const char *pword = default_words;
-            for (; *pword; ++pword)
-            {
-                unsigned long int word = (unsigned int)*pword | (1ul << 32);
-                if (glyph_map.find(word) != glyph_map.end())
-                    continue;
+                auto pfont = &font->font;
+                int  x0, y0, x1, y1, advance;
 
-                int   glyph = stbtt_FindGlyphIndex(pfont, word);
-                float scale = stbtt_ScaleForPixelHeight(pfont, font_size);
-                stbtt_GetGlyphHMetrics(pfont, glyph, &advance, nullptr);
-                stbtt_GetGlyphBitmapBoxSubpixel(pfont, glyph, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
-                glyph_map.insert(make_pair(word, StbWordMeta(x0, y0, x1, y1, scale, advance, glyph, 0)));
+                for (auto &word : words)
+                {
+                    if (glyph_map.find(word) != glyph_map.end())
+                        continue;
+
+                    int   glyph = stbtt_FindGlyphIndex(pfont, word);
+                    float scale = stbtt_ScaleForPixelHeight(pfont, font_size);
+                    stbtt_GetGlyphHMetrics(pfont, glyph, &advance, nullptr);
+                    stbtt_GetGlyphBitmapBoxSubpixel(pfont, glyph, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+
+                    StbWordMeta meta(x0, y0, x1, y1, scale, advance, glyph, 0, 0);
+                    if (meta.width() >= 1 && meta.height() >= 1)
+                    {
+                        evicted.clear();
+                        meta.slot = this->atlas.allocate(meta.width(), meta.height(), evicted);
+                        for (int slot : evicted)
+                        {
+                            auto &owner = this->atlas_slot_owners[slot];
+                            owner.glyph_map->erase(owner.word);
+                        }
+
+                        if (meta.slot < 0)
+                        {
+                            CUOSD_PRINT_W("Glyph atlas is full, can't draw character %lu of %s\n", word,
+                                          textes.first.c_str());
+                            continue;
+                        }
+
+                        const AtlasRect &rect = this->atlas.rect(meta.slot);
+                        meta.offset_x         = rect.x;
+                        meta.offset_y         = rect.y;
+                        this->raster_jobs.push_back(RasterJob{pfont, meta});
+
+                        if ((int)this->atlas_slot_owners.size() <= meta.slot)
+                            this->atlas_slot_owners.resize(meta.slot + 1);
+                        this->atlas_slot_owners[meta.slot] = GlyphOwner{&glyph_map, word};
+                    }
+                    glyph_map.insert(make_pair(word, meta));
+                }
             }
+
+            rasterize_jobs();
+            upload_atlas(stream);
         }
 
-        int max_glyph_height  = 0;
-        int max_glyph_width   = 0;
-        int total_glyph_width = 0;
-        for (auto &map : this->glyph_sets)
+        this->has_new_text_need_build_bitmap = false;
+        this->build_use_textes.clear();
+        this->atlas.begin_frame();
+    }
+
+    virtual void set_raster_threads(int num_threads) override
+    {
+        num_threads = std::max(1, num_threads);
+        if (num_threads != this->raster_threads)
+            this->raster_pool.reset();
+        this->raster_threads = num_threads;
+    }
+
+    virtual void prewarm(const std::vector<unsigned long int> &words, unsigned int font_size, const char *font,
+                         void *_stream) override
+    {
+        this->add_build_text(words, font_size, font);
+        this->build_bitmap(_stream);
+        checkRuntime(cudaStreamSynchronize((cudaStream_t)_stream));
+    }
+
+    void rasterize_jobs()
+    {
+        auto &jobs = this->raster_jobs;
+        if (this->raster_threads > 1 && (int)jobs.size() >= TEXT_RASTER_MIN_PARALLEL_GLYPHS)
         {
-            for (auto &item : map.second)
-            {
-                int w = item.second.x1 - item.second.x0, h = item.second.y1 - item.second.y0;
-                max_glyph_width  = std::max(max_glyph_width, w);
-                max_glyph_height = std::max(max_glyph_height, h);
-                total_glyph_width += w;
-            }
+            if (this->raster_pool == nullptr)
+                this->raster_pool.reset(new WorkerPool(this->raster_threads));
+            this->raster_pool->parallel_for(jobs.size(), [&](int i) { rasterize(jobs[i].font, jobs[i].glyph); });
         }
+        else
+        {
+            for (auto &job : jobs) rasterize(job.font, job.glyph);
+        }
+        jobs.clear();
+    }
+
+    // Thread safe as long as the regions written don't overlap, stb only reads the font.
+    void rasterize(const stbtt_fontinfo *pfont, const StbWordMeta &glyph)
+    {
+        stbtt_vertex *vertices  = nullptr;
+        int           num_verts = stbtt_GetGlyphShape(pfont, glyph.glyph, &vertices);
+        stbtt__bitmap gbm;
+        gbm.pixels = this->atlas.pixels() + (size_t)glyph.offset_y * this->atlas.width() + glyph.offset_x;
+        gbm.w      = glyph.width();
+        gbm.h      = glyph.height();
+        gbm.stride = this->atlas.width();
+        stbtt_Rasterize(&gbm, 0.35f, vertices, num_verts, glyph.scale, glyph.scale, 0, 0, glyph.x0, glyph.y0, 1,
+                        pfont->userdata);
+        STBTT_free(vertices, pfont->userdata);
+    }
 
-        if (this->text_bitmap == nullptr)
-            this->text_bitmap.reset(new Memory<unsigned char>());
-        this->text_bitmap_width  = total_glyph_width;
-        this->text_bitmap_height = max_glyph_height;
-        this->text_bitmap->alloc_or_resize_to(total_glyph_width * max_glyph_height);
-        memset(this->text_bitmap->host(), 0, this->text_bitmap->bytes());
+    // Copies the atlas regions written since the last upload to device. The host pixels
+    // are pageable, so they can be written again as soon as the copies are issued.
+    void upload_atlas(cudaStream_t stream)
+    {
+        bool resized;
+        auto dirty_rects = this->atlas.take_dirty_rects(resized);
 
-        // Rasterize word to bitmap
-        int offset_x = 0;
-        for (auto &map : this->glyph_sets)
+        if (this->device_bitmap_bytes < this->atlas.bytes())
         {
-            string font_name_and_size = map.first;
-            int    p                  = font_name_and_size.rfind(' ');
-            font_name_and_size[p]     = 0;
-            const char *font_name     = font_name_and_size.c_str();
-            auto        font          = get_font(font_name);
-            if (font == nullptr)
-                continue;
-
-            auto pfont = &font->font;
-            for (auto &item : map.second)
-            {
-                auto &glyph = item.second;
+            if (this->device_bitmap)
+                checkRuntime(cudaFree(this->device_bitmap));
+            this->device_bitmap       = nullptr;
+            this->device_bitmap_bytes = 0;
+            if (!checkRuntime(cudaMalloc(&this->device_bitmap, this->atlas.bytes())))
+                return;
+            this->device_bitmap_bytes = this->atlas.bytes();
+            resized                   = true;
+        }
 
-                int w = glyph.x1 - glyph.x0, h = glyph.y1 - glyph.y0;
-                if (w < 1 || h < 1)
-                    continue;
+        int pitch = this->atlas.width();
+        if (resized)
+        {
+            checkRuntime(cudaMemcpyAsync(this->device_bitmap, this->atlas.pixels(), this->atlas.bytes(),
+                                         cudaMemcpyHostToDevice, stream));
+            return;
+        }
 
-                glyph.offset_x          = offset_x;
-                stbtt_vertex *vertices  = nullptr;
-                int           num_verts = stbtt_GetGlyphShape(pfont, glyph.glyph, &vertices);
-                stbtt__bitmap gbm;
-                gbm.pixels = this->text_bitmap->host() + offset_x;
-                gbm.w      = w;
-                gbm.h      = h;
-                gbm.stride = this->text_bitmap_width;
-                stbtt_Rasterize(&gbm, 0.35f, vertices, num_verts, glyph.scale, glyph.scale, 0, 0, glyph.x0, glyph.y0, 1,
-                                pfont->userdata);
-                STBTT_free(vertices, pfont->userdata);
-                offset_x += w;
-            }
+        for (auto &rect : dirty_rects)
+        {
+            size_t offset = (size_t)rect.y * pitch + rect.x;
+            checkRuntime(cudaMemcpy2DAsync(this->device_bitmap + offset, pitch, this->atlas.pixels() + offset, pitch,
+                                           rect.w, rect.h, cudaMemcpyHostToDevice, stream));
         }
-        this->text_bitmap->copy_host_to_device(stream);
-        this->has_new_text_need_build_bitmap = false;
-        this->build_use_textes.clear();
     }
 
     virtual unsigned char *bitmap_device_pointer() const override
     {
-        if (!this->text_bitmap)
-            return nullptr;
-        return this->text_bitmap->device();
+        return this->device_bitmap;
     }
 
     virtual int bitmap_width() const override
     {
-        return this->text_bitmap_width;
+        return this->atlas.width();
     }
 
     virtual int compute_y_offset(int max_glyph_height, int h, WordMeta *word, int font_size) const override
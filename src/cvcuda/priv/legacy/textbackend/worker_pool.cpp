@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "worker_pool.hpp"
+
+WorkerPool::WorkerPool(int num_threads)
+{
+    for (int i = 1; i < num_threads; ++i) workers_.emplace_back(&WorkerPool::worker_main, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+}
+
+void WorkerPool::parallel_for(int count, const std::function<void(int)> &fn)
+{
+    if (count <= 0)
+        return;
+
+    if (workers_.empty() || count == 1)
+    {
+        for (int i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_        = &fn;
+        count_     = count;
+        next_      = 0;
+        remaining_ = count;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    run_items();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return remaining_ == 0; });
+    fn_ = nullptr;
+}
+
+// Claims items one at a time, glyph sizes vary too much for static partitioning.
+void WorkerPool::run_items()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (next_ < count_)
+    {
+        int                              i  = next_++;
+        const std::function<void(int)> *fn = fn_;
+        lock.unlock();
+        (*fn)(i);
+        lock.lock();
+        if (--remaining_ == 0)
+            done_.notify_one();
+    }
+}
+
+void WorkerPool::worker_main()
+{
+    unsigned long seen = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_)
+                return;
+            seen = generation_;
+        }
+        run_items();
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef TEXT_BACKEND_WORKER_POOL_HPP
+#define TEXT_BACKEND_WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads running parallel loops. The calling thread takes
+// part in the loop too, so a pool with N threads spawns N - 1 workers and a pool
+// with a single thread runs everything inline.
+class WorkerPool
+{
+public:
+    explicit WorkerPool(int num_threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &)            = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    int num_threads() const
+    {
+        return (int)workers_.size() + 1;
+    }
+
+    // Calls fn(i) for every i in [0, count) and returns once all calls are done.
+    // Calls may run concurrently in any order, fn must not throw.
+    void parallel_for(int count, const std::function<void(int)> &fn);
+
+private:
+    void worker_main();
+    void run_items();
+
+    std::vector<std::thread>         workers_;
+    std::mutex                       mutex_;
+    std::condition_variable          wake_;
+    std::condition_variable          done_;
+    const std::function<void(int)> *fn_         = nullptr;
+    int                              count_      = 0;
+    int                              next_       = 0;
+    int                              remaining_  = 0;
+    unsigned long                    generation_ = 0;
+    bool                             stop_       = false;
+};
+
+#endif // TEXT_BACKEND_WORKER_POOL_HPP
@@ -23,11 +23,13 @@
 #include "StreamId.hpp"
 
 #include <nvcv/util/CheckError.hpp>
+#include <nvcv/util/Math.hpp>
 
 #include <cassert>
-#include <map>
+#include <cstdint>
+#include <memory>
 #include <mutex>
-#include <set>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace nvcv::util {
@@ -72,6 +74,8 @@ struct StreamCacheItem
 {
     StreamCacheItem *next = nullptr, *prev = nullptr;
 
+    StreamCacheItem *binNext = nullptr, *binPrev = nullptr;
+
     mutable bool wasReady = false;
 
     Payload payload{};
@@ -127,7 +131,7 @@ public:
         {
             m_head  = p->next;
             p->next = nullptr;
-            assert(!p->prev);
+            assert(!p->prev && !p->binNext && !p->binPrev);
             m_allocated++;
             m_free--;
 
@@ -145,7 +149,7 @@ public:
         if (!item)
             return;
 
-        assert(!item->next && !item->prev && "The item is still linked");
+        assert(!item->next && !item->prev && !item->binNext && !item->binPrev && "The item is still linked");
         item->payload = {};
 
         item->next = m_head;
@@ -160,6 +164,132 @@ private:
     size_t m_allocated = 0, m_free = 0;
 };
 
+/** Segregated-fit index of cache items by payload size.
+ *
+ * Items are kept in intrusive lists, one per size class. There are four classes per power of two
+ * (sizes below 4 get a class each), so the items in a class differ in size by less than 25%.
+ * A bitmap of non-empty classes lets the lookup skip to the first class that can hold a request
+ * with a bit scan, so insertion and removal are O(1) and don't allocate.
+ *
+ * @tparam Item  The item type. It must have `binNext` and `binPrev` pointers, a `payloadSize()` method
+ *               and a `payload` member. The size of the payload must not change while the item is indexed.
+ */
+template<typename Item>
+class SizeBins
+{
+public:
+    static constexpr int kSubBinBits = 2;
+    static constexpr int kNumBins    = 64 << kSubBinBits;
+
+    static int binIndex(size_t size) noexcept
+    {
+        if (size < (1u << kSubBinBits))
+            return static_cast<int>(size);
+        int octave = ILog2(size);
+        int sub    = static_cast<int>(size >> (octave - kSubBinBits)) & ((1 << kSubBinBits) - 1);
+        return ((octave - kSubBinBits + 1) << kSubBinBits) + sub;
+    }
+
+    bool empty() const noexcept
+    {
+        return m_count == 0;
+    }
+
+    size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+    void insert(Item *item) noexcept
+    {
+        assert(!item->binNext && !item->binPrev);
+        int b         = binIndex(item->payloadSize());
+        item->binNext = m_bins[b];
+        if (m_bins[b])
+            m_bins[b]->binPrev = item;
+        m_bins[b] = item;
+        m_nonEmpty[b >> 6] |= uint64_t(1) << (b & 63);
+        m_count++;
+    }
+
+    void remove(Item *item) noexcept
+    {
+        int b = binIndex(item->payloadSize());
+        if (item->binPrev)
+            item->binPrev->binNext = item->binNext;
+        else
+        {
+            assert(m_bins[b] == item);
+            m_bins[b] = item->binNext;
+        }
+        if (item->binNext)
+            item->binNext->binPrev = item->binPrev;
+        item->binNext = item->binPrev = nullptr;
+
+        if (!m_bins[b])
+            m_nonEmpty[b >> 6] &= ~(uint64_t(1) << (b & 63));
+        assert(m_count > 0);
+        m_count--;
+    }
+
+    /** Finds the first item, in the order of size classes, that is at least `minSize` large
+     *  and satisfies the predicate.
+     */
+    template<typename Predicate>
+    Item *findFirstFit(size_t minSize, Predicate &&pred) const
+    {
+        int first = binIndex(minSize);
+        for (int b = nextNonEmpty(first); b < kNumBins; b = nextNonEmpty(b + 1))
+        {
+            for (Item *item = m_bins[b]; item; item = item->binNext)
+            {
+                // Only the first class can contain items that are too small
+                if ((b > first || item->payloadSize() >= minSize) && pred(item->payload))
+                    return item;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Finds the largest item or returns nullptr if there are none.
+     */
+    Item *findLargest() const noexcept
+    {
+        for (int w = kNumWords - 1; w >= 0; w--)
+        {
+            if (!m_nonEmpty[w])
+                continue;
+
+            Item *largest = m_bins[(w << 6) + ILog2(m_nonEmpty[w])];
+            for (Item *item = largest->binNext; item; item = item->binNext)
+                if (item->payloadSize() > largest->payloadSize())
+                    largest = item;
+            return largest;
+        }
+        return nullptr;
+    }
+
+private:
+    static constexpr int kNumWords = kNumBins / 64;
+
+    int nextNonEmpty(int from) const noexcept
+    {
+        for (int w = from >> 6; w < kNumWords; w++)
+        {
+            uint64_t mask = m_nonEmpty[w];
+            if (w == from >> 6)
+                mask &= ~uint64_t(0) << (from & 63);
+            if (mask)
+                return (w << 6) + __builtin_ctzll(mask);
+        }
+        return kNumBins;
+    }
+
+    Item    *m_bins[kNumBins]      = {};
+    uint64_t m_nonEmpty[kNumWords] = {};
+    size_t   m_count               = 0;
+};
+
 template<typename Payload, typename Item = StreamCacheItem<Payload>>
 class StreamOrderedCache
 {
@@ -201,25 +331,42 @@ public:
     }
 
 private:
-    void insert(item_t *item);
+    void insert(item_t *item) noexcept;
+
+    void unlink(item_t *item) noexcept;
 
-    void remove(size_t payloadSize, item_t *item) noexcept;
+    Payload take(item_t *item);
 
     StreamCacheItemAllocator<Payload, item_t> *m_itemAlloc;
 
-    std::set<std::pair<size_t, item_t *>> m_bySize;
+    SizeBins<item_t> m_bySize;
 
     item_t *m_head = nullptr, *m_tail = nullptr;
 };
 
 } // namespace detail
 
+/** A cache of payloads that are used in stream order.
+ *
+ * Payloads that are still in use in a stream are kept in a per-stream cache and can be reused in that
+ * stream right away. Payloads that are ready go to a global cache, where they can be used by anyone.
+ *
+ * Each per-stream cache has its own lock and the global cache has another one, so the threads that
+ * work with different streams don't contend, save for a brief shared lock on the stream map.
+ * The locks are always taken in this order: stream map, per-stream cache, global cache.
+ */
 template<typename Payload, typename Item = detail::StreamCacheItem<Payload>>
 class PerStreamCache
 {
     using StreamOrderedCache = detail::StreamOrderedCache<Payload, Item>;
+    using item_t             = Item;
 
 public:
+    ~PerStreamCache()
+    {
+        purge();
+    }
+
     template<typename Predicate>
     std::optional<Payload> getIf(size_t minSize, Predicate &&pred, std::optional<cudaStream_t> stream);
 
@@ -234,29 +381,54 @@ public:
 
     void put(Payload &&payload, std::optional<cudaStream_t> stream);
 
-    void purge()
-    {
-        std::lock_guard g(m_lock);
-        for (auto &[k, v] : m_perStreamCache) v.waitAndPurge();
-        m_globalCache.clear();
-    }
+    void purge();
+
+    /** Destroys the payloads that are ready, largest first, for as long as `keepGoing` returns true.
+     *
+     * Payloads still in use in their streams are not affected.
+     */
+    template<typename Predicate>
+    void trim(Predicate &&keepGoing);
 
 private:
+    /** The per-stream caches of up to this many streams are kept around when they become empty.
+     */
+    static constexpr size_t kMaxIdleStreams = 16;
+
+    struct StreamEntry
+    {
+        StreamEntry()
+            : cache(&itemAlloc)
+        {
+        }
+
+        std::mutex                                      lock;
+        detail::StreamCacheItemAllocator<Payload, Item> itemAlloc;
+        StreamOrderedCache                              cache;
+    };
+
     template<typename Predicate>
     std::optional<Payload> tryGetPerStream(size_t minSize, Predicate &&pred, cudaStream_t stream);
 
     template<typename Predicate>
     std::optional<Payload> tryGetGlobal(size_t minSize, Predicate &&pred);
 
+    // Must be called with m_globalLock held
+    void putGlobal(Payload &&payload);
+
     int moveReadyToGlobal();
 
-    detail::StreamCacheItemAllocator<Payload, Item> m_cacheItemAlloc;
+    void removeIdleStreams();
+
+    std::unordered_map<uint64_t, std::unique_ptr<StreamEntry>> m_perStreamCache;
+
+    std::shared_mutex m_streamMapLock;
 
-    std::unordered_map<uint64_t, StreamOrderedCache> m_perStreamCache;
+    detail::StreamCacheItemAllocator<Payload, Item> m_globalItemAlloc;
 
-    std::multimap<size_t, Payload> m_globalCache;
+    detail::SizeBins<Item> m_globalCache;
 
-    std::mutex m_lock;
+    std::mutex m_globalLock;
 };
 
 } // namespace nvcv::util
@@ -44,12 +44,15 @@ void StreamOrderedCache<Payload, Item>::waitAndPurge()
         curr->prev = nullptr;
         if (m_tail)
             m_tail->next = nullptr;
+        m_bySize.remove(curr);
         m_itemAlloc->deallocate(curr);
         erased++;
     }
-    assert(erased == m_bySize.size());
+#ifdef NDEBUG
+    (void)erased;
+#endif
+    assert(m_bySize.empty());
     m_head = nullptr;
-    m_bySize.clear();
 }
 
 template<typename Payload, typename Item>
@@ -65,10 +68,8 @@ void StreamOrderedCache<Payload, Item>::removeAllReady(PayloadCallback callback)
         // This item and all older items are ready
         while (item)
         {
-            item_t *prev        = item->prev;
-            size_t  payloadSize = item->payloadSize();
-            callback(std::move(item->payload));
-            remove(payloadSize, item);
+            item_t *prev = item->prev;
+            callback(take(item));
             item = prev;
         }
     }
@@ -83,11 +84,7 @@ void StreamOrderedCache<Payload, Item>::removeAllReady(PayloadCallback callback)
         {
             item_t *prev = item->prev;
             if (item->isReady())
-            {
-                size_t payloadSize = item->payloadSize();
-                callback(std::move(item->payload));
-                remove(payloadSize, item);
-            }
+                callback(take(item));
             item = prev;
         }
     }
@@ -148,44 +145,22 @@ void StreamOrderedCache<Payload, Item>::put(Payload &&payload)
     item_t *item  = m_itemAlloc->allocate();
     item->payload = std::move(payload);
     payload       = {};
-    try
-    {
-        insert(item);
-    }
-    catch (...)
-    {
-        m_itemAlloc->deallocate(item);
-        throw;
-    }
+    insert(item);
 }
 
 template<typename Payload, typename Item>
 template<typename Predicate>
 std::optional<Payload> StreamOrderedCache<Payload, Item>::getIf(size_t minSize, Predicate &&pred)
 {
-    auto it = m_bySize.lower_bound({minSize, nullptr});
-    for (; it != m_bySize.end(); ++it)
-    {
-        auto *item = it->second;
-        if (pred(item->payload))
-        {
-            size_t  payloadSize = item->payloadSize();
-            Payload ret         = std::move(item->payload);
-            remove(payloadSize, item);
-            return ret;
-        }
-    }
+    if (item_t *item = m_bySize.findFirstFit(minSize, pred))
+        return take(item);
     return std::nullopt;
 }
 
 template<typename Payload, typename Item>
-void StreamOrderedCache<Payload, Item>::insert(item_t *item)
+void StreamOrderedCache<Payload, Item>::insert(item_t *item) noexcept
 {
-    auto inserted = m_bySize.insert({item->payloadSize(), item});
-#ifdef NDEBUG
-    (void)inserted;
-#endif
-    assert(inserted.second);
+    m_bySize.insert(item);
 
     if (!m_tail)
     {
@@ -202,8 +177,10 @@ void StreamOrderedCache<Payload, Item>::insert(item_t *item)
 }
 
 template<typename Payload, typename Item>
-void StreamOrderedCache<Payload, Item>::remove(size_t payloadSize, item_t *item) noexcept
+void StreamOrderedCache<Payload, Item>::unlink(item_t *item) noexcept
 {
+    m_bySize.remove(item);
+
     if (item == m_head)
         m_head = m_head->next;
     if (item == m_tail)
@@ -214,14 +191,15 @@ void StreamOrderedCache<Payload, Item>::remove(size_t payloadSize, item_t *item)
     if (item->next)
         item->next->prev = item->prev;
     item->prev = item->next = nullptr;
+}
 
-    size_t erased = m_bySize.erase({payloadSize, item});
-#ifdef NDEBUG
-    (void)erased;
-#endif
-    assert(erased == 1);
-
+template<typename Payload, typename Item>
+Payload StreamOrderedCache<Payload, Item>::take(item_t *item)
+{
+    unlink(item);
+    Payload ret = std::move(item->payload);
     m_itemAlloc->deallocate(item);
+    return ret;
 }
 
 } // namespace detail
@@ -233,8 +211,6 @@ std::optional<Payload> PerStreamCache<Payload, Item>::getIf(size_t minSize, Pred
 {
     std::optional<Payload> ret;
 
-    std::lock_guard guard(m_lock);
-
     if (stream)
     {
         ret = tryGetPerStream(minSize, pred, *stream);
@@ -259,46 +235,82 @@ std::optional<Payload> PerStreamCache<Payload, Item>::tryGetPerStream(size_t siz
                                                                       cudaStream_t stream)
 {
     uint64_t streamId = GetCudaStreamIdHint(stream);
-    auto     it       = m_perStreamCache.find(streamId);
+
+    std::shared_lock mapGuard(m_streamMapLock);
+    auto             it = m_perStreamCache.find(streamId);
     if (it == m_perStreamCache.end())
         return std::nullopt;
-    return it->second.getIf(size, std::forward<Predicate>(pred));
+
+    std::lock_guard guard(it->second->lock);
+    return it->second->cache.getIf(size, std::forward<Predicate>(pred));
 }
 
 template<typename Payload, typename Item>
 template<typename Predicate>
 std::optional<Payload> PerStreamCache<Payload, Item>::tryGetGlobal(size_t size, Predicate &&pred)
 {
-    for (auto it = m_globalCache.lower_bound(size); it != m_globalCache.end(); ++it)
+    std::lock_guard guard(m_globalLock);
+    item_t         *item = m_globalCache.findFirstFit(size, pred);
+    if (!item)
+        return std::nullopt;
+
+    m_globalCache.remove(item);
+    Payload ret = std::move(item->payload);
+    m_globalItemAlloc.deallocate(item);
+    return ret;
+}
+
+template<typename Payload, typename Item>
+void PerStreamCache<Payload, Item>::putGlobal(Payload &&payload)
+{
+    item_t *item  = m_globalItemAlloc.allocate();
+    item->payload = std::move(payload);
+    payload       = {};
+    m_globalCache.insert(item);
+}
+
+template<typename Payload, typename Item>
+int PerStreamCache<Payload, Item>::moveReadyToGlobal()
+{
+    int    moved = 0;
+    size_t idle  = 0;
     {
-        if (pred(it->second))
+        std::shared_lock mapGuard(m_streamMapLock);
+        for (auto &[id, entry] : m_perStreamCache)
         {
-            Payload ret = std::move(it->second);
-            m_globalCache.erase(it);
-            return ret;
+            std::lock_guard guard(entry->lock);
+            // The global cache is locked only once there's something to move
+            std::unique_lock globalGuard(m_globalLock, std::defer_lock);
+            entry->cache.removeAllReady(
+                [&](Payload &&payload)
+                {
+                    if (!globalGuard.owns_lock())
+                        globalGuard.lock();
+                    putGlobal(std::move(payload));
+                    moved++;
+                });
+            if (entry->cache.empty())
+                idle++;
         }
     }
-    return std::nullopt;
+
+    if (idle > kMaxIdleStreams)
+        removeIdleStreams();
+
+    return moved;
 }
 
 template<typename Payload, typename Item>
-int PerStreamCache<Payload, Item>::moveReadyToGlobal()
+void PerStreamCache<Payload, Item>::removeIdleStreams()
 {
-    int moved = 0;
+    std::unique_lock mapGuard(m_streamMapLock);
     for (auto it = m_perStreamCache.begin(); it != m_perStreamCache.end();)
     {
-        it->second.removeAllReady(
-            [&](Payload &&payload)
-            {
-                m_globalCache.emplace(StreamCachePayloadSize(payload), std::move(payload));
-                moved++;
-            });
-        if (it->second.empty())
+        if (it->second->cache.empty())
             it = m_perStreamCache.erase(it);
         else
             ++it;
     }
-    return moved;
 }
 
 template<typename Payload, typename Item>
@@ -307,21 +319,73 @@ void PerStreamCache<Payload, Item>::put(Payload &&payload, std::optional<cudaStr
     cudaEvent_t readyEvent = StreamCachePayloadReady(payload);
     bool        per_stream = readyEvent != nullptr && cudaEventQuery(readyEvent) == cudaErrorNotReady;
 
-    std::lock_guard guard(m_lock);
-
     if (per_stream)
     {
-        uint64_t id      = stream ? GetCudaStreamIdHint(*stream) : (uint64_t)-1ll;
-        auto     cacheIt = m_perStreamCache.find(id);
-        if (cacheIt == m_perStreamCache.end())
-            cacheIt = m_perStreamCache.emplace(id, &m_cacheItemAlloc).first;
+        uint64_t id = stream ? GetCudaStreamIdHint(*stream) : (uint64_t)-1ll;
 
-        cacheIt->second.put(std::move(payload));
+        {
+            std::shared_lock mapGuard(m_streamMapLock);
+            auto             it = m_perStreamCache.find(id);
+            if (it != m_perStreamCache.end())
+            {
+                std::lock_guard guard(it->second->lock);
+                it->second->cache.put(std::move(payload));
+                return;
+            }
+        }
+
+        std::unique_lock mapGuard(m_streamMapLock);
+        auto            &entry = m_perStreamCache[id];
+        if (!entry)
+        {
+            try
+            {
+                entry = std::make_unique<StreamEntry>();
+            }
+            catch (...)
+            {
+                m_perStreamCache.erase(id);
+                throw;
+            }
+        }
+        // The exclusive lock on the map keeps everyone else away from the entry
+        entry->cache.put(std::move(payload));
     }
     else
     {
-        size_t size = StreamCachePayloadSize(payload);
-        m_globalCache.emplace(size, std::move(payload));
+        std::lock_guard guard(m_globalLock);
+        putGlobal(std::move(payload));
+    }
+}
+
+template<typename Payload, typename Item>
+void PerStreamCache<Payload, Item>::purge()
+{
+    std::unique_lock mapGuard(m_streamMapLock);
+    for (auto &[id, entry] : m_perStreamCache) entry->cache.waitAndPurge();
+
+    std::lock_guard guard(m_globalLock);
+    while (item_t *item = m_globalCache.findLargest())
+    {
+        m_globalCache.remove(item);
+        m_globalItemAlloc.deallocate(item);
+    }
+}
+
+template<typename Payload, typename Item>
+template<typename Predicate>
+void PerStreamCache<Payload, Item>::trim(Predicate &&keepGoing)
+{
+    moveReadyToGlobal();
+
+    std::lock_guard guard(m_globalLock);
+    while (keepGoing())
+    {
+        item_t *item = m_globalCache.findLargest();
+        if (!item)
+            break;
+        m_globalCache.remove(item);
+        m_globalItemAlloc.deallocate(item);
     }
 }
 
@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace nvcv::util {
+
+ThreadPool::ThreadPool(int numThreads)
+{
+    for (int i = 1; i < numThreads; ++i) m_workers.emplace_back(&ThreadPool::workerMain, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto &worker : m_workers) worker.join();
+}
+
+ThreadPool &ThreadPool::Host()
+{
+    static ThreadPool pool(
+        []
+        {
+            if (const char *env = std::getenv("CVCUDA_HOST_THREADS"))
+            {
+                int n = std::atoi(env);
+                if (n > 0)
+                    return n;
+            }
+            return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }());
+    return pool;
+}
+
+void ThreadPool::parallelFor(int count, const std::function<void(int)> &fn)
+{
+    if (count <= 0)
+        return;
+
+    std::unique_lock<std::mutex> submit(m_submitMutex, std::try_to_lock);
+    if (!submit.owns_lock() || m_workers.empty() || count == 1)
+    {
+        for (int i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_fn        = &fn;
+        m_error     = nullptr;
+        m_count     = count;
+        m_next      = 0;
+        m_remaining = count;
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    runItems();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_remaining == 0; });
+        m_fn = nullptr;
+        std::swap(error, m_error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+// Claims items one at a time, callers are expected to size them so that the locking cost is negligible.
+void ThreadPool::runItems()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_next < m_count)
+    {
+        int                              i  = m_next++;
+        const std::function<void(int)> *fn = m_fn;
+        lock.unlock();
+        try
+        {
+            (*fn)(i);
+            lock.lock();
+        }
+        catch (...)
+        {
+            lock.lock();
+            if (!m_error)
+                m_error = std::current_exception();
+            // Skip the items nobody claimed yet
+            m_remaining -= m_count - m_next;
+            m_next = m_count;
+        }
+        if (--m_remaining == 0)
+            m_done.notify_one();
+    }
+}
+
+void ThreadPool::workerMain()
+{
+    unsigned long seen = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop)
+                return;
+            seen = m_generation;
+        }
+        runItems();
+    }
+}
+
+} // namespace nvcv::util
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_UTIL_THREAD_POOL_HPP
+#define NVCV_UTIL_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nvcv::util {
+
+/** A fixed set of worker threads running parallel loops on the host.
+ *
+ * The calling thread takes part in the loop too, so a pool with N threads spawns N - 1 workers
+ * and a pool with a single thread runs everything inline.
+ * Only one loop runs on the pool at a time; a loop submitted while another one is running,
+ * either from another thread or from inside a loop body, is executed inline by its caller.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &)            = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /** @brief Pool shared by the host implementations of the operators.
+     *
+     * It has one thread per hardware thread, unless CVCUDA_HOST_THREADS is set to the thread count to use.
+     */
+    static ThreadPool &Host();
+
+    int numThreads() const
+    {
+        return static_cast<int>(m_workers.size()) + 1;
+    }
+
+    /** @brief Calls fn(i) for every i in [0, count) and returns once all calls are done.
+     *
+     * Calls may run concurrently in any order. If some of them throw, the remaining items are
+     * skipped and the first exception is rethrown to the caller.
+     */
+    void parallelFor(int count, const std::function<void(int)> &fn);
+
+private:
+    void workerMain();
+    void runItems();
+
+    std::vector<std::thread>         m_workers;
+    std::mutex                       m_submitMutex;
+    std::mutex                       m_mutex;
+    std::condition_variable          m_wake;
+    std::condition_variable          m_done;
+    const std::function<void(int)> *m_fn         = nullptr;
+    std::exception_ptr               m_error;
+    int                              m_count      = 0;
+    int                              m_next       = 0;
+    int                              m_remaining  = 0;
+    unsigned long                    m_generation = 0;
+    bool                             m_stop       = false;
+};
+
+} // namespace nvcv::util
+
+#endif // NVCV_UTIL_THREAD_POOL_HPP
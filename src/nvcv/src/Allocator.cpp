@@ -19,6 +19,7 @@
 #include "priv/CustomAllocator.hpp"
 #include "priv/DefaultAllocator.hpp"
 #include "priv/Exception.hpp"
+#include "priv/PoolAllocator.hpp"
 #include "priv/Status.hpp"
 #include "priv/SymbolVersioning.hpp"
 #include "priv/TLS.hpp"
@@ -55,6 +56,41 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvAllocatorConstructCustom,
         });
 }
 
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvAllocatorConstructPool,
+                (const NVCVPoolAllocatorParams *params, NVCVAllocatorHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            *handle = priv::CreateCoreObject<priv::PoolAllocator>(params);
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvAllocatorGetPoolStats,
+                (NVCVAllocatorHandle handle, NVCVPoolAllocatorStats *stats))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (stats == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output statistics must not be NULL");
+            }
+
+            *stats = priv::ToDynamicRef<priv::PoolAllocator>(handle).stats();
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvAllocatorTrimPool, (NVCVAllocatorHandle handle))
+{
+    return priv::ProtectCall([&] { priv::ToDynamicRef<priv::PoolAllocator>(handle).trim(); });
+}
+
 NVCV_DEFINE_API(0, 3, NVCVStatus, nvcvAllocatorDecRef, (NVCVAllocatorHandle handle, int *newRefCount))
 {
     return priv::ProtectCall(
@@ -28,7 +28,44 @@
 
 namespace priv = nvcv::priv;
 
-NVCV_DEFINE_API(0, 0, NVCVStatus, nvcvImageBatchVarShapeCalcRequirements,
+namespace {
+
+// NVCVImageBatchVarShapeRequirements before ringDepth was added, used by
+// binaries linked against the older API versions. They get the default ring depth.
+struct ImageBatchVarShapeRequirementsV0
+{
+    int32_t          capacity;
+    int32_t          alignBytes;
+    NVCVRequirements mem;
+};
+
+} // namespace
+
+NVCV_DEFINE_OLD_API(0, 0, NVCVStatus, nvcvImageBatchVarShapeCalcRequirements,
+                    (int32_t capacity, ImageBatchVarShapeRequirementsV0 *reqs))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output requirements must not be NULL");
+            }
+
+            if (capacity < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Capacity must >= 0");
+            }
+
+            NVCVImageBatchVarShapeRequirements newReqs = priv::ImageBatchVarShape::CalcRequirements(capacity);
+
+            reqs->capacity   = newReqs.capacity;
+            reqs->alignBytes = newReqs.alignBytes;
+            reqs->mem        = newReqs.mem;
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvImageBatchVarShapeCalcRequirements,
                 (int32_t capacity, NVCVImageBatchVarShapeRequirements *reqs))
 {
     return priv::ProtectCall(
@@ -48,7 +85,57 @@ NVCV_DEFINE_API(0, 0, NVCVStatus, nvcvImageBatchVarShapeCalcRequirements,
         });
 }
 
-NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvImageBatchVarShapeConstruct,
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvImageBatchVarShapeCalcRequirementsWithRingDepth,
+                (int32_t capacity, int32_t ringDepth, NVCVImageBatchVarShapeRequirements *reqs))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output requirements must not be NULL");
+            }
+
+            if (capacity < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Capacity must >= 0");
+            }
+
+            *reqs = priv::ImageBatchVarShape::CalcRequirements(capacity, ringDepth);
+        });
+}
+
+NVCV_DEFINE_OLD_API(0, 2, NVCVStatus, nvcvImageBatchVarShapeConstruct,
+                    (const ImageBatchVarShapeRequirementsV0 *reqs, NVCVAllocatorHandle halloc,
+                     NVCVImageBatchHandle *handle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                                      "Pointer to varshape image batch requirements must not be NULL");
+            }
+
+            if (handle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            NVCVImageBatchVarShapeRequirements newReqs;
+            newReqs.capacity   = reqs->capacity;
+            newReqs.alignBytes = reqs->alignBytes;
+            newReqs.mem        = reqs->mem;
+            newReqs.ringDepth  = NVCV_IMAGE_BATCH_VARSHAPE_DEFAULT_RING_DEPTH;
+
+            priv::IAllocator &alloc = priv::GetAllocator(halloc);
+
+            *handle = priv::CreateCoreObject<priv::ImageBatchVarShape>(newReqs, alloc);
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvImageBatchVarShapeConstruct,
                 (const NVCVImageBatchVarShapeRequirements *reqs, NVCVAllocatorHandle halloc,
                  NVCVImageBatchHandle *handle))
 {
@@ -83,6 +83,52 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorCalcRequirements,
         });
 }
 
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvTensorCalcRequirementsForImagesWithTarget,
+                (int32_t batch, int32_t width, int32_t height, NVCVImageFormat format, int32_t baseAlign,
+                 int32_t rowAlign, NVCVResourceType target, NVCVTensorRequirements *reqs))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output requirements must not be NULL");
+            }
+
+            if (batch < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "numImages must >= 0");
+            }
+
+            if (width < 0 || height < 0)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "width and height must >= 0");
+            }
+
+            priv::ImageFormat fmt{format};
+
+            *reqs = priv::Tensor::CalcRequirements(batch, {width, height}, fmt, baseAlign, rowAlign, target);
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvTensorCalcRequirementsWithTarget,
+                (int32_t rank, const int64_t *shape, NVCVDataType dtype, NVCVTensorLayout layout, int32_t baseAlign,
+                 int32_t rowAlign, NVCVResourceType target, NVCVTensorRequirements *reqs))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output requirements must not be NULL");
+            }
+
+            priv::DataType type{dtype};
+
+            *reqs = priv::Tensor::CalcRequirements(rank, shape, type, layout, baseAlign, rowAlign, target);
+        });
+}
+
 NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorConstruct,
                 (const NVCVTensorRequirements *reqs, NVCVAllocatorHandle halloc, NVCVTensorHandle *handle))
 {
@@ -126,6 +172,8 @@ NVCV_DEFINE_API(0, 2, NVCVStatus, nvcvTensorWrapDataConstruct,
             switch (data->bufferType)
             {
             case NVCV_TENSOR_BUFFER_STRIDED_CUDA:
+            case NVCV_TENSOR_BUFFER_STRIDED_HOST:
+            case NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED:
                 *handle = priv::CreateCoreObject<priv::TensorWrapDataStrided>(*data, cleanup, ctxCleanup);
                 break;
 
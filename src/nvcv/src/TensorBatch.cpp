@@ -25,7 +25,39 @@
 
 namespace priv = nvcv::priv;
 
-NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorBatchCalcRequirements,
+namespace {
+
+// NVCVTensorBatchRequirements before ringDepth was added, used by binaries
+// linked against the older API versions. They get the default ring depth.
+struct TensorBatchRequirementsV0
+{
+    int32_t          capacity;
+    int32_t          alignBytes;
+    NVCVRequirements mem;
+};
+
+} // namespace
+
+NVCV_DEFINE_OLD_API(0, 5, NVCVStatus, nvcvTensorBatchCalcRequirements,
+                    (int32_t capacity, TensorBatchRequirementsV0 *reqs))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output requirements must not be NULL");
+            }
+
+            NVCVTensorBatchRequirements newReqs = priv::TensorBatch::CalcRequirements(capacity);
+
+            reqs->capacity   = newReqs.capacity;
+            reqs->alignBytes = newReqs.alignBytes;
+            reqs->mem        = newReqs.mem;
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvTensorBatchCalcRequirements,
                 (int32_t capacity, NVCVTensorBatchRequirements *reqs))
 {
     return priv::ProtectCall(
@@ -40,7 +72,49 @@ NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorBatchCalcRequirements,
         });
 }
 
-NVCV_DEFINE_API(0, 5, NVCVStatus, nvcvTensorBatchConstruct,
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvTensorBatchCalcRequirementsWithRingDepth,
+                (int32_t capacity, int32_t ringDepth, NVCVTensorBatchRequirements *reqs))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output requirements must not be NULL");
+            }
+
+            *reqs = priv::TensorBatch::CalcRequirements(capacity, ringDepth);
+        });
+}
+
+NVCV_DEFINE_OLD_API(0, 5, NVCVStatus, nvcvTensorBatchConstruct,
+                    (const TensorBatchRequirementsV0 *reqs, NVCVAllocatorHandle halloc,
+                     NVCVTensorBatchHandle *outHandle))
+{
+    return priv::ProtectCall(
+        [&]
+        {
+            if (reqs == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to requirements must not be NULL");
+            }
+            if (outHandle == nullptr)
+            {
+                throw priv::Exception(NVCV_ERROR_INVALID_ARGUMENT, "Pointer to output handle must not be NULL");
+            }
+
+            NVCVTensorBatchRequirements newReqs;
+            newReqs.capacity   = reqs->capacity;
+            newReqs.alignBytes = reqs->alignBytes;
+            newReqs.mem        = reqs->mem;
+            newReqs.ringDepth  = NVCV_TENSOR_BATCH_DEFAULT_RING_DEPTH;
+
+            priv::IAllocator &alloc = priv::GetAllocator(halloc);
+            *outHandle              = priv::CreateCoreObject<priv::TensorBatch>(newReqs, alloc);
+        });
+}
+
+NVCV_DEFINE_API(0, 15, NVCVStatus, nvcvTensorBatchConstruct,
                 (const NVCVTensorBatchRequirements *reqs, NVCVAllocatorHandle halloc, NVCVTensorBatchHandle *outHandle))
 {
     return priv::ProtectCall(
@@ -48,6 +48,8 @@ class Tensor;
 class TensorData;
 class TensorDataStrided;
 class TensorDataStridedCuda;
+class TensorDataStridedHost;
+class TensorDataStridedHostPinned;
 
 class Array;
 class ArrayData;
@@ -56,6 +56,12 @@ typedef struct NVCVImageBatch *NVCVImageBatchHandle;
 /** Image batch data cleanup function type */
 typedef void (*NVCVImageBatchDataCleanupFunc)(void *ctx, const NVCVImageBatchData *data);
 
+/** Default number of image descriptor buffers a varshape image batch uploads to in turns. */
+#define NVCV_IMAGE_BATCH_VARSHAPE_DEFAULT_RING_DEPTH (2)
+
+/** Maximum number of image descriptor buffers a varshape image batch can upload to in turns. */
+#define NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH (16)
+
 /** Stores the requirements of an varshape image batch. */
 typedef struct NVCVImageBatchVarShapeRequirementsRec
 {
@@ -63,6 +69,11 @@ typedef struct NVCVImageBatchVarShapeRequirementsRec
 
     int32_t          alignBytes; /*< Alignment/block size in bytes */
     NVCVRequirements mem;        /*< Image batch resource requirements. */
+
+    /*< Number of device descriptor buffers used in turns.
+     *  Added in v0.15, binaries built against older versions keep using the previous layout
+     *  and get @ref NVCV_IMAGE_BATCH_VARSHAPE_DEFAULT_RING_DEPTH. */
+    int32_t ringDepth;
 } NVCVImageBatchVarShapeRequirements;
 
 /** Calculates the resource requirements needed to create a varshape image batch.
@@ -79,6 +90,31 @@ typedef struct NVCVImageBatchVarShapeRequirementsRec
 NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeCalcRequirements(int32_t                             capacity,
                                                               NVCVImageBatchVarShapeRequirements *reqs);
 
+/** Calculates the resource requirements needed to create a varshape image batch with a given ring depth.
+ *
+ * The image descriptors are uploaded to the device by the first export after they're modified.
+ * Each upload goes to the next one of ringDepth device buffers, so that modifying the batch right after
+ * an export doesn't have to wait for the upload to finish. It only waits when the export wraps around
+ * to a buffer whose previous upload is still pending.
+ * A device buffer stays valid until ringDepth more uploads are done.
+ *
+ * @ref nvcvImageBatchVarShapeCalcRequirements uses @ref NVCV_IMAGE_BATCH_VARSHAPE_DEFAULT_RING_DEPTH.
+ *
+ * @param [in] capacity Maximum number of images that fits in the image batch.
+ *                      + Must be >= 0.
+ *
+ * @param [in] ringDepth Number of device descriptor buffers.
+ *                       + Must be >= 1 and <= @ref NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH.
+ *
+ * @param [out] reqs  Where the image batch requirements will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(int32_t capacity, int32_t ringDepth,
+                                                                          NVCVImageBatchVarShapeRequirements *reqs);
+
 /** Constructs a varshape image batch instance with given requirements in the given storage.
  *
  * @param [in] reqs Image batch requirements. Must have been filled in by @ref nvcvImageBatchVarShapeCalcRequirements.
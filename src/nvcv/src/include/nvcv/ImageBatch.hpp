@@ -142,6 +142,15 @@ public:
      */
     static Requirements CalcRequirements(int32_t capacity);
 
+    /**
+     * @brief Calculate requirements for a variable-shaped image batch with a specific capacity and ring depth.
+     *
+     * @param capacity The capacity for which requirements need to be calculated.
+     * @param ringDepth The number of device descriptor buffers the batch uploads to in turns.
+     * @return The requirements for creating a batch with the specified capacity and ring depth.
+     */
+    static Requirements CalcRequirements(int32_t capacity, int32_t ringDepth);
+
     NVCV_IMPLEMENT_SHARED_RESOURCE(ImageBatchVarShape, ImageBatch);
 
     explicit ImageBatchVarShape(NVCVImageBatchHandle &&handle); ///< Construct from an existing NVCV handle.
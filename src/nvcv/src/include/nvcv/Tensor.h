@@ -139,14 +139,66 @@ NVCV_PUBLIC NVCVStatus nvcvTensorCalcRequirementsForImages(int32_t numImages, in
                                                            NVCVImageFormat format, int32_t baseAddrAlignment,
                                                            int32_t rowAddrAlignment, NVCVTensorRequirements *reqs);
 
+/** Calculates the resource requirements needed to create a tensor with target resource.
+ *
+ * Same as @ref nvcvTensorCalcRequirements, but the tensor contents are allocated in the memory
+ * kind given by @p target. Tensors in host memory export their data as \ref NVCV_TENSOR_BUFFER_STRIDED_HOST,
+ * and the ones in page-locked host memory as \ref NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED.
+ *
+ * Default alignments of host tensors don't depend on the current cuda device, they're only large
+ * enough for vectorized CPU access. Page-locked tensors use the same defaults as cuda tensors,
+ * so that their contents can be copied to and from them in one go.
+ *
+ * @param [in] rank,shape,dtype,layout,baseAddrAlignment,rowAddrAlignment As in @ref nvcvTensorCalcRequirements.
+ *
+ * @param [in] target The target compute resource for where memory allocation for
+ *                    the data contained within the tensor will occur.
+ *
+ * @param [out] reqs  Where the tensor requirements will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorCalcRequirementsWithTarget(int32_t rank, const int64_t *shape, NVCVDataType dtype,
+                                                            NVCVTensorLayout layout, int32_t baseAddrAlignment,
+                                                            int32_t rowAddrAlignment, NVCVResourceType target,
+                                                            NVCVTensorRequirements *reqs);
+
+/** Calculates the resource requirements needed to create a tensor that holds N images with target resource.
+ *
+ * Same as @ref nvcvTensorCalcRequirementsForImages, but the tensor contents are allocated in the memory
+ * kind given by @p target, as described in @ref nvcvTensorCalcRequirementsWithTarget.
+ *
+ * @param [in] numImages,width,height,format,baseAddrAlignment,rowAddrAlignment As in
+ *             @ref nvcvTensorCalcRequirementsForImages.
+ *
+ * @param [in] target The target compute resource for where memory allocation for
+ *                    the data contained within the tensor will occur.
+ *
+ * @param [out] reqs  Where the tensor requirements will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorCalcRequirementsForImagesWithTarget(int32_t numImages, int32_t width,
+                                                                     int32_t height, NVCVImageFormat format,
+                                                                     int32_t baseAddrAlignment,
+                                                                     int32_t rowAddrAlignment, NVCVResourceType target,
+                                                                     NVCVTensorRequirements *reqs);
+
 /** Constructs a tensor instance with given requirements in the given storage.
  *
  * @param [in] reqs Tensor requirements. Must have been filled by one of the nvcvTensorCalcRequirements functions.
  *                  + Must not be NULL
  *
  * @param [in] alloc Allocator to be used to allocate needed memory buffers.
- *                   The following resources are used:
+ *                   The following resources are used, depending on the target the requirements
+ *                   were calculated for:
  *                   - cuda memory
+ *                   - host memory
+ *                   - host pinned memory
  *                   If NULL, it'll use the internal default allocator.
  *                   + Allocator must not be destroyed while an tensor still refers to it.
  *
@@ -168,6 +220,8 @@ NVCV_PUBLIC NVCVStatus nvcvTensorConstruct(const NVCVTensorRequirements *reqs, N
  *                  + Must not be NULL.
  *                  + Allowed buffer types:
  *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA
+ *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST
+ *                    - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED
  *
  * @param [in] cleanup Cleanup function to be called when the tensor is destroyed
  *                     via @ref nvcvTensorDecRef.
@@ -207,7 +261,8 @@ NVCV_PUBLIC NVCVStatus nvcvTensorWrapDataConstruct(const NVCVTensorData *data, N
  *                 + Distance in memory between consecutive planes must be > 0.
  *                 + Row pitch of all planes must be the same.
  *                 + Image must not be destroyed while it's referenced by a tensor.
- *                 + Image contents must be cuda-accessible
+ *                 + Image contents must be cuda-accessible, or in host memory. In the latter case
+ *                   the tensor data is exported as \ref NVCV_TENSOR_BUFFER_STRIDED_HOST.
  *                 + Image format must be pitch-linear.
  *                 + All planes must have the same dimensions.
  *
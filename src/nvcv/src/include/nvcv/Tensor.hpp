@@ -118,9 +118,11 @@ public:
      * @param shape Shape of the tensor.
      * @param dtype Data type of the tensor elements.
      * @param bufAlign Memory alignment for the tensor.
+     * @param target Memory kind where the tensor contents will be allocated.
      * @return Requirements object representing the tensor's requirements.
      */
-    static Requirements CalcRequirements(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign = {});
+    static Requirements CalcRequirements(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign = {},
+                                         NVCVResourceType target = NVCV_RESOURCE_MEM_CUDA);
 
     /**
      * @brief Calculates the requirements for a tensor representing a set of images.
@@ -129,21 +131,25 @@ public:
      * @param imgSize Dimensions of the images.
      * @param fmt Format of the images.
      * @param bufAlign Memory alignment for the tensor.
+     * @param target Memory kind where the tensor contents will be allocated.
      * @return Requirements object representing the tensor's requirements.
      */
     static Requirements CalcRequirements(int numImages, Size2D imgSize, ImageFormat fmt,
-                                         const MemAlignment &bufAlign = {});
+                                         const MemAlignment &bufAlign = {},
+                                         NVCVResourceType target     = NVCV_RESOURCE_MEM_CUDA);
 
     NVCV_IMPLEMENT_SHARED_RESOURCE(Tensor, Base);
 
     /**
      * @brief Constructors
+     *
+     * The tensor is allocated in the memory kind the requirements were calculated for.
      */
     explicit Tensor(const Requirements &reqs, const Allocator &alloc = nullptr);
     explicit Tensor(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign = {},
-                    const Allocator &alloc = nullptr);
+                    const Allocator &alloc = nullptr, NVCVResourceType target = NVCV_RESOURCE_MEM_CUDA);
     explicit Tensor(int numImages, Size2D imgSize, ImageFormat fmt, const MemAlignment &bufAlign = {},
-                    const Allocator &alloc = nullptr);
+                    const Allocator &alloc = nullptr, NVCVResourceType target = NVCV_RESOURCE_MEM_CUDA);
 };
 
 // TensorWrapData definition -------------------------------------
@@ -39,6 +39,12 @@ extern "C"
 
 typedef struct NVCVTensorBatch *NVCVTensorBatchHandle;
 
+/** Default number of tensor descriptor buffers a tensor batch uploads to in turns. */
+#define NVCV_TENSOR_BATCH_DEFAULT_RING_DEPTH (2)
+
+/** Maximum number of tensor descriptor buffers a tensor batch can upload to in turns. */
+#define NVCV_TENSOR_BATCH_MAX_RING_DEPTH (16)
+
 /** Stores the requirements of an varshape tensor. */
 typedef struct NVCVTensorBatchRequirementsRec
 {
@@ -50,6 +56,11 @@ typedef struct NVCVTensorBatchRequirementsRec
 
     /*< Tensor resource requirements. */
     NVCVRequirements mem;
+
+    /*< Number of device descriptor buffers used in turns.
+     *  Added in v0.15, binaries built against older versions keep using the previous layout
+     *  and get @ref NVCV_TENSOR_BATCH_DEFAULT_RING_DEPTH. */
+    int32_t ringDepth;
 } NVCVTensorBatchRequirements;
 
 /** Calculates the resource requirements needed to create a tensor batch.
@@ -65,6 +76,31 @@ typedef struct NVCVTensorBatchRequirementsRec
  */
 NVCV_PUBLIC NVCVStatus nvcvTensorBatchCalcRequirements(int32_t capacity, NVCVTensorBatchRequirements *reqs);
 
+/** Calculates the resource requirements needed to create a tensor batch with a given ring depth.
+ *
+ * The tensor descriptors are uploaded to the device by the first export after they're modified.
+ * Each upload goes to the next one of ringDepth device buffers, so that modifying the batch right after
+ * an export doesn't have to wait for the upload to finish. It only waits when the export wraps around
+ * to a buffer whose previous upload is still pending.
+ * A device buffer stays valid until ringDepth more uploads are done.
+ *
+ * @ref nvcvTensorBatchCalcRequirements uses @ref NVCV_TENSOR_BATCH_DEFAULT_RING_DEPTH.
+ *
+ * @param [in] capacity Maximum number of tensors that fits in the tensor batch.
+ *                      + Must be >= 1.
+ *
+ * @param [in] ringDepth Number of device descriptor buffers.
+ *                       + Must be >= 1 and <= @ref NVCV_TENSOR_BATCH_MAX_RING_DEPTH.
+ *
+ * @param [out] reqs  Where the tensor batch requirements will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside valid range.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvTensorBatchCalcRequirementsWithRingDepth(int32_t capacity, int32_t ringDepth,
+                                                                   NVCVTensorBatchRequirements *reqs);
+
 NVCVStatus nvcvTensorBatchConstruct(const NVCVTensorBatchRequirements *req, NVCVAllocatorHandle alloc,
                                     NVCVTensorBatchHandle *outHandle);
 
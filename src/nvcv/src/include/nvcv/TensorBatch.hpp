@@ -46,6 +46,8 @@ public:
 
     static Requirements CalcRequirements(int32_t capacity);
 
+    static Requirements CalcRequirements(int32_t capacity, int32_t ringDepth);
+
     NVCV_IMPLEMENT_SHARED_RESOURCE(TensorBatch, Base);
 
     TensorBatch(const Requirements &reqs, const Allocator &alloc = nullptr);
@@ -48,6 +48,13 @@ typedef enum
 
     /** GPU-accessible with equal-shape planes in pitch-linear layout. */
     NVCV_TENSOR_BUFFER_STRIDED_CUDA,
+
+    /** Host-accessible with equal-shape planes in pitch-linear layout. */
+    NVCV_TENSOR_BUFFER_STRIDED_HOST,
+
+    /** Page-locked host memory with equal-shape planes in pitch-linear layout.
+     *  It's accessible by the host, and can be copied asynchronously to and from GPU memory. */
+    NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED,
 } NVCVTensorBufferType;
 
 /** Represents the available methods to access image batch contents.
@@ -57,6 +64,8 @@ typedef union NVCVTensorBufferRec
     /** Tensor image batch stored in pitch-linear layout.
      * To be used when \ref NVCVTensorData::bufferType is:
      * - \ref NVCV_TENSOR_BUFFER_STRIDED_CUDA
+     * - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST
+     * - \ref NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED
      */
     NVCVTensorBufferStrided strided;
 } NVCVTensorBuffer;
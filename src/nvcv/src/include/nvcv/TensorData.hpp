@@ -161,7 +161,8 @@ public:
      */
     static bool IsCompatibleKind(NVCVTensorBufferType kind)
     {
-        return kind == NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+        return kind == NVCV_TENSOR_BUFFER_STRIDED_CUDA || kind == NVCV_TENSOR_BUFFER_STRIDED_HOST
+            || kind == NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED;
     }
 
 protected:
@@ -208,6 +209,84 @@ public:
     }
 };
 
+/**
+ * @brief Represents strided tensor data stored in host memory.
+ *
+ * The `TensorDataStridedHost` class extends `TensorDataStrided` to handle tensor data stored in a strided manner
+ * in host memory, either pageable or page-locked.
+ */
+class TensorDataStridedHost : public TensorDataStrided
+{
+public:
+    using Buffer = NVCVTensorBufferStrided;
+
+    /**
+     * @brief Constructs a `TensorDataStridedHost` object from an `NVCVTensorData` instance.
+     *
+     * @param data The underlying tensor data representation.
+     */
+    TensorDataStridedHost(const NVCVTensorData &data);
+
+    /**
+     * @brief Constructs a `TensorDataStridedHost` object from tensor shape, data type, and buffer.
+     *
+     * @param tshape Shape of the tensor.
+     * @param dtype Data type of the tensor elements.
+     * @param buffer The underlying strided buffer in host memory.
+     */
+    TensorDataStridedHost(const TensorShape &tshape, const DataType &dtype, const Buffer &buffer);
+
+    /**
+     * @brief Determines if a given tensor buffer type is compatible with host strided data.
+     *
+     * @param kind The tensor buffer type to check.
+     * @return true if the buffer type is in pageable or page-locked host memory, false otherwise.
+     */
+    static bool IsCompatibleKind(NVCVTensorBufferType kind)
+    {
+        return kind == NVCV_TENSOR_BUFFER_STRIDED_HOST || kind == NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED;
+    }
+};
+
+/**
+ * @brief Represents strided tensor data stored in page-locked host memory.
+ *
+ * The `TensorDataStridedHostPinned` class extends `TensorDataStrided` to handle tensor data stored in a strided
+ * manner in page-locked host memory, which can be copied asynchronously to and from CUDA devices.
+ */
+class TensorDataStridedHostPinned : public TensorDataStrided
+{
+public:
+    using Buffer = NVCVTensorBufferStrided;
+
+    /**
+     * @brief Constructs a `TensorDataStridedHostPinned` object from an `NVCVTensorData` instance.
+     *
+     * @param data The underlying tensor data representation.
+     */
+    TensorDataStridedHostPinned(const NVCVTensorData &data);
+
+    /**
+     * @brief Constructs a `TensorDataStridedHostPinned` object from tensor shape, data type, and buffer.
+     *
+     * @param tshape Shape of the tensor.
+     * @param dtype Data type of the tensor elements.
+     * @param buffer The underlying strided buffer in page-locked host memory.
+     */
+    TensorDataStridedHostPinned(const TensorShape &tshape, const DataType &dtype, const Buffer &buffer);
+
+    /**
+     * @brief Determines if a given tensor buffer type is compatible with page-locked host strided data.
+     *
+     * @param kind The tensor buffer type to check.
+     * @return true if the buffer type is NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED, false otherwise.
+     */
+    static bool IsCompatibleKind(NVCVTensorBufferType kind)
+    {
+        return kind == NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED;
+    }
+};
+
 } // namespace nvcv
 
 #include "detail/TensorDataImpl.hpp"
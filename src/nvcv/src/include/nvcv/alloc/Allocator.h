@@ -163,6 +163,87 @@ typedef struct NVCVAllocator *NVCVAllocatorHandle;
 NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructCustom(const NVCVResourceAllocator *customAllocators,
                                                     int32_t numCustomAllocators, NVCVAllocatorHandle *handle);
 
+/** Parameters of the size-class pooling allocator.
+ *
+ * Host memory blocks are bucketed by power-of-two size class, indexed by log2(size) in the same
+ * way as @ref NVCVMemRequirements::numBlocks. Freed blocks are kept in a per-thread free list
+ * first, falling back to a free list shared among all threads.
+ *
+ * Any member set to zero takes its default value.
+ */
+typedef struct NVCVPoolAllocatorParamsRec
+{
+    /** Maximum number of bytes held in the free lists.
+     *  When a freed block would make the pool exceed this value, it's released back to
+     *  the system instead. Defaults to 256 MiB. */
+    int64_t maxHeldBytes;
+
+    /** Largest block size that is pooled, must be a power of two.
+     *  Requests larger than this are forwarded to the system allocator.
+     *  Defaults to 64 MiB. */
+    int64_t maxBlockSize;
+
+    /** Maximum number of blocks per size class kept in each thread's free list.
+     *  Defaults to 8. */
+    int32_t threadCacheBlocks;
+} NVCVPoolAllocatorParams;
+
+/** Runtime statistics of the size-class pooling allocator. */
+typedef struct NVCVPoolAllocatorStatsRec
+{
+    int64_t numHits;       /*< Number of allocations served from a free list. */
+    int64_t numMisses;     /*< Number of allocations forwarded to the system allocator. */
+    int64_t numTrimmed;    /*< Number of blocks released to the system because of the high-water mark or a trim. */
+    int64_t bytesHeld;     /*< Number of bytes currently held in the free lists. */
+    int64_t peakBytesHeld; /*< Highest value reached by bytesHeld. */
+} NVCVPoolAllocatorStats;
+
+/** Constructs an allocator that pools host memory blocks by power-of-two size class.
+ *
+ * Host memory allocations are served from per-thread and global free lists, avoiding
+ * a system allocation for every object construction. Host-pinned and cuda memory
+ * resources are handled the same way as the default allocator does.
+ *
+ * When not needed anymore, the allocator instance must be destroyed by
+ * @ref nvcvAllocatorDecRef function.
+ *
+ * @param [in] params Pool parameters.
+ *                    Can be NULL, in this case default values are used.
+ *
+ * @param [out] handle Where new instance handle will be written to.
+ *                     + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some argument is outside its valid range.
+ * @retval #NVCV_ERROR_OUT_OF_MEMORY    Not enough memory to create the allocator.
+ * @retval #NVCV_SUCCESS                Allocator created successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorConstructPool(const NVCVPoolAllocatorParams *params, NVCVAllocatorHandle *handle);
+
+/** Retrieves the runtime statistics of a pooling allocator.
+ *
+ * @param [in] handle Allocator to be queried.
+ *                    + Must have been created by @ref nvcvAllocatorConstructPool.
+ *
+ * @param [out] stats Where the statistics will be written to.
+ *                    + Must not be NULL.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT Some parameter is outside its valid range.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   The allocator isn't a pooling allocator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorGetPoolStats(NVCVAllocatorHandle handle, NVCVPoolAllocatorStats *stats);
+
+/** Releases to the system the blocks held in the shared free lists and in the calling thread's free lists.
+ *
+ * @param [in] handle Allocator to be trimmed.
+ *                    + Must have been created by @ref nvcvAllocatorConstructPool.
+ *
+ * @retval #NVCV_ERROR_INVALID_ARGUMENT The handle is invalid.
+ * @retval #NVCV_ERROR_NOT_COMPATIBLE   The allocator isn't a pooling allocator.
+ * @retval #NVCV_SUCCESS                Operation executed successfully.
+ */
+NVCV_PUBLIC NVCVStatus nvcvAllocatorTrimPool(NVCVAllocatorHandle handle);
+
 /** Decrements the reference count of an existing allocator instance.
  *
  * The allocator is destroyed when its reference count reaches zero.
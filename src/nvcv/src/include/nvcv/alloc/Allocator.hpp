@@ -425,6 +425,25 @@ CustomAllocator<ResourceAllocators...> CreateCustomAllocator(ResourceAllocators
     return CustomAllocator<ResourceAllocators...>{std::move(allocators)...};
 }
 
+/** An allocator that recycles host memory blocks bucketed by power-of-two size class.
+ *
+ * Host-pinned and cuda memory are handled the same way as the default allocator does.
+ *
+ * @see nvcvAllocatorConstructPool
+ */
+class PoolAllocator final : public Allocator
+{
+public:
+    PoolAllocator();
+    explicit PoolAllocator(const NVCVPoolAllocatorParams &params);
+
+    /** Returns the pool's hit/miss counters and the number of bytes currently held. */
+    NVCVPoolAllocatorStats stats() const;
+
+    /** Releases the held blocks that are reachable from the calling thread. */
+    void trim();
+};
+
 } // namespace nvcv
 
 #include "AllocatorImpl.hpp"
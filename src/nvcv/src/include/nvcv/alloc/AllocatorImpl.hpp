@@ -199,6 +199,35 @@ inline CustomAllocator<ResourceAllocators...>::CustomAllocator(ResourceAllocator
     reset(std::move(h));
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// PoolAllocator
+
+inline PoolAllocator::PoolAllocator()
+{
+    NVCVAllocatorHandle h = {};
+    detail::CheckThrow(nvcvAllocatorConstructPool(nullptr, &h));
+    reset(std::move(h));
+}
+
+inline PoolAllocator::PoolAllocator(const NVCVPoolAllocatorParams &params)
+{
+    NVCVAllocatorHandle h = {};
+    detail::CheckThrow(nvcvAllocatorConstructPool(&params, &h));
+    reset(std::move(h));
+}
+
+inline NVCVPoolAllocatorStats PoolAllocator::stats() const
+{
+    NVCVPoolAllocatorStats s;
+    detail::CheckThrow(nvcvAllocatorGetPoolStats(handle(), &s));
+    return s;
+}
+
+inline void PoolAllocator::trim()
+{
+    detail::CheckThrow(nvcvAllocatorTrimPool(handle()));
+}
+
 namespace detail {
 
 template<NVCVResourceType KIND>
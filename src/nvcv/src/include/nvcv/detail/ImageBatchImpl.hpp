@@ -226,6 +226,13 @@ inline auto ImageBatchVarShape::CalcRequirements(int32_t capacity) -> Requiremen
     return reqs;
 }
 
+inline auto ImageBatchVarShape::CalcRequirements(int32_t capacity, int32_t ringDepth) -> Requirements
+{
+    Requirements reqs;
+    detail::CheckThrow(nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(capacity, ringDepth, &reqs));
+    return reqs;
+}
+
 inline ImageBatchVarShape::ImageBatchVarShape(const Requirements &reqs, const Allocator &alloc)
 {
     NVCVImageBatchHandle handle = nullptr;
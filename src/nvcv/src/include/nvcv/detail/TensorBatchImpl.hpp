@@ -29,6 +29,13 @@ inline TensorBatch::Requirements TensorBatch::CalcRequirements(int32_t capacity)
     return reqs;
 }
 
+inline TensorBatch::Requirements TensorBatch::CalcRequirements(int32_t capacity, int32_t ringDepth)
+{
+    TensorBatch::Requirements reqs = {};
+    detail::CheckThrow(nvcvTensorBatchCalcRequirementsWithRingDepth(capacity, ringDepth, &reqs));
+    return reqs;
+}
+
 inline TensorBatch::TensorBatch(const TensorBatch::Requirements &reqs, const Allocator &alloc)
 {
     NVCVTensorBatchHandle handle = nullptr;
@@ -71,7 +71,7 @@ inline TensorData Tensor::exportData() const
     NVCVTensorData data;
     detail::CheckThrow(nvcvTensorExportData(this->handle(), &data));
 
-    if (data.bufferType != NVCV_TENSOR_BUFFER_STRIDED_CUDA)
+    if (!TensorDataStrided::IsCompatibleKind(data.bufferType))
     {
         throw Exception(Status::ERROR_INVALID_OPERATION, "Tensor data cannot be exported, buffer type not supported");
     }
@@ -100,22 +100,22 @@ inline Tensor Tensor::reshape(const TensorShape &new_shape)
     return out_tensor;
 }
 
-inline auto Tensor::CalcRequirements(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign)
-    -> Requirements
+inline auto Tensor::CalcRequirements(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign,
+                                     NVCVResourceType target) -> Requirements
 {
     Requirements reqs;
-    detail::CheckThrow(nvcvTensorCalcRequirements(shape.size(), &shape[0], dtype,
-                                                  static_cast<NVCVTensorLayout>(shape.layout()), bufAlign.baseAddr(),
-                                                  bufAlign.rowAddr(), &reqs));
+    detail::CheckThrow(nvcvTensorCalcRequirementsWithTarget(shape.size(), &shape[0], dtype,
+                                                            static_cast<NVCVTensorLayout>(shape.layout()),
+                                                            bufAlign.baseAddr(), bufAlign.rowAddr(), target, &reqs));
     return reqs;
 }
 
-inline auto Tensor::CalcRequirements(int numImages, Size2D imgSize, ImageFormat fmt, const MemAlignment &bufAlign)
-    -> Requirements
+inline auto Tensor::CalcRequirements(int numImages, Size2D imgSize, ImageFormat fmt, const MemAlignment &bufAlign,
+                                     NVCVResourceType target) -> Requirements
 {
     Requirements reqs;
-    detail::CheckThrow(nvcvTensorCalcRequirementsForImages(numImages, imgSize.w, imgSize.h, fmt, bufAlign.baseAddr(),
-                                                           bufAlign.rowAddr(), &reqs));
+    detail::CheckThrow(nvcvTensorCalcRequirementsForImagesWithTarget(
+        numImages, imgSize.w, imgSize.h, fmt, bufAlign.baseAddr(), bufAlign.rowAddr(), target, &reqs));
     return reqs;
 }
 
@@ -127,13 +127,14 @@ inline Tensor::Tensor(const Requirements &reqs, const Allocator &alloc)
 }
 
 inline Tensor::Tensor(int numImages, Size2D imgSize, ImageFormat fmt, const MemAlignment &bufAlign,
-                      const Allocator &alloc)
-    : Tensor(CalcRequirements(numImages, imgSize, fmt, bufAlign), alloc)
+                      const Allocator &alloc, NVCVResourceType target)
+    : Tensor(CalcRequirements(numImages, imgSize, fmt, bufAlign, target), alloc)
 {
 }
 
-inline Tensor::Tensor(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign, const Allocator &alloc)
-    : Tensor(CalcRequirements(shape, dtype, bufAlign), alloc)
+inline Tensor::Tensor(const TensorShape &shape, DataType dtype, const MemAlignment &bufAlign, const Allocator &alloc,
+                      NVCVResourceType target)
+    : Tensor(CalcRequirements(shape, dtype, bufAlign, target), alloc)
 {
 }
 
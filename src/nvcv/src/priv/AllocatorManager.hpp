@@ -21,6 +21,7 @@
 #include "CustomAllocator.hpp"
 #include "DefaultAllocator.hpp"
 #include "IContext.hpp"
+#include "PoolAllocator.hpp"
 
 namespace nvcv::priv {
 
@@ -29,7 +30,7 @@ using AllocatorManager = CoreObjManager<NVCVAllocatorHandle>;
 template<>
 struct ResourceStorage<IAllocator>
 {
-    using type = CompatibleStorage<DefaultAllocator, CustomAllocator>;
+    using type = CompatibleStorage<DefaultAllocator, CustomAllocator, PoolAllocator>;
     ;
 };
 
@@ -17,7 +17,7 @@
 
 #include "Context.hpp"
 
-#include "HandleManagerImpl.hpp"
+#include "SlabHandleManagerImpl.hpp"
 
 #include <nvcv/util/Assert.h>
 
@@ -56,11 +56,11 @@ auto Context::managerList() const -> const Managers &
     return m_managerList;
 }
 
-template class HandleManager<IImage>;
-template class HandleManager<IImageBatch>;
-template class HandleManager<ITensor>;
-template class HandleManager<IArray>;
-template class HandleManager<IAllocator>;
-template class HandleManager<ITensorBatch>;
+template class SlabHandleManager<IImage>;
+template class SlabHandleManager<IImageBatch>;
+template class SlabHandleManager<ITensor>;
+template class SlabHandleManager<IArray>;
+template class SlabHandleManager<IAllocator>;
+template class SlabHandleManager<ITensorBatch>;
 
 } // namespace nvcv::priv
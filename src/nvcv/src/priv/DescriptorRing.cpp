@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DescriptorRing.hpp"
+
+#include "Exception.hpp"
+
+#include <nvcv/util/Assert.h>
+#include <nvcv/util/CheckError.hpp>
+
+#include <algorithm>
+
+namespace nvcv::priv {
+
+DescriptorRing::DescriptorRing(int32_t depth)
+{
+    NVCV_ASSERT(depth >= 1);
+
+    m_slots.resize(depth);
+    // The first upload goes to the first buffer
+    m_current = depth - 1;
+
+    try
+    {
+        for (Slot &slot : m_slots)
+        {
+            NVCV_CHECK_THROW(cudaEventCreateWithFlags(&slot.fence, cudaEventDisableTiming));
+        }
+    }
+    catch (...)
+    {
+        for (Slot &slot : m_slots)
+        {
+            if (slot.fence)
+            {
+                NVCV_CHECK_LOG(cudaEventDestroy(slot.fence));
+            }
+        }
+        throw;
+    }
+}
+
+DescriptorRing::~DescriptorRing()
+{
+    for (Slot &slot : m_slots)
+    {
+        NVCV_CHECK_LOG(cudaEventDestroy(slot.fence));
+    }
+}
+
+int32_t DescriptorRing::depth() const
+{
+    return m_slots.size();
+}
+
+int32_t DescriptorRing::current() const
+{
+    return m_current;
+}
+
+bool DescriptorRing::isDirty() const
+{
+    const Slot &slot = m_slots[m_current];
+    return slot.dirtyBegin < slot.dirtyEnd;
+}
+
+void DescriptorRing::markDirty(int32_t begin, int32_t end)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    for (Slot &slot : m_slots)
+    {
+        if (slot.dirtyBegin < slot.dirtyEnd)
+        {
+            slot.dirtyBegin = std::min(slot.dirtyBegin, begin);
+            slot.dirtyEnd   = std::max(slot.dirtyEnd, end);
+        }
+        else
+        {
+            slot.dirtyBegin = begin;
+            slot.dirtyEnd   = end;
+        }
+    }
+}
+
+void DescriptorRing::truncate(int32_t count)
+{
+    for (Slot &slot : m_slots)
+    {
+        slot.dirtyEnd   = std::min(slot.dirtyEnd, count);
+        slot.dirtyBegin = std::min(slot.dirtyBegin, slot.dirtyEnd);
+    }
+}
+
+DescriptorRing::Range DescriptorRing::advance()
+{
+    int32_t next = (m_current + 1) % depth();
+
+    // Only blocks when the ring wrapped around to a buffer that is still being copied.
+    NVCV_CHECK_THROW(cudaEventSynchronize(m_slots[next].fence));
+
+    m_current = next;
+    return {m_slots[next].dirtyBegin, m_slots[next].dirtyEnd};
+}
+
+void DescriptorRing::recordUpload(cudaStream_t stream)
+{
+    Slot &slot = m_slots[m_current];
+    NVCV_CHECK_THROW(cudaEventRecord(slot.fence, stream));
+    slot.dirtyBegin = slot.dirtyEnd = 0;
+}
+
+void DescriptorRing::waitAll() const noexcept
+{
+    for (const Slot &slot : m_slots)
+    {
+        NVCV_CHECK_LOG(cudaEventSynchronize(slot.fence));
+    }
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_DESCRIPTORRING_HPP
+#define NVCV_CORE_PRIV_DESCRIPTORRING_HPP
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace nvcv::priv {
+
+// Keeps track of a ring of descriptor buffers that batches upload to the device in turns.
+//
+// Batches keep the descriptors of their elements on the host and copy them to a device buffer
+// in exportData. Every buffer in the ring has a fence recorded after its copy, and the host side
+// of a buffer is only refilled once its fence is done. As each upload goes to the next buffer in
+// the ring, refilling only waits when the ring wraps around to a buffer whose copy is still pending,
+// and the device buffers handed out by the previous exports stay intact until then.
+//
+// The ring doesn't own the buffers, it tells which one is current and which descriptors
+// were modified since that buffer was last uploaded.
+class DescriptorRing
+{
+public:
+    struct Range
+    {
+        int32_t begin, end;
+    };
+
+    explicit DescriptorRing(int32_t depth);
+    ~DescriptorRing();
+
+    DescriptorRing(const DescriptorRing &)            = delete;
+    DescriptorRing &operator=(const DescriptorRing &) = delete;
+
+    int32_t depth() const;
+
+    // Index of the buffer uploaded last
+    int32_t current() const;
+
+    // Whether the current buffer is missing any modifications
+    bool isDirty() const;
+
+    // Marks descriptors in [begin, end) as modified in all buffers
+    void markDirty(int32_t begin, int32_t end);
+
+    // Drops modifications past `count` descriptors
+    void truncate(int32_t count);
+
+    // Moves to the next buffer, waiting until its previous upload is done.
+    // Returns the range of descriptors that must be uploaded to it.
+    Range advance();
+
+    // Records the fence of the current buffer in the stream and marks the buffer up to date.
+    void recordUpload(cudaStream_t stream);
+
+    // Waits until all uploads are done, logging errors.
+    void waitAll() const noexcept;
+
+private:
+    struct Slot
+    {
+        cudaEvent_t fence      = nullptr;
+        int32_t     dirtyBegin = 0;
+        int32_t     dirtyEnd   = 0;
+    };
+
+    std::vector<Slot> m_slots;
+    int32_t           m_current;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_DESCRIPTORRING_HPP
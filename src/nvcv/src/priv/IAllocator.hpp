@@ -83,9 +83,9 @@ priv::IAllocator &GetAllocator(NVCVAllocatorHandle handle);
 priv::IAllocator &GetDefaultAllocator();
 
 template<>
-class CoreObjManager<NVCVAllocatorHandle> : public HandleManager<IAllocator>
+class CoreObjManager<NVCVAllocatorHandle> : public SlabHandleManager<IAllocator>
 {
-    using Base = HandleManager<IAllocator>;
+    using Base = SlabHandleManager<IAllocator>;
 
 public:
     using Base::Base;
@@ -47,9 +47,9 @@ public:
 };
 
 template<>
-class CoreObjManager<NVCVArrayHandle> : public HandleManager<IArray>
+class CoreObjManager<NVCVArrayHandle> : public SlabHandleManager<IArray>
 {
-    using Base = HandleManager<IArray>;
+    using Base = SlabHandleManager<IArray>;
 
 public:
     using Base::Base;
@@ -21,6 +21,7 @@
 #include "Exception.hpp"
 #include "HandleManager.hpp"
 #include "HandleTraits.hpp"
+#include "SlabHandleManager.hpp"
 #include "IContext.hpp"
 #include "Version.hpp"
 
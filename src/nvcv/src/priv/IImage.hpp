@@ -42,9 +42,9 @@ public:
 };
 
 template<>
-class CoreObjManager<NVCVImageHandle> : public HandleManager<IImage>
+class CoreObjManager<NVCVImageHandle> : public SlabHandleManager<IImage>
 {
-    using Base = HandleManager<IImage>;
+    using Base = SlabHandleManager<IImage>;
 
 public:
     using Base::Base;
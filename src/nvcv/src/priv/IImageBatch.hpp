@@ -58,9 +58,9 @@ public:
 };
 
 template<>
-class CoreObjManager<NVCVImageBatchHandle> : public HandleManager<IImageBatch>
+class CoreObjManager<NVCVImageBatchHandle> : public SlabHandleManager<IImageBatch>
 {
-    using Base = HandleManager<IImageBatch>;
+    using Base = SlabHandleManager<IImageBatch>;
 
 public:
     using Base::Base;
@@ -44,9 +44,9 @@ public:
 };
 
 template<>
-class CoreObjManager<NVCVTensorHandle> : public HandleManager<ITensor>
+class CoreObjManager<NVCVTensorHandle> : public SlabHandleManager<ITensor>
 {
-    using Base = HandleManager<ITensor>;
+    using Base = SlabHandleManager<ITensor>;
 
 public:
     using Base::Base;
@@ -53,9 +53,9 @@ public:
 };
 
 template<>
-class CoreObjManager<NVCVTensorBatchHandle> : public HandleManager<ITensorBatch>
+class CoreObjManager<NVCVTensorBatchHandle> : public SlabHandleManager<ITensorBatch>
 {
-    using Base = HandleManager<ITensorBatch>;
+    using Base = SlabHandleManager<ITensorBatch>;
 
 public:
     using Base::Base;
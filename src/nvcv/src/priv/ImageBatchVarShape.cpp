@@ -28,6 +28,7 @@
 #include <nvcv/util/CheckError.hpp>
 #include <nvcv/util/Math.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 
@@ -35,11 +36,18 @@ namespace nvcv::priv {
 
 // ImageBatchVarShape implementation -------------------------------------------
 
-NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t capacity)
+NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t capacity, int32_t ringDepth)
 {
+    if (ringDepth < 1 || ringDepth > NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Ring depth must be between 1 and %d, not %d",
+                        NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH, ringDepth);
+    }
+
     NVCVImageBatchVarShapeRequirements reqs;
-    reqs.capacity = capacity;
-    reqs.mem      = {};
+    reqs.capacity  = capacity;
+    reqs.ringDepth = ringDepth;
+    reqs.mem       = {};
 
     reqs.alignBytes = alignof(NVCVImageBufferStrided);
     reqs.alignBytes = std::lcm(alignof(NVCVImageHandle), reqs.alignBytes);
@@ -54,90 +62,107 @@ NVCVImageBatchVarShapeRequirements ImageBatchVarShape::CalcRequirements(int32_t
                         NVCV_MAX_MEM_REQUIREMENTS_BLOCK_SIZE);
     }
 
-    AddBuffer(reqs.mem.cudaMem, capacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
-    AddBuffer(reqs.mem.cudaMem, capacity * sizeof(NVCVImageFormat), reqs.alignBytes);
+    int64_t slotCapacity = (int64_t)ringDepth * capacity;
+
+    AddBuffer(reqs.mem.cudaMem, slotCapacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
+    AddBuffer(reqs.mem.cudaMem, slotCapacity * sizeof(NVCVImageFormat), reqs.alignBytes);
 
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageFormat), reqs.alignBytes);
 
+    AddBuffer(reqs.mem.hostMem, slotCapacity * sizeof(NVCVImageBufferStrided), reqs.alignBytes);
+    AddBuffer(reqs.mem.hostMem, slotCapacity * sizeof(NVCVImageFormat), reqs.alignBytes);
+
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(NVCVImageHandle), reqs.alignBytes);
 
     return reqs;
 }
 
+static int32_t ValidateRingDepth(const NVCVImageBatchVarShapeRequirements &reqs)
+{
+    if (reqs.ringDepth < 1 || reqs.ringDepth > NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Ring depth must be between 1 and %d, not %d",
+                        NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH, reqs.ringDepth);
+    }
+    return reqs.ringDepth;
+}
+
 ImageBatchVarShape::ImageBatchVarShape(NVCVImageBatchVarShapeRequirements reqs, IAllocator &alloc)
     : m_alloc{alloc}
     , m_reqs{std::move(reqs)}
-    , m_dirtyStartingFromIndex(0)
+    , m_ring(ValidateRingDepth(m_reqs))
     , m_numImages(0)
     , m_cacheMaxSize{Size2D{0,0}}
 {
-    m_evPostFence     = nullptr;
-    m_devImagesBuffer = m_hostImagesBuffer = nullptr;
-    m_devFormatsBuffer = m_hostFormatsBuffer = nullptr;
-    m_imgHandleBuffer                        = nullptr;
+    m_devImagesBuffer = m_stagingImagesBuffer = m_hostImagesBuffer = nullptr;
+    m_devFormatsBuffer = m_stagingFormatsBuffer = m_hostFormatsBuffer = nullptr;
+    m_imgHandleBuffer                                                 = nullptr;
 
+    int64_t slotCapacity   = (int64_t)m_reqs.ringDepth * m_reqs.capacity;
     int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
     int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
     int64_t imgHandlesSize = m_reqs.capacity * sizeof(NVCVImageHandle);
 
     try
     {
-        m_devImagesBuffer
-            = static_cast<NVCVImageBufferStrided *>(m_alloc->allocCudaMem(bufImagesSize, m_reqs.alignBytes));
+        m_devImagesBuffer = static_cast<NVCVImageBufferStrided *>(
+            m_alloc->allocCudaMem(slotCapacity * sizeof(NVCVImageBufferStrided), m_reqs.alignBytes));
         NVCV_ASSERT(m_devImagesBuffer != nullptr);
 
         m_hostImagesBuffer
             = static_cast<NVCVImageBufferStrided *>(m_alloc->allocHostMem(bufImagesSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_devImagesBuffer != nullptr);
+        NVCV_ASSERT(m_hostImagesBuffer != nullptr);
+
+        m_stagingImagesBuffer = static_cast<NVCVImageBufferStrided *>(
+            m_alloc->allocHostMem(slotCapacity * sizeof(NVCVImageBufferStrided), m_reqs.alignBytes));
+        NVCV_ASSERT(m_stagingImagesBuffer != nullptr);
 
-        m_devFormatsBuffer = static_cast<NVCVImageFormat *>(m_alloc->allocCudaMem(bufFormatsSize, m_reqs.alignBytes));
+        m_devFormatsBuffer = static_cast<NVCVImageFormat *>(
+            m_alloc->allocCudaMem(slotCapacity * sizeof(NVCVImageFormat), m_reqs.alignBytes));
         NVCV_ASSERT(m_devFormatsBuffer != nullptr);
 
         m_hostFormatsBuffer = static_cast<NVCVImageFormat *>(m_alloc->allocHostMem(bufFormatsSize, m_reqs.alignBytes));
-        NVCV_ASSERT(m_devFormatsBuffer != nullptr);
+        NVCV_ASSERT(m_hostFormatsBuffer != nullptr);
+
+        m_stagingFormatsBuffer = static_cast<NVCVImageFormat *>(
+            m_alloc->allocHostMem(slotCapacity * sizeof(NVCVImageFormat), m_reqs.alignBytes));
+        NVCV_ASSERT(m_stagingFormatsBuffer != nullptr);
 
         m_imgHandleBuffer = static_cast<NVCVImageHandle *>(m_alloc->allocHostMem(imgHandlesSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_imgHandleBuffer != nullptr);
-
-        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&m_evPostFence, cudaEventDisableTiming));
     }
     catch (...)
     {
-        if (m_evPostFence)
-        {
-            NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
-        }
-
-        m_alloc->freeCudaMem(m_devImagesBuffer, bufImagesSize, m_reqs.alignBytes);
-        m_alloc->freeHostMem(m_hostImagesBuffer, bufImagesSize, m_reqs.alignBytes);
-
-        m_alloc->freeCudaMem(m_devFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
-        m_alloc->freeHostMem(m_hostFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
-
-        m_alloc->freeHostMem(m_imgHandleBuffer, imgHandlesSize, m_reqs.alignBytes);
+        doFreeBuffers();
         throw;
     }
 }
 
 ImageBatchVarShape::~ImageBatchVarShape()
 {
-    NVCV_CHECK_LOG(cudaEventSynchronize(m_evPostFence));
+    // Pending uploads might still be reading from the buffers.
+    m_ring.waitAll();
     clear();
+    doFreeBuffers();
+}
 
+void ImageBatchVarShape::doFreeBuffers()
+{
+    int64_t slotCapacity   = (int64_t)m_reqs.ringDepth * m_reqs.capacity;
     int64_t bufImagesSize  = m_reqs.capacity * sizeof(NVCVImageBufferStrided);
     int64_t bufFormatsSize = m_reqs.capacity * sizeof(NVCVImageFormat);
     int64_t imgHandlesSize = m_reqs.capacity * sizeof(NVCVImageHandle);
 
-    m_alloc->freeCudaMem(m_devImagesBuffer, bufImagesSize, m_reqs.alignBytes);
+    m_alloc->freeCudaMem(m_devImagesBuffer, slotCapacity * sizeof(NVCVImageBufferStrided), m_reqs.alignBytes);
     m_alloc->freeHostMem(m_hostImagesBuffer, bufImagesSize, m_reqs.alignBytes);
+    m_alloc->freeHostMem(m_stagingImagesBuffer, slotCapacity * sizeof(NVCVImageBufferStrided), m_reqs.alignBytes);
 
-    m_alloc->freeCudaMem(m_devFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
+    m_alloc->freeCudaMem(m_devFormatsBuffer, slotCapacity * sizeof(NVCVImageFormat), m_reqs.alignBytes);
     m_alloc->freeHostMem(m_hostFormatsBuffer, bufFormatsSize, m_reqs.alignBytes);
+    m_alloc->freeHostMem(m_stagingFormatsBuffer, slotCapacity * sizeof(NVCVImageFormat), m_reqs.alignBytes);
 
     m_alloc->freeHostMem(m_imgHandleBuffer, imgHandlesSize, m_reqs.alignBytes);
-
-    NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
 }
 
 NVCVTypeImageBatch ImageBatchVarShape::type() const
@@ -217,32 +242,39 @@ void ImageBatchVarShape::exportData(CUstream stream, NVCVImageBatchData &data) c
     data.numImages  = m_numImages;
     data.bufferType = NVCV_IMAGE_BATCH_VARSHAPE_BUFFER_STRIDED_CUDA;
 
-    NVCVImageBatchVarShapeBufferStrided &buf = data.buffer.varShapeStrided;
-    buf.imageList                            = m_devImagesBuffer;
-    buf.formatList                           = m_devFormatsBuffer;
-    buf.hostFormatList                       = m_hostFormatsBuffer;
-
-    NVCV_ASSERT(m_dirtyStartingFromIndex <= m_numImages);
-
-    if (m_dirtyStartingFromIndex < m_numImages)
+    if (m_ring.isDirty())
     {
-        NVCV_CHECK_THROW(cudaStreamWaitEvent(stream, m_evPostFence));
+        // Only waits if the ring wrapped around to a slot whose upload is still pending.
+        DescriptorRing::Range dirty = m_ring.advance();
+        NVCV_ASSERT(dirty.end <= m_numImages);
+
+        int64_t                 offset     = (int64_t)m_ring.current() * m_reqs.capacity + dirty.begin;
+        int32_t                 count      = dirty.end - dirty.begin;
+        NVCVImageBufferStrided *stgImages  = m_stagingImagesBuffer + offset;
+        NVCVImageFormat        *stgFormats = m_stagingFormatsBuffer + offset;
 
-        NVCV_CHECK_THROW(cudaMemcpyAsync(
-            m_devImagesBuffer + m_dirtyStartingFromIndex, m_hostImagesBuffer + m_dirtyStartingFromIndex,
-            (m_numImages - m_dirtyStartingFromIndex) * sizeof(*m_devImagesBuffer), cudaMemcpyHostToDevice, stream));
+        std::copy_n(m_hostImagesBuffer + dirty.begin, count, stgImages);
+        std::copy_n(m_hostFormatsBuffer + dirty.begin, count, stgFormats);
 
-        NVCV_CHECK_THROW(cudaMemcpyAsync(
-            m_devFormatsBuffer + m_dirtyStartingFromIndex, m_hostFormatsBuffer + m_dirtyStartingFromIndex,
-            (m_numImages - m_dirtyStartingFromIndex) * sizeof(*m_devFormatsBuffer), cudaMemcpyHostToDevice, stream));
+        NVCV_CHECK_THROW(cudaMemcpyAsync(m_devImagesBuffer + offset, stgImages, count * sizeof(*stgImages),
+                                         cudaMemcpyHostToDevice, stream));
 
-        // Signal that we finished reading from m_hostBuffer
-        NVCV_CHECK_THROW(cudaEventRecord(m_evPostFence, stream));
+        NVCV_CHECK_THROW(cudaMemcpyAsync(m_devFormatsBuffer + offset, stgFormats, count * sizeof(*stgFormats),
+                                         cudaMemcpyHostToDevice, stream));
 
-        // up to m_numImages, we're all good
-        m_dirtyStartingFromIndex = m_numImages;
+        // Signal when we finished reading from the slot's staging buffers
+        m_ring.recordUpload(stream);
     }
 
+    // The current slot holds all images up to m_numImages, and won't be written to
+    // until the ring wraps around.
+    int64_t slotOffset = (int64_t)m_ring.current() * m_reqs.capacity;
+
+    NVCVImageBatchVarShapeBufferStrided &buf = data.buffer.varShapeStrided;
+    buf.imageList                            = m_devImagesBuffer + slotOffset;
+    buf.formatList                           = m_devFormatsBuffer + slotOffset;
+    buf.hostFormatList                       = m_stagingFormatsBuffer + slotOffset;
+
     doUpdateCache();
 
     NVCV_ASSERT(m_cacheMaxSize);
@@ -267,9 +299,6 @@ void ImageBatchVarShape::pushImages(const NVCVImageHandle *images, int32_t numIm
                         numImages + m_numImages, m_reqs.capacity);
     }
 
-    // Wait till m_hostBuffer is free to be written to (all pending reads are finished).
-    NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
-
     int oldNumImages = m_numImages;
 
     try
@@ -286,6 +315,8 @@ void ImageBatchVarShape::pushImages(const NVCVImageHandle *images, int32_t numIm
         m_numImages = oldNumImages;
         throw;
     }
+
+    m_ring.markDirty(oldNumImages, m_numImages);
 }
 
 void ImageBatchVarShape::pushImages(NVCVPushImageFunc cbPushImage, void *ctxCallback)
@@ -296,9 +327,6 @@ void ImageBatchVarShape::pushImages(NVCVPushImageFunc cbPushImage, void *ctxCall
                         "Callback function that adds images to the image batch cannot be NULL");
     }
 
-    // Wait till m_hostBuffer is free to be written to (all pending reads are finished).
-    NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
-
     int oldNumImages = m_numImages;
 
     try
@@ -320,6 +348,8 @@ void ImageBatchVarShape::pushImages(NVCVPushImageFunc cbPushImage, void *ctxCall
         m_numImages = oldNumImages;
         throw;
     }
+
+    m_ring.markDirty(oldNumImages, m_numImages);
 }
 
 void ImageBatchVarShape::doPushImage(NVCVImageHandle imgHandle)
@@ -393,10 +423,7 @@ void ImageBatchVarShape::popImages(int32_t numImages)
 
     m_numImages -= numImages;
 
-    if (m_dirtyStartingFromIndex > m_numImages)
-    {
-        m_dirtyStartingFromIndex = m_numImages;
-    }
+    m_ring.truncate(m_numImages);
 
     // Removing images invalidates size.
     m_cacheMaxSize = std::nullopt;
@@ -434,10 +461,10 @@ void ImageBatchVarShape::clear()
             m_imgHandleBuffer[i] = nullptr;
         }
     }
-    m_numImages              = 0;
-    m_dirtyStartingFromIndex = 0;
-    m_cacheMaxSize           = {0, 0};
-    m_cacheUniqueFormat      = std::nullopt;
+    m_numImages         = 0;
+    m_cacheMaxSize      = {0, 0};
+    m_cacheUniqueFormat = std::nullopt;
+    m_ring.truncate(0);
 }
 
 } // namespace nvcv::priv
@@ -18,6 +18,7 @@
 #ifndef NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_HPP
 #define NVCV_CORE_PRIV_IMAGEBATCHVARSHAPE_HPP
 
+#include "DescriptorRing.hpp"
 #include "IAllocator.hpp"
 #include "IImageBatch.hpp"
 #include "SharedCoreObj.hpp"
@@ -34,7 +35,8 @@ public:
     explicit ImageBatchVarShape(NVCVImageBatchVarShapeRequirements reqs, IAllocator &alloc);
     ~ImageBatchVarShape();
 
-    static NVCVImageBatchVarShapeRequirements CalcRequirements(int32_t capacity);
+    static NVCVImageBatchVarShapeRequirements CalcRequirements(
+        int32_t capacity, int32_t ringDepth = NVCV_IMAGE_BATCH_VARSHAPE_DEFAULT_RING_DEPTH);
 
     int32_t capacity() const override;
     int32_t numImages() const override;
@@ -59,13 +61,18 @@ private:
     SharedCoreObj<IAllocator>          m_alloc;
     NVCVImageBatchVarShapeRequirements m_reqs;
 
-    mutable int32_t m_dirtyStartingFromIndex;
+    // Host buffers are written to as images are pushed and are copied to the staging
+    // and device buffers of the next ring slot when data is exported.
+    // Staging and device buffers hold one block of capacity elements per slot.
+    mutable DescriptorRing m_ring;
 
     int32_t                 m_numImages;
     NVCVImageBufferStrided *m_hostImagesBuffer;
+    NVCVImageBufferStrided *m_stagingImagesBuffer;
     NVCVImageBufferStrided *m_devImagesBuffer;
 
     NVCVImageFormat *m_hostFormatsBuffer;
+    NVCVImageFormat *m_stagingFormatsBuffer;
     NVCVImageFormat *m_devFormatsBuffer;
 
     NVCVImageHandle *m_imgHandleBuffer;
@@ -77,11 +84,10 @@ private:
 
     void doUpdateCache() const;
 
-    // TODO: must be retrieved from the resource allocator;
-    cudaEvent_t m_evPostFence;
+    void doFreeBuffers();
 
     // Assumes there's enough space for image.
-    // Does not update dirty count
+    // Does not mark it dirty
     void doPushImage(NVCVImageHandle imgHandle);
 };
 
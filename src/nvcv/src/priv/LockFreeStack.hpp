@@ -20,112 +20,294 @@
 
 #include <atomic>
 #include <cassert>
-#include <stack>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
 
 namespace nvcv::priv {
 
 template<class T>
 constexpr bool IsForwardListNode = std::is_convertible_v<decltype(std::declval<T>().next), T *>;
 
+// Treiber stack whose head carries a modification counter (tag) next to the node
+// pointer, so that a pop racing with pop/push sequences that bring the same node
+// back to the top (ABA) fails its CAS instead of corrupting the list.
+// Head: TTTT.PPPP.PPPP.PPPP
+// T=tag, P=node address. User-space addresses fit in the lower 48 bits on
+// x86_64 and aarch64 by default.
+//
+// The 16-bit tag wraps around. A pop can still be fooled if, between reading the
+// head and its CAS, exactly a multiple of 65536 updates bring its node back to the
+// top. That needs the popping thread to be preempted in a window of a few
+// instructions while other threads churn the stack, a risk deemed acceptable.
+//
+// Addresses that don't fit in 48 bits (5-level paging, 52-bit VA on arm64, tagged
+// pointers) can't be packed. The first time one must become the head, the stack
+// moves for good to a mutex-guarded list, a slower but correct fallback.
+//
+// Nodes must remain allocated while other threads might still be popping them,
+// as a pop can read the next pointer of a node that was just taken by another
+// thread. It's the case for the handle managers, whose nodes are only freed on clear().
 template<class Node, std::enable_if_t<IsForwardListNode<Node>, int> = 0>
 class LockFreeStack
 {
 public:
     Node *pop() noexcept
     {
-        // Lock the stack's head so that we can pop current head and set the
-        // new one to curhead->next atomically below.
+        uint64_t oldHead = m_head.load(std::memory_order_acquire);
         for (;;)
         {
-            Node *head = doGetUnlocked(m_head.load(std::memory_order_relaxed));
-            if (!head)
+            if (oldHead == kLockedHead)
+            {
+                return doLockedPop(1, nullptr);
+            }
+
+            Node *node = doGetPtr(oldHead);
+            if (!node)
             {
                 return nullptr;
             }
 
-            if (m_head.compare_exchange_weak(head, doGetLocked(head), std::memory_order_relaxed,
-                                             std::memory_order_release))
+            Node *next = doLoadNext(node);
+            if (!doFits(next))
+            {
+                doSwitchToLocked(oldHead);
+                continue;
+            }
+
+            uint64_t newHead = doMakeHead(next, oldHead);
+            if (m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acquire, std::memory_order_acquire))
             {
-                break;
+                return node;
             }
         }
+    }
 
-        // Set the newHead to oldHead->next and return oldHead
-        Node *oldHead, *newHead;
-        do
+    /** Pops up to maxCount nodes at once.
+     *
+     * @return The first node of a null-terminated list with the popped nodes, in stack order,
+     *         or nullptr if the stack is empty.
+     */
+    Node *popStack(int32_t maxCount, int32_t *outCount = nullptr) noexcept
+    {
+        assert(maxCount > 0);
+
+        uint64_t oldHead = m_head.load(std::memory_order_acquire);
+        for (;;)
         {
-            oldHead = m_head.load(std::memory_order_relaxed);
-            assert(doGetLocked(oldHead)); // must have been locked above
+            if (oldHead == kLockedHead)
+            {
+                return doLockedPop(maxCount, outCount);
+            }
 
-            newHead = doGetUnlocked(oldHead)->next;
-        }
-        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_relaxed, std::memory_order_release));
+            Node *first = doGetPtr(oldHead);
+            if (!first)
+            {
+                if (outCount)
+                {
+                    *outCount = 0;
+                }
+                return nullptr;
+            }
 
-        return doGetUnlocked(oldHead);
+            // The walked chain might be stale, but then the head's tag will have
+            // changed and the CAS below will fail.
+            Node   *last  = first;
+            int32_t count = 1;
+            for (Node *n; count < maxCount && (n = doLoadNext(last)) != nullptr; ++count)
+            {
+                last = n;
+            }
+
+            Node *next = doLoadNext(last);
+            if (!doFits(next))
+            {
+                doSwitchToLocked(oldHead);
+                continue;
+            }
+
+            uint64_t newHead = doMakeHead(next, oldHead);
+            if (m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                Link(last, nullptr);
+                if (outCount)
+                {
+                    *outCount = count;
+                }
+                return first;
+            }
+        }
     }
 
     void push(Node *newNode) noexcept
     {
-        Node *oldHead;
-        do
-        {
-            oldHead       = doGetUnlocked(m_head.load(std::memory_order_relaxed));
-            newNode->next = oldHead;
-        }
-        while (!m_head.compare_exchange_weak(oldHead, newNode, std::memory_order_relaxed, std::memory_order_release));
+        pushStack(newNode, newNode);
     }
 
     Node *release() noexcept
     {
-        Node *h = m_head.load(std::memory_order_relaxed);
-        while (!m_head.compare_exchange_weak(h, nullptr, std::memory_order_relaxed, std::memory_order_release))
+        uint64_t oldHead = m_head.load(std::memory_order_acquire);
+        for (;;)
         {
-        }
+            if (oldHead == kLockedHead)
+            {
+                std::lock_guard lock(m_mutex);
+                Node           *head = m_lockedHead;
+                m_lockedHead         = nullptr;
+                return head;
+            }
 
-        return h;
+            if (m_head.compare_exchange_weak(oldHead, doMakeHead(nullptr, oldHead), std::memory_order_acquire,
+                                             std::memory_order_acquire))
+            {
+                return doGetPtr(oldHead);
+            }
+        }
     }
 
+    // Pushes the already linked list [newHead, last] in one go.
     void pushStack(Node *newHead, Node *last) noexcept
     {
-        Node *oldHead;
-        do
+        uint64_t oldHead = m_head.load(std::memory_order_relaxed);
+        for (;;)
         {
-            oldHead    = doGetUnlocked(m_head.load(std::memory_order_relaxed));
-            last->next = oldHead;
+            if (oldHead == kLockedHead)
+            {
+                std::lock_guard lock(m_mutex);
+                Link(last, m_lockedHead);
+                m_lockedHead = newHead;
+                return;
+            }
+
+            if (!doFits(newHead))
+            {
+                doSwitchToLocked(oldHead);
+                continue;
+            }
+
+            Link(last, doGetPtr(oldHead));
+            if (m_head.compare_exchange_weak(oldHead, doMakeHead(newHead, oldHead), std::memory_order_release,
+                                             std::memory_order_relaxed))
+            {
+                return;
+            }
         }
-        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_relaxed, std::memory_order_release));
     }
 
     Node *top() const
     {
-        return doGetUnlocked(m_head.load());
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        if (head == kLockedHead)
+        {
+            std::lock_guard lock(m_mutex);
+            return m_lockedHead;
+        }
+        return doGetPtr(head);
     }
 
     void clear()
     {
-        m_head = nullptr;
+        release();
     }
 
     bool empty() const
     {
-        return m_head == nullptr;
+        return top() == nullptr;
+    }
+
+    // Moves the stack to the mutex-guarded list now, as if a node address didn't fit in the
+    // head. Lets tests exercise the fallback on systems where every address fits.
+    void switchToLocked() noexcept
+    {
+        uint64_t oldHead = m_head.load(std::memory_order_acquire);
+        while (oldHead != kLockedHead)
+        {
+            doSwitchToLocked(oldHead);
+        }
+    }
+
+    // Sets node->next. Nodes that might be in the stack recently must be linked with it
+    // before pushStack, a concurrent pop could still be reading their next pointer.
+    static void Link(Node *node, Node *next) noexcept
+    {
+        __atomic_store_n(&node->next, next, __ATOMIC_RELAXED);
     }
 
 private:
-    std::atomic<Node *> m_head = nullptr;
+    static_assert(sizeof(void *) == sizeof(uint64_t), "Tagged head requires 64-bit pointers");
+    static_assert(alignof(Node) >= 2, "Lowest address bit is used to flag the locked head");
+    static constexpr int      kPtrBits = 48;
+    static constexpr uint64_t kPtrMask = (uint64_t(1) << kPtrBits) - 1;
+
+    // Head value once the stack moved to the locked list, never a valid tagged head
+    // as node addresses are even.
+    static constexpr uint64_t kLockedHead = 1;
+
+    std::atomic<uint64_t> m_head = 0;
+
+    mutable std::mutex m_mutex;
+    Node              *m_lockedHead = nullptr; // guarded by m_mutex once m_head is kLockedHead
+
+    static bool doFits(Node *node) noexcept
+    {
+        return (reinterpret_cast<uint64_t>(node) & ~kPtrMask) == 0;
+    }
 
-    template<typename T>
-    static T *doGetUnlocked(T *maybe_locked)
+    static Node *doGetPtr(uint64_t head) noexcept
     {
-        static_assert(alignof(Node) >= 2);
-        return reinterpret_cast<T *>(reinterpret_cast<intptr_t>(maybe_locked) & -2);
+        return reinterpret_cast<Node *>(head & kPtrMask);
+    }
+
+    // New head pointing to node, with the tag of the previous head incremented.
+    // The node must fit in kPtrBits.
+    static uint64_t doMakeHead(Node *node, uint64_t prevHead) noexcept
+    {
+        uint64_t tag = (prevHead >> kPtrBits) + 1;
+        return (tag << kPtrBits) | reinterpret_cast<uint64_t>(node);
+    }
+
+    // Moves the list starting at oldHead to the locked list. On return oldHead holds the
+    // current head, kLockedHead if this or another thread moved the list already.
+    void doSwitchToLocked(uint64_t &oldHead) noexcept
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_head.compare_exchange_strong(oldHead, kLockedHead, std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+        {
+            m_lockedHead = doGetPtr(oldHead);
+            oldHead      = kLockedHead;
+        }
+    }
+
+    Node *doLockedPop(int32_t maxCount, int32_t *outCount) noexcept
+    {
+        std::lock_guard lock(m_mutex);
+
+        Node   *first = m_lockedHead;
+        Node   *last  = first;
+        int32_t count = first ? 1 : 0;
+        for (Node *n; count > 0 && count < maxCount && (n = doLoadNext(last)) != nullptr; ++count)
+        {
+            last = n;
+        }
+
+        if (first)
+        {
+            m_lockedHead = doLoadNext(last);
+            Link(last, nullptr);
+        }
+        if (outCount)
+        {
+            *outCount = count;
+        }
+        return first;
     }
 
-    template<typename T>
-    static T *doGetLocked(T *maybe_unlocked)
+    // 'next' of a node being popped can be written concurrently by the thread that
+    // popped it first, these accesses must be atomic.
+    static Node *doLoadNext(Node *node) noexcept
     {
-        static_assert(alignof(Node) >= 2);
-        return reinterpret_cast<T *>(reinterpret_cast<intptr_t>(maybe_unlocked) | 1);
+        return __atomic_load_n(&node->next, __ATOMIC_RELAXED);
     }
 };
 
@@ -0,0 +1,495 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PoolAllocator.hpp"
+
+#include "Exception.hpp"
+
+#include <nvcv/util/Math.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib> // for aligned_alloc
+#include <mutex>
+#include <vector>
+
+namespace nvcv::priv {
+
+namespace {
+
+constexpr int64_t kDefaultMaxHeldBytes      = int64_t(256) << 20;
+constexpr int64_t kDefaultMaxBlockSize      = int64_t(64) << 20;
+constexpr int32_t kDefaultThreadCacheBlocks = 8;
+
+// Smallest block must be able to hold the free list link.
+constexpr int kMinSizeClass = 4;
+
+// Free blocks are linked through their own storage.
+struct FreeBlock
+{
+    FreeBlock *next;
+};
+
+std::atomic<uint64_t> g_nextPoolId{1};
+
+constexpr int64_t BlockSize(int cls)
+{
+    return int64_t(1) << cls;
+}
+
+constexpr int32_t BlockAlignment(int cls)
+{
+    return (int32_t)std::min<int64_t>(BlockSize(cls), PoolAllocator::kMaxBlockAlignment);
+}
+
+void FreeList(FreeBlock *head) noexcept
+{
+    while (head != nullptr)
+    {
+        FreeBlock *next = head->next;
+        std::free(head);
+        head = next;
+    }
+}
+
+struct ThreadCache;
+
+} // namespace
+
+struct PoolAllocator::Pool
+{
+    NVCVPoolAllocatorParams params;
+    int                     maxSizeClass;
+    uint64_t                id = g_nextPoolId.fetch_add(1, std::memory_order_relaxed);
+
+    std::mutex mtx;
+    FreeBlock *globalFree[kNumSizeClasses] = {};
+
+    // Thread caches holding blocks of this pool, guarded by mtx, so that they can be
+    // drained when the pool is destroyed instead of when their threads exit.
+    std::vector<ThreadCache *> threadCaches;
+
+    std::atomic<int64_t> numHits{0};
+    std::atomic<int64_t> numMisses{0};
+    std::atomic<int64_t> numTrimmed{0};
+    std::atomic<int64_t> bytesHeld{0};
+    std::atomic<int64_t> peakBytesHeld{0};
+
+    ~Pool()
+    {
+        for (FreeBlock *head : globalFree)
+        {
+            FreeList(head);
+        }
+    }
+
+    // Reserves room for a block in the pool, returns false if it would go past the high-water mark.
+    bool reserve(int64_t size) noexcept
+    {
+        int64_t held = bytesHeld.fetch_add(size, std::memory_order_relaxed) + size;
+        if (held > params.maxHeldBytes)
+        {
+            bytesHeld.fetch_sub(size, std::memory_order_relaxed);
+            return false;
+        }
+
+        int64_t peak = peakBytesHeld.load(std::memory_order_relaxed);
+        while (held > peak && !peakBytesHeld.compare_exchange_weak(peak, held, std::memory_order_relaxed))
+        {
+        }
+        return true;
+    }
+
+    void pushGlobal(int cls, FreeBlock *blk) noexcept
+    {
+        std::unique_lock lk(mtx);
+        blk->next       = globalFree[cls];
+        globalFree[cls] = blk;
+    }
+
+    FreeBlock *popGlobal(int cls) noexcept
+    {
+        std::unique_lock lk(mtx);
+        FreeBlock       *blk = globalFree[cls];
+        if (blk != nullptr)
+        {
+            globalFree[cls] = blk->next;
+        }
+        return blk;
+    }
+
+    // Moves the blocks of all thread caches to the global free lists, must be called with mtx held.
+    void drainThreadCaches() noexcept;
+};
+
+namespace {
+
+// Free lists of one thread for one pool.
+struct ThreadCache
+{
+    explicit ThreadCache(const std::shared_ptr<PoolAllocator::Pool> &pool_)
+        : pool(pool_)
+        , poolId(pool_->id)
+    {
+    }
+
+    ~ThreadCache()
+    {
+        // Hands the blocks over to the global free lists, or releases them if the pool is gone.
+        // A pool being destroyed drains its thread caches first, so they are empty by then.
+        if (std::shared_ptr<PoolAllocator::Pool> p = pool.lock())
+        {
+            std::unique_lock lk(p->mtx);
+            spliceInto(p->globalFree);
+            p->threadCaches.erase(std::find(p->threadCaches.begin(), p->threadCaches.end(), this));
+        }
+        else
+        {
+            for (FreeBlock *blk : head)
+            {
+                FreeList(blk);
+            }
+        }
+    }
+
+    // Moves the blocks in front of the given lists, leaving the cache empty.
+    void spliceInto(FreeBlock *(&lists)[PoolAllocator::kNumSizeClasses]) noexcept
+    {
+        for (int cls = 0; cls < PoolAllocator::kNumSizeClasses; ++cls)
+        {
+            if (FreeBlock *tail = head[cls])
+            {
+                while (tail->next != nullptr)
+                {
+                    tail = tail->next;
+                }
+                tail->next = lists[cls];
+                lists[cls] = head[cls];
+                head[cls]  = nullptr;
+                count[cls] = 0;
+            }
+        }
+    }
+
+    std::weak_ptr<PoolAllocator::Pool> pool;
+    uint64_t                           poolId;
+
+    FreeBlock *head[PoolAllocator::kNumSizeClasses]  = {};
+    int32_t    count[PoolAllocator::kNumSizeClasses] = {};
+};
+
+ThreadCache *GetThreadCache(const std::shared_ptr<PoolAllocator::Pool> &pool, bool create)
+{
+    thread_local std::vector<std::unique_ptr<ThreadCache>> caches;
+
+    for (auto &c : caches)
+    {
+        if (c->poolId == pool->id)
+        {
+            return c.get();
+        }
+    }
+
+    if (!create)
+    {
+        return nullptr;
+    }
+
+    // Release the caches of pools that were destroyed before adding a new one.
+    caches.erase(std::remove_if(caches.begin(), caches.end(), [](auto &c) { return c->pool.expired(); }),
+                 caches.end());
+
+    caches.push_back(std::make_unique<ThreadCache>(pool));
+    try
+    {
+        std::unique_lock lk(pool->mtx);
+        pool->threadCaches.push_back(caches.back().get());
+    }
+    catch (...)
+    {
+        caches.pop_back();
+        throw;
+    }
+    return caches.back().get();
+}
+
+} // namespace
+
+void PoolAllocator::Pool::drainThreadCaches() noexcept
+{
+    for (ThreadCache *tc : threadCaches)
+    {
+        tc->spliceInto(globalFree);
+    }
+}
+
+PoolAllocator::PoolAllocator(const NVCVPoolAllocatorParams *params)
+{
+    NVCVPoolAllocatorParams p = {};
+    if (params != nullptr)
+    {
+        p = *params;
+    }
+
+    if (p.maxHeldBytes < 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Maximum held bytes must be >= 0, not %ld", p.maxHeldBytes);
+    }
+    if (p.maxBlockSize < 0 || (p.maxBlockSize != 0 && !util::IsPowerOfTwo(p.maxBlockSize)))
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Maximum block size must be a power of two, not %ld",
+                        p.maxBlockSize);
+    }
+    if (p.maxBlockSize >= BlockSize(kNumSizeClasses))
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Maximum block size must be < %ld, not %ld",
+                        BlockSize(kNumSizeClasses), p.maxBlockSize);
+    }
+    if (p.threadCacheBlocks < 0)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Number of thread-cached blocks must be >= 0, not %d",
+                        p.threadCacheBlocks);
+    }
+
+    if (p.maxHeldBytes == 0)
+    {
+        p.maxHeldBytes = kDefaultMaxHeldBytes;
+    }
+    if (p.maxBlockSize == 0)
+    {
+        p.maxBlockSize = kDefaultMaxBlockSize;
+    }
+    if (p.threadCacheBlocks == 0)
+    {
+        p.threadCacheBlocks = kDefaultThreadCacheBlocks;
+    }
+
+    m_pool               = std::make_shared<Pool>();
+    m_pool->params       = p;
+    m_pool->maxSizeClass = util::ILog2(p.maxBlockSize);
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    // The allocator isn't used anymore by any thread, so the blocks cached by all threads
+    // can be taken back and released with the global ones.
+    {
+        std::unique_lock lk(m_pool->mtx);
+        m_pool->drainThreadCaches();
+    }
+    trim();
+}
+
+const NVCVPoolAllocatorParams &PoolAllocator::params() const noexcept
+{
+    return m_pool->params;
+}
+
+int PoolAllocator::sizeClass(int64_t size, int32_t align) const noexcept
+{
+    if (align > kMaxBlockAlignment || size > m_pool->params.maxBlockSize)
+    {
+        return -1;
+    }
+
+    int64_t blockSize = std::max<int64_t>({size, align, BlockSize(kMinSizeClass)});
+    int     cls       = util::ILog2(blockSize);
+    if (BlockSize(cls) != blockSize)
+    {
+        ++cls;
+    }
+
+    return cls <= m_pool->maxSizeClass ? cls : -1;
+}
+
+NVCVPoolAllocatorStats PoolAllocator::stats() const noexcept
+{
+    NVCVPoolAllocatorStats s;
+    s.numHits       = m_pool->numHits.load(std::memory_order_relaxed);
+    s.numMisses     = m_pool->numMisses.load(std::memory_order_relaxed);
+    s.numTrimmed    = m_pool->numTrimmed.load(std::memory_order_relaxed);
+    s.bytesHeld     = m_pool->bytesHeld.load(std::memory_order_relaxed);
+    s.peakBytesHeld = m_pool->peakBytesHeld.load(std::memory_order_relaxed);
+    return s;
+}
+
+void PoolAllocator::trim() noexcept
+{
+    Pool &pool = *m_pool;
+
+    FreeBlock *lists[kNumSizeClasses];
+    {
+        std::unique_lock lk(pool.mtx);
+        std::copy(std::begin(pool.globalFree), std::end(pool.globalFree), lists);
+        std::fill(std::begin(pool.globalFree), std::end(pool.globalFree), nullptr);
+    }
+
+    if (ThreadCache *tc = GetThreadCache(m_pool, false))
+    {
+        tc->spliceInto(lists);
+    }
+
+    for (int cls = 0; cls < kNumSizeClasses; ++cls)
+    {
+        for (FreeBlock *blk = lists[cls]; blk != nullptr;)
+        {
+            FreeBlock *next = blk->next;
+            std::free(blk);
+            pool.bytesHeld.fetch_sub(BlockSize(cls), std::memory_order_relaxed);
+            pool.numTrimmed.fetch_add(1, std::memory_order_relaxed);
+            blk = next;
+        }
+    }
+}
+
+void *PoolAllocator::doAllocHostMem(int64_t size, int32_t align)
+{
+    Pool &pool = *m_pool;
+
+    int cls = this->sizeClass(size, align);
+    if (cls < 0)
+    {
+        pool.numMisses.fetch_add(1, std::memory_order_relaxed);
+        return std::aligned_alloc(align, size);
+    }
+
+    FreeBlock *blk = nullptr;
+
+    ThreadCache *tc = GetThreadCache(m_pool, true);
+    if ((blk = tc->head[cls]) != nullptr)
+    {
+        tc->head[cls] = blk->next;
+        --tc->count[cls];
+    }
+    else
+    {
+        blk = pool.popGlobal(cls);
+    }
+
+    if (blk != nullptr)
+    {
+        pool.bytesHeld.fetch_sub(BlockSize(cls), std::memory_order_relaxed);
+        pool.numHits.fetch_add(1, std::memory_order_relaxed);
+        return blk;
+    }
+
+    pool.numMisses.fetch_add(1, std::memory_order_relaxed);
+    return std::aligned_alloc(BlockAlignment(cls), BlockSize(cls));
+}
+
+void PoolAllocator::doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    Pool &pool = *m_pool;
+
+    int cls = this->sizeClass(size, align);
+    if (cls < 0)
+    {
+        std::free(ptr);
+        return;
+    }
+
+    if (!pool.reserve(BlockSize(cls)))
+    {
+        pool.numTrimmed.fetch_add(1, std::memory_order_relaxed);
+        std::free(ptr);
+        return;
+    }
+
+    FreeBlock *blk = static_cast<FreeBlock *>(ptr);
+
+    ThreadCache *tc = nullptr;
+    try
+    {
+        tc = GetThreadCache(m_pool, true);
+    }
+    catch (...)
+    {
+        // Couldn't create the thread cache, the global list will do.
+    }
+
+    if (tc != nullptr && tc->count[cls] < pool.params.threadCacheBlocks)
+    {
+        blk->next     = tc->head[cls];
+        tc->head[cls] = blk;
+        ++tc->count[cls];
+    }
+    else
+    {
+        pool.pushGlobal(cls, blk);
+    }
+}
+
+void *PoolAllocator::doAllocHostPinnedMem(int64_t size, int32_t align)
+{
+    return GetDefaultAllocator().allocHostPinnedMem(size, align);
+}
+
+void PoolAllocator::doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    GetDefaultAllocator().freeHostPinnedMem(ptr, size, align);
+}
+
+void *PoolAllocator::doAllocCudaMem(int64_t size, int32_t align)
+{
+    return GetDefaultAllocator().allocCudaMem(size, align);
+}
+
+void PoolAllocator::doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept
+{
+    GetDefaultAllocator().freeCudaMem(ptr, size, align);
+}
+
+NVCVResourceAllocator PoolAllocator::doGet(NVCVResourceType resType)
+{
+    NVCVResourceAllocator custAllocator = {};
+    custAllocator.ctx                   = this;
+    custAllocator.resType               = resType;
+
+    switch (resType)
+    {
+    case NVCV_RESOURCE_MEM_HOST:
+        static auto poolAllocHostMem = [](void *ctx, int64_t size, int32_t align)
+        {
+            auto *self = static_cast<PoolAllocator *>(ctx);
+            return self->allocHostMem(size, align);
+        };
+        static auto poolFreeHostMem = [](void *ctx, void *ptr, int64_t size, int32_t align)
+        {
+            auto *self = static_cast<PoolAllocator *>(ctx);
+            return self->freeHostMem(ptr, size, align);
+        };
+        custAllocator.res.mem.fnAlloc = poolAllocHostMem;
+        custAllocator.res.mem.fnFree  = poolFreeHostMem;
+        break;
+
+    case NVCV_RESOURCE_MEM_CUDA:
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        return GetDefaultAllocator().get(resType);
+
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown resource type: " << resType << ".";
+    }
+
+    return custAllocator;
+}
+
+} // namespace nvcv::priv
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_CORE_PRIV_POOL_ALLOCATOR_HPP
+#define NVCV_CORE_PRIV_POOL_ALLOCATOR_HPP
+
+#include "IAllocator.hpp"
+
+#include <nvcv/alloc/Allocator.h>
+#include <nvcv/alloc/Requirements.h>
+
+#include <memory>
+
+namespace nvcv::priv {
+
+// Allocator that recycles host memory blocks bucketed by power-of-two size class.
+// Freed blocks go to a per-thread free list first, then to a global one guarded by a mutex.
+// Host-pinned and cuda memory are forwarded to the default allocator.
+class PoolAllocator final : public CoreObjectBase<IAllocator>
+{
+public:
+    // Same indexing as NVCVMemRequirements::numBlocks, i.e. log2(blockSize).
+    static constexpr int kNumSizeClasses = NVCV_MAX_MEM_REQUIREMENTS_LOG2_BLOCK_SIZE;
+
+    // Pooled blocks are aligned to min(blockSize, kMaxBlockAlignment).
+    // Requests that need stronger alignment bypass the pool.
+    static constexpr int32_t kMaxBlockAlignment = 4096;
+
+    explicit PoolAllocator(const NVCVPoolAllocatorParams *params);
+    ~PoolAllocator();
+
+    NVCVPoolAllocatorStats stats() const noexcept;
+
+    // Releases the blocks in the global free lists and in the calling thread's free lists.
+    void trim() noexcept;
+
+    const NVCVPoolAllocatorParams &params() const noexcept;
+
+    // Returns the size class a request is served from, or -1 if it isn't pooled.
+    int sizeClass(int64_t size, int32_t align) const noexcept;
+
+    struct Pool;
+
+private:
+    std::shared_ptr<Pool> m_pool;
+
+    void *doAllocHostMem(int64_t size, int32_t align) override;
+    void  doFreeHostMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    void *doAllocHostPinnedMem(int64_t size, int32_t align) override;
+    void  doFreeHostPinnedMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    void *doAllocCudaMem(int64_t size, int32_t align) override;
+    void  doFreeCudaMem(void *ptr, int64_t size, int32_t align) noexcept override;
+
+    NVCVResourceAllocator doGet(NVCVResourceType resType) override;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_CORE_PRIV_POOL_ALLOCATOR_HPP
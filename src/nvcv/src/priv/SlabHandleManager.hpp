@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PRIV_CORE_SLAB_HANDLE_MANAGER_HPP
+#define NVCV_PRIV_CORE_SLAB_HANDLE_MANAGER_HPP
+
+#include "HandleManager.hpp"
+
+#include <limits>
+
+namespace nvcv::priv {
+
+// Handle manager whose handles encode a slot index and a 32-bit generation
+// instead of the resource address, so that a slot can be reused ~4 billion times
+// before a stale handle aliases a live object.
+// Handle: GGGG.GGGG.IIII.IIII
+// G=generation, I=slot index + 1 (so that a valid handle is never 0)
+//
+// Slots are stored in contiguous slabs of kSlabSize entries, an index is mapped
+// to its slot in O(1) through a two-level slab directory that grows along with the
+// slabs, without walking the list of slabs. Freed slots are kept in a small
+// per-thread cache before going back to the shared lock-free stack.
+template<typename Interface>
+class SlabHandleManager
+{
+public:
+    using HandleType = GetHandleType<Interface>;
+
+    static_assert(sizeof(HandleType) == sizeof(uint64_t), "Handle must be able to hold index and generation");
+
+    static constexpr int     kLog2SlabSize    = 10;
+    static constexpr int32_t kSlabSize        = 1 << kLog2SlabSize;
+    static constexpr int32_t kMaxHandles      = std::numeric_limits<int32_t>::max();
+    static constexpr int32_t kThreadCacheSize = 32;
+
+private:
+    struct SlotBase
+    {
+        std::atomic<uint32_t> generation{0};
+        uint32_t              index = 0;
+
+        SlotBase *next = nullptr;
+
+        template<class T, typename... Args>
+        T *constructObject(Args &&...args)
+        {
+            static_assert(std::is_base_of_v<Interface, T>);
+
+            using Storage = typename ResourceStorage<Interface>::type;
+            static_assert(sizeof(Storage) >= sizeof(T));
+            static_assert(alignof(Storage) % alignof(T) == 0);
+
+            NVCV_ASSERT(!this->live());
+            T *obj         = new (getStorage()) T{std::forward<Args>(args)...};
+            this->m_ptrObj = obj;
+
+            // Generation 0 is never handed out, it marks a slot that was never used.
+            uint32_t gen = this->generation.load(std::memory_order_relaxed) + 1;
+            this->generation.store(gen != 0 ? gen : 1, std::memory_order_relaxed);
+
+            NVCV_ASSERT(this->live());
+
+            return obj;
+        }
+
+        void destroyObject();
+
+        int decRef()
+        {
+            return --m_refCount;
+        }
+
+        int incRef()
+        {
+            return ++m_refCount;
+        }
+
+        int refCount()
+        {
+            return m_refCount;
+        }
+
+        Interface *obj() const
+        {
+            return m_ptrObj;
+        }
+
+        bool live() const
+        {
+            return m_ptrObj != nullptr;
+        }
+
+    protected:
+        void *getStorage();
+
+        ~SlotBase();
+        Interface      *m_ptrObj = nullptr;
+        std::atomic_int m_refCount{0};
+    };
+
+public:
+    SlabHandleManager(const char *name);
+    ~SlabHandleManager();
+
+    template<class T, typename... Args>
+    std::pair<HandleType, T *> create(Args &&...args)
+    {
+        SlotBase *slot = doFetchFreeSlot();
+        try
+        {
+            T *obj = slot->template constructObject<T>(std::forward<Args>(args)...);
+            return std::make_pair(doGetHandleFromSlot(slot), obj); // noexcept
+        }
+        catch (...)
+        {
+            // If object ctor threw an exception, we must return
+            // the slot we would have used for it.
+            slot->decRef();
+            doReturnSlot(slot);
+            throw;
+        }
+    }
+
+    /** Decrements the reference count of the object pointed to by the handle and destroys
+     *  it if no longer referenced
+     *
+     * @return The remaining reference count if the handle is valid, 0 if the object is destroyed.
+     */
+    int decRef(HandleType handle);
+
+    /** Increments the reference count of the object pointed to by the handle.
+     *
+     * @return The new reference count.
+     */
+    int incRef(HandleType handle);
+
+    /** Returns the current reference count of the object pointed to by the handle;
+     */
+    int refCount(HandleType handle);
+
+    Interface *validate(HandleType handle) const;
+
+    void setFixedSize(int32_t maxSize);
+    void setDynamicSize(int32_t minSize = 0);
+
+    void clear();
+
+private:
+    struct Impl;
+    // Shared with the per-thread caches, so that they can tell when the manager is gone.
+    std::shared_ptr<Impl> pimpl;
+
+    void doAllocate(int32_t count);
+    void doGrow();
+
+    SlotBase *getValidSlot(HandleType handle) const;
+
+    SlotBase  *doFetchFreeSlot();
+    void       doReturnSlot(SlotBase *s) noexcept;
+    HandleType doGetHandleFromSlot(SlotBase *s) const noexcept;
+    int32_t    doCountLiveSlots() const;
+};
+
+} // namespace nvcv::priv
+
+#endif // NVCV_PRIV_CORE_SLAB_HANDLE_MANAGER_HPP
@@ -0,0 +1,598 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_PRIV_CORE_SLAB_HANDLE_MANAGER_IMPL_HPP
+#define NVCV_PRIV_CORE_SLAB_HANDLE_MANAGER_IMPL_HPP
+
+#include "Exception.hpp"
+#include "HandleManager.hpp"
+#include "HandleManagerImpl.hpp" // for LEAK_DETECTION_ENVVAR
+#include "LockFreeStack.hpp"
+#include "SlabHandleManager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+namespace nvcv::priv {
+
+template<typename Interface>
+SlabHandleManager<Interface>::SlotBase::~SlotBase()
+{
+    assert(m_ptrObj == nullptr && "Internal error - the object must be destroyed by ~Slot");
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::SlotBase::destroyObject()
+{
+    if (m_ptrObj)
+    {
+        m_ptrObj->~Interface();
+        m_ptrObj = nullptr;
+    }
+
+    NVCV_ASSERT(!this->live());
+}
+
+template<class Interface>
+void *SlabHandleManager<Interface>::SlotBase::getStorage()
+{
+    using Slot = typename SlabHandleManager<Interface>::Impl::Slot;
+    return static_cast<Slot *>(this)->getStorage();
+}
+
+template<typename Interface>
+struct SlabHandleManager<Interface>::Impl
+{
+    using Storage = typename ResourceStorage<Interface>::type;
+
+    class Slot : public SlotBase
+    {
+    public:
+        ~Slot()
+        {
+            this->destroyObject();
+        }
+
+        void *getStorage()
+        {
+            return m_storage;
+        }
+
+    private:
+        alignas(Storage) std::byte m_storage[sizeof(Storage)];
+    };
+
+    static constexpr int kMinHandles = 1024;
+
+    // The slab directory is split in chunks of kDirSize slabs, allocated when their first slab is.
+    static constexpr int     kLog2DirSize = 8;
+    static constexpr int32_t kDirSize     = 1 << kLog2DirSize;
+    static constexpr int32_t kMaxDirs     = (int32_t)(((int64_t)kMaxHandles + ((int64_t)kSlabSize << kLog2DirSize) - 1)
+                                                  >> (kLog2SlabSize + kLog2DirSize));
+
+    struct SlabDir
+    {
+        std::atomic<Slot *> slabs[kDirSize] = {};
+    };
+
+    // Free slots of one thread, for one manager.
+    struct ThreadCache
+    {
+        std::weak_ptr<Impl> owner;
+        uint64_t            ownerId = 0;
+        uint64_t            epoch   = 0;
+
+        SlotBase *slots[kThreadCacheSize];
+        int32_t   count = 0;
+
+        ~ThreadCache()
+        {
+            // Slots of a manager that was cleared or destroyed meanwhile are simply forgotten.
+            if (std::shared_ptr<Impl> impl = owner.lock())
+            {
+                if (count > 0 && impl->epoch.load(std::memory_order_relaxed) == epoch)
+                {
+                    impl->pushChain(slots, count);
+                }
+            }
+        }
+    };
+
+    static ThreadCache *GetThreadCache(const std::shared_ptr<Impl> &impl)
+    {
+        thread_local std::vector<std::unique_ptr<ThreadCache>> caches;
+
+        ThreadCache *tc = nullptr;
+        for (auto &c : caches)
+        {
+            if (c->ownerId == impl->id)
+            {
+                tc = c.get();
+                break;
+            }
+        }
+
+        if (tc == nullptr)
+        {
+            caches.erase(std::remove_if(caches.begin(), caches.end(), [](auto &c) { return c->owner.expired(); }),
+                         caches.end());
+
+            caches.push_back(std::make_unique<ThreadCache>());
+            tc          = caches.back().get();
+            tc->owner   = impl;
+            tc->ownerId = impl->id;
+            tc->epoch   = impl->epoch.load(std::memory_order_relaxed);
+        }
+
+        // Manager was cleared, the cached slots don't exist anymore.
+        uint64_t epoch = impl->epoch.load(std::memory_order_relaxed);
+        if (tc->epoch != epoch)
+        {
+            tc->epoch = epoch;
+            tc->count = 0;
+        }
+
+        return tc;
+    }
+
+    // Links the slots together and pushes them to the shared free stack in one go.
+    void pushChain(SlotBase **slots, int32_t count) noexcept
+    {
+        NVCV_ASSERT(count > 0);
+        for (int32_t i = 0; i < count - 1; ++i)
+        {
+            LockFreeStack<SlotBase>::Link(slots[i], slots[i + 1]);
+        }
+        freeSlots.pushStack(slots[0], slots[count - 1]);
+    }
+
+    SlotBase *slotAt(uint32_t index) const noexcept
+    {
+        uint32_t slabIdx = index >> kLog2SlabSize;
+        uint32_t dirIdx  = slabIdx >> kLog2DirSize;
+        if (dirIdx >= (uint32_t)kMaxDirs)
+        {
+            return nullptr;
+        }
+
+        SlabDir *dir = dirs[dirIdx].load(std::memory_order_acquire);
+        if (dir == nullptr)
+        {
+            return nullptr;
+        }
+
+        Slot *slab = dir->slabs[slabIdx & (kDirSize - 1)].load(std::memory_order_acquire);
+        return slab ? &slab[index & (kSlabSize - 1)] : nullptr;
+    }
+
+    // Makes the slab visible to slotAt, creating its directory chunk if needed.
+    void publishSlab(int64_t slabIdx, Slot *slab)
+    {
+        int64_t dirIdx = slabIdx >> kLog2DirSize;
+        if (dirIdx >= (int64_t)dirStorage.size())
+        {
+            dirStorage.resize(dirIdx + 1);
+        }
+        if (dirStorage[dirIdx] == nullptr)
+        {
+            dirStorage[dirIdx] = std::make_unique<SlabDir>();
+            dirs[dirIdx].store(dirStorage[dirIdx].get(), std::memory_order_release);
+        }
+        dirStorage[dirIdx]->slabs[slabIdx & (kDirSize - 1)].store(slab, std::memory_order_release);
+    }
+
+    void allocate(int32_t count)
+    {
+        int64_t newCapacity = (int64_t)capacity + count;
+        if (newCapacity > kMaxHandles)
+        {
+            throw Exception(NVCV_ERROR_OUT_OF_MEMORY, "%s handle manager can't hold more than %d handles", name,
+                            kMaxHandles);
+        }
+
+        // Create the slabs that cover the new slots
+        int64_t lastSlab = (newCapacity - 1) >> kLog2SlabSize;
+        if (lastSlab >= (int64_t)slabStorage.size())
+        {
+            slabStorage.resize(lastSlab + 1);
+        }
+        for (int64_t s = capacity >> kLog2SlabSize; s <= lastSlab; ++s)
+        {
+            if (slabStorage[s] == nullptr)
+            {
+                auto slab = std::make_unique<Slot[]>(kSlabSize);
+                for (int32_t i = 0; i < kSlabSize; ++i)
+                {
+                    slab[i].index = (uint32_t)(s * kSlabSize + i);
+                }
+                publishSlab(s, slab.get());
+                slabStorage[s] = std::move(slab);
+            }
+        }
+
+        // Chain the new slots in index order so that they're handed out sequentially.
+        SlotBase *first = slotAt(capacity);
+        SlotBase *last  = first;
+        for (int64_t i = capacity + 1; i < newCapacity; ++i)
+        {
+            SlotBase *s = slotAt((uint32_t)i);
+            last->next  = s;
+            last        = s;
+        }
+        freeSlots.pushStack(first, last);
+
+        capacity = (int32_t)newCapacity;
+    }
+
+    void release()
+    {
+        freeSlots.clear();
+        for (size_t d = 0; d < dirStorage.size(); ++d)
+        {
+            dirs[d].store(nullptr, std::memory_order_relaxed);
+        }
+        dirStorage.clear();
+        slabStorage.clear();
+        capacity = 0;
+        epoch.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static inline std::atomic<uint64_t> nextId{1};
+
+    const uint64_t        id = nextId.fetch_add(1, std::memory_order_relaxed);
+    std::atomic<uint64_t> epoch{0};
+
+    std::mutex mtxAlloc;
+
+    // Slab directory, read without locking when validating handles.
+    std::atomic<SlabDir *> dirs[kMaxDirs] = {};
+
+    // Owners of the directory chunks and of the slabs, indexed like them, only used under mtxAlloc.
+    std::vector<std::unique_ptr<SlabDir>> dirStorage;
+    std::vector<std::unique_ptr<Slot[]>>  slabStorage;
+
+    // All the free slots not held by thread caches
+    LockFreeStack<SlotBase> freeSlots;
+
+    // Written under mtxAlloc but read without it when fetching and returning slots,
+    // a thread seeing the old policy for a while only delays when it takes effect.
+    std::atomic<bool> hasFixedSize{false};
+    int32_t           capacity = 0;
+    const char       *name;
+};
+
+template<typename Interface>
+SlabHandleManager<Interface>::SlabHandleManager(const char *name)
+    : pimpl(std::make_shared<Impl>())
+{
+    pimpl->name = name;
+}
+
+template<typename Interface>
+SlabHandleManager<Interface>::~SlabHandleManager()
+{
+    this->clear();
+}
+
+template<typename Interface>
+int SlabHandleManager<Interface>::decRef(HandleType handle)
+{
+    if (!handle)
+        return 0; // "destruction" of a null handle is a no-op
+
+    if (SlotBase *slot = this->getValidSlot(handle))
+    {
+        int ref = slot->decRef();
+        if (ref == 0)
+        {
+            slot->destroyObject();
+            doReturnSlot(slot);
+        }
+        return ref;
+    }
+    else
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "The handle is invalid.");
+    }
+}
+
+template<typename Interface>
+int SlabHandleManager<Interface>::incRef(HandleType handle)
+{
+    if (SlotBase *slot = this->getValidSlot(handle))
+    {
+        return slot->incRef();
+    }
+    else
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "The handle is invalid.");
+    }
+}
+
+template<typename Interface>
+int SlabHandleManager<Interface>::refCount(HandleType handle)
+{
+    if (SlotBase *slot = this->getValidSlot(handle))
+    {
+        return slot->refCount();
+    }
+    else
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "The handle is invalid.");
+    }
+}
+
+template<typename Interface>
+Interface *SlabHandleManager<Interface>::validate(HandleType handle) const
+{
+    if (auto *slot = getValidSlot(handle))
+    {
+        return slot->obj();
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template<typename Interface>
+auto SlabHandleManager<Interface>::getValidSlot(HandleType handle) const -> SlotBase *
+{
+    uint64_t h = reinterpret_cast<uint64_t>(handle);
+
+    uint32_t indexPlusOne = (uint32_t)h;
+    uint32_t generation   = (uint32_t)(h >> 32);
+    if (indexPlusOne == 0)
+    {
+        return nullptr;
+    }
+
+    SlotBase *slot = pimpl->slotAt(indexPlusOne - 1);
+
+    if (slot && slot->live() && slot->generation.load(std::memory_order_relaxed) == generation)
+    {
+        return slot;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+template<typename Interface>
+int32_t SlabHandleManager<Interface>::doCountLiveSlots() const
+{
+    int32_t count = 0;
+    for (int32_t i = 0; i < pimpl->capacity; ++i)
+    {
+        if (pimpl->slotAt(i)->live())
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::setFixedSize(int32_t maxSize)
+{
+    std::lock_guard lock(pimpl->mtxAlloc);
+    if (int32_t usedCount = doCountLiveSlots())
+    {
+        throw Exception(NVCV_ERROR_INVALID_OPERATION,
+                        "Cannot change the size policy while there are still %d live %s handles", usedCount,
+                        pimpl->name);
+    }
+
+    if (pimpl->capacity >= maxSize)
+    {
+        return;
+    }
+
+    this->clear();
+
+    pimpl->hasFixedSize.store(true, std::memory_order_relaxed);
+    doAllocate(maxSize);
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::setDynamicSize(int32_t minSize)
+{
+    std::lock_guard lock(pimpl->mtxAlloc);
+
+    pimpl->hasFixedSize.store(false, std::memory_order_relaxed);
+    if (pimpl->capacity < minSize)
+    {
+        doAllocate(minSize - pimpl->capacity);
+    }
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::clear()
+{
+    if (int32_t usedCount = doCountLiveSlots())
+    {
+        // nosemgrep: flawfinder.getenv-1.curl_getenv-1
+        const char *leakDetection = getenv(LEAK_DETECTION_ENVVAR);
+#ifndef NDEBUG
+        // On debug builds, report leaks by default
+        if (leakDetection == nullptr)
+        {
+            leakDetection = "warn";
+        }
+#endif
+
+        if (leakDetection != nullptr)
+        {
+            bool doAbort = false;
+            if (strcmp(leakDetection, "warn") == 0)
+            {
+                std::cerr << "WARNING: ";
+            }
+            else if (strcmp(leakDetection, "abort") == 0)
+            {
+                std::cerr << "ERROR: ";
+                doAbort = true;
+            }
+            else
+            {
+                std::cerr << "Invalid value '" << leakDetection << " for " << LEAK_DETECTION_ENVVAR
+                          << " environment variable. It must be either not defiled or '0' "
+                             "(to disable), 'warn' or 'abort'";
+                abort();
+            }
+
+            std::cerr << pimpl->name << " leak detection: " << usedCount << " handle" << (usedCount > 1 ? "s" : "")
+                      << " still in use" << std::endl;
+            if (doAbort)
+            {
+                abort();
+            }
+        }
+    }
+
+    pimpl->release();
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::doAllocate(int32_t count)
+{
+    NVCV_ASSERT(count > 0);
+    pimpl->allocate(count);
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::doGrow()
+{
+    if (pimpl->hasFixedSize.load(std::memory_order_relaxed))
+    {
+        throw Exception(NVCV_ERROR_OUT_OF_MEMORY, "%s handle manager pool exhausted under fixed size policy",
+                        pimpl->name);
+    }
+
+    std::lock_guard lock(pimpl->mtxAlloc);
+    if (!pimpl->freeSlots.top())
+    {
+        // Double the capacity up to kMaxHandles, past it allocate reports that the manager is full.
+        int32_t count = pimpl->kMinHandles;
+        if (pimpl->capacity > 0)
+        {
+            count = std::max(1, std::min(pimpl->capacity, kMaxHandles - pimpl->capacity));
+        }
+        doAllocate(count);
+    }
+}
+
+template<typename Interface>
+auto SlabHandleManager<Interface>::doFetchFreeSlot() -> SlotBase *
+{
+    // Under fixed size policy all free slots must be visible to all threads,
+    // or else a thread could run out of handles while another one hoards them.
+    typename Impl::ThreadCache *tc
+        = pimpl->hasFixedSize.load(std::memory_order_relaxed) ? nullptr : Impl::GetThreadCache(pimpl);
+
+    for (;;)
+    {
+        SlotBase *slot = nullptr;
+        if (tc != nullptr)
+        {
+            if (tc->count == 0)
+            {
+                // Refill half of the cache at once, the rest stays for slots returned by this thread.
+                for (SlotBase *s = pimpl->freeSlots.popStack(kThreadCacheSize / 2); s; s = s->next)
+                {
+                    tc->slots[tc->count++] = s;
+                }
+            }
+            if (tc->count > 0)
+            {
+                slot = tc->slots[--tc->count];
+            }
+        }
+        else
+        {
+            slot = pimpl->freeSlots.pop();
+        }
+
+        if (slot)
+        {
+            slot->incRef();
+            assert(slot->refCount() == 1);
+            return slot;
+        }
+        else
+        {
+            doGrow();
+        }
+    }
+}
+
+template<typename Interface>
+void SlabHandleManager<Interface>::doReturnSlot(SlotBase *slot) noexcept
+{
+    typename Impl::ThreadCache *tc = nullptr;
+    if (!pimpl->hasFixedSize.load(std::memory_order_relaxed))
+    {
+        try
+        {
+            tc = Impl::GetThreadCache(pimpl);
+        }
+        catch (...)
+        {
+            // Couldn't create the thread cache, the shared stack will do.
+        }
+    }
+
+    if (tc == nullptr)
+    {
+        pimpl->freeSlots.push(slot);
+        return;
+    }
+
+    if (tc->count == kThreadCacheSize)
+    {
+        // Hand the older half of the cache over to the other threads.
+        constexpr int32_t kHalf = kThreadCacheSize / 2;
+        pimpl->pushChain(tc->slots, kHalf);
+        std::copy(tc->slots + kHalf, tc->slots + kThreadCacheSize, tc->slots);
+        tc->count -= kHalf;
+    }
+    tc->slots[tc->count++] = slot;
+}
+
+template<typename Interface>
+auto SlabHandleManager<Interface>::doGetHandleFromSlot(SlotBase *slot) const noexcept -> HandleType
+{
+    if (slot)
+    {
+        uint64_t gen = slot->generation.load(std::memory_order_relaxed);
+        return reinterpret_cast<HandleType>((gen << 32) | (uint64_t(slot->index) + 1));
+    }
+    else
+    {
+        return {};
+    }
+}
+
+} // namespace nvcv::priv
+
+#endif // NVCV_PRIV_CORE_SLAB_HANDLE_MANAGER_IMPL_HPP
@@ -21,6 +21,6 @@
 #include <nvcv/util/SymbolVersioning.hpp>
 
 #define NVCV_DEFINE_API(...)     NVCV_PROJ_DEFINE_API(NVCV, __VA_ARGS__)
-#define NVCV_DEFINE_OLD_API(...) NVCV_PROJ_DEFINE_OLD_API(NVCV, __VA_ARGS__)
+#define NVCV_DEFINE_OLD_API(...) NVCV_PROJ_DEFINE_API_OLD(NVCV, __VA_ARGS__)
 
 #endif // NVCV_CORE_PRIV_SYMBOLVERSIONING_HPP
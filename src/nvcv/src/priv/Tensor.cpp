@@ -36,10 +36,56 @@
 
 namespace nvcv::priv {
 
+namespace {
+constexpr NVCVTensorBufferType ResourceToBufferType(NVCVResourceType target)
+{
+    NVCVTensorBufferType result = NVCV_TENSOR_BUFFER_NONE;
+
+    switch (target)
+    {
+    case NVCV_RESOURCE_MEM_CUDA:
+        result = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+        break;
+    case NVCV_RESOURCE_MEM_HOST:
+        result = NVCV_TENSOR_BUFFER_STRIDED_HOST;
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        result = NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED;
+        break;
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown Resource type " << target;
+    }
+
+    return result;
+}
+
+// The requirements hold a single buffer, in the memory kind it was calculated for.
+// Empty tensors don't have any buffer, they're treated as cuda tensors.
+NVCVResourceType RequirementsTarget(const NVCVTensorRequirements &reqs)
+{
+    if (CalcTotalSizeBytes(reqs.mem.hostMem) > 0)
+    {
+        return NVCV_RESOURCE_MEM_HOST;
+    }
+    else if (CalcTotalSizeBytes(reqs.mem.hostPinnedMem) > 0)
+    {
+        return NVCV_RESOURCE_MEM_HOST_PINNED;
+    }
+    else
+    {
+        return NVCV_RESOURCE_MEM_CUDA;
+    }
+}
+
+// Host memory doesn't have texture alignment constraints, rows and base address are only aligned
+// to what's needed for vectorized CPU access.
+constexpr int kHostAlignment = 64;
+} // namespace
+
 // Tensor implementation -------------------------------------------
 
 NVCVTensorRequirements Tensor::CalcRequirements(int32_t numImages, Size2D imgSize, ImageFormat fmt,
-                                                int32_t userBaseAlign, int32_t userRowAlign)
+                                                int32_t userBaseAlign, int32_t userRowAlign, NVCVResourceType target)
 {
     // Check if format is compatible with tensor representation
     if (fmt.memLayout() != NVCV_MEM_LAYOUT_PL)
@@ -89,14 +135,18 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t numImages, Size2D imgSiz
 
     DataType dtype{fmt.dataKind(), *chPacking};
 
-    return CalcRequirements(layout.rank, shape, dtype, layout, userBaseAlign, userRowAlign);
+    return CalcRequirements(layout.rank, shape, dtype, layout, userBaseAlign, userRowAlign, target);
 }
 
 NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *shape, const DataType &dtype,
-                                                NVCVTensorLayout layout, int32_t userBaseAlign, int32_t userRowAlign)
+                                                NVCVTensorLayout layout, int32_t userBaseAlign, int32_t userRowAlign,
+                                                NVCVResourceType target)
 {
     NVCVTensorRequirements reqs;
 
+    // Validates the target early on
+    (void)ResourceToBufferType(target);
+
     reqs.layout = layout;
     reqs.dtype  = dtype.value();
 
@@ -116,16 +166,28 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
 
     reqs.mem = {};
 
-    int dev;
-    NVCV_CHECK_THROW(cudaGetDevice(&dev));
+    // Pageable host tensors don't need any device to be current. Pinned ones use the
+    // device defaults so that their layout matches the device tensors they're copied to/from.
+    int dev = -1;
+    if (target != NVCV_RESOURCE_MEM_HOST)
+    {
+        NVCV_CHECK_THROW(cudaGetDevice(&dev));
+    }
 
     // Calculate row pitch alignment
     int rowAlign;
     {
         if (userRowAlign == 0)
         {
-            // it usually returns 32 bytes
-            NVCV_CHECK_THROW(cudaDeviceGetAttribute(&rowAlign, cudaDevAttrTexturePitchAlignment, dev));
+            if (target == NVCV_RESOURCE_MEM_HOST)
+            {
+                rowAlign = dtype.alignment();
+            }
+            else
+            {
+                // it usually returns 32 bytes
+                NVCV_CHECK_THROW(cudaDeviceGetAttribute(&rowAlign, cudaDevAttrTexturePitchAlignment, dev));
+            }
             rowAlign = std::lcm(rowAlign, util::RoundUpNextPowerOfTwo(dtype.strideBytes()));
         }
         else
@@ -145,8 +207,15 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
         if (userBaseAlign == 0)
         {
             int addrAlign;
-            // it usually returns 512 bytes
-            NVCV_CHECK_THROW(cudaDeviceGetAttribute(&addrAlign, cudaDevAttrTextureAlignment, dev));
+            if (target == NVCV_RESOURCE_MEM_HOST)
+            {
+                addrAlign = kHostAlignment;
+            }
+            else
+            {
+                // it usually returns 512 bytes
+                NVCV_CHECK_THROW(cudaDeviceGetAttribute(&addrAlign, cudaDevAttrTextureAlignment, dev));
+            }
             reqs.alignBytes = std::lcm(addrAlign, rowAlign);
             reqs.alignBytes = util::RoundUpNextPowerOfTwo(reqs.alignBytes);
 
@@ -184,7 +253,20 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
         }
     }
 
-    AddBuffer(reqs.mem.cudaMem, reqs.strides[0] * reqs.shape[0], reqs.alignBytes);
+    switch (target)
+    {
+    case NVCV_RESOURCE_MEM_CUDA:
+        AddBuffer(reqs.mem.cudaMem, reqs.strides[0] * reqs.shape[0], reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST:
+        AddBuffer(reqs.mem.hostMem, reqs.strides[0] * reqs.shape[0], reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        AddBuffer(reqs.mem.hostPinnedMem, reqs.strides[0] * reqs.shape[0], reqs.alignBytes);
+        break;
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown Resource type " << target;
+    }
 
     return reqs;
 }
@@ -192,17 +274,47 @@ NVCVTensorRequirements Tensor::CalcRequirements(int32_t rank, const int64_t *sha
 Tensor::Tensor(NVCVTensorRequirements reqs, IAllocator &alloc)
     : m_alloc{alloc}
     , m_reqs{std::move(reqs)}
+    , m_target{RequirementsTarget(m_reqs)}
 {
     // Assuming reqs are already validated during its creation
 
-    int64_t bufSize = CalcTotalSizeBytes(m_reqs.mem.cudaMem);
-    m_memBuffer     = m_alloc->allocCudaMem(bufSize, m_reqs.alignBytes);
+    int64_t bufSize;
+    switch (m_target)
+    {
+    case NVCV_RESOURCE_MEM_CUDA:
+        bufSize     = CalcTotalSizeBytes(m_reqs.mem.cudaMem);
+        m_memBuffer = m_alloc->allocCudaMem(bufSize, m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST:
+        bufSize     = CalcTotalSizeBytes(m_reqs.mem.hostMem);
+        m_memBuffer = m_alloc->allocHostMem(bufSize, m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        bufSize     = CalcTotalSizeBytes(m_reqs.mem.hostPinnedMem);
+        m_memBuffer = m_alloc->allocHostPinnedMem(bufSize, m_reqs.alignBytes);
+        break;
+    default:
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Unknown Resource type " << m_target;
+    }
     NVCV_ASSERT(m_memBuffer != nullptr);
 }
 
 Tensor::~Tensor()
 {
-    m_alloc->freeCudaMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes);
+    switch (m_target)
+    {
+    case NVCV_RESOURCE_MEM_CUDA:
+        m_alloc->freeCudaMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.cudaMem), m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST:
+        m_alloc->freeHostMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.hostMem), m_reqs.alignBytes);
+        break;
+    case NVCV_RESOURCE_MEM_HOST_PINNED:
+        m_alloc->freeHostPinnedMem(m_memBuffer, CalcTotalSizeBytes(m_reqs.mem.hostPinnedMem), m_reqs.alignBytes);
+        break;
+    default:
+        break;
+    }
 }
 
 int32_t Tensor::rank() const
@@ -232,7 +344,7 @@ SharedCoreObj<IAllocator> Tensor::alloc() const
 
 void Tensor::exportData(NVCVTensorData &data) const
 {
-    data.bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+    data.bufferType = ResourceToBufferType(m_target);
 
     data.dtype  = m_reqs.dtype;
     data.layout = m_reqs.layout;
@@ -33,9 +33,11 @@ public:
     ~Tensor();
 
     static NVCVTensorRequirements CalcRequirements(int32_t numImages, Size2D imgSize, ImageFormat fmt,
-                                                   int32_t baseAlign, int32_t rowAlign);
+                                                   int32_t baseAlign, int32_t rowAlign,
+                                                   NVCVResourceType target = NVCV_RESOURCE_MEM_CUDA);
     static NVCVTensorRequirements CalcRequirements(int rank, const int64_t *shape, const DataType &dtype,
-                                                   NVCVTensorLayout layout, int32_t baseAlign, int32_t rowAlign);
+                                                   NVCVTensorLayout layout, int32_t baseAlign, int32_t rowAlign,
+                                                   NVCVResourceType target = NVCV_RESOURCE_MEM_CUDA);
 
     int32_t        rank() const override;
     const int64_t *shape() const override;
@@ -52,6 +54,8 @@ private:
     SharedCoreObj<IAllocator> m_alloc;
     NVCVTensorRequirements    m_reqs;
 
+    NVCVResourceType          m_target;
+
     void *m_memBuffer;
 };
 
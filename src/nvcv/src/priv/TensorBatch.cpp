@@ -25,35 +25,42 @@
 
 namespace nvcv::priv {
 
+static int32_t ValidateRingDepth(int32_t ringDepth)
+{
+    if (ringDepth < 1 || ringDepth > NVCV_TENSOR_BATCH_MAX_RING_DEPTH)
+    {
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT, "Ring depth must be between 1 and %d, not %d",
+                        NVCV_TENSOR_BATCH_MAX_RING_DEPTH, ringDepth);
+    }
+    return ringDepth;
+}
+
 TensorBatch::TensorBatch(const NVCVTensorBatchRequirements &reqs, IAllocator &alloc)
     : m_alloc(alloc)
     , m_reqs(reqs)
-    , m_dirtyBegin(0)
-    , m_dirtyEnd(0)
+    , m_ring(ValidateRingDepth(reqs.ringDepth))
     , m_dtype(NVCV_DATA_TYPE_NONE)
     , m_layout(NVCV_TENSOR_LAYOUT_MAKE(""))
     , m_rank(-1)
     , m_userPointer(nullptr)
 {
-    m_evPostFence         = nullptr;
     m_devTensorsBuffer    = nullptr;
     m_pinnedTensorsBuffer = nullptr;
     m_Tensors             = nullptr;
 
     int64_t bufferSize = m_reqs.capacity * sizeof(BatchElement);
+    int64_t ringSize   = m_reqs.ringDepth * bufferSize;
 
     try
     {
-        m_devTensorsBuffer = static_cast<BatchElement *>(m_alloc->allocCudaMem(bufferSize, m_reqs.alignBytes));
+        m_devTensorsBuffer = static_cast<BatchElement *>(m_alloc->allocCudaMem(ringSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_devTensorsBuffer != nullptr);
 
-        m_pinnedTensorsBuffer = static_cast<BatchElement *>(m_alloc->allocHostPinnedMem(bufferSize, m_reqs.alignBytes));
+        m_pinnedTensorsBuffer = static_cast<BatchElement *>(m_alloc->allocHostPinnedMem(ringSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_pinnedTensorsBuffer != nullptr);
 
         m_Tensors = static_cast<NVCVTensorHandle *>(m_alloc->allocHostMem(bufferSize, m_reqs.alignBytes));
         NVCV_ASSERT(m_Tensors != nullptr);
-
-        NVCV_CHECK_THROW(cudaEventCreateWithFlags(&m_evPostFence, cudaEventDisableTiming));
     }
     catch (...)
     {
@@ -62,11 +69,12 @@ TensorBatch::TensorBatch(const NVCVTensorBatchRequirements &reqs, IAllocator &al
     }
 }
 
-NVCVTensorBatchRequirements TensorBatch::CalcRequirements(int32_t capacity)
+NVCVTensorBatchRequirements TensorBatch::CalcRequirements(int32_t capacity, int32_t ringDepth)
 {
     NVCVTensorBatchRequirements reqs;
-    reqs.capacity = capacity;
-    reqs.mem      = {};
+    reqs.capacity  = capacity;
+    reqs.ringDepth = ValidateRingDepth(ringDepth);
+    reqs.mem       = {};
 
     reqs.alignBytes = alignof(BatchElement);
     reqs.alignBytes = util::RoundUpNextPowerOfTwo(reqs.alignBytes);
@@ -78,8 +86,8 @@ NVCVTensorBatchRequirements TensorBatch::CalcRequirements(int32_t capacity)
                         NVCV_MAX_MEM_REQUIREMENTS_BLOCK_SIZE);
     }
 
-    AddBuffer(reqs.mem.cudaMem, capacity * sizeof(BatchElement), reqs.alignBytes);
-    AddBuffer(reqs.mem.hostPinnedMem, capacity * sizeof(BatchElement), reqs.alignBytes);
+    AddBuffer(reqs.mem.cudaMem, (int64_t)ringDepth * capacity * sizeof(BatchElement), reqs.alignBytes);
+    AddBuffer(reqs.mem.hostPinnedMem, (int64_t)ringDepth * capacity * sizeof(BatchElement), reqs.alignBytes);
     AddBuffer(reqs.mem.hostMem, capacity * sizeof(BatchElement), reqs.alignBytes);
 
     return reqs;
@@ -92,10 +100,8 @@ TensorBatch::~TensorBatch()
 
 void TensorBatch::cleanUp()
 {
-    if (m_evPostFence)
-    {
-        NVCV_CHECK_LOG(cudaEventDestroy(m_evPostFence));
-    }
+    // Pending uploads might still be reading from the pinned buffer.
+    m_ring.waitAll();
 
     for (int i = 0; i < m_numTensors; ++i)
     {
@@ -103,25 +109,29 @@ void TensorBatch::cleanUp()
     }
 
     int64_t bufferSize = m_reqs.capacity * sizeof(BatchElement);
+    int64_t ringSize   = m_reqs.ringDepth * bufferSize;
 
-    m_alloc->freeCudaMem(m_devTensorsBuffer, bufferSize, m_reqs.alignBytes);
-    m_alloc->freeHostPinnedMem(m_pinnedTensorsBuffer, bufferSize, m_reqs.alignBytes);
+    m_alloc->freeCudaMem(m_devTensorsBuffer, ringSize, m_reqs.alignBytes);
+    m_alloc->freeHostPinnedMem(m_pinnedTensorsBuffer, ringSize, m_reqs.alignBytes);
     m_alloc->freeHostMem(m_Tensors, bufferSize, m_reqs.alignBytes);
 }
 
 void TensorBatch::exportData(CUstream stream, NVCVTensorBatchData &data)
 {
-    if (m_dirtyBegin < m_dirtyEnd)
+    if (m_ring.isDirty())
     {
-        // Block until the previous call to exportData finishes the buffer copy.
-        NVCV_CHECK_THROW(cudaEventSynchronize(m_evPostFence));
+        // Block only if the ring wrapped around to a slot whose buffer copy isn't finished yet.
+        DescriptorRing::Range dirty = m_ring.advance();
 
-        for (auto i = m_dirtyBegin; i < m_dirtyEnd; ++i)
+        BatchElement *pinned = m_pinnedTensorsBuffer + (int64_t)m_ring.current() * m_reqs.capacity;
+        BatchElement *dev    = m_devTensorsBuffer + (int64_t)m_ring.current() * m_reqs.capacity;
+
+        for (auto i = dirty.begin; i < dirty.end; ++i)
         {
             auto          &t = ToStaticRef<ITensor>(m_Tensors[i]);
             NVCVTensorData tdata;
             t.exportData(tdata);
-            auto &element = m_pinnedTensorsBuffer[i];
+            auto &element = pinned[i];
             element.data  = tdata.buffer.strided.basePtr;
             for (int d = 0; d < tdata.rank; ++d)
             {
@@ -130,16 +140,19 @@ void TensorBatch::exportData(CUstream stream, NVCVTensorBatchData &data)
             }
         }
 
-        int64_t copySize = (m_dirtyEnd - m_dirtyBegin) * sizeof(BatchElement);
-        NVCV_CHECK_THROW(cudaMemcpyAsync(m_devTensorsBuffer + m_dirtyBegin, m_pinnedTensorsBuffer + m_dirtyBegin,
-                                         copySize, cudaMemcpyHostToDevice, stream));
+        int64_t copySize = (dirty.end - dirty.begin) * sizeof(BatchElement);
+        NVCV_CHECK_THROW(
+            cudaMemcpyAsync(dev + dirty.begin, pinned + dirty.begin, copySize, cudaMemcpyHostToDevice, stream));
 
         // Signal the buffer copy is finished.
-        NVCV_CHECK_THROW(cudaEventRecord(m_evPostFence, stream));
-        m_dirtyBegin = m_dirtyEnd;
+        m_ring.recordUpload(stream);
     }
+
+    // The current slot holds all the tensors and won't be written to until the ring wraps around.
+    BatchElement *devSlot = m_devTensorsBuffer + (int64_t)m_ring.current() * m_reqs.capacity;
+
     NVCVTensorBatchBuffer buffer;
-    buffer.strided  = NVCVTensorBatchBufferStrided{m_devTensorsBuffer};
+    buffer.strided  = NVCVTensorBatchBufferStrided{devSlot};
     data.buffer     = buffer;
     data.type       = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
     data.rank       = m_rank;
@@ -168,6 +181,13 @@ void TensorBatch::validateTensors(const NVCVTensorHandle *tensors, int32_t numTe
             throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
                             "Trying to add a tensor to a tensor batch with an inconsistent layout.");
         }
+        NVCVTensorData tdata;
+        t.exportData(tdata);
+        if (tdata.bufferType != BUFFER_TYPE)
+        {
+            throw Exception(NVCV_ERROR_INVALID_ARGUMENT,
+                            "Trying to add a tensor that isn't cuda-accessible to a tensor batch.");
+        }
     }
 }
 
@@ -205,12 +225,8 @@ void TensorBatch::pushTensors(const NVCVTensorHandle *tensors, int32_t numTensor
         CoreObjectIncRef(tensors[i]);
         m_Tensors[m_numTensors + i] = tensors[i];
     }
-    if (m_dirtyEnd == m_dirtyBegin)
-    {
-        m_dirtyBegin = m_numTensors;
-    }
+    m_ring.markDirty(m_numTensors, m_numTensors + numTensors);
     m_numTensors += numTensors;
-    m_dirtyEnd = m_numTensors;
 }
 
 void TensorBatch::popTensors(int32_t numTensors)
@@ -229,8 +245,7 @@ void TensorBatch::popTensors(int32_t numTensors)
         CoreObjectDecRef(m_Tensors[i]);
     }
     m_numTensors -= numTensors;
-    m_dirtyEnd   = std::min(m_dirtyEnd, m_numTensors);
-    m_dirtyBegin = std::min(m_dirtyBegin, m_dirtyEnd);
+    m_ring.truncate(m_numTensors);
     if (m_numTensors == 0)
     {
         m_dtype  = NVCV_DATA_TYPE_NONE;
@@ -275,16 +290,7 @@ void TensorBatch::setTensors(int32_t index, const NVCVTensorHandle *tensors, int
         CoreObjectIncRef(tensors[idx]);
         m_Tensors[idx + index] = tensors[idx];
     }
-    if (m_dirtyBegin != m_dirtyEnd)
-    {
-        m_dirtyBegin = std::min(m_dirtyBegin, index);
-        m_dirtyEnd   = std::max(m_dirtyEnd, index + numTensors);
-    }
-    else
-    {
-        m_dirtyBegin = index;
-        m_dirtyEnd   = m_dirtyBegin + numTensors;
-    }
+    m_ring.markDirty(index, index + numTensors);
 }
 
 SharedCoreObj<IAllocator> TensorBatch::alloc() const
@@ -329,8 +335,7 @@ void TensorBatch::clear()
         CoreObjectDecRef(m_Tensors[i]);
     }
     m_numTensors = 0;
-    m_dirtyBegin = 0;
-    m_dirtyEnd   = 0;
+    m_ring.truncate(0);
     m_dtype      = NVCV_DATA_TYPE_NONE;
     m_layout     = NVCV_TENSOR_LAYOUT_MAKE("");
     m_rank       = -1;
@@ -19,6 +19,7 @@
 #define NVCV_CORE_PRIV_TENSORBATCH_HPP
 
 #include "DataType.hpp"
+#include "DescriptorRing.hpp"
 #include "IAllocator.hpp"
 #include "ITensorBatch.hpp"
 #include "SharedCoreObj.hpp"
@@ -34,7 +35,8 @@ public:
     using BatchElement                            = NVCVTensorBatchElementStrided;
     static const NVCVTensorBufferType BUFFER_TYPE = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
 
-    static NVCVTensorBatchRequirements CalcRequirements(int32_t capacity);
+    static NVCVTensorBatchRequirements CalcRequirements(int32_t capacity,
+                                                        int32_t ringDepth = NVCV_TENSOR_BATCH_DEFAULT_RING_DEPTH);
 
     TensorBatch(const NVCVTensorBatchRequirements &reqs, IAllocator &alloc);
 
@@ -70,29 +72,24 @@ private:
     SharedCoreObj<IAllocator>   m_alloc;
     NVCVTensorBatchRequirements m_reqs;
 
-    // Dirty begin and end describe a range containing all the tensors that have been modified
-    // since the previous exportData call and thus should be updated in the exported buffer.
-    int32_t m_dirtyBegin;
-    int32_t m_dirtyEnd;
+    // Tracks, for each slot of the pinned and device buffers, the range containing all the tensors
+    // that have been modified since the slot was last uploaded.
+    DescriptorRing m_ring;
 
     int32_t m_numTensors = 0;
 
     NVCVTensorHandle              *m_Tensors; // host buffer for tensor handles
-    // Pinned buffer for the tensor data descriptors
-    // It's updated every time the user updates the tensor batch.
-    // Changes are tracked with the m_dirty flags.
+    // Pinned buffer for the tensor data descriptors, one block of capacity elements per ring slot.
+    // The next slot is filled with the modified descriptors when the exportData method is called.
     NVCVTensorBatchElementStrided *m_pinnedTensorsBuffer;
-    // Device buffer for the tensor data descriptors.
-    // It's updated and returned when the exportData method is called.
+    // Device buffer for the tensor data descriptors, one block of capacity elements per ring slot.
+    // The next slot is updated and returned when the exportData method is called.
     NVCVTensorBatchElementStrided *m_devTensorsBuffer;
 
     NVCVDataType     m_dtype;
     NVCVTensorLayout m_layout;
     int32_t          m_rank;
 
-    // TODO: must be retrieved from the resource allocator;
-    cudaEvent_t m_evPostFence;
-
     void *m_userPointer;
 
     void cleanUp();
@@ -74,10 +74,9 @@ void FillTensorData(IImage &img, NVCVTensorData &tensorData)
     NVCVImageData imgData;
     img.exportData(imgData);
 
-    if (imgData.bufferType != NVCV_IMAGE_BUFFER_STRIDED_CUDA)
+    if (imgData.bufferType != NVCV_IMAGE_BUFFER_STRIDED_CUDA && imgData.bufferType != NVCV_IMAGE_BUFFER_STRIDED_HOST)
     {
-        throw Exception(NVCV_ERROR_INVALID_ARGUMENT)
-            << "Only cuda-accessible images with pitch-linear data are accepted";
+        throw Exception(NVCV_ERROR_INVALID_ARGUMENT) << "Only images with pitch-linear data are accepted";
     }
 
     NVCVImageBufferStrided &imgStrided = imgData.buffer.strided;
@@ -118,7 +117,8 @@ void FillTensorData(IImage &img, NVCVTensorData &tensorData)
     // Now fill up tensor data with image data
 
     tensorData            = {}; // start everything afresh
-    tensorData.bufferType = NVCV_TENSOR_BUFFER_STRIDED_CUDA;
+    tensorData.bufferType = imgData.bufferType == NVCV_IMAGE_BUFFER_STRIDED_HOST ? NVCV_TENSOR_BUFFER_STRIDED_HOST
+                                                                                 : NVCV_TENSOR_BUFFER_STRIDED_CUDA;
 
     NVCVTensorBufferStrided &tensorStrided = tensorData.buffer.strided;
 
@@ -316,8 +316,10 @@ void ReshapeTensorData(NVCVTensorData &tensor_data, int new_rank, const int64_t
 
     // Check strides ------------
 
-    // right now is the only option supported
-    assert(tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA);
+    // right now strided buffers are the only option supported
+    assert(tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA
+           || tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST
+           || tensor_data.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED);
 
     // Collapses non-strided dimensions into groups
     // Example 1:
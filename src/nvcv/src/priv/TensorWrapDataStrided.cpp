@@ -34,7 +34,9 @@ namespace nvcv::priv {
 
 static void ValidateTensorBufferStrided(const NVCVTensorData &tdata)
 {
-    NVCV_ASSERT(tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA);
+    NVCV_ASSERT(tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_CUDA
+                || tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST
+                || tdata.bufferType == NVCV_TENSOR_BUFFER_STRIDED_HOST_PINNED);
 
     const NVCVTensorBufferStrided &buffer = tdata.buffer.strided;
 
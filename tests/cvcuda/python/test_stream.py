@@ -16,6 +16,7 @@
 import cvcuda
 import nvcv
 import torch
+import pytest as t
 
 # TODO: These tests technically belong to nvcv, but since it doesn't expose any
 # operator (or anything that we could submit to a stream), we need to add this
@@ -34,3 +35,30 @@ def test_stream_gcbag_vs_streamsync_race_condition():
     with cvcuda_stream:
         nvcvResizeTensor = cvcuda.remap(nvcvInputTensor, nvcvInputMap)
     del nvcvResizeTensor
+
+
+@t.mark.parametrize("epoch_length", [1, 4, 16])
+def test_stream_epoch_release_mode(epoch_length):
+    src = torch.randint(0, 256, (2, 64, 64, 3), dtype=torch.uint8).cuda()
+    nvcvSrc = nvcv.as_tensor(src, "NHWC")
+
+    stream = cvcuda.Stream()
+    prev_mode = nvcv.cuda.get_release_mode()
+    nvcv.cuda.set_release_mode(nvcv.cuda.ReleaseMode.EPOCH, epoch_length)
+    try:
+        outputs = [cvcuda.flip(nvcvSrc, flipCode=1, stream=stream) for _ in range(10)]
+        assert nvcv.cuda.internal.num_held_resources(stream) > 0
+
+        stream.sync()
+        assert nvcv.cuda.internal.num_held_resources(stream) == 0
+
+        ref = torch.flip(src, dims=[2])
+        for out in outputs:
+            assert torch.equal(torch.as_tensor(out.cuda()), ref)
+    finally:
+        nvcv.cuda.set_release_mode(prev_mode)
+
+
+def test_stream_release_mode_invalid_epoch_length():
+    with t.raises(ValueError):
+        nvcv.cuda.set_release_mode(nvcv.cuda.ReleaseMode.EPOCH, 0)
@@ -24,6 +24,8 @@
 #include <cvcuda/cuda_tools/TypeTraits.hpp>   // for BaseType, etc.
 #include <nvcv/util/Assert.h>                 // for NVCV_ASSERT, etc.
 
+#include <algorithm> // for std::copy, etc.
+
 namespace nvcv::test {
 
 namespace detail {
@@ -142,6 +144,96 @@ inline void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std
     }
 }
 
+template<typename T>
+inline void MorphSeparable(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
+                           const long3 &srcStrides, const int3 &shape, const Size2D &kernelSize, int2 &kernelAnchor,
+                           const NVCVBorderType &borderMode, NVCVMorphologyType type)
+{
+    using BT  = cuda::BaseType<T>;
+    int2 size = cuda::DropCast<2>(shape);
+
+    BT val
+        = (type == NVCVMorphologyType::NVCV_DILATE) ? std::numeric_limits<BT>::min() : std::numeric_limits<BT>::max();
+    T borderValueT = cuda::SetAll<T>(val);
+
+    if (kernelAnchor.x < 0)
+    {
+        kernelAnchor.x = kernelSize.w / 2;
+    }
+    if (kernelAnchor.y < 0)
+    {
+        kernelAnchor.y = kernelSize.h / 2;
+    }
+
+    auto op = [type](const T &a, const T &b)
+    {
+        return (type == NVCVMorphologyType::NVCV_DILATE) ? cuda::max(a, b) : cuda::min(a, b);
+    };
+
+    // van Herk/Gil-Werman: output i is the combination of the suffix of the segment holding
+    // i - anchor and of the prefix of the next one, segments being ksize long.
+    auto filterLine = [&op](int length, int ksize, int anchor, auto &&valueAt, std::vector<T> &out)
+    {
+        int            span = length + ksize - 1;
+        std::vector<T> prefix(span), suffix(span);
+        for (int i = 0; i < span; ++i)
+        {
+            prefix[i] = suffix[i] = valueAt(i - anchor);
+        }
+        for (int first = 0; first < span; first += ksize)
+        {
+            int last = std::min(first + ksize, span) - 1;
+            for (int i = first + 1; i <= last; ++i)
+            {
+                prefix[i] = op(prefix[i - 1], prefix[i]);
+            }
+            for (int i = last - 1; i >= first; --i)
+            {
+                suffix[i] = op(suffix[i + 1], suffix[i]);
+            }
+        }
+        out.resize(length);
+        for (int i = 0; i < length; ++i)
+        {
+            out[i] = op(suffix[i], prefix[i + ksize - 1]);
+        }
+    };
+
+    std::vector<T> rowPass(shape.x * shape.y), line;
+
+    for (int b = 0; b < shape.z; ++b)
+    {
+        for (int y = 0; y < shape.y; ++y)
+        {
+            filterLine(shape.x, kernelSize.w, kernelAnchor.x,
+                       [&](int x)
+                       {
+                           int2 coord{x, y};
+                           return IsInside(coord, size, borderMode) ? ValueAt<T>(hSrc, srcStrides, b, coord.y, coord.x)
+                                                                    : borderValueT;
+                       },
+                       line);
+            std::copy(line.begin(), line.end(), rowPass.begin() + y * shape.x);
+        }
+
+        for (int x = 0; x < shape.x; ++x)
+        {
+            filterLine(shape.y, kernelSize.h, kernelAnchor.y,
+                       [&](int y)
+                       {
+                           int2 coord{x, y};
+                           return IsInside(coord, size, borderMode) ? rowPass[coord.y * shape.x + coord.x]
+                                                                    : borderValueT;
+                       },
+                       line);
+            for (int y = 0; y < shape.y; ++y)
+            {
+                ValueAt<T>(hDst, dstStrides, b, y, x) = line[y];
+            }
+        }
+    }
+}
+
 #define NVCV_TEST_INST(TYPE)                                                                                            \
     template const TYPE &ValueAt<TYPE>(const std::vector<uint8_t> &, long3, int, int, int);                             \
     template TYPE       &ValueAt<TYPE>(std::vector<uint8_t> &, long3, int, int, int);                                   \
@@ -151,7 +243,11 @@ inline void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std
                                  const NVCVBorderType &borderMode, const float4 &borderValue);                   \
     template void Morph<TYPE>(std::vector<uint8_t> & hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,   \
                               const long3 &srcStrides, const int3 &shape, const Size2D &kernelSize,                     \
-                              int2 &kernelAnchor, const NVCVBorderType &borderMode, NVCVMorphologyType type)
+                              int2 &kernelAnchor, const NVCVBorderType &borderMode, NVCVMorphologyType type);           \
+    template void MorphSeparable<TYPE>(std::vector<uint8_t> & hDst, const long3 &dstStrides,                            \
+                                       const std::vector<uint8_t> &hSrc, const long3 &srcStrides, const int3 &shape,    \
+                                       const Size2D &kernelSize, int2 &kernelAnchor, const NVCVBorderType &borderMode,  \
+                                       NVCVMorphologyType type)
 
 NVCV_TEST_INST(uint8_t);
 NVCV_TEST_INST(ushort);
@@ -221,6 +317,34 @@ void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vecto
     }
 }
 
+void MorphSeparable(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
+                    const long3 &srcStrides, const int3 &shape, const ImageFormat &format, const Size2D &kernelSize,
+                    int2 &kernelAnchor, const NVCVBorderType &borderMode, NVCVMorphologyType type)
+{
+    NVCV_ASSERT(format.numPlanes() == 1);
+
+    switch (format.planeDataType(0))
+    {
+#define NVCV_TEST_CASE(DATATYPE, TYPE)                                                                      \
+    case NVCV_DATA_TYPE_##DATATYPE:                                                                         \
+        detail::MorphSeparable<TYPE>(hDst, dstStrides, hSrc, srcStrides, shape, kernelSize, kernelAnchor, \
+                                     borderMode, type);                                                   \
+        break
+
+        NVCV_TEST_CASE(U8, uint8_t);
+        NVCV_TEST_CASE(U16, ushort);
+        NVCV_TEST_CASE(3U8, uchar3);
+        NVCV_TEST_CASE(4U8, uchar4);
+        NVCV_TEST_CASE(4F32, float4);
+        NVCV_TEST_CASE(3F32, float3);
+
+#undef NVCV_TEST_CASE
+
+    default:
+        break;
+    }
+}
+
 std::vector<float> ComputeMeanKernel(nvcv::Size2D kernelSize)
 {
     std::size_t ks = kernelSize.w * kernelSize.h;
@@ -39,6 +39,11 @@ void Morph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vecto
            const long3 &srcStrides, const int3 &shape, const ImageFormat &format, const Size2D &kernelSize,
            int2 &kernelAnchor, const NVCVBorderType &borderMode, NVCVMorphologyType type);
 
+// Same result as Morph, computed with separable van Herk/Gil-Werman passes for large kernels.
+void MorphSeparable(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
+                    const long3 &srcStrides, const int3 &shape, const ImageFormat &format, const Size2D &kernelSize,
+                    int2 &kernelAnchor, const NVCVBorderType &borderMode, NVCVMorphologyType type);
+
 std::vector<float> ComputeMeanKernel(nvcv::Size2D kernelSize);
 
 std::vector<float> ComputeGaussianKernel(nvcv::Size2D kernelSize, double2 sigma);
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NMSUtils.hpp"
+
+#include <algorithm> // for std::stable_sort, etc.
+#include <cmath>     // for std::exp, etc.
+#include <limits>    // for std::numeric_limits, etc.
+#include <numeric>   // for std::iota, etc.
+
+namespace nvcv::test {
+
+float NMSIoU(const short4 &box1, const short4 &box2)
+{
+    int   xInterLeft   = std::max(box1.x, box2.x);
+    int   yInterTop    = std::max(box1.y, box2.y);
+    int   xInterRight  = std::min(box1.x + box1.z, box2.x + box2.z);
+    int   yInterBottom = std::min(box1.y + box1.w, box2.y + box2.w);
+    int   widthInter   = xInterRight - xInterLeft;
+    int   heightInter  = yInterBottom - yInterTop;
+    float interArea    = widthInter * heightInter;
+    float iou          = 0.f;
+    if (widthInter > 0.f && heightInter > 0.f)
+    {
+        float unionArea = static_cast<float>(box1.z * box1.w) + static_cast<float>(box2.z * box2.w) - interArea;
+        if (unionArea > 0.f)
+        {
+            iou = interArea / unionArea;
+        }
+    }
+    return iou;
+}
+
+void NMSTopKCPU(std::vector<int> &outIndices, std::vector<float> &outScores, const std::vector<short4> &bboxes,
+                const std::vector<float> &scores, const std::vector<int> &classIds, int maxOutputs,
+                float scoreThreshold, float iouThreshold, NVCVNMSScoreDecay scoreDecay, float sigma)
+{
+    constexpr float kRemoved = -std::numeric_limits<float>::infinity();
+
+    outIndices.clear();
+    outScores.clear();
+
+    auto sameClass = [&](int i, int j)
+    {
+        return classIds.empty() || classIds[i] == classIds[j];
+    };
+
+    // Candidates above the score threshold, by decreasing score then increasing index
+    std::vector<int> cands;
+    for (int i = 0; i < static_cast<int>(scores.size()); ++i)
+    {
+        if (scores[i] >= scoreThreshold)
+        {
+            cands.push_back(i);
+        }
+    }
+    std::stable_sort(cands.begin(), cands.end(), [&](int i, int j) { return scores[i] > scores[j]; });
+
+    if (scoreDecay == NVCV_NMS_SCORE_DECAY_NONE)
+    {
+        for (int i : cands)
+        {
+            if (static_cast<int>(outIndices.size()) == maxOutputs)
+            {
+                break;
+            }
+
+            bool suppressed = false;
+            for (int k : outIndices)
+            {
+                if (sameClass(i, k) && NMSIoU(bboxes[k], bboxes[i]) > iouThreshold)
+                {
+                    suppressed = true;
+                    break;
+                }
+            }
+            if (!suppressed)
+            {
+                outIndices.push_back(i);
+                outScores.push_back(scores[i]);
+            }
+        }
+        return;
+    }
+
+    std::vector<float> candScores(cands.size());
+    for (size_t c = 0; c < cands.size(); ++c)
+    {
+        candScores[c] = scores[cands[c]];
+    }
+
+    while (static_cast<int>(outIndices.size()) < maxOutputs)
+    {
+        int sel = -1;
+        for (int c = 0; c < static_cast<int>(cands.size()); ++c)
+        {
+            if (candScores[c] > kRemoved && (sel < 0 || candScores[c] > candScores[sel]))
+            {
+                sel = c;
+            }
+        }
+        if (sel < 0)
+        {
+            break;
+        }
+
+        outIndices.push_back(cands[sel]);
+        outScores.push_back(candScores[sel]);
+        candScores[sel] = kRemoved;
+
+        for (int c = 0; c < static_cast<int>(cands.size()); ++c)
+        {
+            if (candScores[c] == kRemoved || !sameClass(cands[sel], cands[c]))
+            {
+                continue;
+            }
+
+            float iou   = NMSIoU(bboxes[cands[sel]], bboxes[cands[c]]);
+            float score = candScores[c];
+            if (scoreDecay == NVCV_NMS_SCORE_DECAY_LINEAR)
+            {
+                if (iou > iouThreshold)
+                {
+                    score *= 1.f - iou;
+                }
+            }
+            else
+            {
+                score *= std::exp(-iou * iou / sigma);
+            }
+            candScores[c] = score >= scoreThreshold ? score : kRemoved;
+        }
+    }
+}
+
+} // namespace nvcv::test
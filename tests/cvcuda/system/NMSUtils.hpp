@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVCV_TEST_COMMON_NMS_UTILS_HPP
+#define NVCV_TEST_COMMON_NMS_UTILS_HPP
+
+#include <cuda_runtime.h> // for short4, etc.
+#include <cvcuda/Types.h> // for NVCVNMSScoreDecay, etc.
+
+#include <vector> // for std::vector, etc.
+
+namespace nvcv::test {
+
+// Intersection-over-Union of two (x, y, width, height) boxes, as computed by the NonMaximumSuppression operator
+float NMSIoU(const short4 &box1, const short4 &box2);
+
+// Host reference of the top-K NonMaximumSuppression of one sample: fills outIndices and outScores with the selected
+// boxes, by decreasing score, classIds being empty when boxes are suppressed regardless of their class
+void NMSTopKCPU(std::vector<int> &outIndices, std::vector<float> &outScores, const std::vector<short4> &bboxes,
+                const std::vector<float> &scores, const std::vector<int> &classIds, int maxOutputs,
+                float scoreThreshold, float iouThreshold, NVCVNMSScoreDecay scoreDecay, float sigma);
+
+} // namespace nvcv::test
+
+#endif // NVCV_TEST_COMMON_NMS_UTILS_HPP
@@ -24,8 +24,10 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <random>
+#include <type_traits>
 
 namespace gt   = ::testing;
 namespace test = nvcv::test;
@@ -63,6 +65,59 @@ static void computeHistogramWithMask(std::vector<uint8_t> imageVec, std::vector<
     goldHistogram.insert(goldHistogram.end(), histogram.begin(), histogram.end());
 };
 
+// Bin of the value as the binned histogram computes it, -1 if out of range.
+static int computeBinnedHistogramBin(float value, NVCVHistogramRange range, int numBins)
+{
+    if (!(value >= range.lowerBound && value < range.upperBound))
+    {
+        return -1;
+    }
+    float scale = numBins / (range.upperBound - range.lowerBound);
+    return std::min(static_cast<int>((value - range.lowerBound) * scale), numBins - 1);
+}
+
+// Per-channel histograms interleave the channels in each bin, joint histograms are row-major over the bins of the
+// first two channels.
+template<typename T>
+static void computeBinnedHistogram(const std::vector<T> &imageVec, const std::vector<uint8_t> &maskVec, int channels,
+                                   NVCVHistogramMode mode, const std::vector<int> &numBins,
+                                   const std::vector<NVCVHistogramRange> &ranges, std::vector<uint32_t> &goldHistogram)
+{
+    bool                  joint = mode == NVCV_HISTOGRAM_JOINT_2D;
+    std::vector<uint32_t> histogram(joint ? numBins[0] * numBins[1] : numBins[0] * channels, 0);
+
+    for (size_t i = 0; i < imageVec.size() / channels; ++i)
+    {
+        if (!maskVec.empty() && !maskVec[i])
+        {
+            continue;
+        }
+
+        if (joint)
+        {
+            int bin0 = computeBinnedHistogramBin(imageVec[i * channels], ranges[0], numBins[0]);
+            int bin1 = computeBinnedHistogramBin(imageVec[i * channels + 1], ranges[1], numBins[1]);
+            if (bin0 >= 0 && bin1 >= 0)
+            {
+                histogram[bin0 * numBins[1] + bin1]++;
+            }
+        }
+        else
+        {
+            for (int c = 0; c < channels; ++c)
+            {
+                int bin = computeBinnedHistogramBin(imageVec[i * channels + c], ranges[c], numBins[0]);
+                if (bin >= 0)
+                {
+                    histogram[bin * channels + c]++;
+                }
+            }
+        }
+    }
+
+    goldHistogram.insert(goldHistogram.end(), histogram.begin(), histogram.end());
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpHistogram, test::ValueList<int, int, NVCVImageFormat, int>
 {
@@ -178,6 +233,219 @@ TEST_P(OpHistogram, Histogram_mask)
     ASSERT_EQ(opHistogram, goldHistogram);
 }
 
+// clang-format off
+NVCV_TEST_SUITE_P(OpHistogramBinned, test::ValueList<int, int, int, int, nvcv::DataType, NVCVHistogramMode, int, int, int, bool>
+{
+    // width, height, batches, channels,       dataType,                       mode, numBins0, numBins1, numRanges,  mask
+    {      64,     48,       1,        1,  nvcv::TYPE_U8, NVCV_HISTOGRAM_PER_CHANNEL,      256,        1,         0, false},
+    {     320,    240,       2,        3,  nvcv::TYPE_U8, NVCV_HISTOGRAM_PER_CHANNEL,       64,        1,         1,  true},
+    {    1920,   1080,       1,        4,  nvcv::TYPE_U8, NVCV_HISTOGRAM_PER_CHANNEL,      256,        1,         4, false},
+    {     333,     97,       2,        1, nvcv::TYPE_U16, NVCV_HISTOGRAM_PER_CHANNEL,     1024,        1,         0, false},
+    {     640,    480,       1,        2, nvcv::TYPE_U16, NVCV_HISTOGRAM_PER_CHANNEL,    65536,        1,         0,  true},
+    {     200,    100,       3,        3, nvcv::TYPE_F32, NVCV_HISTOGRAM_PER_CHANNEL,      100,        1,         3, false},
+    {     320,    240,       2,        3,  nvcv::TYPE_U8,    NVCV_HISTOGRAM_JOINT_2D,       32,       32,         0, false},
+    {     640,    360,       1,        2, nvcv::TYPE_U16,    NVCV_HISTOGRAM_JOINT_2D,       64,      128,         2,  true},
+    {     257,    129,       1,        4, nvcv::TYPE_F32,    NVCV_HISTOGRAM_JOINT_2D,       50,       40,         1, false},
+    {    3840,   2160,       1,        3,  nvcv::TYPE_U8,    NVCV_HISTOGRAM_JOINT_2D,      256,      256,         0, false},
+});
+
+// clang-format on
+
+// Range of axis i, with 0 ranges the default of the data type
+static NVCVHistogramRange binnedHistogramRange(nvcv::DataType dataType, int numRanges, int i)
+{
+    float typeMax = dataType == nvcv::TYPE_U8 ? 256.f : (dataType == nvcv::TYPE_U16 ? 65536.f : 1.f);
+    if (numRanges == 0)
+    {
+        return {0.f, typeMax};
+    }
+    i = numRanges == 1 ? 0 : i;
+    return {typeMax * (0.05f + 0.1f * i), typeMax * (0.95f - 0.05f * i)};
+}
+
+template<typename T>
+static void testHistogramBinned(int width, int height, int batches, int channels, nvcv::DataType dataType,
+                                NVCVHistogramMode mode, int numBins0, int numBins1, int numRanges, bool useMask)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    bool joint   = mode == NVCV_HISTOGRAM_JOINT_2D;
+    int  numAxes = joint ? 2 : channels;
+
+    std::vector<NVCVHistogramRange> ranges, axisRanges;
+    for (int i = 0; i < numAxes; ++i)
+    {
+        axisRanges.push_back(binnedHistogramRange(dataType, numRanges, i));
+        if (i < numRanges)
+        {
+            ranges.push_back(axisRanges.back());
+        }
+    }
+
+    nvcv::Tensor inTensor({{batches, height, width, channels}, "NHWC"}, dataType);
+    nvcv::Tensor inMask    = nvcv::util::CreateTensor(batches, width, height, nvcv::ImageFormat(NVCV_IMAGE_FORMAT_U8));
+    nvcv::Tensor histogram = joint ? nvcv::Tensor({{batches, numBins0, numBins1}, "NHW"}, nvcv::TYPE_S32)
+                                   : nvcv::Tensor({{batches, numBins0, channels}, "HWC"}, nvcv::TYPE_S32);
+
+    auto inData = inTensor.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(inData);
+    auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+    ASSERT_TRUE(inAccess);
+
+    std::vector<uint32_t>                 goldHistogram;
+    std::default_random_engine            randEng(0);
+    std::uniform_real_distribution<float> randFloat(-0.25f, 1.25f); // some out of the default range
+    std::uniform_int_distribution<int>    randInt(0, dataType == nvcv::TYPE_U8 ? 255 : 65535);
+    std::uniform_int_distribution         randMask(0u, 1u);
+
+    for (int i = 0; i < batches; ++i)
+    {
+        std::vector<T> imageVec(width * height * channels);
+        for (T &v : imageVec)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                v = randFloat(randEng);
+            }
+            else
+            {
+                v = randInt(randEng);
+            }
+        }
+
+        int rowStride = width * channels * sizeof(T);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(inAccess->sampleData(i), inAccess->rowStride(), imageVec.data(), rowStride,
+                                            rowStride, height, cudaMemcpyHostToDevice));
+
+        std::vector<uint8_t> maskVec;
+        if (useMask)
+        {
+            maskVec.resize(width * height);
+            std::generate(maskVec.begin(), maskVec.end(), [&]() { return randMask(randEng); });
+            EXPECT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inMask.exportData(), maskVec, i));
+        }
+
+        computeBinnedHistogram(imageVec, maskVec, channels, mode, {numBins0, numBins1}, axisRanges, goldHistogram);
+    }
+
+    cvcuda::Histogram op;
+    nvcv::OptionalTensorConstRef mask = useMask ? nvcv::OptionalTensorConstRef{inMask} : nvcv::OptionalTensorConstRef{};
+    EXPECT_NO_THROW(op(stream, inTensor, mask, histogram, mode, ranges.empty() ? nullptr : ranges.data(),
+                       static_cast<int32_t>(ranges.size())));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    auto histData = histogram.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(histData);
+
+    int                   histRowBytes = histogram.shape()[1] * histogram.shape()[2] * sizeof(uint32_t);
+    std::vector<uint32_t> opHistogram(goldHistogram.size());
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(opHistogram.data(), histRowBytes, histData->basePtr(), histData->stride(0),
+                                        histRowBytes, batches, cudaMemcpyDeviceToHost));
+
+    ASSERT_EQ(opHistogram, goldHistogram);
+}
+
+TEST_P(OpHistogramBinned, Histogram)
+{
+    int               width     = GetParamValue<0>();
+    int               height    = GetParamValue<1>();
+    int               batches   = GetParamValue<2>();
+    int               channels  = GetParamValue<3>();
+    nvcv::DataType    dataType  = GetParamValue<4>();
+    NVCVHistogramMode mode      = GetParamValue<5>();
+    int               numBins0  = GetParamValue<6>();
+    int               numBins1  = GetParamValue<7>();
+    int               numRanges = GetParamValue<8>();
+    bool              useMask   = GetParamValue<9>();
+
+    if (dataType == nvcv::TYPE_U8)
+    {
+        testHistogramBinned<uint8_t>(width, height, batches, channels, dataType, mode, numBins0, numBins1, numRanges,
+                                     useMask);
+    }
+    else if (dataType == nvcv::TYPE_U16)
+    {
+        testHistogramBinned<uint16_t>(width, height, batches, channels, dataType, mode, numBins0, numBins1, numRanges,
+                                      useMask);
+    }
+    else
+    {
+        testHistogramBinned<float>(width, height, batches, channels, dataType, mode, numBins0, numBins1, numRanges,
+                                   useMask);
+    }
+}
+
+TEST(OpHistogramBinned, matches_histogram)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    int batches = 2;
+
+    nvcv::Tensor inTensor   = nvcv::util::CreateTensor(batches, 640, 480, nvcv::ImageFormat(NVCV_IMAGE_FORMAT_U8));
+    nvcv::Tensor histogram  = nvcv::util::CreateTensor(1, 256, batches, nvcv::ImageFormat(NVCV_IMAGE_FORMAT_S32));
+    nvcv::Tensor histogram2 = nvcv::util::CreateTensor(1, 256, batches, nvcv::ImageFormat(NVCV_IMAGE_FORMAT_S32));
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    for (int i = 0; i < batches; ++i)
+    {
+        std::vector<uint8_t> imageVec(640 * 480);
+        std::generate(imageVec.begin(), imageVec.end(), [&]() { return rand(randEng); });
+        EXPECT_NO_THROW(util::SetImageTensorFromVector<uint8_t>(inTensor.exportData(), imageVec, i));
+    }
+
+    cvcuda::Histogram op;
+    EXPECT_NO_THROW(op(stream, inTensor, nvcv::NullOpt, histogram));
+    EXPECT_NO_THROW(op(stream, inTensor, nvcv::NullOpt, histogram2, NVCV_HISTOGRAM_PER_CHANNEL));
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    std::vector<uint32_t> opHistogram, opHistogram2;
+    EXPECT_NO_THROW(util::GetImageVectorFromTensor(histogram.exportData(), 0, opHistogram));
+    EXPECT_NO_THROW(util::GetImageVectorFromTensor(histogram2.exportData(), 0, opHistogram2));
+
+    ASSERT_EQ(opHistogram, opHistogram2);
+}
+
+TEST(OpHistogramBinned_Negative, op)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor gray(nvcv::TensorShape{{1, 16, 16, 1}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor rgb(nvcv::TensorShape{{1, 16, 16, 3}, "NHWC"}, nvcv::TYPE_U8);
+    nvcv::Tensor rgbS8(nvcv::TensorShape{{1, 16, 16, 3}, "NHWC"}, nvcv::TYPE_S8);
+    nvcv::Tensor perChannel(nvcv::TensorShape{{1, 256, 3}, "HWC"}, nvcv::TYPE_S32);
+    nvcv::Tensor joint(nvcv::TensorShape{{1, 32, 32}, "NHW"}, nvcv::TYPE_S32);
+    nvcv::Tensor perChannelF32(nvcv::TensorShape{{1, 256, 3}, "HWC"}, nvcv::TYPE_F32);
+
+    NVCVHistogramRange validRanges[3]   = {{0.f, 256.f}, {0.f, 128.f}, {10.f, 20.f}};
+    NVCVHistogramRange invalidRanges[1] = {{10.f, 10.f}};
+
+    cvcuda::Histogram op;
+
+    auto submit = [&](const nvcv::Tensor &in, const nvcv::Tensor &hist, NVCVHistogramMode mode,
+                      const NVCVHistogramRange *ranges, int32_t numRanges)
+    { return nvcv::ProtectCall([&] { op(stream, in, nvcv::NullOpt, hist, mode, ranges, numRanges); }); };
+
+    EXPECT_EQ(NVCV_SUCCESS, submit(rgb, perChannel, NVCV_HISTOGRAM_PER_CHANNEL, validRanges, 3));
+    EXPECT_EQ(NVCV_SUCCESS, submit(rgb, joint, NVCV_HISTOGRAM_JOINT_2D, validRanges, 1));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(gray, joint, NVCV_HISTOGRAM_JOINT_2D, nullptr, 0));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(gray, perChannel, NVCV_HISTOGRAM_PER_CHANNEL, nullptr, 0));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(rgbS8, perChannel, NVCV_HISTOGRAM_PER_CHANNEL, nullptr, 0));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(rgb, joint, NVCV_HISTOGRAM_PER_CHANNEL, nullptr, 0));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(rgb, perChannelF32, NVCV_HISTOGRAM_PER_CHANNEL, nullptr, 0));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(rgb, perChannel, NVCV_HISTOGRAM_PER_CHANNEL, validRanges, 2));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(rgb, perChannel, NVCV_HISTOGRAM_PER_CHANNEL, invalidRanges, 1));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, submit(rgb, perChannel, NVCV_HISTOGRAM_PER_CHANNEL, nullptr, 3));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpHistogram_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat, nvcv::ImageFormat, int, int>{
     // inFmt, histFmt, batches, histHeight
@@ -24,6 +24,7 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 
@@ -173,6 +174,67 @@ static void GenerateInputWithBorderReplicate(std::vector<uint8_t> &hDst, int dst
     }
 }
 
+// Median with a histogram sliding along each row, replicating the border. The median is searched in the
+// histogram of the high byte first and then among the values of the found high byte.
+template<typename T>
+static void HostMedianHistogram(std::vector<T> &hDst, const std::vector<T> &hSrc, int width, int height, int channels,
+                                nvcv::Size2D ksize)
+{
+    constexpr int coarseShift = 8 * sizeof(T) - 8;
+
+    std::vector<int> fine(1 << (8 * sizeof(T)));
+    std::vector<int> coarse(256);
+
+    const int rank = (ksize.w * ksize.h) / 2;
+
+    for (int c = 0; c < channels; c++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            std::fill(fine.begin(), fine.end(), 0);
+            std::fill(coarse.begin(), coarse.end(), 0);
+
+            auto addColumn = [&](int x, int delta)
+            {
+                x = std::clamp(x, 0, width - 1);
+                for (int j = -ksize.h / 2; j <= ksize.h / 2; j++)
+                {
+                    T v = hSrc[(std::clamp(y + j, 0, height - 1) * width + x) * channels + c];
+                    fine[v] += delta;
+                    coarse[v >> coarseShift] += delta;
+                }
+            };
+
+            for (int i = -ksize.w / 2; i <= ksize.w / 2; i++)
+            {
+                addColumn(i, 1);
+            }
+
+            for (int x = 0; x < width; x++)
+            {
+                if (x > 0)
+                {
+                    addColumn(x - ksize.w / 2 - 1, -1);
+                    addColumn(x + ksize.w / 2, 1);
+                }
+
+                int below = 0, bin = 0;
+                while (below + coarse[bin] <= rank)
+                {
+                    below += coarse[bin++];
+                }
+                int value = bin << coarseShift;
+                while (below + fine[value] <= rank)
+                {
+                    below += fine[value++];
+                }
+
+                hDst[(y * width + x) * channels + c] = value;
+            }
+        }
+    }
+}
+
 // clang-format off
 
 NVCV_TEST_SUITE_P(OpMedianBlur, test::ValueList<int, int, nvcv::Size2D, int>
@@ -462,6 +524,200 @@ TEST_P(OpMedianBlur, varshape_correct_output)
     }
 }
 
+// clang-format off
+
+// Both 8bit and 16bit pixels go through the sliding histograms. 16bit pixels with a small maxValue span few coarse
+// bins, so the fine histogram is mostly slid along, the others make the median change coarse bins often.
+NVCV_TEST_SUITE_P(OpMedianBlurLargeKernel, test::ValueList<int, int, int, int, nvcv::DataType, int, nvcv::Size2D>
+{
+    // width,  height,  numberImages,  channels,       dataType,  maxValue,  kernel size
+    {    100,     150,             2,         1,  nvcv::TYPE_U8,       255,      {11,11}},
+    {     67,     129,             1,         3,  nvcv::TYPE_U8,       255,      {15,15}},
+    {    333,      70,             1,         4,  nvcv::TYPE_U8,       255,      {31,31}},
+    {     45,     200,             3,         1,  nvcv::TYPE_U8,         7,      {1,121}},
+    {    200,      40,             1,         2,  nvcv::TYPE_U8,       255,       {41,3}},
+    {    100,     150,             2,         1, nvcv::TYPE_U16,     65535,      {11,11}},
+    {     67,     129,             1,         3, nvcv::TYPE_U16,      1000,      {15,15}},
+    {    130,      70,             1,         4, nvcv::TYPE_U16,     65535,      {31,31}},
+    {     16,       9,             1,         1, nvcv::TYPE_U16,       300,      {21,21}},
+    {     70,      60,             2,         1, nvcv::TYPE_U16,     65535,       {3,61}},
+});
+
+// clang-format on
+
+template<typename T>
+static void TestMedianBlurLargeKernel(int width, int height, int numberOfImages, int channels, nvcv::DataType dataType,
+                                      int maxValue, nvcv::Size2D ksize)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::Tensor imgSrc({{numberOfImages, height, width, channels}, "NHWC"}, dataType);
+    nvcv::Tensor imgDst({{numberOfImages, height, width, channels}, "NHWC"}, dataType);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nvcv::NullOpt, srcData);
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    ASSERT_TRUE(srcAccess);
+
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nvcv::NullOpt, dstData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(dstAccess);
+
+    int vecRowStride = width * channels * sizeof(T);
+
+    std::default_random_engine         randEng;
+    std::uniform_int_distribution<int> rand(0, maxValue);
+
+    std::vector<std::vector<T>> srcVec(numberOfImages);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        srcVec[i].resize(height * width * channels);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcAccess->sampleData(i), srcAccess->rowStride(), srcVec[i].data(),
+                                            vecRowStride, vecRowStride, height, cudaMemcpyHostToDevice));
+    }
+
+    cvcuda::MedianBlur medianBlurOp(0);
+    EXPECT_NO_THROW(medianBlurOp(stream, imgSrc, imgDst, ksize));
+
+    EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<T> testVec(height * width * channels);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), vecRowStride, dstAccess->sampleData(i),
+                                            dstAccess->rowStride(), vecRowStride, height, cudaMemcpyDeviceToHost));
+
+        std::vector<T> goldVec(height * width * channels);
+        HostMedianHistogram(goldVec, srcVec[i], width, height, channels, ksize);
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
+
+TEST_P(OpMedianBlurLargeKernel, tensor_correct_output)
+{
+    int            width          = GetParamValue<0>();
+    int            height         = GetParamValue<1>();
+    int            numberOfImages = GetParamValue<2>();
+    int            channels       = GetParamValue<3>();
+    nvcv::DataType dataType       = GetParamValue<4>();
+    int            maxValue       = GetParamValue<5>();
+    nvcv::Size2D   ksize          = GetParamValue<6>();
+
+    if (dataType == nvcv::TYPE_U8)
+    {
+        TestMedianBlurLargeKernel<uint8_t>(width, height, numberOfImages, channels, dataType, maxValue, ksize);
+    }
+    else
+    {
+        TestMedianBlurLargeKernel<uint16_t>(width, height, numberOfImages, channels, dataType, maxValue, ksize);
+    }
+}
+
+// The column histograms are per stream, the same operator can run on several streams at once.
+TEST(OpMedianBlur, histogram_concurrent_streams)
+{
+    constexpr int      kNumStreams = 4;
+    const int          width = 133, height = 97, channels = 3;
+    const nvcv::Size2D ksize{31, 31};
+    const int          vecRowStride = width * channels;
+
+    cvcuda::MedianBlur medianBlurOp(0);
+
+    std::vector<cudaStream_t>         streams(kNumStreams);
+    std::vector<nvcv::Tensor>         srcs, dsts;
+    std::vector<std::vector<uint8_t>> srcVecs(kNumStreams);
+
+    std::default_random_engine         randEng;
+    std::uniform_int_distribution<int> rand(0, 255);
+
+    for (int i = 0; i < kNumStreams; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&streams[i]));
+
+        srcs.emplace_back(nvcv::TensorShape{{1, height, width, channels}, "NHWC"}, nvcv::TYPE_U8);
+        dsts.emplace_back(nvcv::TensorShape{{1, height, width, channels}, "NHWC"}, nvcv::TYPE_U8);
+
+        auto srcData = srcs[i].exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(nvcv::NullOpt, srcData);
+
+        srcVecs[i].resize(height * vecRowStride);
+        std::generate(srcVecs[i].begin(), srcVecs[i].end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(srcData->basePtr(), srcData->stride(1), srcVecs[i].data(), vecRowStride,
+                                            vecRowStride, height, cudaMemcpyHostToDevice));
+    }
+
+    for (int i = 0; i < kNumStreams; ++i)
+    {
+        EXPECT_NO_THROW(medianBlurOp(streams[i], srcs[i], dsts[i], ksize));
+    }
+
+    for (int i = 0; i < kNumStreams; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(streams[i]));
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(streams[i]));
+
+        auto dstData = dsts[i].exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_NE(nvcv::NullOpt, dstData);
+
+        std::vector<uint8_t> testVec(height * vecRowStride);
+        ASSERT_EQ(cudaSuccess, cudaMemcpy2D(testVec.data(), vecRowStride, dstData->basePtr(), dstData->stride(1),
+                                            vecRowStride, height, cudaMemcpyDeviceToHost));
+
+        std::vector<uint8_t> goldVec(height * vecRowStride);
+        HostMedianHistogram(goldVec, srcVecs[i], width, height, channels, ksize);
+
+        EXPECT_EQ(goldVec, testVec);
+    }
+}
+
+TEST(OpMedianBlur, histogram_host_reference_matches_sort)
+{
+    const nvcv::ImageFormat fmt       = nvcv::FMT_RGB8;
+    const int               width     = 37;
+    const int               height    = 23;
+    const int               rowStride = width * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    std::vector<uint8_t> srcVec(height * rowStride);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+
+    for (nvcv::Size2D ksize : {nvcv::Size2D{3, 3}, nvcv::Size2D{15, 15}, nvcv::Size2D{21, 9}, nvcv::Size2D{1, 25},
+                               nvcv::Size2D{51, 51}})
+    {
+        SCOPED_TRACE(ksize.w);
+        SCOPED_TRACE(ksize.h);
+
+        int brdWidth     = width + (ksize.w / 2) * 2;
+        int brdHeight    = height + (ksize.h / 2) * 2;
+        int brdRowStride = brdWidth * fmt.planePixelStrideBytes(0);
+
+        std::vector<uint8_t> brdVec(brdHeight * brdRowStride);
+        GenerateInputWithBorderReplicate(brdVec, brdRowStride, {brdWidth, brdHeight}, srcVec, rowStride,
+                                         {width, height}, fmt, ksize);
+
+        std::vector<uint8_t> goldVec(height * rowStride);
+        GenerateMedianBlurGoldenOutput(goldVec, rowStride, {width, height}, brdVec, brdRowStride,
+                                       {brdWidth, brdHeight}, fmt, ksize);
+
+        std::vector<uint8_t> histVec(height * rowStride);
+        HostMedianHistogram(histVec, srcVec, width, height, fmt.numChannels(), ksize);
+
+        EXPECT_EQ(goldVec, histVec);
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpMedianBlur_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat, nvcv::Size2D>{
     // inFmt, outFmt, kernelSize
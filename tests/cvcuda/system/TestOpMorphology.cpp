@@ -34,10 +34,12 @@ namespace cuda = nvcv::cuda;
 
 using uchar = unsigned char;
 
+using HostMorphFn = decltype(&test::Morph);
+
 static void hostMorphDilateErode(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
                                  const long3 &srcStrides, const int3 &shape, const nvcv::ImageFormat &format,
                                  const nvcv::Size2D &kernelSize, int2 &kernelAnchor, int iterations,
-                                 const NVCVBorderType &borderMode, NVCVMorphologyType type)
+                                 const NVCVBorderType &borderMode, NVCVMorphologyType type, HostMorphFn morph)
 {
     std::vector<uint8_t> tmpDst;
     tmpDst.reserve(hSrc.size());
@@ -45,13 +47,12 @@ static void hostMorphDilateErode(std::vector<uint8_t> &hDst, const long3 &dstStr
     {
         if (i == 0)
         {
-            test::Morph(hDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode, type);
+            morph(hDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode, type);
         }
         else
         {
             tmpDst = hDst;
-            test::Morph(hDst, dstStrides, tmpDst, dstStrides, shape, format, kernelSize, kernelAnchor, borderMode,
-                        type);
+            morph(hDst, dstStrides, tmpDst, dstStrides, shape, format, kernelSize, kernelAnchor, borderMode, type);
         }
     }
 }
@@ -59,7 +60,7 @@ static void hostMorphDilateErode(std::vector<uint8_t> &hDst, const long3 &dstStr
 static void hostMorph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const std::vector<uint8_t> &hSrc,
                       const long3 &srcStrides, const int3 &shape, const nvcv::ImageFormat &format,
                       const nvcv::Size2D &kernelSize, int2 &kernelAnchor, int iterations,
-                      const NVCVBorderType &borderMode, NVCVMorphologyType type)
+                      const NVCVBorderType &borderMode, NVCVMorphologyType type, HostMorphFn morph = test::Morph)
 {
     switch (type)
     {
@@ -67,7 +68,7 @@ static void hostMorph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const
     case NVCVMorphologyType::NVCV_ERODE:
     {
         hostMorphDilateErode(hDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, iterations,
-                             borderMode, type);
+                             borderMode, type, morph);
         break;
     }
     case NVCVMorphologyType::NVCV_OPEN:
@@ -83,16 +84,13 @@ static void hostMorph(std::vector<uint8_t> &hDst, const long3 &dstStrides, const
         {
             if (i == 0)
             {
-                test::Morph(tmpDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode,
-                            first);
+                morph(tmpDst, dstStrides, hSrc, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode, first);
             }
             else
             {
-                test::Morph(tmpDst, dstStrides, hDst, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode,
-                            first);
+                morph(tmpDst, dstStrides, hDst, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode, first);
             }
-            test::Morph(hDst, dstStrides, tmpDst, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode,
-                        second);
+            morph(hDst, dstStrides, tmpDst, srcStrides, shape, format, kernelSize, kernelAnchor, borderMode, second);
         }
         break;
     }
@@ -510,24 +508,12 @@ TEST_P(OpMorphology, morph_noop)
     ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
 
-TEST_P(OpMorphology, morph_random)
+static void testMorphRandom(int width, int height, int batches, nvcv::ImageFormat format, nvcv::Size2D maskSize,
+                            NVCVBorderType borderMode, NVCVMorphologyType morphType, int iteration, HostMorphFn morph)
 {
     cudaStream_t stream;
     ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
 
-    int width   = GetParamValue<0>();
-    int height  = GetParamValue<1>();
-    int batches = GetParamValue<2>();
-
-    nvcv::ImageFormat format{GetParamValue<3>()};
-
-    nvcv::Size2D maskSize;
-    maskSize.w                    = GetParamValue<4>();
-    maskSize.h                    = GetParamValue<5>();
-    NVCVBorderType     borderMode = GetParamValue<6>();
-    NVCVMorphologyType morphType  = GetParamValue<7>();
-    int                iteration  = GetParamValue<8>();
-
     int3 shape{width, height, batches};
 
     nvcv::Tensor inTensor        = nvcv::util::CreateTensor(batches, width, height, format);
@@ -592,11 +578,150 @@ TEST_P(OpMorphology, morph_random)
     }
     int2 kernelAnchor{maskSize.w / 2, maskSize.h / 2};
     hostMorph(goldVec, outStrides, inVec, inStrides, shape, format, maskSize, kernelAnchor, iteration, borderMode,
-              morphType);
+              morphType, morph);
 
     EXPECT_EQ(testVec, goldVec);
 }
 
+TEST_P(OpMorphology, morph_random)
+{
+    int                width      = GetParamValue<0>();
+    int                height     = GetParamValue<1>();
+    int                batches    = GetParamValue<2>();
+    nvcv::ImageFormat  format     = nvcv::ImageFormat{GetParamValue<3>()};
+    nvcv::Size2D       maskSize   = {GetParamValue<4>(), GetParamValue<5>()};
+    NVCVBorderType     borderMode = GetParamValue<6>();
+    NVCVMorphologyType morphType  = GetParamValue<7>();
+    int                iteration  = GetParamValue<8>();
+
+    testMorphRandom(width, height, batches, format, maskSize, borderMode, morphType, iteration, test::Morph);
+}
+
+// Kernels large enough to go through the separable van Herk/Gil-Werman passes, checked against
+// the separable host reference as the direct one is too slow at these sizes.
+// clang-format off
+NVCV_TEST_SUITE_P(OpMorphologyLargeKernel, test::ValueList<int, int, int, NVCVImageFormat, int, int, NVCVBorderType, NVCVMorphologyType, int>
+{
+    // width, height, batches,               format,  maskWidth, maskHeight,             borderMode,  morphType,    iteration
+    {    217,    151,       2, NVCV_IMAGE_FORMAT_U8,         31,         31,   NVCV_BORDER_CONSTANT, NVCV_ERODE,            1},
+    {    217,    151,       1, NVCV_IMAGE_FORMAT_U8,         51,         51,   NVCV_BORDER_REPLICATE, NVCV_DILATE,          1},
+    {    320,    240,       1, NVCV_IMAGE_FORMAT_RGB8,      101,          3,   NVCV_BORDER_REFLECT, NVCV_ERODE,             1},
+    {    320,    240,       1, NVCV_IMAGE_FORMAT_RGBA8,       3,        101,   NVCV_BORDER_REFLECT101, NVCV_DILATE,         1},
+    {     45,     33,       2, NVCV_IMAGE_FORMAT_U8,         64,         80,   NVCV_BORDER_WRAP, NVCV_DILATE,               2},
+    {    300,    200,       1, NVCV_IMAGE_FORMAT_U16,        25,          1,   NVCV_BORDER_CONSTANT, NVCV_DILATE,           1},
+    {    300,    200,       2, NVCV_IMAGE_FORMAT_RGBAf32,    12,          9,   NVCV_BORDER_REPLICATE, NVCV_ERODE,           2},
+    {    217,    151,       1, NVCV_IMAGE_FORMAT_U8,         31,         31,   NVCV_BORDER_REPLICATE, NVCV_OPEN,            1},
+    {    217,    151,       2, NVCV_IMAGE_FORMAT_RGB8,       51,         51,   NVCV_BORDER_CONSTANT, NVCV_CLOSE,            2},
+});
+
+// clang-format on
+
+TEST_P(OpMorphologyLargeKernel, morph_random)
+{
+    int                width      = GetParamValue<0>();
+    int                height     = GetParamValue<1>();
+    int                batches    = GetParamValue<2>();
+    nvcv::ImageFormat  format     = nvcv::ImageFormat{GetParamValue<3>()};
+    nvcv::Size2D       maskSize   = {GetParamValue<4>(), GetParamValue<5>()};
+    NVCVBorderType     borderMode = GetParamValue<6>();
+    NVCVMorphologyType morphType  = GetParamValue<7>();
+    int                iteration  = GetParamValue<8>();
+
+    testMorphRandom(width, height, batches, format, maskSize, borderMode, morphType, iteration, test::MorphSeparable);
+}
+
+// The row buffer of large kernels is per stream, the same operator can run on several streams at once.
+TEST(OpMorphology, large_kernel_concurrent_streams)
+{
+    constexpr int     kNumStreams = 4;
+    const int3        shape{217, 151, 2};
+    nvcv::ImageFormat format{NVCV_IMAGE_FORMAT_U8};
+    nvcv::Size2D      maskSize{31, 31};
+
+    cvcuda::Morphology morphOp;
+
+    std::vector<cudaStream_t>         streams(kNumStreams);
+    std::vector<nvcv::Tensor>         inTensors, outTensors;
+    std::vector<std::vector<uint8_t>> inVecs(kNumStreams);
+
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+
+    long3 strides;
+    for (int i = 0; i < kNumStreams; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamCreate(&streams[i]));
+
+        inTensors.push_back(nvcv::util::CreateTensor(shape.z, shape.x, shape.y, format));
+        outTensors.push_back(nvcv::util::CreateTensor(shape.z, shape.x, shape.y, format));
+
+        auto inData   = inTensors[i].exportData<nvcv::TensorDataStridedCuda>();
+        auto inAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*inData);
+        ASSERT_TRUE(inAccess);
+        strides = long3{inAccess->sampleStride(), inAccess->rowStride(), inAccess->colStride()};
+
+        inVecs[i].resize(strides.x * shape.z);
+        std::generate(inVecs[i].begin(), inVecs[i].end(), [&]() { return rand(randEng); });
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpy(inData->basePtr(), inVecs[i].data(), inVecs[i].size(), cudaMemcpyHostToDevice));
+    }
+
+    for (int i = 0; i < kNumStreams; ++i)
+    {
+        EXPECT_NO_THROW(morphOp(streams[i], inTensors[i], outTensors[i], nvcv::NullOpt, NVCV_ERODE, maskSize, {-1, -1},
+                                1, NVCV_BORDER_REPLICATE));
+    }
+
+    for (int i = 0; i < kNumStreams; ++i)
+    {
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(streams[i]));
+        ASSERT_EQ(cudaSuccess, cudaStreamDestroy(streams[i]));
+
+        auto outData = outTensors[i].exportData<nvcv::TensorDataStridedCuda>();
+
+        std::vector<uint8_t> testVec(inVecs[i].size()), goldVec(inVecs[i].size());
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(testVec.data(), outData->basePtr(), testVec.size(), cudaMemcpyDeviceToHost));
+
+        int2 kernelAnchor{maskSize.w / 2, maskSize.h / 2};
+        hostMorph(goldVec, strides, inVecs[i], strides, shape, format, maskSize, kernelAnchor, 1, NVCV_BORDER_REPLICATE,
+                  NVCV_ERODE, test::MorphSeparable);
+        EXPECT_EQ(testVec, goldVec) << "stream " << i;
+    }
+}
+
+TEST(OpMorphology, separable_host_reference_matches_direct)
+{
+    const int3        shape{37, 29, 2};
+    nvcv::ImageFormat format{NVCV_IMAGE_FORMAT_U8};
+    long3             strides{shape.x * shape.y, shape.x, 1};
+
+    std::vector<uint8_t>          src(strides.x * shape.z);
+    std::default_random_engine    randEng(0);
+    std::uniform_int_distribution rand(0u, 255u);
+    std::generate(src.begin(), src.end(), [&]() { return rand(randEng); });
+
+    for (nvcv::Size2D kernelSize : {nvcv::Size2D{7, 5}, nvcv::Size2D{1, 9}, nvcv::Size2D{12, 3}, nvcv::Size2D{40, 40}})
+    {
+        for (NVCVBorderType borderMode : {NVCV_BORDER_CONSTANT, NVCV_BORDER_REPLICATE, NVCV_BORDER_REFLECT,
+                                          NVCV_BORDER_WRAP, NVCV_BORDER_REFLECT101})
+        {
+            for (NVCVMorphologyType type : {NVCV_ERODE, NVCV_DILATE})
+            {
+                SCOPED_TRACE(testing::Message() << kernelSize.w << "x" << kernelSize.h << " border " << borderMode
+                                                << " type " << type);
+
+                std::vector<uint8_t> direct(src.size()), separable(src.size());
+                int2                 anchor{0, -1};
+                test::Morph(direct, strides, src, strides, shape, format, kernelSize, anchor, borderMode, type);
+                anchor = {0, -1};
+                test::MorphSeparable(separable, strides, src, strides, shape, format, kernelSize, anchor, borderMode,
+                                     type);
+                EXPECT_EQ(direct, separable);
+            }
+        }
+    }
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpMorphologyVarShape, test::ValueList<int, int, int, NVCVImageFormat, int, int, NVCVBorderType, NVCVMorphologyType, int>
 {
@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include "NMSUtils.hpp"
+
 #include <common/TensorDataUtils.hpp>
 #include <common/ValueTests.hpp>
 #include <cvcuda/OpNonMaximumSuppression.hpp>
@@ -270,3 +272,240 @@ TEST_P(OpNonMaximumSuppression_Negative, op)
     ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
     ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
+
+// clang-format off
+
+NVCV_TEST_SUITE_P(OpNonMaximumSuppression_TopK, test::ValueList<int, int, int, int, float, float, NVCVNMSScoreDecay>
+{
+    // numSamples, numBBoxes, numClasses, maxOutputs, scThresh, iouThresh,                    scoreDecay
+    {           1,         5,          0,          5,     .50f,      .75f,     NVCV_NMS_SCORE_DECAY_NONE},
+    {           3,        23,          0,         10,     .25f,      .50f,     NVCV_NMS_SCORE_DECAY_NONE},
+    {          10,       123,          3,         20,     .35f,      .45f,     NVCV_NMS_SCORE_DECAY_NONE},
+    {           2,      1234,          0,        100,     .05f,      .65f,     NVCV_NMS_SCORE_DECAY_NONE},
+    {           1,     20000,          8,        300,     .01f,      .50f,     NVCV_NMS_SCORE_DECAY_NONE},
+    {        2000,         4,          2,          2,     .55f,      .25f,     NVCV_NMS_SCORE_DECAY_NONE},
+    {           3,        23,          0,         10,     .25f,      .50f,   NVCV_NMS_SCORE_DECAY_LINEAR},
+    {           4,      1234,          3,         50,     .05f,      .30f,   NVCV_NMS_SCORE_DECAY_LINEAR},
+    {           3,        23,          0,         10,     .25f,      .50f, NVCV_NMS_SCORE_DECAY_GAUSSIAN},
+    {           2,      1234,          0,         50,     .05f,      .50f, NVCV_NMS_SCORE_DECAY_GAUSSIAN},
+});
+
+// clang-format on
+
+TEST_P(OpNonMaximumSuppression_TopK, correct_output)
+{
+    int               numSamples = GetParamValue<0>();
+    int               numBBoxes  = GetParamValue<1>();
+    int               numClasses = GetParamValue<2>();
+    int               maxOutputs = GetParamValue<3>();
+    float             scThresh   = GetParamValue<4>();
+    float             iouThresh  = GetParamValue<5>();
+    NVCVNMSScoreDecay scoreDecay = GetParamValue<6>();
+    float             sigma      = 0.5f;
+
+    nvcv::Tensor srcBB({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_4S16);
+    nvcv::Tensor srcSc({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_F32);
+    nvcv::Tensor dstIdx({{numSamples, maxOutputs}, "NW"}, nvcv::TYPE_S32);
+    nvcv::Tensor dstSc({{numSamples, maxOutputs}, "NW"}, nvcv::TYPE_F32);
+    nvcv::Tensor dstCnt({{numSamples}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor srcCl; // no class ids when empty
+
+    if (numClasses > 0)
+    {
+        srcCl = nvcv::Tensor({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_S32);
+    }
+
+    std::uniform_int_distribution<int16_t> randPos(0, 512), randSize(20, 100), randScore(0, 1 << 20);
+    std::uniform_int_distribution<int>     randClass(0, std::max(numClasses - 1, 0));
+
+    std::vector<std::vector<short4>> bboxes(numSamples, std::vector<short4>(numBBoxes));
+    std::vector<std::vector<float>>  scores(numSamples, std::vector<float>(numBBoxes));
+    std::vector<std::vector<int>>    classIds(numSamples, std::vector<int>(numClasses > 0 ? numBBoxes : 0));
+
+    for (int x = 0; x < numSamples; ++x)
+    {
+        for (int y = 0; y < numBBoxes; ++y)
+        {
+            bboxes[x][y] = short4{randPos(g_rng), randPos(g_rng), randSize(g_rng), randSize(g_rng)};
+            scores[x][y] = randScore(g_rng) / static_cast<float>(1 << 20);
+            if (numClasses > 0)
+            {
+                classIds[x][y] = randClass(g_rng);
+            }
+        }
+    }
+
+    auto copyToTensor = [&](const nvcv::Tensor &tensor, auto &values)
+    {
+        auto data = tensor.exportData<nvcv::TensorDataStridedCuda>();
+        ASSERT_TRUE(data);
+        for (int x = 0; x < numSamples; ++x)
+        {
+            ASSERT_EQ(cudaSuccess, cudaMemcpy(data->basePtr() + x * data->stride(0), values[x].data(),
+                                              values[x].size() * sizeof(values[x][0]), cudaMemcpyHostToDevice));
+        }
+    };
+
+    copyToTensor(srcBB, bboxes);
+    copyToTensor(srcSc, scores);
+    if (numClasses > 0)
+    {
+        copyToTensor(srcCl, classIds);
+    }
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::NonMaximumSuppression nms;
+
+    cvcuda::UniqueWorkspace ws
+        = cvcuda::AllocateWorkspace(nms.getWorkspaceRequirements(numSamples, numBBoxes, maxOutputs));
+    EXPECT_NO_THROW(
+        nms(stream, ws.get(), srcBB, srcSc, srcCl, dstIdx, dstSc, dstCnt, scThresh, iouThresh, scoreDecay, sigma));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    auto dstIdxData = dstIdx.exportData<nvcv::TensorDataStridedCuda>();
+    auto dstScData  = dstSc.exportData<nvcv::TensorDataStridedCuda>();
+    auto dstCntData = dstCnt.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(dstIdxData && dstScData && dstCntData);
+
+    std::vector<int> countTest(numSamples);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2D(countTest.data(), sizeof(int), dstCntData->basePtr(), dstCntData->stride(0),
+                                        sizeof(int), numSamples, cudaMemcpyDeviceToHost));
+
+    for (int x = 0; x < numSamples; ++x)
+    {
+        std::vector<int>   indicesTest(maxOutputs), indicesGold;
+        std::vector<float> scoresTest(maxOutputs), scoresGold;
+
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(indicesTest.data(), dstIdxData->basePtr() + x * dstIdxData->stride(0),
+                                          maxOutputs * sizeof(int), cudaMemcpyDeviceToHost));
+        ASSERT_EQ(cudaSuccess, cudaMemcpy(scoresTest.data(), dstScData->basePtr() + x * dstScData->stride(0),
+                                          maxOutputs * sizeof(float), cudaMemcpyDeviceToHost));
+
+        test::NMSTopKCPU(indicesGold, scoresGold, bboxes[x], scores[x], classIds[x], maxOutputs, scThresh, iouThresh,
+                         scoreDecay, sigma);
+
+        ASSERT_EQ(countTest[x], static_cast<int>(indicesGold.size())) << "sample " << x;
+
+        indicesGold.resize(maxOutputs, -1);
+        scoresGold.resize(maxOutputs, 0.f);
+
+        EXPECT_EQ(indicesTest, indicesGold) << "sample " << x;
+        for (int k = 0; k < maxOutputs; ++k)
+        {
+            EXPECT_NEAR(scoresTest[k], scoresGold[k], 1e-5f) << "sample " << x << " output " << k;
+        }
+    }
+}
+
+TEST(OpNonMaximumSuppression_TopK, overlapping_classes_and_cap)
+{
+    // Two identical boxes of different classes and a third overlapping the first one
+    std::vector<short4> bboxes{
+        {0, 0, 10, 10},
+        {0, 0, 10, 10},
+        {1, 0, 10, 10},
+        {50, 50, 10, 10}
+    };
+    std::vector<float> scores{.9f, .8f, .7f, .6f};
+    std::vector<int>   classIds{0, 1, 0, 0};
+
+    std::vector<int>   indices;
+    std::vector<float> outScores;
+
+    test::NMSTopKCPU(indices, outScores, bboxes, scores, {}, 4, .5f, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f);
+    EXPECT_EQ(indices, (std::vector<int>{0, 3}));
+
+    test::NMSTopKCPU(indices, outScores, bboxes, scores, classIds, 4, .5f, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f);
+    EXPECT_EQ(indices, (std::vector<int>{0, 1, 3}));
+
+    test::NMSTopKCPU(indices, outScores, bboxes, scores, classIds, 2, .5f, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f);
+    EXPECT_EQ(indices, (std::vector<int>{0, 1}));
+
+    // Linear decay keeps the overlapping box with a lower score, 0.7 * (1 - 90/110)
+    test::NMSTopKCPU(indices, outScores, bboxes, scores, classIds, 4, .1f, .5f, NVCV_NMS_SCORE_DECAY_LINEAR, .5f);
+    EXPECT_EQ(indices, (std::vector<int>{0, 1, 3, 2}));
+    EXPECT_NEAR(outScores[3], .7f * (1.f - 90.f / 110.f), 1e-6f);
+}
+
+// clang-format off
+NVCV_TEST_SUITE_P(OpNonMaximumSuppression_TopK_Negative, test::ValueList<nvcv::DataType, nvcv::DataType, nvcv::DataType, int, int, float, NVCVNMSScoreDecay, float>{
+    // classIds dtype, outIndices dtype, outCount dtype, numSamplesOut, maxOutputsScores, iouThresh, scoreDecay, sigma
+    {nvcv::TYPE_F32, nvcv::TYPE_S32, nvcv::TYPE_S32, 3, 4, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f}, // classIds: not S32
+    {nvcv::TYPE_S32, nvcv::TYPE_U8, nvcv::TYPE_S32, 3, 4, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f}, // outIndices: not S32
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_F32, 3, 4, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f}, // outCount: not S32
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_S32, 2, 4, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f}, // outputs number of batches is not equal
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_S32, 3, 5, .5f, NVCV_NMS_SCORE_DECAY_NONE, .5f}, // indices, scores number of boxes is not equal
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_S32, 3, 4, 0.f, NVCV_NMS_SCORE_DECAY_NONE, .5f}, // invalid iou threshold
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_S32, 3, 4, 1.5f, NVCV_NMS_SCORE_DECAY_LINEAR, .5f}, // invalid iou threshold
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_S32, 3, 4, .5f, NVCV_NMS_SCORE_DECAY_GAUSSIAN, 0.f}, // invalid sigma
+    {nvcv::TYPE_S32, nvcv::TYPE_S32, nvcv::TYPE_S32, 3, 4, .5f, static_cast<NVCVNMSScoreDecay>(3), .5f}, // invalid score decay
+});
+
+// clang-format on
+
+TEST_P(OpNonMaximumSuppression_TopK_Negative, op)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::DataType    classIdsDatatype = GetParamValue<0>();
+    nvcv::DataType    dstIdxDatatype   = GetParamValue<1>();
+    nvcv::DataType    dstCntDatatype   = GetParamValue<2>();
+    const int         numSamplesOut    = GetParamValue<3>();
+    const int         maxOutputsScores = GetParamValue<4>();
+    const float       iouThresh        = GetParamValue<5>();
+    NVCVNMSScoreDecay scoreDecay       = GetParamValue<6>();
+    const float       sigma            = GetParamValue<7>();
+
+    const int numSamples = 3, numBBoxes = 5, maxOutputs = 4;
+
+    nvcv::Tensor srcBB({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_4S16);
+    nvcv::Tensor srcSc({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_F32);
+    nvcv::Tensor srcCl({{numSamples, numBBoxes}, "NW"}, classIdsDatatype);
+    nvcv::Tensor dstIdx({{numSamplesOut, maxOutputs}, "NW"}, dstIdxDatatype);
+    nvcv::Tensor dstSc({{numSamples, maxOutputsScores}, "NW"}, nvcv::TYPE_F32);
+    nvcv::Tensor dstCnt({{numSamples}, "N"}, dstCntDatatype);
+
+    cvcuda::NonMaximumSuppression nms;
+
+    cvcuda::UniqueWorkspace ws
+        = cvcuda::AllocateWorkspace(nms.getWorkspaceRequirements(numSamples, numBBoxes, maxOutputs));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall(
+                                               [&] {
+                                                   nms(stream, ws.get(), srcBB, srcSc, srcCl, dstIdx, dstSc, dstCnt,
+                                                       0.5f, iouThresh, scoreDecay, sigma);
+                                               }));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpNonMaximumSuppression_TopK_Negative, workspace_too_small)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const int numSamples = 3, numBBoxes = 5, maxOutputs = 4;
+
+    nvcv::Tensor srcBB({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_4S16);
+    nvcv::Tensor srcSc({{numSamples, numBBoxes}, "NW"}, nvcv::TYPE_F32);
+    nvcv::Tensor dstIdx({{numSamples, maxOutputs}, "NW"}, nvcv::TYPE_S32);
+    nvcv::Tensor dstCnt({{numSamples}, "N"}, nvcv::TYPE_S32);
+
+    cvcuda::NonMaximumSuppression nms;
+
+    // Requirements for fewer boxes than the input has
+    cvcuda::UniqueWorkspace ws = cvcuda::AllocateWorkspace(nms.getWorkspaceRequirements(1, 1, 1));
+    EXPECT_EQ(NVCV_ERROR_OUT_OF_MEMORY,
+              nvcv::ProtectCall([&] { nms(stream, ws.get(), srcBB, srcSc, {}, dstIdx, {}, dstCnt, 0.5f, 0.5f); }));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcv::ProtectCall([&] { nms.getWorkspaceRequirements(-1, numBBoxes, maxOutputs); }));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
@@ -541,3 +541,35 @@ TEST(OpOSD, stb_backend)
 
     EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
+
+TEST(OpOSD, raster_threads_and_prewarm)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+    int               inN    = 2;
+    int               inW    = 224;
+    int               inH    = 224;
+    int               num    = 100;
+    int               sed    = 5;
+    nvcv::ImageFormat format = nvcv::FMT_RGBA8;
+
+    for (int numRasterThreads : {0, 1, 4})
+    {
+        cvcuda::OSD op(NVCVOSDParams{numRasterThreads});
+        EXPECT_NO_THROW(op.prewarm(stream, "0123456789 abcdefghijklmnopqrstuvwxyz", DEFAULT_OSD_FONT, 20));
+        runOp(stream, op, inN, inW, inH, num, sed, format);
+    }
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+TEST(OpOSD, invalid_params)
+{
+    NVCVOperatorHandle handle;
+    NVCVOSDParams      params{-1};
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaOSDCreateWithParams(&handle, &params));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaOSDCreateWithParams(nullptr, nullptr));
+
+    cvcuda::OSD op;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaOSDPrewarm(op.handle(), nullptr, nullptr, DEFAULT_OSD_FONT, 20));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, cvcudaOSDPrewarm(op.handle(), nullptr, "abc", DEFAULT_OSD_FONT, 0));
+}
@@ -26,7 +26,10 @@
 #include <bitset>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <random>
+#include <set>
 #include <tuple>
 #include <vector>
 
@@ -238,6 +241,245 @@ inline void SortOutput(std::vector<std::tuple<int, int, int, float>> &outIdsDist
     std::sort(outIdsDist.begin(), outIdsDist.end());
 }
 
+// Distance between the points set1Idx of set1 and set2Idx of set2, the square-root of L2 is not taken
+template<typename ST>
+float PointDistance(const RawBufferType &set1Vec, const RawBufferType &set2Vec, const long3 &set1Strides,
+                    const long3 &set2Strides, int sampleIdx, int set1Idx, int set2Idx, int numDim,
+                    NVCVNormType normType)
+{
+    float dist = 0.f;
+
+    for (int coordIdx = 0; coordIdx < numDim; coordIdx++)
+    {
+        ST p1 = util::ValueAt<ST>(set1Vec, set1Strides, long3{sampleIdx, set1Idx, coordIdx});
+        ST p2 = util::ValueAt<ST>(set2Vec, set2Strides, long3{sampleIdx, set2Idx, coordIdx});
+
+        ComputeDistance(dist, p1, p2, normType);
+    }
+
+    return dist;
+}
+
+// Best match in set2 of each point in set1 among the given candidates, ties broken by the smallest index
+template<typename ST, class Candidates>
+int BestMatch(const Candidates &candidates, const RawBufferType &set1Vec, const RawBufferType &set2Vec,
+              const long3 &set1Strides, const long3 &set2Strides, int sampleIdx, int set1Idx, int numDim,
+              NVCVNormType normType)
+{
+    std::tuple<float, int> best{std::numeric_limits<float>::max(), -1};
+
+    for (int set2Idx : candidates)
+    {
+        float dist = PointDistance<ST>(set1Vec, set2Vec, set1Strides, set2Strides, sampleIdx, set1Idx, set2Idx, numDim,
+                                       normType);
+
+        best = std::min(best, std::make_tuple(dist, set2Idx));
+    }
+
+    return std::get<1>(best);
+}
+
+// Host multi-probe LSH matcher: it writes in bestIdx the best match in set2 of each point in set1, or -1 if there
+// is none in the probed buckets, with the same parameters as the operator but its own sampling of the key bits
+template<typename ST>
+void LshMatcher(std::vector<int> &bestIdx, const RawBufferType &set1Vec, const RawBufferType &set2Vec,
+                const long3 &set1Strides, const long3 &set2Strides, int numSamples, int numDim, int set1Size,
+                int set2Size, const NVCVPairwiseMatcherParams &params)
+{
+    constexpr int kElemBits = sizeof(ST) * 8;
+
+    int numBuckets = 1 << params.numHashBits;
+
+    std::mt19937                       rng(params.seed);
+    std::uniform_int_distribution<int> randomBit(0, numDim * kElemBits - 1);
+
+    std::vector<std::vector<int>> bitPos(params.numTables);
+
+    for (auto &tableBits : bitPos)
+    {
+        while (static_cast<int>(tableBits.size()) < params.numHashBits)
+        {
+            int bit = randomBit(rng);
+
+            if (std::find(tableBits.begin(), tableBits.end(), bit) == tableBits.end())
+            {
+                tableBits.push_back(bit);
+            }
+        }
+    }
+
+    std::vector<int> probeMasks(numBuckets);
+
+    std::iota(probeMasks.begin(), probeMasks.end(), 0);
+    std::stable_sort(probeMasks.begin(), probeMasks.end(),
+                     [](int a, int b) { return std::bitset<32>(a).count() < std::bitset<32>(b).count(); });
+    probeMasks.resize(params.numProbes);
+
+    auto hash = [&](const RawBufferType &setVec, const long3 &setStrides, int sampleIdx, int setIdx, int tableIdx)
+    {
+        int key = 0;
+
+        for (int i = 0; i < params.numHashBits; ++i)
+        {
+            int bit  = bitPos[tableIdx][i];
+            ST  elem = util::ValueAt<ST>(setVec, setStrides, long3{sampleIdx, setIdx, bit / kElemBits});
+
+            key |= static_cast<int>((elem >> (bit % kElemBits)) & 1) << i;
+        }
+
+        return key;
+    };
+
+    bestIdx.assign(numSamples * set1Size, -1);
+
+    for (int sampleIdx = 0; sampleIdx < numSamples; sampleIdx++)
+    {
+        std::vector<std::vector<std::vector<int>>> buckets(params.numTables,
+                                                           std::vector<std::vector<int>>(numBuckets));
+
+        for (int tableIdx = 0; tableIdx < params.numTables; tableIdx++)
+        {
+            for (int set2Idx = 0; set2Idx < set2Size; set2Idx++)
+            {
+                buckets[tableIdx][hash(set2Vec, set2Strides, sampleIdx, set2Idx, tableIdx)].push_back(set2Idx);
+            }
+        }
+
+        for (int set1Idx = 0; set1Idx < set1Size; set1Idx++)
+        {
+            std::set<int> candidates;
+
+            for (int tableIdx = 0; tableIdx < params.numTables; tableIdx++)
+            {
+                int key = hash(set1Vec, set1Strides, sampleIdx, set1Idx, tableIdx);
+
+                for (int mask : probeMasks)
+                {
+                    candidates.insert(buckets[tableIdx][key ^ mask].begin(), buckets[tableIdx][key ^ mask].end());
+                }
+            }
+
+            bestIdx[sampleIdx * set1Size + set1Idx] = BestMatch<ST>(
+                candidates, set1Vec, set2Vec, set1Strides, set2Strides, sampleIdx, set1Idx, numDim, NVCV_NORM_HAMMING);
+        }
+    }
+}
+
+// Host IVF matcher: it writes in bestIdx the best match in set2 of each point in set1, or -1 if there is none in
+// the probed lists, clustering set2 in lists with k-means as the operator does: centers start at evenly spaced
+// points, and are trained for 8 iterations on up to 64 evenly spaced points per list
+template<typename ST>
+void IvfMatcher(std::vector<int> &bestIdx, const RawBufferType &set1Vec, const RawBufferType &set2Vec,
+                const long3 &set1Strides, const long3 &set2Strides, int numSamples, int numDim, int set1Size,
+                int set2Size, const NVCVPairwiseMatcherParams &params, NVCVNormType normType)
+{
+    constexpr int kNumIterations = 8;
+    constexpr int kTrainPerList  = 64;
+
+    int numLists = params.numLists;
+    int numTrain = std::min(set2Size, kTrainPerList * numLists);
+
+    bestIdx.assign(numSamples * set1Size, -1);
+
+    for (int sampleIdx = 0; sampleIdx < numSamples; sampleIdx++)
+    {
+        std::vector<float> centers(numLists * numDim, 0.f);
+
+        // Lists sorted by distance from a point to their centers, given the coordinates of the point
+        auto sortLists = [&](auto &&coord)
+        {
+            std::vector<std::tuple<float, int>> distIdx(numLists);
+
+            for (int listIdx = 0; listIdx < numLists; listIdx++)
+            {
+                float dist = 0.f;
+
+                for (int i = 0; i < numDim; i++)
+                {
+                    float d = coord(i) - centers[listIdx * numDim + i];
+
+                    dist += d * d;
+                }
+
+                distIdx[listIdx] = std::make_tuple(dist, listIdx);
+            }
+
+            std::sort(distIdx.begin(), distIdx.end());
+
+            return distIdx;
+        };
+
+        auto set2Coord = [&](int set2Idx)
+        {
+            return [&, set2Idx](int i)
+            { return static_cast<float>(util::ValueAt<ST>(set2Vec, set2Strides, long3{sampleIdx, set2Idx, i})); };
+        };
+
+        for (int listIdx = 0; listIdx < numLists && set2Size > 0; listIdx++)
+        {
+            int set2Idx = ((long)listIdx * set2Size / numLists + static_cast<uint32_t>(params.seed)) % set2Size;
+
+            for (int i = 0; i < numDim; i++)
+            {
+                centers[listIdx * numDim + i] = set2Coord(set2Idx)(i);
+            }
+        }
+
+        for (int iteration = 0; iteration < kNumIterations && numTrain > 0; iteration++)
+        {
+            std::vector<double> sums(numLists * numDim, 0.0);
+            std::vector<int>    counts(numLists, 0);
+
+            for (int trainIdx = 0; trainIdx < numTrain; trainIdx++)
+            {
+                int set2Idx = (long)trainIdx * set2Size / numTrain;
+                int listIdx = std::get<1>(sortLists(set2Coord(set2Idx))[0]);
+
+                for (int i = 0; i < numDim; i++)
+                {
+                    sums[listIdx * numDim + i] += set2Coord(set2Idx)(i);
+                }
+
+                counts[listIdx]++;
+            }
+
+            for (int listIdx = 0; listIdx < numLists; listIdx++)
+            {
+                for (int i = 0; i < numDim && counts[listIdx] > 0; i++)
+                {
+                    centers[listIdx * numDim + i] = sums[listIdx * numDim + i] / counts[listIdx];
+                }
+            }
+        }
+
+        std::vector<std::vector<int>> lists(numLists);
+
+        for (int set2Idx = 0; set2Idx < set2Size; set2Idx++)
+        {
+            lists[std::get<1>(sortLists(set2Coord(set2Idx))[0])].push_back(set2Idx);
+        }
+
+        for (int set1Idx = 0; set1Idx < set1Size; set1Idx++)
+        {
+            auto probed = sortLists(
+                [&](int i)
+                { return static_cast<float>(util::ValueAt<ST>(set1Vec, set1Strides, long3{sampleIdx, set1Idx, i})); });
+
+            std::vector<int> candidates;
+
+            for (int probeIdx = 0; probeIdx < params.numProbes; probeIdx++)
+            {
+                const auto &list = lists[std::get<1>(probed[probeIdx])];
+
+                candidates.insert(candidates.end(), list.begin(), list.end());
+            }
+
+            bestIdx[sampleIdx * set1Size + set1Idx] = BestMatch<ST>(candidates, set1Vec, set2Vec, set1Strides,
+                                                                    set2Strides, sampleIdx, set1Idx, numDim, normType);
+        }
+    }
+}
+
 } // namespace ref
 
 // ----------------------------- Start tests -----------------------------------
@@ -438,6 +680,380 @@ TYPED_TEST(OpPairwiseMatcher, CorrectOutput)
     EXPECT_EQ(testIdsDist, goldIdsDist);
 }
 
+// clang-format off
+
+#define NVCV_TEST_APPROX_ROW(NumSamples, Set1Size, Set2Size, NumDim, AlgoChoice, NormType, Type)            \
+    type::Types<type::Value<NumSamples>, type::Value<Set1Size>, type::Value<Set2Size>, type::Value<NumDim>, \
+                type::Value<AlgoChoice>, type::Value<NormType>, Type>
+
+NVCV_TYPED_TEST_SUITE(OpPairwiseMatcherApprox, type::Types<
+    NVCV_TEST_APPROX_ROW(1, 17, 40, 32, NVCV_LSH, NVCV_NORM_HAMMING, uint8_t),
+    NVCV_TEST_APPROX_ROW(2, 33, 70, 8, NVCV_LSH, NVCV_NORM_HAMMING, uint32_t),
+    NVCV_TEST_APPROX_ROW(3, 20, 95, 5, NVCV_LSH, NVCV_NORM_HAMMING, uint8_t),
+    NVCV_TEST_APPROX_ROW(2, 45, 120, 32, NVCV_IVF_FLAT, NVCV_NORM_L1, uint8_t),
+    NVCV_TEST_APPROX_ROW(1, 30, 64, 17, NVCV_IVF_FLAT, NVCV_NORM_L2, float),
+    NVCV_TEST_APPROX_ROW(3, 25, 50, 128, NVCV_IVF_FLAT, NVCV_NORM_L2, uint8_t),
+    NVCV_TEST_APPROX_ROW(2, 19, 37, 1025, NVCV_IVF_FLAT, NVCV_NORM_L1, float),
+    NVCV_TEST_APPROX_ROW(1, 9, 5, 3, NVCV_IVF_FLAT, NVCV_NORM_L2, uint32_t)
+>);
+
+// clang-format on
+
+// Probing all buckets (LSH) or lists (IVF) compares each point of set1 to all points of set2, so the approximate
+// matchers must return the same best matches as brute force
+TYPED_TEST(OpPairwiseMatcherApprox, ExhaustiveProbingMatchesBruteForce)
+{
+    int numSamples = type::GetValue<TypeParam, 0>;
+    int set1Size   = type::GetValue<TypeParam, 1>;
+    int set2Size   = type::GetValue<TypeParam, 2>;
+    int numDim     = type::GetValue<TypeParam, 3>;
+
+    NVCVPairwiseMatcherType algoChoice{type::GetValue<TypeParam, 4>};
+
+    NVCVNormType normType{type::GetValue<TypeParam, 5>};
+
+    using SrcT = type::GetType<TypeParam, 6>;
+
+    constexpr nvcv::DataType srcDT{ToDataType<SrcT>()};
+
+    NVCVPairwiseMatcherParams params{};
+
+    if (algoChoice == NVCV_LSH)
+    {
+        params.numTables   = 2;
+        params.numHashBits = 4;
+        params.numProbes   = 1 << params.numHashBits;
+    }
+    else
+    {
+        params.numLists  = 8;
+        params.numProbes = params.numLists;
+    }
+
+    int maxSet1    = set1Size + 12;
+    int maxSet2    = set2Size + 23;
+    int maxMatches = maxSet1;
+
+    nvcv::Tensor set1({{numSamples, maxSet1, numDim}, "NMD"}, srcDT);
+    nvcv::Tensor set2({{numSamples, maxSet2, numDim}, "NMD"}, srcDT);
+
+    nvcv::Tensor numSet1({{numSamples}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor numSet2({{numSamples}, "N"}, nvcv::TYPE_S32);
+
+    nvcv::Tensor matches({{numSamples, maxMatches, 2}, "NMD"}, nvcv::TYPE_S32);
+    nvcv::Tensor numMatches({{numSamples}, "N"}, nvcv::TYPE_S32);
+    nvcv::Tensor distances({{numSamples, maxMatches}, "NM"}, nvcv::TYPE_F32);
+
+    auto set1Data = set1.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(set1Data);
+
+    auto set2Data = set2.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(set2Data);
+
+    auto ns1Data = numSet1.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(ns1Data);
+
+    auto ns2Data = numSet2.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(ns2Data);
+
+    auto mchData = matches.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(mchData);
+
+    auto nmData = numMatches.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(nmData);
+
+    auto dData = distances.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(dData);
+
+    long3 set1Strides{set1Data->stride(0), set1Data->stride(1), set1Data->stride(2)};
+    long3 set2Strides{set2Data->stride(0), set2Data->stride(1), set2Data->stride(2)};
+    long1 ns1Strides{ns1Data->stride(0)};
+    long1 ns2Strides{ns2Data->stride(0)};
+    long3 mchStrides{mchData->stride(0), mchData->stride(1), mchData->stride(2)};
+    long1 nmStrides{nmData->stride(0)};
+    long2 dStrides{dData->stride(0), dData->stride(1)};
+
+    long set1BufSize = set1Strides.x * numSamples;
+    long set2BufSize = set2Strides.x * numSamples;
+    long ns1BufSize  = ns1Strides.x * numSamples;
+    long ns2BufSize  = ns2Strides.x * numSamples;
+    long mchBufSize  = mchStrides.x * numSamples;
+    long nmBufSize   = nmStrides.x * numSamples;
+    long dBufSize    = dStrides.x * numSamples;
+
+    RawBufferType set1Vec(set1BufSize);
+    RawBufferType set2Vec(set2BufSize);
+    RawBufferType ns1Vec(ns1BufSize);
+    RawBufferType ns2Vec(ns2BufSize);
+
+    std::default_random_engine rng(12345u);
+
+    SrcT minV = std::is_integral_v<SrcT> ? cuda::TypeTraits<SrcT>::min : -1;
+    SrcT maxV = std::is_integral_v<SrcT> ? cuda::TypeTraits<SrcT>::max : +1;
+
+    uniform_distribution<SrcT> rand(minV, maxV);
+
+    for (int x = 0; x < numSamples; ++x)
+    {
+        for (int z = 0; z < numDim; ++z)
+        {
+            for (int y = 0; y < set1Size; ++y)
+            {
+                util::ValueAt<SrcT>(set1Vec, set1Strides, long3{x, y, z}) = rand(rng);
+            }
+            for (int y = 0; y < set2Size; ++y)
+            {
+                util::ValueAt<SrcT>(set2Vec, set2Strides, long3{x, y, z}) = rand(rng);
+            }
+        }
+
+        util::ValueAt<int>(ns1Vec, ns1Strides, long1{x}) = set1Size;
+        util::ValueAt<int>(ns2Vec, ns2Strides, long1{x}) = set2Size;
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(set1Data->basePtr(), set1Vec.data(), set1BufSize, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(set2Data->basePtr(), set2Vec.data(), set2BufSize, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(ns1Data->basePtr(), ns1Vec.data(), ns1BufSize, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(ns2Data->basePtr(), ns2Vec.data(), ns2BufSize, cudaMemcpyHostToDevice));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::PairwiseMatcher op(algoChoice, params);
+
+    op(stream, set1, set2, numSet1, numSet2, matches, numMatches, distances, false, 1, normType);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+
+    RawBufferType nmTestVec(nmBufSize, 0);
+    RawBufferType nmGoldVec(nmBufSize, 0);
+    RawBufferType mchTestVec(mchBufSize, 0);
+    RawBufferType mchGoldVec(mchBufSize, 0);
+    RawBufferType dTestVec(dBufSize, 0);
+    RawBufferType dGoldVec(dBufSize, 0);
+
+    std::vector<std::tuple<int, int, int, float>> testIdsDist;
+    std::vector<std::tuple<int, int, int, float>> goldIdsDist;
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(mchTestVec.data(), mchData->basePtr(), mchBufSize, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(nmTestVec.data(), nmData->basePtr(), nmBufSize, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(dTestVec.data(), dData->basePtr(), dBufSize, cudaMemcpyDeviceToHost));
+
+    ref::SortOutput(testIdsDist, mchTestVec, nmTestVec, dTestVec, mchStrides, nmStrides, dStrides, numSamples, set1Size,
+                    1, maxMatches);
+
+    ref::BruteForceMatcher<SrcT>(mchGoldVec, nmGoldVec, dGoldVec, set1Vec, set2Vec, mchStrides, nmStrides, dStrides,
+                                 set1Strides, set2Strides, numSamples, numDim, set1Size, set2Size, false, 1, normType);
+
+    ref::SortOutput(goldIdsDist, mchGoldVec, nmGoldVec, dGoldVec, mchStrides, nmStrides, dStrides, numSamples, set1Size,
+                    1, maxMatches);
+
+    EXPECT_EQ(testIdsDist, goldIdsDist);
+}
+
+// Match points of set1 that are random points of set2 perturbed by noise, flipping bits for Hamming norm or adding
+// values otherwise, checking the approximate matcher finds most of the best matches (recall), as many as the host
+// reference does, and that querying an index built on one stream from another stream finds matches as close
+static void approxMatcherRecall(NVCVPairwiseMatcherType algoChoice, NVCVNormType normType, int numDim, int noise,
+                                const NVCVPairwiseMatcherParams &params)
+{
+    using SrcT = uint8_t;
+
+    int numSamples = 2;
+    int set1Size   = 200;
+    int set2Size   = 3000;
+
+    nvcv::Tensor set1({{numSamples, set1Size, numDim}, "NMD"}, nvcv::TYPE_U8);
+    nvcv::Tensor set2({{numSamples, set2Size, numDim}, "NMD"}, nvcv::TYPE_U8);
+
+    nvcv::Tensor matches({{numSamples, set1Size, 2}, "NMD"}, nvcv::TYPE_S32);
+    nvcv::Tensor distances({{numSamples, set1Size}, "NM"}, nvcv::TYPE_F32);
+
+    auto set1Data = set1.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(set1Data);
+
+    auto set2Data = set2.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(set2Data);
+
+    auto mchData = matches.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(mchData);
+
+    auto dData = distances.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_TRUE(dData);
+
+    long3 set1Strides{set1Data->stride(0), set1Data->stride(1), set1Data->stride(2)};
+    long3 set2Strides{set2Data->stride(0), set2Data->stride(1), set2Data->stride(2)};
+    long3 mchStrides{mchData->stride(0), mchData->stride(1), mchData->stride(2)};
+    long2 dStrides{dData->stride(0), dData->stride(1)};
+
+    long set1BufSize = set1Strides.x * numSamples;
+    long set2BufSize = set2Strides.x * numSamples;
+    long mchBufSize  = mchStrides.x * numSamples;
+    long dBufSize    = dStrides.x * numSamples;
+
+    RawBufferType set1Vec(set1BufSize);
+    RawBufferType set2Vec(set2BufSize);
+
+    std::default_random_engine rng(12345u);
+
+    std::uniform_int_distribution<int> randValue(0, 255);
+    std::uniform_int_distribution<int> randPoint(0, set2Size - 1);
+    std::uniform_int_distribution<int> randBit(0, numDim * 8 - 1);
+    std::uniform_int_distribution<int> randNoise(-noise, noise);
+
+    for (int x = 0; x < numSamples; ++x)
+    {
+        for (int y = 0; y < set2Size; ++y)
+        {
+            for (int z = 0; z < numDim; ++z)
+            {
+                util::ValueAt<SrcT>(set2Vec, set2Strides, long3{x, y, z}) = randValue(rng);
+            }
+        }
+        for (int y = 0; y < set1Size; ++y)
+        {
+            int src = randPoint(rng);
+
+            for (int z = 0; z < numDim; ++z)
+            {
+                int value = util::ValueAt<SrcT>(set2Vec, set2Strides, long3{x, src, z});
+
+                if (normType != NVCV_NORM_HAMMING)
+                {
+                    value = std::clamp(value + randNoise(rng), 0, 255);
+                }
+
+                util::ValueAt<SrcT>(set1Vec, set1Strides, long3{x, y, z}) = value;
+            }
+            for (int i = 0; i < noise && normType == NVCV_NORM_HAMMING; ++i)
+            {
+                int bit = randBit(rng);
+
+                util::ValueAt<SrcT>(set1Vec, set1Strides, long3{x, y, bit / 8}) ^= 1 << (bit % 8);
+            }
+        }
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(set1Data->basePtr(), set1Vec.data(), set1BufSize, cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(set2Data->basePtr(), set2Vec.data(), set2BufSize, cudaMemcpyHostToDevice));
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::PairwiseMatcher op(algoChoice, params);
+
+    op(stream, set1, set2, nvcv::Tensor{}, nvcv::Tensor{}, matches, nvcv::Tensor{}, distances, false, 1, normType);
+
+    RawBufferType mchTestVec(mchBufSize, 0);
+    RawBufferType dTestVec(dBufSize, 0);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(mchTestVec.data(), mchData->basePtr(), mchBufSize, cudaMemcpyDeviceToHost));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(dTestVec.data(), dData->basePtr(), dBufSize, cudaMemcpyDeviceToHost));
+
+    ASSERT_EQ(cudaSuccess, cudaMemset(dData->basePtr(), 0, dBufSize));
+
+    cudaStream_t queryStream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&queryStream));
+
+    {
+        cvcuda::PairwiseMatcherIndex index = op.buildIndex(stream, set2, nvcv::Tensor{});
+
+        op(queryStream, index, set1, set2, nvcv::Tensor{}, matches, nvcv::Tensor{}, distances, 1, normType);
+    }
+
+    RawBufferType dIndexVec(dBufSize, 0);
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(queryStream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(queryStream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(dIndexVec.data(), dData->basePtr(), dBufSize, cudaMemcpyDeviceToHost));
+
+    // Points in a bucket (or list) may be grouped in another order, changing the pick between equidistant matches
+    EXPECT_EQ(dTestVec, dIndexVec);
+
+    std::vector<int> goldIdx;
+
+    if (algoChoice == NVCV_LSH)
+    {
+        ref::LshMatcher<SrcT>(goldIdx, set1Vec, set2Vec, set1Strides, set2Strides, numSamples, numDim, set1Size,
+                              set2Size, params);
+    }
+    else
+    {
+        ref::IvfMatcher<SrcT>(goldIdx, set1Vec, set2Vec, set1Strides, set2Strides, numSamples, numDim, set1Size,
+                              set2Size, params, normType);
+    }
+
+    std::vector<int> allIdx(set2Size);
+    std::iota(allIdx.begin(), allIdx.end(), 0);
+
+    int testFound = 0;
+    int goldFound = 0;
+
+    for (int x = 0; x < numSamples; ++x)
+    {
+        for (int y = 0; y < set1Size; ++y)
+        {
+            auto distance = [&](int set2Idx)
+            {
+                return ref::PointDistance<SrcT>(set1Vec, set2Vec, set1Strides, set2Strides, x, y, set2Idx, numDim,
+                                                normType);
+            };
+
+            int bestIdx = ref::BestMatch<SrcT>(allIdx, set1Vec, set2Vec, set1Strides, set2Strides, x, y, numDim,
+                                               normType);
+            int testIdx = util::ValueAt<int>(mchTestVec, mchStrides, long3{x, y, 1});
+            int refIdx  = goldIdx[x * set1Size + y];
+
+            float bestDist = distance(bestIdx);
+
+            EXPECT_EQ(util::ValueAt<int>(mchTestVec, mchStrides, long3{x, y, 0}), y);
+
+            if (testIdx >= 0)
+            {
+                float testDist = distance(testIdx);
+
+                EXPECT_EQ(util::ValueAt<float>(dTestVec, dStrides, long2{x, y}),
+                          normType == NVCV_NORM_L2 ? std::sqrt(testDist) : testDist);
+
+                testFound += testDist == bestDist;
+            }
+
+            goldFound += refIdx >= 0 && distance(refIdx) == bestDist;
+        }
+    }
+
+    double testRecall = static_cast<double>(testFound) / (numSamples * set1Size);
+    double goldRecall = static_cast<double>(goldFound) / (numSamples * set1Size);
+
+    EXPECT_GE(testRecall, 0.9);
+    EXPECT_GE(goldRecall, 0.9);
+    EXPECT_NEAR(testRecall, goldRecall, 0.1);
+}
+
+TEST(OpPairwiseMatcherApprox, LshRecall)
+{
+    NVCVPairwiseMatcherParams params{};
+
+    params.numTables   = 8;
+    params.numHashBits = 14;
+    params.numProbes   = 15;
+
+    approxMatcherRecall(NVCV_LSH, NVCV_NORM_HAMMING, 32, 16, params);
+}
+
+TEST(OpPairwiseMatcherApprox, IvfRecall)
+{
+    NVCVPairwiseMatcherParams params{};
+
+    params.numLists  = 64;
+    params.numProbes = 8;
+
+    approxMatcherRecall(NVCV_IVF_FLAT, NVCV_NORM_L2, 128, 8, params);
+}
+
 static void pairwiseMatcherNegative(nvcv::Tensor &set1, nvcv::Tensor &set2, nvcv::Tensor &numSet1,
                                     nvcv::Tensor &numSet2, nvcv::Tensor &matches, nvcv::Tensor &numMatches,
                                     nvcv::Tensor &distances, bool crossCheck, int matchesPerPoint,
@@ -587,3 +1203,106 @@ TEST(OpPairwiseMatcher_Negative, create_null_handle)
 {
     EXPECT_EQ(cvcudaPairwiseMatcherCreate(nullptr, NVCV_BRUTE_FORCE), NVCV_ERROR_INVALID_ARGUMENT);
 }
+
+TEST(OpPairwiseMatcher_Negative, create_invalid_params)
+{
+    NVCVOperatorHandle handle;
+
+    // clang-format off
+
+    std::vector<std::tuple<NVCVPairwiseMatcherType, NVCVPairwiseMatcherParams>> invalidParams{
+        {NVCV_LSH,      {33, 0, 0, 0, 0}},   // too many tables
+        {NVCV_LSH,      {0, 17, 0, 0, 0}},   // too many bits in a key
+        {NVCV_LSH,      {0, 4, 0, 17, 0}},   // more probes than buckets
+        {NVCV_LSH,      {0, 0, 0, -1, 0}},   // negative probes
+        {NVCV_IVF_FLAT, {0, 0, 4097, 0, 0}}, // too many lists
+        {NVCV_IVF_FLAT, {0, 0, 8, 9, 0}},    // more probes than lists
+        {NVCV_IVF_FLAT, {0, 0, -1, 0, 0}}    // negative lists
+    };
+
+    // clang-format on
+
+    for (const auto &[algoChoice, params] : invalidParams)
+    {
+        EXPECT_EQ(cvcudaPairwiseMatcherCreateWithParams(&handle, algoChoice, &params), NVCV_ERROR_INVALID_ARGUMENT);
+    }
+
+    EXPECT_EQ(cvcudaPairwiseMatcherCreateWithParams(nullptr, NVCV_LSH, nullptr), NVCV_ERROR_INVALID_ARGUMENT);
+}
+
+TEST(OpPairwiseMatcher_Negative, approximate_invalid_inputs)
+{
+    int numSamples = 2;
+    int maxSet1    = 2 + 12;
+    int maxSet2    = 2 + 23;
+    int numDim     = 3;
+
+    nvcv::Tensor nullTensor;
+
+    nvcv::Tensor set1({{numSamples, maxSet1, numDim}, "NMD"}, nvcv::TYPE_U8);
+    nvcv::Tensor set2({{numSamples, maxSet2, numDim}, "NMD"}, nvcv::TYPE_U8);
+    nvcv::Tensor f32Set1({{numSamples, maxSet1, numDim}, "NMD"}, nvcv::TYPE_F32);
+    nvcv::Tensor f32Set2({{numSamples, maxSet2, numDim}, "NMD"}, nvcv::TYPE_F32);
+
+    nvcv::Tensor matches({{numSamples, maxSet1, 2}, "NMD"}, nvcv::TYPE_S32);
+    nvcv::Tensor numMatches({{numSamples}, "N"}, nvcv::TYPE_S32);
+
+    // invalid norm
+    pairwiseMatcherNegative(set1, set2, nullTensor, nullTensor, matches, numMatches, nullTensor, false, 1,
+                            NVCV_NORM_L2, NVCV_LSH);
+    pairwiseMatcherNegative(set1, set2, nullTensor, nullTensor, matches, numMatches, nullTensor, false, 1,
+                            NVCV_NORM_HAMMING, NVCV_IVF_FLAT);
+
+    // invalid type
+    pairwiseMatcherNegative(f32Set1, f32Set2, nullTensor, nullTensor, matches, numMatches, nullTensor, false, 1,
+                            NVCV_NORM_HAMMING, NVCV_LSH);
+
+    // invalid crossCheck
+    pairwiseMatcherNegative(set1, set2, nullTensor, nullTensor, matches, numMatches, nullTensor, true, 1, NVCV_NORM_L1,
+                            NVCV_IVF_FLAT);
+
+    // brute force has no index
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    cvcuda::PairwiseMatcher op(NVCV_BRUTE_FORCE);
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcv::ProtectCall([&] { op.buildIndex(stream, set2, nullTensor); }));
+
+    // an index is only queried by a matcher with the algorithm and parameters it was built with, given its set2
+
+    NVCVPairwiseMatcherParams params{};
+    params.numProbes = 2;
+
+    cvcuda::PairwiseMatcher lsh(NVCV_LSH);
+    cvcuda::PairwiseMatcher lshProbes(NVCV_LSH, params);
+    cvcuda::PairwiseMatcher ivf(NVCV_IVF_FLAT);
+
+    nvcv::Tensor otherSet2({{numSamples, maxSet2 + 1, numDim}, "NMD"}, nvcv::TYPE_U8);
+
+    cvcuda::PairwiseMatcherIndex index = lsh.buildIndex(stream, set2, nullTensor);
+
+    auto query = [&](cvcuda::PairwiseMatcher &matcher, nvcv::Tensor &querySet2, NVCVNormType normType)
+    {
+        return nvcv::ProtectCall(
+            [&] {
+                matcher(stream, index, set1, querySet2, nullTensor, matches, numMatches, nullTensor, 1, normType);
+            });
+    };
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, query(op, set2, NVCV_NORM_HAMMING));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, query(lshProbes, set2, NVCV_NORM_HAMMING));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, query(ivf, set2, NVCV_NORM_L2));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, query(lsh, otherSet2, NVCV_NORM_HAMMING));
+    EXPECT_EQ(NVCV_SUCCESS, query(lsh, set2, NVCV_NORM_HAMMING));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaPairwiseMatcherBuildIndex(lsh.handle(), stream, set2.handle(), nullptr, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              cvcudaPairwiseMatcherSubmitWithIndex(lsh.handle(), stream, nullptr, set1.handle(), set2.handle(),
+                                                   nullptr, matches.handle(), numMatches.handle(), nullptr, 1,
+                                                   NVCV_NORM_HAMMING));
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
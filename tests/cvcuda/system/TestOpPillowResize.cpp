@@ -1223,6 +1223,75 @@ TEST_P(OpPillowResize, varshape_correct_output)
         StartVarShapeTest<float>(srcWidth, srcHeight, dstWidth, dstHeight, interpolation, numberOfImages, fmt);
 }
 
+TEST(OpPillowResize, tensor_cached_coeffs_reused_across_calls_and_streams)
+{
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+    const nvcv::Size2D      srcSize{64, 48}, dstSize{20, 16}, otherDstSize{30, 24};
+
+    cudaStream_t streams[2];
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&streams[0]));
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&streams[1]));
+
+    nvcv::Tensor imgSrc(2, srcSize, fmt);
+    nvcv::Tensor imgDst(2, dstSize, fmt);
+    nvcv::Tensor imgOtherDst(2, otherDstSize, fmt);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, srcData);
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedCuda>();
+    ASSERT_NE(nullptr, dstData);
+
+    std::vector<uint8_t>                   srcVec(srcData->stride(0) * srcData->shape(0));
+    std::default_random_engine             randEng{0};
+    std::uniform_int_distribution<uint8_t> srcRand{0u, 255u};
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return srcRand(randEng); });
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(srcData->basePtr(), srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+
+    // The uncached operator computes the coefficients on the device at each call
+    cvcuda::PillowResize    cachedOp;
+    cvcuda::PillowResize    uncachedOp(0);
+    cvcuda::UniqueWorkspace ws
+        = cvcuda::AllocateWorkspace(cachedOp.getWorkspaceRequirements(2, srcSize, otherDstSize, fmt));
+
+    auto resize = [&](cvcuda::PillowResize &op, cudaStream_t stream, const nvcv::Tensor &dst)
+    {
+        EXPECT_NO_THROW(op(stream, ws.get(), imgSrc, dst, NVCV_INTERP_CUBIC));
+        EXPECT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    };
+
+    auto download = [&]()
+    {
+        std::vector<uint8_t> dstVec(dstData->stride(0) * dstData->shape(0));
+        EXPECT_EQ(cudaSuccess, cudaMemcpy(dstVec.data(), dstData->basePtr(), dstVec.size(), cudaMemcpyDeviceToHost));
+        EXPECT_EQ(cudaSuccess, cudaMemset(dstData->basePtr(), 0, dstVec.size()));
+        return dstVec;
+    };
+
+    // Cached coefficients are computed on the host in double precision, the device ones in float
+    auto expectNear = [](const std::vector<uint8_t> &gold, const std::vector<uint8_t> &test)
+    {
+        ASSERT_EQ(gold.size(), test.size());
+        for (size_t i = 0; i < gold.size(); ++i)
+        {
+            EXPECT_NEAR(gold[i], test[i], 1) << "at byte " << i;
+        }
+    };
+
+    resize(uncachedOp, streams[0], imgDst);
+    std::vector<uint8_t> gold = download();
+
+    resize(cachedOp, streams[0], imgDst);
+    expectNear(gold, download());
+
+    // Same sizes again on another stream, after a call with other sizes, uses the tables cached by the first call
+    resize(cachedOp, streams[1], imgOtherDst);
+    resize(cachedOp, streams[1], imgDst);
+    expectNear(gold, download());
+
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(streams[0]));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(streams[1]));
+}
+
 // clang-format off
 NVCV_TEST_SUITE_P(OpPillowResize_Negative, test::ValueList<nvcv::ImageFormat, nvcv::ImageFormat, NVCVInterpolationType>{
     {nvcv::FMT_RGB8p, nvcv::FMT_RGB8, NVCV_INTERP_LINEAR},
@@ -1413,3 +1482,10 @@ TEST(OpPillowResize_Negative, create_null_handle)
 {
     EXPECT_EQ(cvcudaPillowResizeCreate(nullptr), NVCV_ERROR_INVALID_ARGUMENT);
 }
+
+TEST(OpPillowResize_Negative, create_invalid_coeff_cache_size)
+{
+    NVCVOperatorHandle handle = nullptr;
+    EXPECT_EQ(cvcudaPillowResizeCreateWithCoeffCache(&handle, -1), NVCV_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(cvcudaPillowResizeCreateWithCoeffCache(nullptr, 0), NVCV_ERROR_INVALID_ARGUMENT);
+}
@@ -30,6 +30,7 @@
 #include <nvcv/TensorDataAccess.hpp>
 
 #include <cmath>
+#include <cstring>
 #include <random>
 
 namespace cuda = nvcv::cuda;
@@ -192,6 +193,144 @@ TEST_P(OpResize, tensor_correct_output)
     }
 }
 
+TEST_P(OpResize, tensor_host_correct_output)
+{
+    int srcWidth  = GetParamValue<0>();
+    int srcHeight = GetParamValue<1>();
+    int dstWidth  = GetParamValue<2>();
+    int dstHeight = GetParamValue<3>();
+
+    NVCVInterpolationType interpolation = GetParamValue<4>();
+
+    int numberOfImages = GetParamValue<5>();
+
+    const nvcv::ImageFormat fmt = GetParamValue<6>();
+
+    // Tensors in host memory are resized on the CPU
+    nvcv::Tensor imgSrc(numberOfImages, {srcWidth, srcHeight}, fmt, nvcv::MemAlignment{}, nullptr,
+                        NVCV_RESOURCE_MEM_HOST);
+    nvcv::Tensor imgDst(numberOfImages, {dstWidth, dstHeight}, fmt, nvcv::MemAlignment{}, nullptr,
+                        NVCV_RESOURCE_MEM_HOST);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedHost>();
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess && dstAccess);
+
+    int srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    std::vector<std::vector<uint8_t>> srcVec(numberOfImages);
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        srcVec[i].resize(srcHeight * srcVecRowStride);
+        std::generate(srcVec[i].begin(), srcVec[i].end(), [&]() { return rand(randEng); });
+
+        for (int y = 0; y < srcHeight; ++y)
+        {
+            std::memcpy(srcAccess->rowData(y, srcAccess->sampleData(i)), srcVec[i].data() + y * srcVecRowStride,
+                        srcVecRowStride);
+        }
+    }
+
+    // The call returns once the output is written
+    cvcuda::Resize resizeOp;
+    EXPECT_NO_THROW(resizeOp(nullptr, imgSrc, imgDst, interpolation));
+
+    for (int i = 0; i < numberOfImages; ++i)
+    {
+        SCOPED_TRACE(i);
+
+        std::vector<uint8_t> testVec(dstHeight * dstVecRowStride);
+        for (int y = 0; y < dstHeight; ++y)
+        {
+            std::memcpy(testVec.data() + y * dstVecRowStride, dstAccess->rowData(y, dstAccess->sampleData(i)),
+                        dstVecRowStride);
+        }
+
+        std::vector<uint8_t> goldVec(dstHeight * dstVecRowStride);
+        test::Resize(goldVec, dstVecRowStride, {dstWidth, dstHeight}, srcVec[i], srcVecRowStride, {srcWidth, srcHeight},
+                     fmt, interpolation, false);
+
+        std::vector<int> mae(testVec.size());
+        for (size_t j = 0; j < mae.size(); ++j)
+        {
+            mae[j] = abs(static_cast<int>(goldVec[j]) - static_cast<int>(testVec[j]));
+        }
+
+        EXPECT_THAT(mae, t::Each(t::Le(1)));
+    }
+}
+
+TEST(OpResize, tensor_host_pinned_waits_for_stream)
+{
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    const nvcv::ImageFormat fmt = nvcv::FMT_RGB8;
+
+    int srcWidth = 640, srcHeight = 480, dstWidth = 320, dstHeight = 240;
+
+    // Pinned tensors are resized on the CPU too, once the copy queued on the stream is done
+    nvcv::Tensor imgSrc(1, {srcWidth, srcHeight}, fmt, nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST_PINNED);
+    nvcv::Tensor imgDst(1, {dstWidth, dstHeight}, fmt, nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST_PINNED);
+
+    auto srcData = imgSrc.exportData<nvcv::TensorDataStridedHost>();
+    auto dstData = imgDst.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nullptr, srcData);
+    ASSERT_NE(nullptr, dstData);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*srcData);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dstData);
+    ASSERT_TRUE(srcAccess && dstAccess);
+
+    int srcVecRowStride = srcWidth * fmt.planePixelStrideBytes(0);
+    int dstVecRowStride = dstWidth * fmt.planePixelStrideBytes(0);
+
+    std::default_random_engine             randEng;
+    std::uniform_int_distribution<uint8_t> rand(0, 255);
+
+    std::vector<uint8_t> srcVec(srcHeight * srcVecRowStride);
+    std::generate(srcVec.begin(), srcVec.end(), [&]() { return rand(randEng); });
+
+    uint8_t *devSrc = nullptr;
+    ASSERT_EQ(cudaSuccess, cudaMalloc(&devSrc, srcVec.size()));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(devSrc, srcVec.data(), srcVec.size(), cudaMemcpyHostToDevice));
+    ASSERT_EQ(cudaSuccess, cudaMemcpy2DAsync(srcAccess->sampleData(0), srcAccess->rowStride(), devSrc, srcVecRowStride,
+                                             srcVecRowStride, srcHeight, cudaMemcpyDeviceToHost, stream));
+
+    cvcuda::Resize resizeOp;
+    EXPECT_NO_THROW(resizeOp(stream, imgSrc, imgDst, NVCV_INTERP_LINEAR));
+
+    std::vector<uint8_t> testVec(dstHeight * dstVecRowStride);
+    for (int y = 0; y < dstHeight; ++y)
+    {
+        std::memcpy(testVec.data() + y * dstVecRowStride, dstAccess->rowData(y, dstAccess->sampleData(0)),
+                    dstVecRowStride);
+    }
+
+    std::vector<uint8_t> goldVec(dstHeight * dstVecRowStride);
+    test::Resize(goldVec, dstVecRowStride, {dstWidth, dstHeight}, srcVec, srcVecRowStride, {srcWidth, srcHeight}, fmt,
+                 NVCV_INTERP_LINEAR, false);
+
+    std::vector<int> mae(testVec.size());
+    for (size_t j = 0; j < mae.size(); ++j)
+    {
+        mae[j] = abs(static_cast<int>(goldVec[j]) - static_cast<int>(testVec[j]));
+    }
+    EXPECT_THAT(mae, t::Each(t::Le(1)));
+
+    EXPECT_EQ(cudaSuccess, cudaFree(devSrc));
+    EXPECT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST_P(OpResize, varshape_correct_output)
 {
     cudaStream_t stream;
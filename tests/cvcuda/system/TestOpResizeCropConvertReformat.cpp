@@ -31,6 +31,7 @@
 #include <nvcv/Tensor.hpp>
 #include <nvcv/TensorDataAccess.hpp>
 
+#include <cstring>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -437,6 +438,92 @@ TYPED_TEST(OpResizeCropConvertReformat, tensor_correct_output)
     VEC_EXPECT_NEAR(refVec, dstVec, 1);
 }
 
+TYPED_TEST(OpResizeCropConvertReformat, tensor_host_correct_output)
+{
+    int3 srcShape = ttype::GetValue<TypeParam, 0>;
+    int2 resize   = ttype::GetValue<TypeParam, 1>;
+
+    NVCVInterpolationType interp = ttype::GetValue<TypeParam, 2>;
+
+    int2 cropDim = ttype::GetValue<TypeParam, 3>;
+    int2 cropPos = ttype::GetValue<TypeParam, 4>;
+
+    float scale  = ttype::GetValue<TypeParam, 5>;
+    float offset = ttype::GetValue<TypeParam, 6>;
+
+    nvcv::ImageFormat srcFormat{ttype::GetValue<TypeParam, 7>};
+    nvcv::ImageFormat dstFormat{ttype::GetValue<TypeParam, 8>};
+
+    using SrcVT = typename ttype::GetType<TypeParam, 9>;
+    using DstVT = typename ttype::GetType<TypeParam, 10>;
+    using SrcBT = typename cuda::BaseType<SrcVT>;
+    using DstBT = typename cuda::BaseType<DstVT>;
+
+    bool srcCast = ttype::GetValue<TypeParam, 11>;
+
+    int srcW      = srcShape.x;
+    int srcH      = srcShape.y;
+    int dstW      = cropDim.x;
+    int dstH      = cropDim.y;
+    int numImages = srcShape.z;
+
+    int srcPlanes   = srcFormat.numPlanes();
+    int dstPlanes   = dstFormat.numPlanes();
+    int srcRowElems = srcFormat.numChannels() / srcPlanes * srcW;
+    int dstRowElems = dstFormat.numChannels() / dstPlanes * dstW;
+
+    NVCVChannelManip manip = ChannelManip(srcFormat, dstFormat);
+
+    // Tensors in host memory are processed on the CPU
+    nvcv::Tensor srcTensor(numImages, {srcW, srcH}, srcFormat, nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST);
+    nvcv::Tensor dstTensor(numImages, {dstW, dstH}, dstFormat, nvcv::MemAlignment{}, nullptr, NVCV_RESOURCE_MEM_HOST);
+
+    auto src = srcTensor.exportData<nvcv::TensorDataStridedHost>();
+    auto dst = dstTensor.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(src, nullptr);
+    ASSERT_NE(dst, nullptr);
+
+    auto srcAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*src);
+    auto dstAccess = nvcv::TensorDataAccessStridedImagePlanar::Create(*dst);
+    ASSERT_TRUE(srcAccess && dstAccess);
+
+    size_t srcElems = (size_t)srcRowElems * srcH * srcPlanes * numImages;
+    size_t dstElems = (size_t)dstRowElems * dstH * dstPlanes * numImages;
+
+    NVCVSize2D srcSize{srcW, srcH};
+    NVCVSize2D newSize{resize.x, resize.y};
+    NVCVSize2D dstSize{dstW, dstH};
+
+    std::vector<SrcBT> srcVec(srcElems);
+    std::vector<DstBT> refVec(dstElems);
+
+    for (int n = 0; n < numImages; n++)
+    {
+        fillVec(srcVec, srcSize, srcFormat, n * (size_t)srcRowElems * (size_t)srcH * (size_t)srcPlanes);
+    }
+
+    // Rows of all planes and images follow each other in both the vector and the tensor.
+    for (int r = 0; r < srcH * srcPlanes * numImages; ++r)
+    {
+        std::memcpy(srcAccess->rowData(r), srcVec.data() + (size_t)r * srcRowElems, srcRowElems * sizeof(SrcBT));
+    }
+
+    ResizeCropConvert(refVec, dstSize, dstFormat, srcVec, srcSize, srcFormat, numImages, newSize, cropPos, interp,
+                      manip, scale, offset, srcCast);
+
+    // The call returns once the output is written
+    cvcuda::ResizeCropConvertReformat resizeCrop;
+    EXPECT_NO_THROW(resizeCrop(nullptr, srcTensor, dstTensor, newSize, interp, cropPos, manip, scale, offset, srcCast));
+
+    std::vector<DstBT> dstVec(dstElems);
+    for (int r = 0; r < dstH * dstPlanes * numImages; ++r)
+    {
+        std::memcpy(dstVec.data() + (size_t)r * dstRowElems, dstAccess->rowData(r), dstRowElems * sizeof(DstBT));
+    }
+
+    VEC_EXPECT_NEAR(refVec, dstVec, 1);
+}
+
 TYPED_TEST(OpResizeCropConvertReformat, varshape_correct_output)
 {
     int3 srcShape = ttype::GetValue<TypeParam, 0>;
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host benchmark of OSD glyph rasterization throughput. Glyphs are packed into a
+// GlyphAtlas and rasterized with stb_truetype into its host pixels the same way
+// the stb text backend builds its atlas, with an increasing number of threads.
+// Nothing is uploaded to the device.
+//
+// Usage: cvcuda_hostbench_glyph_raster <font.ttf> [max threads] [repetitions]
+
+#include <cvcuda/priv/legacy/textbackend/atlas.hpp>
+#include <cvcuda/priv/legacy/textbackend/worker_pool.hpp>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#include <cvcuda/priv/legacy/textbackend/stb_truetype.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Glyph
+{
+    int   index;
+    float scale;
+    int   x0, y0, x1, y1;
+    int   slot;
+};
+
+// Every glyph the font has among printable Latin, Greek, Cyrillic and CJK code points,
+// at the font sizes OSD ends up with for NVCVText sizes 10 to 30.
+std::vector<Glyph> CollectGlyphs(const stbtt_fontinfo &font)
+{
+    std::vector<int> codepoints;
+    for (int c = 0x21; c < 0x7f; ++c) codepoints.push_back(c);
+    for (int c = 0xa1; c < 0x180; ++c) codepoints.push_back(c);
+    for (int c = 0x391; c < 0x4ff; ++c) codepoints.push_back(c);
+    for (int c = 0x4e00; c < 0x5200; ++c) codepoints.push_back(c);
+
+    std::vector<Glyph> glyphs;
+    for (int size = 30; size <= 90; size += 15)
+    {
+        float scale = stbtt_ScaleForPixelHeight(&font, size);
+        for (int c : codepoints)
+        {
+            Glyph g;
+            g.index = stbtt_FindGlyphIndex(&font, c);
+            if (g.index == 0)
+                continue;
+            g.scale = scale;
+            stbtt_GetGlyphBitmapBoxSubpixel(&font, g.index, scale, scale, 0, 0, &g.x0, &g.y0, &g.x1, &g.y1);
+            if (g.x1 > g.x0 && g.y1 > g.y0)
+                glyphs.push_back(g);
+        }
+    }
+    return glyphs;
+}
+
+void Rasterize(const stbtt_fontinfo &font, GlyphAtlas &atlas, const Glyph &g)
+{
+    const AtlasRect &rect = atlas.rect(g.slot);
+
+    stbtt_vertex *vertices  = nullptr;
+    int           num_verts = stbtt_GetGlyphShape(&font, g.index, &vertices);
+    stbtt__bitmap gbm;
+    gbm.pixels = atlas.pixels() + (size_t)rect.y * atlas.width() + rect.x;
+    gbm.w      = rect.w;
+    gbm.h      = rect.h;
+    gbm.stride = atlas.width();
+    stbtt_Rasterize(&gbm, 0.35f, vertices, num_verts, g.scale, g.scale, 0, 0, g.x0, g.y0, 1, nullptr);
+    STBTT_free(vertices, nullptr);
+}
+
+// Returns the glyphs per second of a cold atlas build.
+double Run(const stbtt_fontinfo &font, std::vector<Glyph> glyphs, int numThreads, int repetitions)
+{
+    WorkerPool pool(numThreads);
+    double     best = 0;
+    for (int r = 0; r < repetitions; ++r)
+    {
+        auto       start = std::chrono::steady_clock::now();
+        GlyphAtlas atlas(1024, 64, 64 << 20);
+
+        std::vector<int> evicted;
+        for (auto &g : glyphs)
+        {
+            g.slot = atlas.allocate(g.x1 - g.x0, g.y1 - g.y0, evicted);
+            if (g.slot < 0)
+            {
+                std::fprintf(stderr, "Atlas is full\n");
+                std::exit(1);
+            }
+        }
+        pool.parallel_for(glyphs.size(), [&](int i) { Rasterize(font, atlas, glyphs[i]); });
+
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best        = std::max(best, glyphs.size() / secs);
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <font.ttf> [max threads] [repetitions]\n", argv[0]);
+        return 1;
+    }
+
+    int maxThreads  = argc > 2 ? std::atoi(argv[2]) : (int)std::max(1u, std::thread::hardware_concurrency());
+    int repetitions = argc > 3 ? std::atoi(argv[3]) : 5;
+
+    std::ifstream        file(argv[1], std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    stbtt_fontinfo       font;
+    if (data.empty() || !stbtt_InitFont(&font, data.data(), stbtt_GetFontOffsetForIndex(data.data(), 0)))
+    {
+        std::fprintf(stderr, "Failed to load %s\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<Glyph> glyphs = CollectGlyphs(font);
+    std::printf("%zu glyphs, best of %d\n", glyphs.size(), repetitions);
+    std::printf("%8s %14s %8s\n", "threads", "glyphs/s", "speedup");
+
+    double base = 0;
+    for (int t = 1; t <= maxThreads; t *= 2)
+    {
+        double rate = Run(font, glyphs, t, repetitions);
+        if (t == 1)
+            base = rate;
+        std::printf("%8d %14.0f %7.2fx\n", t, rate, rate / base);
+        if (t < maxThreads && t * 2 > maxThreads)
+            t = maxThreads / 2;
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host benchmark of OSD command binning. Scatters boxes over a 1080p frame and
+// reports how long binning them takes and how many commands the render kernel
+// visits per 2x2 quad with the tile lists, against walking every command.
+//
+// Usage: cvcuda_hostbench_osd_binning [box size] [repetitions]
+
+#include <cvcuda/priv/legacy/osd_binning.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace nvcv::cuda::osd;
+
+int main(int argc, char *argv[])
+{
+    const int width = 1920, height = 1080;
+
+    int boxSize     = argc > 1 ? std::atoi(argv[1]) : 32;
+    int repetitions = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    std::printf("%dx%d, %dx%d boxes, best of %d\n", width, height, boxSize, boxSize, repetitions);
+    std::printf("%8s %12s %16s %16s\n", "commands", "bin us", "visits/quad", "all/quad");
+
+    std::mt19937                       rng(12345);
+    std::uniform_int_distribution<int> x(0, width - boxSize), y(0, height - boxSize);
+
+    for (int numCommands : {10, 100, 1000, 10000})
+    {
+        std::vector<CommandBox> boxes(numCommands);
+        for (auto &box : boxes)
+        {
+            box.left        = x(rng);
+            box.top         = y(rng);
+            box.right       = box.left + boxSize - 1;
+            box.bottom      = box.top + boxSize - 1;
+            box.batch_index = 0;
+        }
+
+        CommandBins bins;
+        double      best = 1e30;
+        for (int r = 0; r < repetitions; ++r)
+        {
+            auto start = std::chrono::steady_clock::now();
+            bin_commands(boxes, width, height, 1, bins);
+            auto stop = std::chrono::steady_clock::now();
+            best      = std::min(best, std::chrono::duration<double, std::micro>(stop - start).count());
+        }
+
+        // Each quad walks the list of its tile, a tile holds OSD_TILE_SIZE^2 / 4 quads.
+        double visits = 0;
+        for (int t = 0; t < bins.num_tiles(); ++t)
+        {
+            int tx = t % bins.tiles_x, ty = t / bins.tiles_x;
+            int tw = std::min(OSD_TILE_SIZE, width - tx * OSD_TILE_SIZE);
+            int th = std::min(OSD_TILE_SIZE, height - ty * OSD_TILE_SIZE);
+            visits += (double)(bins.offsets[t + 1] - bins.offsets[t]) * (tw / 2) * (th / 2);
+        }
+        visits /= (width / 2) * (height / 2);
+
+        std::printf("%8d %12.1f %16.2f %16d\n", numCommands, best, visits, numCommands);
+    }
+    return 0;
+}
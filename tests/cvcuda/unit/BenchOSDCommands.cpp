@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host benchmark of OSD command building. Each frame adds a filled and a bordered
+// rectangle per box, then lays the commands out in the pinned upload buffer, either
+// into the CommandArena or with one shared_ptr per command copied out afterwards as
+// cuOSDContext used to. Nothing is uploaded to the device.
+//
+// Usage: cvcuda_hostbench_osd_commands [frames]
+
+#include <cvcuda/priv/legacy/CvCudaOSD.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace nvcv::cuda::osd;
+
+namespace {
+
+void FillRect(RectangleCommand *cmd, int i, int thickness)
+{
+    int left             = i % 1900;
+    int top              = i % 1060;
+    cmd->batch_index     = 0;
+    cmd->thickness       = thickness;
+    cmd->c0              = 255;
+    cmd->c1              = 0;
+    cmd->c2              = 0;
+    cmd->c3              = 255;
+    cmd->ax1             = left;
+    cmd->ay1             = top;
+    cmd->dx1             = left + 20;
+    cmd->dy1             = top;
+    cmd->cx1             = left + 20;
+    cmd->cy1             = top + 20;
+    cmd->bx1             = left;
+    cmd->by1             = top + 20;
+    cmd->bounding_left   = left;
+    cmd->bounding_right  = left + 20;
+    cmd->bounding_top    = top;
+    cmd->bounding_bottom = top + 20;
+}
+
+// Returns the best commands per second over the frames.
+template<class Frame>
+double Run(int numBoxes, int frames, Frame &&frame)
+{
+    double best = 0;
+    for (int f = 0; f < frames; ++f)
+    {
+        auto start = std::chrono::steady_clock::now();
+        frame(numBoxes);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best        = std::max(best, 2 * numBoxes / secs);
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int frames = argc > 1 ? std::atoi(argv[1]) : 50;
+
+    std::printf("2 commands per box, best of %d frames\n", frames);
+    std::printf("%8s %16s %16s %8s\n", "boxes", "shared_ptr/s", "arena/s", "speedup");
+
+    std::vector<std::shared_ptr<cuOSDContextCommand>> commands;
+    Memory<unsigned char>                             upload;
+    CommandArena                                      arena;
+
+    for (int numBoxes : {10, 100, 1000, 10000})
+    {
+        double before = Run(numBoxes, frames,
+                            [&](int n)
+                            {
+                                for (int i = 0; i < n; ++i)
+                                {
+                                    auto fill = std::make_shared<RectangleCommand>();
+                                    FillRect(fill.get(), i, -1);
+                                    commands.emplace_back(fill);
+                                    auto border = std::make_shared<RectangleCommand>();
+                                    FillRect(border.get(), i, 2);
+                                    commands.emplace_back(border);
+                                }
+
+                                std::vector<unsigned int> offsets(commands.size());
+                                size_t                    bytes = 0;
+                                for (size_t i = 0; i < commands.size(); ++i)
+                                {
+                                    offsets[i] = bytes;
+                                    bytes += sizeof(RectangleCommand);
+                                }
+                                upload.alloc_or_resize_to(bytes);
+                                for (size_t i = 0; i < commands.size(); ++i)
+                                {
+                                    memcpy(upload.host() + offsets[i], commands[i].get(), sizeof(RectangleCommand));
+                                }
+                                commands.clear();
+                            });
+
+        double after = Run(numBoxes, frames,
+                           [&](int n)
+                           {
+                               arena.reserve(2 * n, 2 * n * sizeof(RectangleCommand));
+                               for (int i = 0; i < n; ++i)
+                               {
+                                   FillRect(arena.emplace<RectangleCommand>(), i, -1);
+                                   FillRect(arena.emplace<RectangleCommand>(), i, 2);
+                               }
+                               arena.clear();
+                           });
+
+        std::printf("%8d %16.0f %16.0f %7.2fx\n", numBoxes, before, after, after / before);
+    }
+    return 0;
+}
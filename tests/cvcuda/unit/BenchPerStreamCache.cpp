@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host benchmark of PerStreamCache get/put throughput. Every thread works with its
+// own stream and does get/put pairs with a handful of payloads in flight.
+//
+// In the "ready" mode the payloads carry no event and always go through the global
+// cache. In the "pending" mode their events are recorded in streams held up by a
+// host callback, so they stay in the per-stream caches. No kernels are launched,
+// but a CUDA device is needed for the streams.
+//
+// It only uses get and put, so it builds against older PerStreamCache versions too.
+// compare_per_stream_cache.sh builds it in this tree and in a baseline one (by default
+// the std::set / std::multimap implementation behind a single mutex that this cache
+// replaced) and prints both results side by side.
+//
+// Usage: cvcuda_hostbench_per_stream_cache [max streams] [pairs per stream]
+
+#include <cuda_runtime.h>
+#include <cvcuda/util/PerStreamCache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct BenchPayload
+{
+    size_t      size = 0, alignment = 1;
+    cudaEvent_t ready = nullptr;
+};
+
+void CheckCuda(cudaError_t err)
+{
+    if (err != cudaSuccess)
+    {
+        std::fprintf(stderr, "CUDA error: %s\n", cudaGetErrorString(err));
+        std::exit(1);
+    }
+}
+
+// Keeps the stream busy until `release` is set.
+void CUDART_CB HoldStream(void *release)
+{
+    while (!static_cast<std::atomic<bool> *>(release)->load()) std::this_thread::yield();
+}
+
+struct StreamContext
+{
+    cudaStream_t             stream = nullptr;
+    std::vector<cudaEvent_t> events;
+};
+
+// Returns the get/put pairs per second for all streams together.
+double Run(std::vector<StreamContext> &streams, bool pending, int pairsPerStream)
+{
+    std::atomic<bool> release{false};
+    if (pending)
+        for (auto &ctx : streams) CheckCuda(cudaLaunchHostFunc(ctx.stream, HoldStream, &release));
+
+    constexpr int kInFlight = 4;
+    // Workspace-like sizes: a few hundred bytes up to a few megabytes
+    const size_t kSizes[] = {256, 640, 1024, 4096, 12288, 65536, 262144, 1 << 20, 3 << 20};
+
+    nvcv::util::PerStreamCache<BenchPayload> cache;
+    std::atomic<bool>                        start{false};
+    std::vector<std::thread>                 threads;
+    for (auto &ctx : streams)
+    {
+        threads.emplace_back(
+            [&, pctx = &ctx]
+            {
+                std::mt19937                          rng(std::hash<const void *>()(pctx));
+                std::uniform_int_distribution<size_t> pick(0, std::size(kSizes) - 1);
+                std::vector<BenchPayload>             inFlight;
+
+                while (!start) std::this_thread::yield();
+
+                for (int i = 0; i < pairsPerStream + kInFlight; i++)
+                {
+                    size_t size = kSizes[pick(rng)];
+                    auto   p    = cache.get(size, 1, pctx->stream);
+                    if (!p)
+                    {
+                        BenchPayload np{size, 1, nullptr};
+                        if (pending)
+                        {
+                            cudaEvent_t ev;
+                            CheckCuda(cudaEventCreateWithFlags(&ev, cudaEventDisableTiming));
+                            CheckCuda(cudaEventRecord(ev, pctx->stream));
+                            pctx->events.push_back(ev);
+                            np.ready = ev;
+                        }
+                        p = np;
+                    }
+                    inFlight.push_back(*p);
+                    if (inFlight.size() > kInFlight)
+                    {
+                        cache.put(std::move(inFlight.front()), pctx->stream);
+                        inFlight.erase(inFlight.begin());
+                    }
+                }
+                for (auto &p : inFlight) cache.put(std::move(p), pctx->stream);
+            });
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    start   = true;
+    for (auto &t : threads) t.join();
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // Let the events complete before the cache waits for them
+    release = true;
+    for (auto &ctx : streams) CheckCuda(cudaStreamSynchronize(ctx.stream));
+
+    return (double)pairsPerStream * streams.size() / secs;
+}
+
+void RunAll(const char *mode, bool pending, int maxStreams, int pairsPerStream)
+{
+    for (int n = 1; n <= maxStreams; n *= 2)
+    {
+        std::vector<StreamContext> streams(n);
+        for (auto &ctx : streams) CheckCuda(cudaStreamCreateWithFlags(&ctx.stream, cudaStreamNonBlocking));
+
+        double rate = Run(streams, pending, pairsPerStream);
+        std::printf("%8s %8d %14.0f\n", mode, n, rate);
+
+        for (auto &ctx : streams)
+        {
+            for (cudaEvent_t ev : ctx.events) CheckCuda(cudaEventDestroy(ev));
+            CheckCuda(cudaStreamDestroy(ctx.stream));
+        }
+
+        if (n < maxStreams && n * 2 > maxStreams)
+            n = maxStreams / 2;
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int maxStreams     = argc > 1 ? std::atoi(argv[1]) : (int)std::max(1u, std::thread::hardware_concurrency());
+    int pairsPerStream = argc > 2 ? std::atoi(argv[2]) : 200000;
+
+    int devices = 0;
+    if (cudaGetDeviceCount(&devices) != cudaSuccess || devices == 0)
+    {
+        std::fprintf(stderr, "No CUDA device found\n");
+        return 1;
+    }
+
+    std::printf("get/put pairs per second, %d pairs per stream\n", pairsPerStream);
+    std::printf("%8s %8s %14s\n", "mode", "streams", "pairs/s");
+
+    RunAll("ready", false, maxStreams, pairsPerStream);
+    RunAll("pending", true, maxStreams, pairsPerStream);
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/legacy/textbackend/atlas.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+bool Overlap(const AtlasRect &a, const AtlasRect &b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+} // namespace
+
+TEST(GlyphAtlas, packs_glyphs_in_shelves)
+{
+    GlyphAtlas       atlas(64, 16, 64 * 64);
+    std::vector<int> evicted;
+
+    std::vector<int> slots;
+    for (int i = 0; i < 6; ++i)
+    {
+        int slot = atlas.allocate(20, 10 + i % 2, evicted);
+        ASSERT_GE(slot, 0);
+        slots.push_back(slot);
+    }
+    EXPECT_TRUE(evicted.empty());
+    EXPECT_EQ(6, atlas.num_live_slots());
+
+    // Similar heights share shelves, 3 glyphs per 64 pixels wide shelf.
+    EXPECT_EQ(0, atlas.rect(slots[0]).y);
+    EXPECT_EQ(0, atlas.rect(slots[2]).y);
+    EXPECT_EQ(atlas.rect(slots[3]).y, atlas.rect(slots[5]).y);
+    EXPECT_GT(atlas.rect(slots[3]).y, 0);
+
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        const AtlasRect &r = atlas.rect(slots[i]);
+        EXPECT_LE(r.x + r.w, atlas.width());
+        EXPECT_LE(r.y + r.h, atlas.height());
+        for (size_t j = 0; j < i; ++j)
+        {
+            EXPECT_FALSE(Overlap(r, atlas.rect(slots[j]))) << i << " overlaps " << j;
+        }
+    }
+}
+
+TEST(GlyphAtlas, grows_up_to_memory_bound)
+{
+    GlyphAtlas       atlas(32, 8, 32 * 32);
+    std::vector<int> evicted;
+
+    bool resized;
+    atlas.take_dirty_rects(resized);
+    EXPECT_TRUE(resized);
+
+    ASSERT_GE(atlas.allocate(32, 8, evicted), 0);
+    ASSERT_GE(atlas.allocate(32, 8, evicted), 0);
+    EXPECT_EQ(16, atlas.height());
+    EXPECT_EQ(32u * 16, atlas.bytes());
+    atlas.take_dirty_rects(resized);
+    EXPECT_TRUE(resized);
+
+    ASSERT_GE(atlas.allocate(32, 16, evicted), 0);
+    EXPECT_EQ(32, atlas.height());
+
+    // Bound reached and everything is used by the current frame
+    EXPECT_EQ(-1, atlas.allocate(4, 4, evicted));
+    EXPECT_EQ(-1, atlas.allocate(33, 4, evicted));
+    EXPECT_TRUE(evicted.empty());
+    EXPECT_EQ(32, atlas.height());
+}
+
+TEST(GlyphAtlas, dirty_rects_are_merged_per_shelf)
+{
+    GlyphAtlas       atlas(64, 64, 64 * 64);
+    std::vector<int> evicted;
+
+    bool resized;
+    atlas.take_dirty_rects(resized);
+
+    int a = atlas.allocate(10, 8, evicted);
+    int b = atlas.allocate(12, 7, evicted);
+    int c = atlas.allocate(10, 20, evicted);
+
+    std::vector<AtlasRect> dirty = atlas.take_dirty_rects(resized);
+    EXPECT_FALSE(resized);
+    ASSERT_EQ(2u, dirty.size());
+
+    EXPECT_EQ(atlas.rect(a).x, dirty[0].x);
+    EXPECT_EQ(atlas.rect(a).y, dirty[0].y);
+    EXPECT_EQ(22, dirty[0].w);
+    EXPECT_EQ(8, dirty[0].h);
+    EXPECT_EQ(atlas.rect(b).y, dirty[0].y);
+
+    EXPECT_EQ(atlas.rect(c).y, dirty[1].y);
+    EXPECT_EQ(10, dirty[1].w);
+    EXPECT_EQ(20, dirty[1].h);
+
+    EXPECT_TRUE(atlas.take_dirty_rects(resized).empty());
+}
+
+TEST(GlyphAtlas, evicts_least_recently_used_shelf)
+{
+    // Room for 4 shelves of 8 pixels, one glyph each.
+    GlyphAtlas       atlas(8, 32, 8 * 32);
+    std::vector<int> evicted;
+
+    int slots[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        slots[i] = atlas.allocate(8, 8, evicted);
+        ASSERT_GE(slots[i], 0);
+        atlas.begin_frame();
+    }
+
+    // Glyph 0 is used again, glyph 1 is now the coldest
+    atlas.touch(slots[0]);
+    atlas.begin_frame();
+    atlas.touch(slots[2]);
+
+    memset(atlas.pixels() + atlas.rect(slots[1]).y * atlas.width(), 0xFF, 8 * 8);
+
+    int slot = atlas.allocate(6, 8, evicted);
+    ASSERT_GE(slot, 0);
+    ASSERT_EQ(1u, evicted.size());
+    EXPECT_EQ(slots[1], evicted[0]);
+    EXPECT_EQ(4, atlas.num_live_slots());
+
+    // Reused region is cleared
+    const AtlasRect &r = atlas.rect(slot);
+    for (int y = r.y; y < r.y + r.h; ++y)
+    {
+        for (int x = r.x; x < r.x + r.w; ++x)
+        {
+            EXPECT_EQ(0, atlas.pixels()[y * atlas.width() + x]);
+        }
+    }
+}
+
+TEST(GlyphAtlas, merges_cold_shelves_for_taller_glyphs)
+{
+    GlyphAtlas       atlas(8, 32, 8 * 32);
+    std::vector<int> evicted;
+
+    int slots[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        slots[i] = atlas.allocate(8, 8, evicted);
+        ASSERT_GE(slots[i], 0);
+    }
+    atlas.begin_frame();
+    atlas.touch(slots[0]);
+
+    int slot = atlas.allocate(8, 20, evicted);
+    ASSERT_GE(slot, 0);
+    EXPECT_EQ(3u, evicted.size());
+    EXPECT_EQ(std::find(evicted.begin(), evicted.end(), slots[0]), evicted.end());
+    EXPECT_FALSE(Overlap(atlas.rect(slot), atlas.rect(slots[0])));
+    EXPECT_LE(atlas.rect(slot).y + atlas.rect(slot).h, atlas.height());
+}
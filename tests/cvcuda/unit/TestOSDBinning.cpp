@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/legacy/osd_binning.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace nvcv::cuda::osd;
+
+namespace {
+
+std::vector<int> TileCommands(const CommandBins &bins, int b, int tx, int ty)
+{
+    int t = bins.tile_index(b, tx, ty);
+    return std::vector<int>(bins.commands.begin() + bins.offsets[t], bins.commands.begin() + bins.offsets[t + 1]);
+}
+
+// Same test as the render kernel does for the 2x2 quad starting at (ix, iy).
+bool Covers(const CommandBox &box, int ix, int iy)
+{
+    return !(ix + 1 < box.left || ix > box.right || iy + 1 < box.top || iy > box.bottom);
+}
+
+} // namespace
+
+TEST(OSDBinning, tile_grid_rounds_up)
+{
+    CommandBins bins;
+    bin_commands({}, 1920, 1080, 2, bins);
+
+    EXPECT_EQ(30, bins.tiles_x);
+    EXPECT_EQ(17, bins.tiles_y);
+    EXPECT_EQ(2, bins.batch);
+    ASSERT_EQ(30 * 17 * 2 + 1, (int)bins.offsets.size());
+    EXPECT_EQ(0, bins.offsets.back());
+    EXPECT_TRUE(bins.commands.empty());
+}
+
+TEST(OSDBinning, command_goes_to_overlapped_tiles)
+{
+    CommandBins bins;
+    bin_commands({{10, 10, 20, 20, 0}, {60, 0, 70, 10, 0}, {0, 0, 10, 10, 1}}, 256, 128, 2, bins);
+
+    EXPECT_EQ((std::vector<int>{0, 1}), TileCommands(bins, 0, 0, 0));
+    EXPECT_EQ((std::vector<int>{1}), TileCommands(bins, 0, 1, 0));
+    EXPECT_TRUE(TileCommands(bins, 0, 0, 1).empty());
+    EXPECT_EQ((std::vector<int>{2}), TileCommands(bins, 1, 0, 0));
+    EXPECT_TRUE(TileCommands(bins, 1, 1, 0).empty());
+}
+
+TEST(OSDBinning, quad_straddling_tile_edge)
+{
+    // The last quad of tile 0 starts at ix = 62 and covers pixels 62 and 63. It draws a
+    // command ending at 63, but not one starting at 64 or 65, which the first quad of
+    // tile 1 does.
+    CommandBins bins;
+    bin_commands({{64, 0, 64, 0, 0}, {65, 0, 65, 0, 0}, {63, 0, 63, 0, 0}}, 256, 64, 1, bins);
+
+    EXPECT_EQ((std::vector<int>{2}), TileCommands(bins, 0, 0, 0));
+    EXPECT_EQ((std::vector<int>{0, 1}), TileCommands(bins, 0, 1, 0));
+}
+
+TEST(OSDBinning, drops_commands_outside)
+{
+    CommandBins bins;
+    std::vector<CommandBox> boxes = {
+        {-50, -50, -2, -2, 0}, // above and left of the image
+        {300, 0, 400, 10, 0},  // right of the image
+        {0, 0, 10, 10, 3},     // batch index out of range
+        {0, 0, 10, 10, -1},    // disabled command
+        {20, 30, 10, 40, 0},   // empty box
+    };
+    bin_commands(boxes, 256, 128, 2, bins);
+
+    EXPECT_TRUE(bins.commands.empty());
+}
+
+TEST(OSDBinning, clamps_to_image)
+{
+    CommandBins bins;
+    bin_commands({{-1000, -1000, 1000, 1000, 0}}, 100, 70, 1, bins);
+
+    ASSERT_EQ(2, bins.tiles_x);
+    ASSERT_EQ(2, bins.tiles_y);
+    EXPECT_EQ(4, (int)bins.commands.size());
+    for (int ty = 0; ty < 2; ++ty)
+        for (int tx = 0; tx < 2; ++tx) EXPECT_EQ((std::vector<int>{0}), TileCommands(bins, 0, tx, ty));
+}
+
+TEST(OSDBinning, matches_brute_force)
+{
+    const int width = 333, height = 201, batch = 3;
+
+    std::mt19937                       rng(42);
+    std::uniform_int_distribution<int> x(-40, width + 40), y(-40, height + 40), size(0, 120), b(0, batch - 1);
+
+    std::vector<CommandBox> boxes;
+    for (int i = 0; i < 500; ++i)
+    {
+        CommandBox box;
+        box.left        = x(rng);
+        box.top         = y(rng);
+        box.right       = box.left + size(rng);
+        box.bottom      = box.top + size(rng);
+        box.batch_index = b(rng);
+        boxes.push_back(box);
+    }
+
+    CommandBins bins;
+    bin_commands(boxes, width, height, batch, bins);
+
+    // Every quad the kernel runs sees in its tile exactly the commands it would
+    // have drawn walking all of them, in the same order.
+    for (int bi = 0; bi < batch; ++bi)
+    {
+        for (int iy = 0; iy < height - 1; iy += 2)
+        {
+            for (int ix = 0; ix < width - 1; ix += 2)
+            {
+                std::vector<int> expected;
+                for (int i = 0; i < (int)boxes.size(); ++i)
+                {
+                    if (boxes[i].batch_index == bi && Covers(boxes[i], ix, iy))
+                        expected.push_back(i);
+                }
+
+                std::vector<int> got;
+                for (int i : TileCommands(bins, bi, ix >> OSD_TILE_SHIFT, iy >> OSD_TILE_SHIFT))
+                {
+                    if (Covers(boxes[i], ix, iy))
+                        got.push_back(i);
+                }
+                ASSERT_EQ(expected, got) << "batch " << bi << " quad " << ix << "," << iy;
+            }
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/legacy/CvCudaOSD.hpp>
+
+#include <cstdint>
+
+using namespace nvcv::cuda::osd;
+
+TEST(OSDCommandArena, commands_keep_order_and_alignment)
+{
+    CommandArena arena;
+    EXPECT_TRUE(arena.empty());
+
+    arena.emplace<TextCommand>(3, 7, 1, 2, 3, 4);
+    auto seg  = arena.emplace<SegmentCommand>();
+    seg->dSeg = nullptr;
+    arena.emplace<CircleCommand>(1, 10, 20, 5, -1, 9, 8, 7, 6);
+
+    ASSERT_EQ(3, arena.size());
+    EXPECT_EQ(CommandType::Text, arena.at(0)->type);
+    EXPECT_EQ(CommandType::Segment, arena.at(1)->type);
+    EXPECT_EQ(CommandType::Circle, arena.at(2)->type);
+
+    EXPECT_EQ(7, arena.at<TextCommand>(0)->ilocation);
+    EXPECT_EQ(1, arena.at<CircleCommand>(2)->batch_index);
+    EXPECT_EQ(20, arena.at<CircleCommand>(2)->cy);
+
+    // The kernel reads them in place, each must be aligned for its type.
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(arena.at(1)) % alignof(SegmentCommand));
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(arena.at(2)) % alignof(CircleCommand));
+}
+
+TEST(OSDCommandArena, growing_keeps_commands)
+{
+    CommandArena arena;
+    arena.reserve(4, 4 * sizeof(RectangleCommand));
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto cmd         = arena.emplace<RectangleCommand>();
+        cmd->batch_index = i;
+        cmd->thickness   = i % 5;
+    }
+
+    ASSERT_EQ(1000, arena.size());
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto cmd = arena.at<RectangleCommand>(i);
+        ASSERT_EQ(CommandType::Rectangle, cmd->type);
+        ASSERT_EQ(i, cmd->batch_index);
+        ASSERT_EQ(i % 5, cmd->thickness);
+    }
+}
+
+TEST(OSDCommandArena, clear_reuses_buffers)
+{
+    CommandArena arena;
+    for (int i = 0; i < 100; ++i) arena.emplace<CircleCommand>(0, i, i, 1, -1, 0, 0, 0, 255);
+
+    const cuOSDContextCommand *first = arena.at(0);
+    arena.clear();
+    EXPECT_TRUE(arena.empty());
+
+    arena.emplace<CircleCommand>(0, 1, 2, 3, -1, 0, 0, 0, 255);
+    ASSERT_EQ(1, arena.size());
+    EXPECT_EQ(first, arena.at(0));
+    EXPECT_EQ(1, arena.at<CircleCommand>(0)->cx);
+}
@@ -93,6 +93,60 @@ TEST(StreamCacheItemAllocator, BasicTest)
     }
 }
 
+TEST(SizeBinsTest, BinIndex)
+{
+    using Bins = detail::SizeBins<ItemAlloc::item_t>;
+
+    int prev = Bins::binIndex(0);
+    EXPECT_EQ(prev, 0);
+    for (size_t size = 1; size < 100000; size++)
+    {
+        int bin = Bins::binIndex(size);
+        ASSERT_TRUE(bin == prev || bin == prev + 1) << "@ size = " << size;
+        prev = bin;
+    }
+    EXPECT_EQ(Bins::binIndex(1024), Bins::binIndex(1279));
+    EXPECT_EQ(Bins::binIndex(1024) + 1, Bins::binIndex(1280));
+    EXPECT_EQ(Bins::binIndex(~size_t(0)), Bins::kNumBins - 5);
+}
+
+TEST(SizeBinsTest, FirstFitAndLargest)
+{
+    ItemAlloc                           alloc;
+    detail::SizeBins<ItemAlloc::item_t> bins;
+    std::vector<ItemAlloc::item_t *>    items;
+
+    for (size_t size : {100, 1000, 1100, 5000, 3000, 1 << 20})
+    {
+        auto *item         = alloc.allocate();
+        item->payload.size = size;
+        bins.insert(item);
+        items.push_back(item);
+    }
+    EXPECT_EQ(bins.size(), items.size());
+
+    auto any = [](const DummyPayload &) { return true; };
+    EXPECT_EQ(bins.findFirstFit(50, any), items[0]);
+    EXPECT_EQ(bins.findFirstFit(1020, any), items[2]) << "1000 is in the same class, but too small";
+    EXPECT_EQ(bins.findFirstFit(2000, any), items[4]);
+    EXPECT_EQ(bins.findFirstFit(2000, [](const DummyPayload &p) { return p.size > 3000; }), items[3]);
+    EXPECT_EQ(bins.findFirstFit((1 << 20) + 1, any), nullptr);
+    EXPECT_EQ(bins.findLargest(), items[5]);
+
+    bins.remove(items[5]);
+    EXPECT_EQ(bins.findLargest(), items[3]);
+    EXPECT_EQ(bins.findFirstFit(6000, any), nullptr);
+
+    for (auto *item : items)
+    {
+        if (item != items[5])
+            bins.remove(item);
+        alloc.deallocate(item);
+    }
+    EXPECT_TRUE(bins.empty());
+    EXPECT_EQ(bins.findLargest(), nullptr);
+}
+
 namespace {
 
 struct EventAlloc
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/legacy/textbackend/worker_pool.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(TextWorkerPoolTest, runs_every_item_once)
+{
+    for (int numThreads : {1, 2, 4})
+    {
+        WorkerPool pool(numThreads);
+        EXPECT_EQ(numThreads, pool.num_threads());
+
+        for (int count : {0, 1, 3, 1000})
+        {
+            std::vector<std::atomic<int>> calls(count);
+            pool.parallel_for(count, [&](int i) { calls[i]++; });
+            for (int i = 0; i < count; ++i) EXPECT_EQ(1, calls[i].load()) << "item " << i;
+        }
+    }
+}
+
+TEST(TextWorkerPoolTest, uses_several_threads)
+{
+    WorkerPool pool(4);
+
+    std::mutex                mutex;
+    std::set<std::thread::id> ids;
+    std::atomic<int>          running{0};
+    pool.parallel_for(64,
+                      [&](int)
+                      {
+                          // Keep items busy until another thread picks one up, or long enough to give up
+                          running++;
+                          for (int spin = 0; spin < 1000000 && running.load() < 2; ++spin) std::this_thread::yield();
+                          std::lock_guard<std::mutex> lock(mutex);
+                          ids.insert(std::this_thread::get_id());
+                      });
+    EXPECT_GT(ids.size(), 1u);
+}
+
+TEST(TextWorkerPoolTest, back_to_back_loops)
+{
+    WorkerPool       pool(3);
+    std::atomic<int> total{0};
+    for (int loop = 0; loop < 2000; ++loop) pool.parallel_for(loop % 7, [&](int i) { total += i + 1; });
+
+    int expected = 0;
+    for (int loop = 0; loop < 2000; ++loop) expected += (loop % 7) * (loop % 7 + 1) / 2;
+    EXPECT_EQ(expected, total.load());
+}
@@ -0,0 +1,296 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/priv/WorkspaceCache.hpp>
+#include <nvcv/alloc/Allocator.hpp>
+#include <nvcv/util/Math.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace priv = cvcuda::priv;
+
+namespace {
+
+// Host allocator counting the live allocations, all kinds are host memory in host-only mode
+struct CountingAllocator
+{
+    std::atomic<int> allocs{0}, frees{0};
+
+    nvcv::Allocator make()
+    {
+        return nvcv::CustomAllocator<nvcv::CustomHostMemAllocator>(nvcv::CustomHostMemAllocator(
+            [this](int64_t size, int32_t align)
+            {
+                allocs++;
+                return std::aligned_alloc(align, nvcv::util::RoundUp(size, align));
+            },
+            [this](void *mem, int64_t, int32_t)
+            {
+                frees++;
+                std::free(mem);
+            }));
+    }
+};
+
+NVCVWorkspaceRequirements Req(size_t host, size_t pinned, size_t cuda, size_t alignment = 16)
+{
+    return {{host, alignment}, {pinned, alignment}, {cuda, alignment}};
+}
+
+} // namespace
+
+TEST(WorkspaceCacheTest, SizeClass)
+{
+    EXPECT_EQ(256u, priv::WorkspaceSizeClass(1));
+    EXPECT_EQ(256u, priv::WorkspaceSizeClass(256));
+    EXPECT_EQ(320u, priv::WorkspaceSizeClass(257));
+    EXPECT_EQ(512u, priv::WorkspaceSizeClass(512));
+    EXPECT_EQ(640u, priv::WorkspaceSizeClass(513));
+    EXPECT_EQ(1792u, priv::WorkspaceSizeClass(1537));
+    EXPECT_EQ(size_t(5) << 30, priv::WorkspaceSizeClass((size_t(4) << 30) + 1));
+}
+
+TEST(WorkspaceCacheTest, HostOnlyReuse)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+
+    NVCVWorkspace ws1 = cache.acquire(Req(1000, 3000, 5000), nullptr);
+    ASSERT_NE(nullptr, ws1.hostMem.data);
+    ASSERT_NE(nullptr, ws1.pinnedMem.data);
+    ASSERT_NE(nullptr, ws1.cudaMem.data);
+    EXPECT_EQ(nullptr, ws1.pinnedMem.ready);
+    EXPECT_EQ(nullptr, ws1.cudaMem.ready);
+    EXPECT_EQ(1024u, ws1.hostMem.req.size);
+    EXPECT_EQ(3072u, ws1.pinnedMem.req.size);
+    EXPECT_EQ(5120u, ws1.cudaMem.req.size);
+    EXPECT_EQ(3, counter.allocs);
+    cache.release(ws1, nullptr);
+
+    // Sizes in the same class get the same blocks back
+    NVCVWorkspace ws2 = cache.acquire(Req(1010, 2900, 5100), nullptr);
+    EXPECT_EQ(ws1.hostMem.data, ws2.hostMem.data);
+    EXPECT_EQ(ws1.pinnedMem.data, ws2.pinnedMem.data);
+    EXPECT_EQ(ws1.cudaMem.data, ws2.cudaMem.data);
+    EXPECT_EQ(3, counter.allocs);
+
+    NVCVWorkspaceCacheStats stats = cache.pool(NVCV_WORKSPACE_MEM_CUDA).stats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(5120u, stats.bytesInUse);
+    EXPECT_EQ(0u, stats.bytesCached);
+    EXPECT_EQ(5120u, stats.peakBytes);
+
+    cache.release(ws2, nullptr);
+    EXPECT_EQ(5120u, cache.pool(NVCV_WORKSPACE_MEM_CUDA).stats().bytesCached);
+}
+
+TEST(WorkspaceCacheTest, EmptyRequirements)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+
+    NVCVWorkspace ws = cache.acquire(Req(0, 0, 100), nullptr);
+    EXPECT_EQ(nullptr, ws.hostMem.data);
+    EXPECT_EQ(nullptr, ws.pinnedMem.data);
+    EXPECT_NE(nullptr, ws.cudaMem.data);
+    EXPECT_EQ(1, counter.allocs);
+    cache.release(ws, nullptr);
+}
+
+TEST(WorkspaceCacheTest, MuchLargerBlocksAreNotReused)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+    auto                &pool = cache.pool(NVCV_WORKSPACE_MEM_HOST);
+
+    NVCVWorkspaceMem big = pool.acquire({1 << 20, 16}, std::nullopt);
+    pool.release(big, std::nullopt);
+
+    NVCVWorkspaceMem small = pool.acquire({1 << 10, 16}, std::nullopt);
+    EXPECT_NE(big.data, small.data);
+    EXPECT_EQ(2, counter.allocs);
+
+    // ... but up to twice the size needed is fine
+    NVCVWorkspaceMem half = pool.acquire({(1 << 19) + 1, 16}, std::nullopt);
+    EXPECT_EQ(big.data, half.data);
+    EXPECT_EQ(2, counter.allocs);
+
+    pool.release(small, std::nullopt);
+    pool.release(half, std::nullopt);
+}
+
+TEST(WorkspaceCacheTest, AlignmentIsHonored)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+    auto                &pool = cache.pool(NVCV_WORKSPACE_MEM_PINNED);
+
+    NVCVWorkspaceMem a = pool.acquire({1000, 16}, std::nullopt);
+    pool.release(a, std::nullopt);
+
+    NVCVWorkspaceMem b = pool.acquire({1000, 4096}, std::nullopt);
+    EXPECT_NE(a.data, b.data);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(b.data) % 4096);
+    EXPECT_EQ(4096u, b.req.alignment);
+    pool.release(b, std::nullopt);
+
+    // A more aligned block satisfies a less demanding request
+    NVCVWorkspaceMem c = pool.acquire({1000, 2048}, std::nullopt);
+    EXPECT_EQ(b.data, c.data);
+    pool.release(c, std::nullopt);
+
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, pool.acquire({1000, 24}, std::nullopt));
+}
+
+TEST(WorkspaceCacheTest, MaxCachedBytes)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+    auto                &pool = cache.pool(NVCV_WORKSPACE_MEM_CUDA);
+    pool.setLimits({4096, NVCV_WORKSPACE_CACHE_UNLIMITED});
+
+    std::vector<NVCVWorkspaceMem> mems;
+    for (int i = 0; i < 4; i++) mems.push_back(pool.acquire({2048, 256}, std::nullopt));
+    for (auto &mem : mems) pool.release(mem, std::nullopt);
+
+    NVCVWorkspaceCacheStats stats = pool.stats();
+    EXPECT_EQ(4096u, stats.bytesCached);
+    EXPECT_EQ(2u, stats.frees);
+    EXPECT_EQ(2, counter.frees);
+
+    // Larger than the limit, freed right away
+    NVCVWorkspaceMem big = pool.acquire({8192, 256}, std::nullopt);
+    pool.release(big, std::nullopt);
+    EXPECT_EQ(3, counter.frees);
+    EXPECT_EQ(4096u, pool.stats().bytesCached);
+
+    pool.setLimits({0, NVCV_WORKSPACE_CACHE_UNLIMITED});
+    EXPECT_EQ(0u, pool.stats().bytesCached);
+    EXPECT_EQ(counter.allocs.load(), counter.frees.load());
+}
+
+TEST(WorkspaceCacheTest, MaxTotalBytes)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+    auto                &pool = cache.pool(NVCV_WORKSPACE_MEM_CUDA);
+    pool.setLimits({NVCV_WORKSPACE_CACHE_UNLIMITED, 8192});
+
+    NVCVWorkspaceMem a = pool.acquire({4096, 256}, std::nullopt);
+    NVCVWorkspaceMem b = pool.acquire({4096, 256}, std::nullopt);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_OUT_OF_MEMORY, pool.acquire({256, 256}, std::nullopt));
+
+    // Cached blocks are freed to make room
+    pool.release(a, std::nullopt);
+    NVCVWorkspaceMem c = pool.acquire({1024, 256}, std::nullopt);
+    EXPECT_EQ(1, counter.frees);
+    EXPECT_EQ(4096u + 1024, pool.stats().bytesInUse);
+
+    pool.release(b, std::nullopt);
+    pool.release(c, std::nullopt);
+}
+
+TEST(WorkspaceCacheTest, TrimLargestFirst)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+    auto                &pool = cache.pool(NVCV_WORKSPACE_MEM_HOST);
+
+    NVCVWorkspaceMem small = pool.acquire({1024, 16}, std::nullopt);
+    NVCVWorkspaceMem big   = pool.acquire({1 << 20, 16}, std::nullopt);
+    pool.release(small, std::nullopt);
+    pool.release(big, std::nullopt);
+
+    pool.trim(4096);
+    EXPECT_EQ(1024u, pool.stats().bytesCached);
+    NVCVWorkspaceMem again = pool.acquire({1024, 16}, std::nullopt);
+    EXPECT_EQ(small.data, again.data);
+    pool.release(again, std::nullopt);
+
+    pool.trim(0);
+    EXPECT_EQ(0u, pool.stats().bytesCached);
+    EXPECT_EQ(2, counter.frees);
+}
+
+TEST(WorkspaceCacheTest, ScopedWorkspaceReturnsToCache)
+{
+    CountingAllocator    counter;
+    priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+    auto                &pool = cache.pool(NVCV_WORKSPACE_MEM_CUDA);
+
+    void *data = nullptr;
+    {
+        priv::ScopedWorkspace ws(cache, Req(0, 0, 4096), nullptr);
+        data = ws.get().cudaMem.data;
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(4096u, pool.stats().bytesInUse);
+    }
+    EXPECT_EQ(0u, pool.stats().bytesInUse);
+    EXPECT_EQ(4096u, pool.stats().bytesCached);
+
+    {
+        priv::ScopedWorkspace ws(cache, Req(0, 0, 4000), nullptr);
+        EXPECT_EQ(data, ws.get().cudaMem.data);
+    }
+    EXPECT_EQ(1, counter.allocs);
+
+    // Nothing is held when the acquisition fails
+    pool.setLimits({NVCV_WORKSPACE_CACHE_UNLIMITED, 8192});
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_OUT_OF_MEMORY, priv::ScopedWorkspace{cache, Req(0, 0, 16384), nullptr});
+    EXPECT_EQ(0u, pool.stats().bytesInUse);
+}
+
+TEST(WorkspaceCacheTest, ConcurrentAcquireRelease)
+{
+    CountingAllocator counter;
+    {
+        priv::WorkspaceCache cache(counter.make(), NVCV_WORKSPACE_CACHE_HOST_ONLY);
+        cache.pool(NVCV_WORKSPACE_MEM_CUDA).setLimits({1 << 20, NVCV_WORKSPACE_CACHE_UNLIMITED});
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    for (int i = 0; i < 2000; i++)
+                    {
+                        size_t        size = 256 + ((i * 7919 + t * 104729) % 65536);
+                        NVCVWorkspace ws   = cache.acquire(Req(size, size / 2, size * 2), nullptr);
+                        static_cast<char *>(ws.cudaMem.data)[size * 2 - 1] = 1;
+                        cache.release(ws, nullptr);
+                    }
+                });
+        }
+        for (auto &t : threads) t.join();
+
+        for (auto kind : {NVCV_WORKSPACE_MEM_HOST, NVCV_WORKSPACE_MEM_PINNED, NVCV_WORKSPACE_MEM_CUDA})
+        {
+            NVCVWorkspaceCacheStats stats = cache.pool(kind).stats();
+            EXPECT_EQ(0u, stats.bytesInUse);
+            EXPECT_EQ(4u * 2000, stats.hits + stats.misses);
+        }
+        EXPECT_LE(cache.pool(NVCV_WORKSPACE_MEM_CUDA).stats().bytesCached, 1u << 20);
+    }
+    EXPECT_EQ(counter.allocs.load(), counter.frees.load());
+}
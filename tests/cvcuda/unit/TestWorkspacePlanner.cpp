@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <cvcuda/WorkspacePlanner.hpp>
+
+#include <random>
+
+namespace {
+
+cvcuda::WorkspaceRequirements CudaReq(size_t size, size_t alignment = 256)
+{
+    cvcuda::WorkspaceRequirements req{};
+    req.hostMem   = {0, 1};
+    req.pinnedMem = {0, 1};
+    req.cudaMem   = {size, alignment};
+    return req;
+}
+
+} // namespace
+
+TEST(WorkspacePlannerTest, DisjointLifetimesShareMemory)
+{
+    // HQResize -> CvtColor -> Normalize -> Reformat, each needing its workspace only for its own call
+    cvcuda::WorkspacePlanner planner;
+    int                      a = planner.add(CudaReq(4096), 0);
+    int                      b = planner.add(CudaReq(1024), 1);
+    int                      c = planner.add(CudaReq(8192), 2);
+    int                      d = planner.add(CudaReq(256), 3);
+
+    auto req = planner.plan();
+    EXPECT_EQ(req.cudaMem.size, 8192);
+    EXPECT_EQ(req.cudaMem.alignment, 256);
+    EXPECT_EQ(req.hostMem.size, 0);
+    EXPECT_EQ(req.pinnedMem.size, 0);
+    for (int i : {a, b, c, d}) EXPECT_EQ(planner.offsets(i)[2], 0);
+}
+
+TEST(WorkspacePlannerTest, OverlappingLifetimesDontCollide)
+{
+    cvcuda::WorkspacePlanner planner;
+    int                      a = planner.add(CudaReq(1000, 8), 0, 1);
+    int                      b = planner.add(CudaReq(3000, 8), 1, 2);
+    int                      c = planner.add(CudaReq(2000, 8), 2, 3);
+    int                      d = planner.add(CudaReq(500, 256), 3);
+
+    auto req = planner.plan();
+    // b is placed first; a and c overlap b, but not each other, so they go right after it; d fits below b
+    EXPECT_EQ(planner.offsets(b)[2], 0);
+    EXPECT_EQ(planner.offsets(c)[2], 3000);
+    EXPECT_EQ(planner.offsets(a)[2], 3000);
+    EXPECT_EQ(planner.offsets(d)[2], 0);
+    EXPECT_EQ(req.cudaMem.size, 5120);
+    EXPECT_EQ(req.cudaMem.alignment, 256);
+}
+
+TEST(WorkspacePlannerTest, RandomPipelines)
+{
+    std::mt19937                          rng(1234);
+    std::uniform_int_distribution<int>    step(0, 15), len(0, 3), alignLog(0, 9);
+    std::uniform_int_distribution<size_t> size(0, 100000);
+
+    for (int iter = 0; iter < 100; iter++)
+    {
+        cvcuda::WorkspacePlanner planner;
+        std::vector<int>         first, last;
+        size_t                   peak[16] = {};
+        for (int i = 0; i < 20; i++)
+        {
+            cvcuda::WorkspaceRequirements req{};
+            req.hostMem   = {size(rng), size_t(1) << alignLog(rng)};
+            req.pinnedMem = {0, 1};
+            req.cudaMem   = {size(rng), size_t(1) << alignLog(rng)};
+            first.push_back(step(rng));
+            last.push_back(first.back() + len(rng));
+            planner.add(req, first.back(), last.back());
+            for (int s = first.back(); s <= last.back() && s < 16; s++) peak[s] += req.cudaMem.size;
+        }
+        auto arena = planner.plan();
+
+        for (int i = 0; i < planner.size(); i++)
+        {
+            cvcuda::Workspace ws{};
+            ws.hostMem = {arena.hostMem, reinterpret_cast<void *>(1 << 20), nullptr};
+            ws.cudaMem = {arena.cudaMem, reinterpret_cast<void *>(1 << 20), nullptr};
+            auto sub   = planner.get(ws, i);
+
+            for (auto mem : {sub.hostMem, sub.cudaMem})
+            {
+                if (!mem.req.size)
+                    continue;
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(mem.data) % mem.req.alignment, 0);
+            }
+            EXPECT_LE(planner.offsets(i)[0] + sub.hostMem.req.size, arena.hostMem.size);
+            EXPECT_LE(planner.offsets(i)[2] + sub.cudaMem.req.size, arena.cudaMem.size);
+
+            for (int j = 0; j < i; j++)
+            {
+                if (first[i] > last[j] || first[j] > last[i])
+                    continue;
+                for (int k : {0, 2})
+                {
+                    size_t si = k ? sub.cudaMem.req.size : sub.hostMem.req.size;
+                    size_t sj = k ? planner.get(ws, j).cudaMem.req.size : planner.get(ws, j).hostMem.req.size;
+                    if (!si || !sj)
+                        continue;
+                    size_t oi = planner.offsets(i)[k], oj = planner.offsets(j)[k];
+                    EXPECT_TRUE(oi + si <= oj || oj + sj <= oi) << "Workspaces " << i << " and " << j << " collide";
+                }
+            }
+        }
+
+        // The layout can't beat the peak of the live workspaces at any step
+        EXPECT_GE(arena.cudaMem.size, *std::max_element(std::begin(peak), std::end(peak)));
+    }
+}
+
+TEST(WorkspacePlannerTest, Errors)
+{
+    cvcuda::WorkspacePlanner planner;
+    EXPECT_THROW(planner.add(CudaReq(100), 2, 1), nvcv::Exception);
+    EXPECT_THROW(planner.add(CudaReq(100, 3), 0), nvcv::Exception);
+
+    int i = planner.add(CudaReq(100), 0);
+    EXPECT_THROW(planner.offsets(i), nvcv::Exception) << "Not planned yet";
+    planner.plan();
+    EXPECT_THROW(planner.offsets(i + 1), nvcv::Exception);
+
+    cvcuda::Workspace ws{};
+    ws.cudaMem = {{64, 256}, reinterpret_cast<void *>(256), nullptr};
+    EXPECT_THROW(planner.get(ws, i), nvcv::Exception) << "The arena is too small";
+    ws.cudaMem = {{256, 256}, reinterpret_cast<void *>(128), nullptr};
+    EXPECT_THROW(planner.get(ws, i), nvcv::Exception) << "The arena is misaligned";
+    ws.cudaMem = {{256, 256}, reinterpret_cast<void *>(256), nullptr};
+    EXPECT_EQ(planner.get(ws, i).cudaMem.data, reinterpret_cast<void *>(256));
+}
@@ -0,0 +1,87 @@
+#!/bin/bash -e
+
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares the PerStreamCache of this tree with a baseline one, side by side.
+
+# Usage: compare_per_stream_cache.sh [baseline rev] [max streams] [pairs per stream]
+# baseline rev:
+#   - Any git revision of this repository
+#   - If not specified, defaults to the tree before the size-class bins and per-stream locks,
+#     which used std::set / std::multimap behind a single mutex
+# max streams, pairs per stream:
+#   - Passed to cvcuda_hostbench_per_stream_cache, see BenchPerStreamCache.cpp
+#
+# Both trees are configured and only the bench target is built, in a temporary directory
+# (WORK_DIR to keep it). The current BenchPerStreamCache.cpp is used for both, it only relies
+# on PerStreamCache::get and put. A CUDA device is needed to run it.
+
+SDIR=$(dirname "$(readlink -f "$0")")
+REPO=$(git -C "$SDIR" rev-parse --show-toplevel)
+BENCH_SRC=$SDIR/BenchPerStreamCache.cpp
+TARGET=cvcuda_hostbench_per_stream_cache
+
+if [[ $# -ge 1 ]]; then
+    baseline=$1
+    shift
+else
+    # Parent of the commit that added the bench
+    added=$(git -C "$REPO" log --diff-filter=A --format=%H -- tests/cvcuda/unit/BenchPerStreamCache.cpp | tail -n 1)
+    baseline="$added^"
+fi
+bench_args="$*"
+
+work_dir=${WORK_DIR:-$(mktemp -d)}
+if [ -z "$WORK_DIR" ]; then
+    trap 'git -C "$REPO" worktree remove --force "$work_dir/baseline" > /dev/null 2>&1; rm -rf "$work_dir"' EXIT
+fi
+
+# The baseline tree may predate the bench, build the current one in it
+if [ ! -d "$work_dir/baseline" ]; then
+    git -C "$REPO" worktree add --detach "$work_dir/baseline" "$baseline"
+fi
+cp "$BENCH_SRC" "$work_dir/baseline/tests/cvcuda/unit/"
+if ! grep -q "$TARGET" "$work_dir/baseline/tests/cvcuda/unit/CMakeLists.txt"; then
+    cat >> "$work_dir/baseline/tests/cvcuda/unit/CMakeLists.txt" << EOF
+
+add_executable($TARGET BenchPerStreamCache.cpp)
+target_link_libraries($TARGET PRIVATE cvcuda_priv cvcuda_util cuda)
+EOF
+fi
+
+cmake_args="-DBUILD_TESTS=1 -DBUILD_PYTHON=0 -DCMAKE_BUILD_TYPE=Release"
+if which ninja > /dev/null; then
+    cmake_args="$cmake_args -G Ninja"
+fi
+
+for tree in baseline current; do
+    if [ $tree = baseline ]; then
+        src_dir=$work_dir/baseline
+    else
+        src_dir=$REPO
+    fi
+    cmake -B "$work_dir/build-$tree" "$src_dir" $cmake_args > /dev/null
+    cmake --build "$work_dir/build-$tree" --target $TARGET -- -j"$(nproc)"
+done
+
+for tree in baseline current; do
+    echo "Running $tree"
+    "$work_dir/build-$tree/bin/$TARGET" $bench_args > "$work_dir/$tree.txt"
+done
+
+echo
+echo "baseline: $(git -C "$REPO" rev-parse --short "$baseline")    current: $(git -C "$REPO" rev-parse --short HEAD)"
+paste -d '|' "$work_dir/baseline.txt" "$work_dir/current.txt" | sed 's/|/  |  /'
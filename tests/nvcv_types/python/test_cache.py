@@ -195,3 +195,81 @@ def test_parallel_clear_cache():
     nvcv.Tensor((h, w), np.uint8)
     assert nvcv.cache_size() == 1
     assert nvcv.current_cache_size_inbytes() == size_inbytes
+
+
+def test_cache_lru_eviction():
+    nvcv.set_cache_limit_inbytes(torch.cuda.mem_get_info()[1] // 2)
+    nvcv.clear_cache()
+    nvcv.reset_cache_stats()
+
+    shape = (16, 32)
+    nvcv.Tensor(shape, np.int16)
+    nvcv.Tensor(shape, np.uint16)
+    nvcv.Tensor(shape, np.float16)
+    assert nvcv.cache_size() == 3
+    assert nvcv.cache_stats()["misses"] == 3
+
+    # Re-using the int16 tensor makes the uint16 one the least recently used
+    nvcv.Tensor(shape, np.int16)
+    assert nvcv.cache_stats()["hits"] == 1
+
+    # Adding a new tensor only evicts what's needed to stay within the limit
+    nvcv.set_cache_limit_inbytes(nvcv.current_cache_size_inbytes())
+    nvcv.Tensor(shape, np.uint8)
+    stats = nvcv.cache_stats()
+    assert stats["evictions"] == 1
+    assert stats["evicted_inbytes"] > 0
+    assert nvcv.cache_size() == 3
+
+    nvcv.Tensor(shape, np.int16)
+    nvcv.Tensor(shape, np.float16)
+    assert nvcv.cache_stats()["hits"] == 3
+
+
+def test_cache_eviction_skips_items_in_use():
+    nvcv.set_cache_limit_inbytes(torch.cuda.mem_get_info()[1] // 2)
+    nvcv.clear_cache()
+
+    shape = (16, 32)
+    in_use = nvcv.Tensor(shape, np.int16)
+    nvcv.Tensor(shape, np.uint16)
+
+    nvcv.set_cache_limit_inbytes(nvcv.current_cache_size_inbytes())
+    nvcv.reset_cache_stats()
+    nvcv.Tensor(shape, np.float16)
+
+    # The least recently used tensor is still in use, the next one is evicted instead
+    assert nvcv.cache_stats()["evictions"] == 1
+    assert nvcv.cache_size() == 2
+    del in_use
+    nvcv.Tensor(shape, np.int16)
+    assert nvcv.cache_stats()["hits"] == 1
+
+
+def test_cache_quota():
+    nvcv.set_cache_limit_inbytes(torch.cuda.mem_get_info()[1] // 2)
+    nvcv.clear_cache()
+
+    assert nvcv.get_cache_quota_inbytes(nvcv.Tensor) is None
+
+    shape = (16, 32)
+    tensor = nvcv.Tensor(shape, np.int16)
+    tensor_size = nvcv.internal.nbytes_in_cache(tensor)
+    del tensor
+
+    nvcv.set_cache_quota_inbytes(nvcv.Tensor, tensor_size)
+    assert nvcv.get_cache_quota_inbytes(nvcv.Tensor) == tensor_size
+
+    # Only one tensor fits in the quota, other types aren't affected
+    nvcv.reset_cache_stats()
+    nvcv.Tensor(shape, np.uint16)
+    nvcv.ImageBatchVarShape(5)
+    assert nvcv.cache_stats()["evictions"] == 1
+    assert nvcv.cache_size() == 2
+    assert nvcv.current_cache_size_inbytes() < nvcv.get_cache_limit_inbytes()
+
+    nvcv.set_cache_quota_inbytes(nvcv.Tensor, None)
+    assert nvcv.get_cache_quota_inbytes(nvcv.Tensor) is None
+
+    with pytest.raises(ValueError):
+        nvcv.set_cache_quota_inbytes(nvcv.Tensor, -1)
@@ -120,3 +120,30 @@ def test_stream_size_in_bytes():
     """
     stream = nvcv.cuda.Stream()
     assert nvcv.internal.nbytes_in_cache(stream) == 0
+
+
+def test_stream_event_pool():
+    limit = nvcv.cuda.get_event_pool_limit()
+    nvcv.clear_cache()
+    nvcv.cuda.clear_event_pool()
+    nvcv.cuda.reset_event_pool_stats()
+
+    # New streams take their event from the pool, and give it back when destroyed
+    stream = nvcv.cuda.Stream()
+    assert nvcv.cuda.event_pool_stats()["misses"] == 1
+    del stream
+    nvcv.clear_cache()
+    assert nvcv.cuda.event_pool_size() == 1
+
+    stream = nvcv.cuda.Stream()
+    assert nvcv.cuda.event_pool_stats()["hits"] == 1
+    assert nvcv.cuda.event_pool_size() == 0
+
+    # Events released when the pool is full are destroyed
+    nvcv.cuda.set_event_pool_limit(0)
+    del stream
+    nvcv.clear_cache()
+    assert nvcv.cuda.event_pool_size() == 0
+    assert nvcv.cuda.event_pool_stats()["discards"] == 1
+
+    nvcv.cuda.set_event_pool_limit(limit)
@@ -13,6 +13,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import sys
 import torch
 import nvcv
 import pytest as t
@@ -262,6 +263,39 @@ def test_tensor_hold_reference_of_wrapped_buffer():
     assert ptr0 != ttensor.data_ptr()
 
 
+@t.mark.parametrize(
+    "shape,dtype,layout",
+    [
+        ((16, 32, 3), np.uint8, "HWC"),
+        ((2, 3, 7, 38), np.float32, "NCHW"),
+    ],
+)
+def test_tensor_wrap_numpy_host(shape, dtype, layout):
+    array = np.zeros(shape, dtype)
+    refcount = sys.getrefcount(array)
+
+    tensor = nvcv.as_tensor(array, layout)
+    assert tensor.shape == shape
+    assert tensor.dtype == dtype
+    assert tensor.layout == layout
+
+    # no copy is made, the tensor keeps the array alive instead
+    assert sys.getrefcount(array) > refcount
+    del tensor
+    nvcv.clear_cache()
+    assert sys.getrefcount(array) == refcount
+
+
+def test_tensor_wrap_numpy_host_non_contiguous():
+    array = np.zeros((32, 64, 4), np.uint8)[:, ::2, :]
+
+    tensor = nvcv.as_tensor(array, "HWC")
+    assert tensor.shape == (32, 32, 4)
+
+    reshaped = nvcv.reshape(tensor, (32 * 32, 4), "NC")
+    assert reshaped.shape == (32 * 32, 4)
+
+
 def test_tensor_is_kept_alive_by_cuda_array_interface():
     nvcv.clear_cache()
 
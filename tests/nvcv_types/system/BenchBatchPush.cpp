@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmark of push/clear/push cycles on ImageBatchVarShape and TensorBatch with
+// different descriptor ring depths. Each cycle refills the batch, exports it and enqueues
+// some device work, then spends some time on the host, like a pipeline preparing its next frame.
+// With a ring depth of 1 the host waits for the previous upload before refilling the batch,
+// deeper rings let the host run ahead of the stream.
+//
+// Usage: nvcv_bench_batch_push [cycles] [device work us] [host work us]
+
+#include <cuda_runtime.h>
+#include <nvcv/ImageBatch.hpp>
+#include <nvcv/TensorBatch.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kBatchSize = 64;
+
+using Clock = std::chrono::steady_clock;
+
+struct Result
+{
+    double cycleUs;   // wall time per cycle
+    double blockedUs; // time per cycle spent in clear, push and export
+};
+
+void CUDART_CB DeviceWork(void *us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(*static_cast<int *>(us)));
+}
+
+void HostWork(int us)
+{
+    auto end = Clock::now() + std::chrono::microseconds(us);
+    while (Clock::now() < end)
+    {
+    }
+}
+
+template<class Refill>
+Result Run(int cycles, int deviceUs, int hostUs, Refill refill)
+{
+    cudaStream_t stream;
+    cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+
+    Clock::duration blocked{};
+
+    auto start = Clock::now();
+    for (int i = 0; i < cycles; ++i)
+    {
+        auto t0 = Clock::now();
+        refill(stream);
+        blocked += Clock::now() - t0;
+
+        cudaLaunchHostFunc(stream, DeviceWork, &deviceUs);
+        HostWork(hostUs);
+    }
+    cudaStreamSynchronize(stream);
+    auto end = Clock::now();
+
+    cudaStreamDestroy(stream);
+
+    return {std::chrono::duration<double, std::micro>(end - start).count() / cycles,
+            std::chrono::duration<double, std::micro>(blocked).count() / cycles};
+}
+
+Result RunImageBatch(int ringDepth, int cycles, int deviceUs, int hostUs)
+{
+    std::vector<nvcv::Image> images;
+    for (int i = 0; i < 2 * kBatchSize; ++i)
+    {
+        images.emplace_back(nvcv::Size2D{32 + i, 32}, nvcv::FMT_RGB8);
+    }
+
+    nvcv::ImageBatchVarShape batch(nvcv::ImageBatchVarShape::CalcRequirements(kBatchSize, ringDepth));
+
+    int frame = 0;
+    return Run(cycles, deviceUs, hostUs,
+               [&](cudaStream_t stream)
+               {
+                   auto first = images.begin() + (frame++ % 2) * kBatchSize;
+                   batch.clear();
+                   batch.pushBack(first, first + kBatchSize / 2);
+                   batch.pushBack(first + kBatchSize / 2, first + kBatchSize);
+                   batch.exportData(stream);
+               });
+}
+
+Result RunTensorBatch(int ringDepth, int cycles, int deviceUs, int hostUs)
+{
+    std::vector<nvcv::Tensor> tensors;
+    for (int i = 0; i < 2 * kBatchSize; ++i)
+    {
+        tensors.emplace_back(1, nvcv::Size2D{32 + i, 32}, nvcv::FMT_RGB8);
+    }
+
+    nvcv::TensorBatch batch(nvcv::TensorBatch::CalcRequirements(kBatchSize, ringDepth));
+
+    int frame = 0;
+    return Run(cycles, deviceUs, hostUs,
+               [&](cudaStream_t stream)
+               {
+                   auto first = tensors.begin() + (frame++ % 2) * kBatchSize;
+                   batch.clear();
+                   batch.pushBack(first, first + kBatchSize / 2);
+                   batch.pushBack(first + kBatchSize / 2, first + kBatchSize);
+                   batch.exportData(stream);
+               });
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int cycles   = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int deviceUs = argc > 2 ? std::atoi(argv[2]) : 200;
+    int hostUs   = argc > 3 ? std::atoi(argv[3]) : 150;
+
+    std::printf("# %d cycles of %d elements, %dus of device work, %dus of host work per cycle\n", cycles, kBatchSize,
+                deviceUs, hostUs);
+    std::printf("%-12s %6s %12s %12s\n", "batch", "depth", "cycle (us)", "blocked (us)");
+
+    for (int depth : {1, 2, 4})
+    {
+        Result r = RunImageBatch(depth, cycles, deviceUs, hostUs);
+        std::printf("%-12s %6d %12.1f %12.1f\n", "image", depth, r.cycleUs, r.blockedUs);
+    }
+
+    for (int depth : {1, 2, 4})
+    {
+        Result r = RunTensorBatch(depth, cycles, deviceUs, hostUs);
+        std::printf("%-12s %6d %12.1f %12.1f\n", "tensor", depth, r.cycleUs, r.blockedUs);
+    }
+
+    return 0;
+}
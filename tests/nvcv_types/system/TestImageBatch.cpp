@@ -20,6 +20,8 @@
 #include <common/ValueTests.hpp>
 #include <nvcv/ImageBatch.hpp>
 
+#include <dlfcn.h>
+
 #include <list>
 #include <random>
 
@@ -356,6 +358,63 @@ TEST(ImageBatchVarShape, smoke_sync)
     ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
 }
 
+TEST(ImageBatchVarShape, ring_depth_keeps_previous_exports)
+{
+    constexpr int kRingDepth = 3;
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    nvcv::ImageBatchVarShape batch(nvcv::ImageBatchVarShape::CalcRequirements(8, kRingDepth));
+
+    std::mt19937                  rng(321);
+    std::uniform_int_distribution rnd(1, 4);
+
+    std::vector<std::vector<nvcv::Image>>                images(kRingDepth + 1);
+    std::vector<std::vector<NVCVImageBufferStrided>>     goldImages(kRingDepth + 1);
+    std::vector<nvcv::ImageBatchVarShapeDataStridedCuda> exported;
+
+    for (int i = 0; i <= kRingDepth; ++i)
+    {
+        for (int j = 0; j <= i; ++j)
+        {
+            images[i].emplace_back(nvcv::Size2D{rnd(rng) * 2, rnd(rng) * 2}, nvcv::FMT_NV12);
+            goldImages[i].push_back(images[i].back().exportData<nvcv::ImageDataStridedCuda>()->cdata().buffer.strided);
+        }
+
+        // Refilling the batch right after an export must not overwrite what was exported before
+        batch.clear();
+        batch.pushBack(images[i].begin(), images[i].end());
+
+        auto devdata = batch.exportData<nvcv::ImageBatchVarShapeDataStridedCuda>(stream);
+        ASSERT_TRUE(devdata);
+        exported.push_back(*devdata);
+    }
+
+    // Exports go to different buffers until the ring wraps around
+    for (int i = 0; i < kRingDepth; ++i)
+    {
+        for (int j = i + 1; j < kRingDepth; ++j)
+        {
+            EXPECT_NE(exported[i].imageList(), exported[j].imageList());
+        }
+    }
+    EXPECT_EQ(exported[0].imageList(), exported[kRingDepth].imageList());
+
+    for (int i = 1; i <= kRingDepth; ++i)
+    {
+        std::vector<NVCVImageBufferStrided> devImages(exported[i].numImages());
+        ASSERT_EQ(cudaSuccess,
+                  cudaMemcpyAsync(devImages.data(), exported[i].imageList(), sizeof(devImages[0]) * devImages.size(),
+                                  cudaMemcpyDeviceToHost, stream));
+        ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+
+        EXPECT_THAT(devImages, t::ElementsAreArray(goldImages[i]));
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
 TEST(ImageBatchVarShape, push_exceed_capacity)
 {
     nvcv::ImageBatchVarShape batch(32);
@@ -617,6 +676,73 @@ TEST(ImageBatch, calc_req_invalid_parameters)
     NVCVImageBatchVarShapeRequirements reqs;
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeCalcRequirements(5, nullptr));
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeCalcRequirements(-1, &reqs));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(5, 1, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(5, 0, &reqs));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(
+                                               5, NVCV_IMAGE_BATCH_VARSHAPE_MAX_RING_DEPTH + 1, &reqs));
+}
+
+TEST(ImageBatch, calc_req_ring_depth)
+{
+    NVCVImageBatchVarShapeRequirements reqs1, reqs4;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageBatchVarShapeCalcRequirements(5, &reqs1));
+    EXPECT_EQ(NVCV_IMAGE_BATCH_VARSHAPE_DEFAULT_RING_DEPTH, reqs1.ringDepth);
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(5, 1, &reqs1));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageBatchVarShapeCalcRequirementsWithRingDepth(5, 4, &reqs4));
+    EXPECT_EQ(1, reqs1.ringDepth);
+    EXPECT_EQ(4, reqs4.ringDepth);
+    EXPECT_LT(nvcv::CalcTotalSizeBytes(nvcv::Requirements{reqs1.mem}.cudaMem()),
+              nvcv::CalcTotalSizeBytes(nvcv::Requirements{reqs4.mem}.cudaMem()));
+
+    NVCVImageBatchHandle handle;
+    reqs1.ringDepth = 0;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvImageBatchVarShapeConstruct(&reqs1, nullptr, &handle));
+}
+
+TEST(ImageBatch, old_api_requirements_layout)
+{
+    // Layout of NVCVImageBatchVarShapeRequirements used by binaries built before v0.15
+    struct OldRequirements
+    {
+        int32_t          capacity;
+        int32_t          alignBytes;
+        NVCVRequirements mem;
+    };
+
+    using CalcReqsFn  = NVCVStatus (*)(int32_t, OldRequirements *);
+    using ConstructFn = NVCVStatus (*)(const OldRequirements *, NVCVAllocatorHandle, NVCVImageBatchHandle *);
+
+    auto calcReqs  = (CalcReqsFn)dlvsym(RTLD_DEFAULT, "nvcvImageBatchVarShapeCalcRequirements", "NVCV_0.0");
+    auto construct = (ConstructFn)dlvsym(RTLD_DEFAULT, "nvcvImageBatchVarShapeConstruct", "NVCV_0.2");
+    ASSERT_NE(nullptr, calcReqs);
+    ASSERT_NE(nullptr, construct);
+
+    struct
+    {
+        OldRequirements reqs;
+        int32_t         canary = 0x5a5a5a5a;
+    } buf;
+
+    ASSERT_EQ(NVCV_SUCCESS, calcReqs(5, &buf.reqs));
+    EXPECT_EQ(0x5a5a5a5a, buf.canary);
+    EXPECT_EQ(5, buf.reqs.capacity);
+
+    NVCVImageBatchVarShapeRequirements reqs;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvImageBatchVarShapeCalcRequirements(5, &reqs));
+    EXPECT_EQ(reqs.alignBytes, buf.reqs.alignBytes);
+    EXPECT_EQ(0, memcmp(&reqs.mem, &buf.reqs.mem, sizeof(reqs.mem)));
+
+    // Whatever follows the old struct isn't read as ring depth
+    buf.canary = 0;
+    NVCVImageBatchHandle handle;
+    ASSERT_EQ(NVCV_SUCCESS, construct(&buf.reqs, nullptr, &handle));
+
+    int32_t capacity = 0;
+    EXPECT_EQ(NVCV_SUCCESS, nvcvImageBatchGetCapacity(handle, &capacity));
+    EXPECT_EQ(5, capacity);
+    EXPECT_EQ(NVCV_SUCCESS, nvcvImageBatchDecRef(handle, nullptr));
 }
 
 TEST(ImageBatch, construct_null_parameters)
@@ -0,0 +1,243 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv/alloc/Allocator.hpp>
+
+#include <future>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(PoolAllocatorTest, reuses_freed_blocks)
+{
+    nvcv::PoolAllocator alloc;
+
+    auto  hostMem = alloc.hostMem();
+    void *ptr0    = hostMem.alloc(160, 16);
+    ASSERT_NE(nullptr, ptr0);
+    hostMem.free(ptr0, 160, 16);
+
+    // Same size class (256 bytes) is served from the free list
+    void *ptr1 = hostMem.alloc(256, 16);
+    EXPECT_EQ(ptr0, ptr1);
+
+    NVCVPoolAllocatorStats stats = alloc.stats();
+    EXPECT_EQ(1, stats.numHits);
+    EXPECT_EQ(1, stats.numMisses);
+    EXPECT_EQ(0, stats.bytesHeld);
+    EXPECT_EQ(256, stats.peakBytesHeld);
+
+    hostMem.free(ptr1, 256, 16);
+    EXPECT_EQ(256, alloc.stats().bytesHeld);
+
+    alloc.trim();
+    stats = alloc.stats();
+    EXPECT_EQ(0, stats.bytesHeld);
+    EXPECT_EQ(1, stats.numTrimmed);
+}
+
+TEST(PoolAllocatorTest, blocks_are_aligned)
+{
+    nvcv::PoolAllocator alloc;
+
+    for (int32_t align = 1; align <= 4096; align *= 2)
+    {
+        int64_t size = align * 3;
+        void   *ptr  = alloc.hostMem().alloc(size, align);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % align) << "align " << align;
+        alloc.hostMem().free(ptr, size, align);
+    }
+}
+
+TEST(PoolAllocatorTest, large_and_overaligned_requests_bypass_pool)
+{
+    NVCVPoolAllocatorParams params = {};
+    params.maxBlockSize            = 1024;
+    nvcv::PoolAllocator alloc(params);
+
+    void *ptr = alloc.hostMem().alloc(2048, 16);
+    alloc.hostMem().free(ptr, 2048, 16);
+
+    ptr = alloc.hostMem().alloc(8192, 8192);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % 8192);
+    alloc.hostMem().free(ptr, 8192, 8192);
+
+    NVCVPoolAllocatorStats stats = alloc.stats();
+    EXPECT_EQ(0, stats.numHits);
+    EXPECT_EQ(2, stats.numMisses);
+    EXPECT_EQ(0, stats.bytesHeld);
+}
+
+TEST(PoolAllocatorTest, high_water_mark_is_enforced)
+{
+    NVCVPoolAllocatorParams params = {};
+    params.maxHeldBytes            = 4096;
+    nvcv::PoolAllocator alloc(params);
+
+    std::vector<void *> ptrs;
+    for (int i = 0; i < 8; ++i)
+    {
+        ptrs.push_back(alloc.hostMem().alloc(1024, 64));
+    }
+    for (void *ptr : ptrs)
+    {
+        alloc.hostMem().free(ptr, 1024, 64);
+    }
+
+    NVCVPoolAllocatorStats stats = alloc.stats();
+    EXPECT_EQ(4096, stats.bytesHeld);
+    EXPECT_EQ(4096, stats.peakBytesHeld);
+    EXPECT_EQ(4, stats.numTrimmed);
+}
+
+TEST(PoolAllocatorTest, blocks_freed_by_exited_thread_are_reused)
+{
+    nvcv::PoolAllocator alloc;
+
+    std::set<void *> freed;
+    std::thread      th(
+        [&]
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                freed.insert(alloc.hostMem().alloc(512, 16));
+            }
+            for (void *ptr : freed)
+            {
+                alloc.hostMem().free(ptr, 512, 16);
+            }
+        });
+    th.join();
+
+    // The exited thread's free list was handed over to the global one
+    for (int i = 0; i < 4; ++i)
+    {
+        void *ptr = alloc.hostMem().alloc(512, 16);
+        EXPECT_EQ(1u, freed.count(ptr));
+    }
+    EXPECT_EQ(4, alloc.stats().numHits);
+    EXPECT_EQ(0, alloc.stats().bytesHeld);
+
+    for (void *ptr : freed)
+    {
+        alloc.hostMem().free(ptr, 512, 16);
+    }
+}
+
+TEST(PoolAllocatorTest, destroyed_pool_drains_running_thread_caches)
+{
+    std::optional<nvcv::PoolAllocator> alloc(std::in_place);
+
+    std::promise<void> cached, destroyed;
+    std::thread        th(
+        [&, hostMem = alloc->hostMem()]() mutable
+        {
+            void *ptr = hostMem.alloc(512, 16);
+            hostMem.free(ptr, 512, 16);
+            cached.set_value();
+
+            // The pool takes the cached block back while this thread is still running,
+            // leaving nothing for the thread cache to release when the thread exits.
+            destroyed.get_future().wait();
+        });
+
+    cached.get_future().wait();
+    alloc.reset();
+    destroyed.set_value();
+    th.join();
+}
+
+TEST(PoolAllocatorTest, concurrent_alloc_free)
+{
+    NVCVPoolAllocatorParams params = {};
+    params.threadCacheBlocks       = 2;
+    nvcv::PoolAllocator alloc(params);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back(
+            [&alloc, t]
+            {
+                std::vector<std::pair<void *, int64_t>> ptrs;
+                for (int i = 0; i < 1000; ++i)
+                {
+                    int64_t size = int64_t(16) << ((i + t) % 12);
+                    ptrs.emplace_back(alloc.hostMem().alloc(size, 16), size);
+                    *static_cast<int *>(ptrs.back().first) = i;
+                    if (ptrs.size() > 16)
+                    {
+                        alloc.hostMem().free(ptrs.front().first, ptrs.front().second, 16);
+                        ptrs.erase(ptrs.begin());
+                    }
+                }
+                for (auto &p : ptrs)
+                {
+                    alloc.hostMem().free(p.first, p.second, 16);
+                }
+            });
+    }
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    NVCVPoolAllocatorStats stats = alloc.stats();
+    EXPECT_EQ(8 * 1000, stats.numHits + stats.numMisses);
+    EXPECT_GT(stats.numHits, 0);
+}
+
+TEST(PoolAllocatorTest, cuda_and_pinned_memory_use_default_allocator)
+{
+    nvcv::PoolAllocator alloc;
+
+    void *ptrDev        = alloc.cudaMem().alloc(768, 256);
+    void *ptrHostPinned = alloc.hostPinnedMem().alloc(144, 16);
+    alloc.cudaMem().free(ptrDev, 768, 256);
+    alloc.hostPinnedMem().free(ptrHostPinned, 144, 16);
+
+    EXPECT_EQ(0, alloc.stats().numMisses);
+}
+
+TEST(PoolAllocatorTest, invalid_arguments_api_calls)
+{
+    NVCVAllocatorHandle halloc = nullptr;
+
+    NVCVPoolAllocatorParams params = {};
+    params.maxBlockSize            = 1000;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructPool(&params, &halloc));
+
+    params              = {};
+    params.maxHeldBytes = -1;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructPool(&params, &halloc));
+
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorConstructPool(nullptr, nullptr));
+
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorConstructPool(nullptr, &halloc));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvAllocatorGetPoolStats(halloc, nullptr));
+    EXPECT_EQ(NVCV_SUCCESS, nvcvAllocatorDecRef(halloc, nullptr));
+
+    // Only pool allocators have statistics
+    ASSERT_EQ(NVCV_SUCCESS, nvcvAllocatorConstructCustom(nullptr, 0, &halloc));
+    NVCVPoolAllocatorStats stats;
+    EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE, nvcvAllocatorGetPoolStats(halloc, &stats));
+    EXPECT_EQ(NVCV_ERROR_NOT_COMPATIBLE, nvcvAllocatorTrimPool(halloc));
+    EXPECT_EQ(NVCV_SUCCESS, nvcvAllocatorDecRef(halloc, nullptr));
+}
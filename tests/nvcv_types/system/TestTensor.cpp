@@ -24,6 +24,7 @@
 #include <nvcv/TensorDataAccess.hpp>
 #include <nvcv/alloc/Allocator.hpp>
 
+#include <cstring>
 #include <list>
 #include <random>
 #include <vector>
@@ -227,6 +228,76 @@ TEST(TensorTests, smoke_create_allocator)
     EXPECT_EQ(117 * 163 * 4 * 1, devdata->stride(0));
 }
 
+TEST(TensorTests, smoke_create_host)
+{
+    nvcv::TensorShape shape{{4, 16, 17}, nvcv::TENSOR_CHW};
+
+    nvcv::Tensor::Requirements reqs
+        = nvcv::Tensor::CalcRequirements(shape, nvcv::TYPE_U8, nvcv::MemAlignment{}, NVCV_RESOURCE_MEM_HOST);
+
+    int64_t cudaSize, hostSize;
+    ASSERT_EQ(NVCV_SUCCESS, nvcvMemRequirementsCalcTotalSizeBytes(&reqs.mem.cudaMem, &cudaSize));
+    ASSERT_EQ(NVCV_SUCCESS, nvcvMemRequirementsCalcTotalSizeBytes(&reqs.mem.hostMem, &hostSize));
+    EXPECT_EQ(0, cudaSize);
+    EXPECT_EQ(4 * 16 * 17, hostSize);
+
+    nvcv::Tensor tensor(reqs);
+    EXPECT_EQ(shape, tensor.shape());
+    EXPECT_EQ(nvcv::TYPE_U8, tensor.dtype());
+
+    nvcv::TensorData data = tensor.exportData();
+    EXPECT_EQ(NVCV_TENSOR_BUFFER_STRIDED_HOST, data.cdata().bufferType);
+    EXPECT_EQ(nvcv::NullOpt, data.cast<nvcv::TensorDataStridedCuda>());
+    EXPECT_EQ(nvcv::NullOpt, data.cast<nvcv::TensorDataStridedHostPinned>());
+
+    auto hostData = data.cast<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, hostData);
+
+    // packed rows, host memory doesn't need the device's pitch alignment
+    EXPECT_EQ(16 * 17, hostData->stride(0));
+    EXPECT_EQ(17, hostData->stride(1));
+    EXPECT_EQ(1, hostData->stride(2));
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(hostData->basePtr()) % 64);
+
+    auto access = nvcv::TensorDataAccessStridedImagePlanar::Create(*hostData);
+    ASSERT_TRUE(access);
+    EXPECT_EQ(4, access->numPlanes());
+
+    // contents are directly accessible by the host
+    for (int p = 0; p < access->numPlanes(); ++p)
+    {
+        std::memset(access->planeData(p), p, access->planeStride());
+    }
+    EXPECT_EQ(nvcv::Byte{3}, access->rowData(5, access->planeData(3))[7]);
+}
+
+TEST(TensorTests, smoke_create_host_pinned)
+{
+    nvcv::Tensor devTensor(3, {61, 23}, nvcv::FMT_RGBA8);
+    nvcv::Tensor pinnedTensor(3, {61, 23}, nvcv::FMT_RGBA8, nvcv::MemAlignment{}, nullptr,
+                              NVCV_RESOURCE_MEM_HOST_PINNED);
+
+    auto devData    = devTensor.exportData<nvcv::TensorDataStridedCuda>();
+    auto pinnedData = pinnedTensor.exportData<nvcv::TensorDataStridedHostPinned>();
+    ASSERT_NE(nvcv::NullOpt, devData);
+    ASSERT_NE(nvcv::NullOpt, pinnedData);
+    EXPECT_TRUE(pinnedTensor.exportData().IsCompatible<nvcv::TensorDataStridedHost>());
+
+    // Same layout as device tensors, so that contents can be copied in one go
+    for (int d = 0; d < devData->rank(); ++d)
+    {
+        EXPECT_EQ(devData->stride(d), pinnedData->stride(d)) << "dimension " << d;
+    }
+
+    int64_t size = pinnedData->stride(0) * pinnedData->shape(0);
+    std::memset(pinnedData->basePtr(), 0x5A, size);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(devData->basePtr(), pinnedData->basePtr(), size, cudaMemcpyHostToDevice));
+
+    std::vector<uint8_t> gold(size, 0x5A), result(size);
+    ASSERT_EQ(cudaSuccess, cudaMemcpy(result.data(), devData->basePtr(), size, cudaMemcpyDeviceToHost));
+    EXPECT_EQ(gold, result);
+}
+
 TEST(Tensor, smoke_cast)
 {
     NVCVTensorHandle       handle;
@@ -383,6 +454,47 @@ TEST(TensorWrapData, smoke_create)
               accessRef->sampleData(3, accessRef->planeData(1)));
 }
 
+TEST(TensorWrapData, smoke_create_host)
+{
+    std::vector<float> buffer(2 * 7 * 5 * 3);
+
+    nvcv::TensorDataStridedHost::Buffer buf{};
+    buf.strides[3] = sizeof(float);
+    buf.strides[2] = 3 * buf.strides[3];
+    buf.strides[1] = 5 * buf.strides[2];
+    buf.strides[0] = 7 * buf.strides[1];
+    buf.basePtr    = reinterpret_cast<NVCVByte *>(buffer.data());
+
+    nvcv::TensorShape shape{{2, 7, 5, 3}, nvcv::TENSOR_NHWC};
+
+    nvcv::Tensor tensor = nvcv::TensorWrapData(nvcv::TensorDataStridedHost{shape, nvcv::TYPE_F32, buf});
+    ASSERT_NE(nullptr, tensor.handle());
+    EXPECT_EQ(shape, tensor.shape());
+
+    auto hostData = tensor.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, hostData);
+    EXPECT_EQ(NVCV_TENSOR_BUFFER_STRIDED_HOST, hostData->cdata().bufferType);
+    EXPECT_EQ(reinterpret_cast<NVCVByte *>(buffer.data()), hostData->basePtr());
+
+    auto access = nvcv::TensorDataAccessStridedImage::Create(*hostData);
+    ASSERT_TRUE(access);
+    EXPECT_EQ(2, access->numSamples());
+    EXPECT_EQ(7, access->numRows());
+    EXPECT_EQ(5, access->numCols());
+    EXPECT_EQ(3, access->numChannels());
+
+    *reinterpret_cast<float *>(access->sampleData(1, access->rowData(6))) = 42.f;
+    EXPECT_EQ(42.f, buffer[(1 * 7 + 6) * 5 * 3]);
+
+    // Reshaping a host tensor keeps it in host memory
+    nvcv::Tensor reshaped = tensor.reshape(nvcv::TensorShape{{2 * 7 * 5, 3}, nvcv::TENSOR_NC});
+
+    auto reshapedData = reshaped.exportData<nvcv::TensorDataStridedHost>();
+    ASSERT_NE(nvcv::NullOpt, reshapedData);
+    EXPECT_EQ(hostData->basePtr(), reshapedData->basePtr());
+    EXPECT_EQ(3 * sizeof(float), reshapedData->stride(0));
+}
+
 class TensorWrapImageTests
     : public t::TestWithParam<
           std::tuple<test::Param<"size", nvcv::Size2D>, test::Param<"format", nvcv::ImageFormat>,
@@ -578,6 +690,23 @@ TEST_F(TensorTests_Negative, invalid_parameter_TensorCalcRequirements)
               nvcvTensorCalcRequirements(2, valid_wh, NVCV_DATA_TYPE_U8, NVCV_TENSOR_NONE, 0, 0, nullptr)); // null reqs
 }
 
+TEST_F(TensorTests_Negative, invalid_parameter_TensorCalcRequirementsWithTarget)
+{
+    int64_t valid_wh[] = {224, 224};
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorCalcRequirementsWithTarget(2, valid_wh, NVCV_DATA_TYPE_U8, NVCV_TENSOR_NONE, 0, 0,
+                                                   static_cast<NVCVResourceType>(255), &reqs)); // invalid target
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorCalcRequirementsWithTarget(2, valid_wh, NVCV_DATA_TYPE_U8, NVCV_TENSOR_NONE, 3, 0,
+                                                   NVCV_RESOURCE_MEM_HOST, &reqs)); // invalid baseAddrAlignment
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorCalcRequirementsWithTarget(2, valid_wh, NVCV_DATA_TYPE_U8, NVCV_TENSOR_NONE, 0, 0,
+                                                   NVCV_RESOURCE_MEM_HOST, nullptr)); // null reqs
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorCalcRequirementsForImagesWithTarget(-1, 224, 224, NVCV_IMAGE_FORMAT_RGBA8, 0, 0,
+                                                            NVCV_RESOURCE_MEM_HOST, &reqs)); // invalid numImages
+}
+
 TEST_F(TensorTests_Negative, invalid_parameter_TensorConstruct)
 {
     ASSERT_EQ(NVCV_SUCCESS, nvcvTensorCalcRequirementsForImages(1, 224, 224, NVCV_IMAGE_FORMAT_RGBA8, 0, 0, &reqs));
@@ -22,6 +22,8 @@
 #include <nvcv/TensorData.hpp>
 #include <nvcv/TensorLayout.hpp>
 
+#include <dlfcn.h>
+
 #include <list>
 #include <random>
 
@@ -159,6 +161,15 @@ TEST(TensorBatch, consistency_validation)
     test_inconsistency(3, nvcv::TYPE_U8, nvcv::TensorLayout("HWC"));
 }
 
+TEST(TensorBatch, host_tensor_rejected)
+{
+    nvcv::TensorBatch tb(nvcv::TensorBatch::CalcRequirements(2));
+    nvcv::Tensor      tensor(nvcv::TensorShape{{16, 17, 3}, nvcv::TENSOR_HWC}, nvcv::TYPE_U8, nvcv::MemAlignment{},
+                             nullptr, NVCV_RESOURCE_MEM_HOST);
+    NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tb.pushBack(tensor));
+    EXPECT_EQ(0, tb.numTensors());
+}
+
 TEST(TensorBatch, push_in_parts)
 {
     const int32_t             iters    = 20;
@@ -340,6 +351,102 @@ TEST(TensorBatch, pop_tensors)
     NVCV_EXPECT_THROW_STATUS(NVCV_ERROR_INVALID_ARGUMENT, tb.popTensors(-1));
 }
 
+class TensorBatchRingDepthTest : public t::TestWithParam<int32_t>
+{
+};
+
+TEST_P(TensorBatchRingDepthTest, refill_after_export)
+{
+    const int32_t ringDepth = GetParam();
+    const int32_t capacity  = 8;
+    const int32_t numCycles = 2 * ringDepth + 1;
+
+    std::mt19937              rg(ringDepth);
+    std::vector<nvcv::Tensor> tensors(capacity + numCycles);
+    for (auto &tensor : tensors)
+    {
+        tensor = GetRandomTensor(rg, nvcv::FMT_RGB8);
+    }
+
+    auto reqs = nvcv::TensorBatch::CalcRequirements(capacity, ringDepth);
+    EXPECT_EQ(reqs.ringDepth, ringDepth);
+    nvcv::TensorBatch tb(reqs);
+
+    cudaStream_t stream;
+    ASSERT_EQ(cudaSuccess, cudaStreamCreate(&stream));
+
+    std::vector<const void *> buffers;
+    for (int32_t i = 0; i < numCycles; ++i)
+    {
+        // Refill the batch right after the previous export, without waiting for its upload
+        tb.clear();
+        tb.pushBack(tensors.begin() + i, tensors.begin() + i + capacity - i % 2);
+        tb.setTensor(0, tensors[capacity + i]);
+
+        auto data = tb.exportData(stream);
+        buffers.push_back(data.cast<nvcv::TensorBatchDataStridedCuda>()->buffer().tensors);
+
+        std::vector<nvcv::Tensor> result(tensors.begin() + i, tensors.begin() + i + capacity - i % 2);
+        result[0] = tensors[capacity + i];
+        CheckTensorBatchData(data, result.begin(), result.end(), stream);
+    }
+
+    // Consecutive exports go to different buffers unless there's only one
+    for (int32_t i = ringDepth; i < numCycles; ++i)
+    {
+        EXPECT_EQ(buffers[i], buffers[i - ringDepth]);
+        EXPECT_EQ(ringDepth == 1, buffers[i] == buffers[i - 1]);
+    }
+
+    ASSERT_EQ(cudaSuccess, cudaStreamSynchronize(stream));
+    ASSERT_EQ(cudaSuccess, cudaStreamDestroy(stream));
+}
+
+INSTANTIATE_TEST_SUITE_P(_, TensorBatchRingDepthTest, t::Values(1, 2, 3, NVCV_TENSOR_BATCH_MAX_RING_DEPTH));
+
+TEST(TensorBatch, old_api_requirements_layout)
+{
+    // Layout of NVCVTensorBatchRequirements used by binaries built before v0.15
+    struct OldRequirements
+    {
+        int32_t          capacity;
+        int32_t          alignBytes;
+        NVCVRequirements mem;
+    };
+
+    using CalcReqsFn  = NVCVStatus (*)(int32_t, OldRequirements *);
+    using ConstructFn = NVCVStatus (*)(const OldRequirements *, NVCVAllocatorHandle, NVCVTensorBatchHandle *);
+
+    auto calcReqs  = (CalcReqsFn)dlvsym(RTLD_DEFAULT, "nvcvTensorBatchCalcRequirements", "NVCV_0.5");
+    auto construct = (ConstructFn)dlvsym(RTLD_DEFAULT, "nvcvTensorBatchConstruct", "NVCV_0.5");
+    ASSERT_NE(nullptr, calcReqs);
+    ASSERT_NE(nullptr, construct);
+
+    struct
+    {
+        OldRequirements reqs;
+        int32_t         canary = 0x5a5a5a5a;
+    } buf;
+
+    ASSERT_EQ(NVCV_SUCCESS, calcReqs(5, &buf.reqs));
+    EXPECT_EQ(0x5a5a5a5a, buf.canary);
+    EXPECT_EQ(5, buf.reqs.capacity);
+
+    NVCVTensorBatchRequirements reqs = nvcv::TensorBatch::CalcRequirements(5);
+    EXPECT_EQ(reqs.alignBytes, buf.reqs.alignBytes);
+    EXPECT_EQ(0, memcmp(&reqs.mem, &buf.reqs.mem, sizeof(reqs.mem)));
+
+    // Whatever follows the old struct isn't read as ring depth
+    buf.canary = 0;
+    NVCVTensorBatchHandle handle;
+    ASSERT_EQ(NVCV_SUCCESS, construct(&buf.reqs, nullptr, &handle));
+
+    int32_t capacity = 0;
+    EXPECT_EQ(NVCV_SUCCESS, nvcvTensorBatchGetCapacity(handle, &capacity));
+    EXPECT_EQ(5, capacity);
+    EXPECT_EQ(NVCV_SUCCESS, nvcvTensorBatchDecRef(handle, nullptr));
+}
+
 TEST(TensorBatch, iterator_arithm)
 {
     int32_t                   capacity = 4;
@@ -498,6 +605,12 @@ TEST(TensorBatch, calc_req_invalid_arg)
 {
     // output is nullptr
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchCalcRequirements(32, nullptr));
+
+    NVCVTensorBatchRequirements req;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchCalcRequirementsWithRingDepth(32, 2, nullptr));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchCalcRequirementsWithRingDepth(32, 0, &req));
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT,
+              nvcvTensorBatchCalcRequirementsWithRingDepth(32, NVCV_TENSOR_BATCH_MAX_RING_DEPTH + 1, &req));
 }
 
 TEST(TensorBatch, construct_invalid_arg)
@@ -508,6 +621,9 @@ TEST(TensorBatch, construct_invalid_arg)
 
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchConstruct(nullptr, nullptr, &tensorBatchHandle));
     EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchConstruct(&req, nullptr, nullptr));
+
+    req.ringDepth = 0;
+    EXPECT_EQ(NVCV_ERROR_INVALID_ARGUMENT, nvcvTensorBatchConstruct(&req, nullptr, &tensorBatchHandle));
 }
 
 TEST(TensorBatch, push_invalid_arg)
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmark of handle create/validate/decRef throughput, comparing
+// HandleManager (address + 4-bit generation) and SlabHandleManager
+// (index + 32-bit generation, per-thread slot caches).
+//
+// Usage: nvcv_bench_handle_manager [iterations per thread]
+
+#include <nvcv/src/priv/Exception.hpp>
+#include <nvcv/src/priv/HandleManager.hpp>
+#include <nvcv/src/priv/HandleManagerImpl.hpp>
+#include <nvcv/src/priv/SlabHandleManager.hpp>
+#include <nvcv/src/priv/SlabHandleManagerImpl.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+class alignas(priv::kResourceAlignment) IBenchObject
+{
+public:
+    virtual ~IBenchObject() = default;
+
+    virtual int value() const = 0;
+};
+
+class BenchObject : public IBenchObject
+{
+public:
+    explicit BenchObject(int val)
+        : m_value(val)
+    {
+    }
+
+    int value() const override
+    {
+        return m_value;
+    }
+
+private:
+    int m_value;
+};
+
+// Number of live handles each thread keeps around, so that create and destroy interleave.
+constexpr int kWindowSize = 16;
+
+// Sum of the validated values, printed at the end so that the validation isn't optimized out.
+std::atomic<long> g_checksum{0};
+
+template<class Manager>
+double Run(int numThreads, int iterations)
+{
+    Manager mgr("BenchObject");
+
+    std::vector<std::thread> threads;
+    std::atomic<int>         ready{0};
+    std::atomic<bool>        go{false};
+
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                void *window[kWindowSize] = {};
+
+                ready++;
+                while (!go)
+                {
+                    std::this_thread::yield();
+                }
+
+                long sum = 0;
+                for (int i = 0; i < iterations; ++i)
+                {
+                    void *&h = window[i % kWindowSize];
+                    if (h != nullptr)
+                    {
+                        mgr.decRef(h);
+                    }
+                    h = mgr.template create<BenchObject>(i).first;
+                    sum += mgr.validate(h)->value();
+                }
+                for (void *h : window)
+                {
+                    if (h != nullptr)
+                    {
+                        mgr.decRef(h);
+                    }
+                }
+                g_checksum.fetch_add(sum, std::memory_order_relaxed);
+            });
+    }
+
+    while (ready < numThreads)
+    {
+        std::this_thread::yield();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go         = true;
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double secs = std::chrono::duration<double>(end - start).count();
+    return (double)numThreads * iterations / secs;
+}
+
+} // namespace
+
+namespace nvcv::priv {
+template<>
+struct ResourceStorage<IBenchObject>
+{
+    using type = CompatibleStorage<BenchObject>;
+};
+} // namespace nvcv::priv
+
+int main(int argc, char *argv[])
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+
+    std::printf("# create+validate+decRef cycles per second (millions)\n");
+    std::printf("%8s %16s %20s %8s\n", "threads", "HandleManager", "SlabHandleManager", "speedup");
+
+    for (int numThreads = 1; numThreads <= 64; numThreads *= 2)
+    {
+        double base = Run<priv::HandleManager<IBenchObject>>(numThreads, iterations);
+        double slab = Run<priv::SlabHandleManager<IBenchObject>>(numThreads, iterations);
+        std::printf("%8d %16.2f %20.2f %7.2fx\n", numThreads, base / 1e6, slab / 1e6, slab / base);
+    }
+
+    std::printf("# checksum %ld\n", g_checksum.load());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmark of LockFreeStack pop/push throughput under contention, comparing
+// the tagged-head stack against the previous design that locked the head by
+// setting its lowest bit while popping. Also measures batched popStack/pushStack.
+//
+// Usage: nvcv_bench_lock_free_stack [iterations per thread]
+
+#include <nvcv/src/priv/LockFreeStack.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace priv = nvcv::priv;
+
+namespace {
+
+struct Node
+{
+    Node *next = nullptr;
+};
+
+// Previous LockFreeStack pop/push, kept here as the baseline.
+class SpinLockBitStack
+{
+public:
+    Node *pop() noexcept
+    {
+        for (;;)
+        {
+            Node *head = Unlocked(m_head.load(std::memory_order_acquire));
+            if (!head)
+            {
+                return nullptr;
+            }
+
+            if (m_head.compare_exchange_weak(head, Locked(head), std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        Node *oldHead, *newHead;
+        do
+        {
+            oldHead = m_head.load(std::memory_order_acquire);
+            newHead = Unlocked(oldHead)->next;
+        }
+        while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel));
+
+        return Unlocked(oldHead);
+    }
+
+    void push(Node *newNode) noexcept
+    {
+        Node *oldHead;
+        do
+        {
+            oldHead       = Unlocked(m_head.load(std::memory_order_relaxed));
+            newNode->next = oldHead;
+        }
+        while (!m_head.compare_exchange_weak(oldHead, newNode, std::memory_order_release));
+    }
+
+private:
+    std::atomic<Node *> m_head = nullptr;
+
+    static Node *Unlocked(Node *n)
+    {
+        return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(n) & ~uintptr_t(1));
+    }
+
+    static Node *Locked(Node *n)
+    {
+        return reinterpret_cast<Node *>(reinterpret_cast<uintptr_t>(n) | 1);
+    }
+};
+
+constexpr int kNodesPerThread = 64;
+constexpr int kBatchSize      = 16;
+
+template<class Body>
+double Run(int numThreads, int iterations, Body body)
+{
+    std::vector<std::thread> threads;
+    std::atomic<int>         ready{0};
+    std::atomic<bool>        go{false};
+
+    for (int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                ready++;
+                while (!go)
+                {
+                    std::this_thread::yield();
+                }
+                body(iterations);
+            });
+    }
+
+    while (ready < numThreads)
+    {
+        std::this_thread::yield();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go         = true;
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double secs = std::chrono::duration<double>(end - start).count();
+    return (double)numThreads * iterations / secs;
+}
+
+template<class Stack>
+double RunSingle(int numThreads, int iterations)
+{
+    std::vector<Node> nodes(numThreads * kNodesPerThread);
+    Stack             stack;
+    for (Node &n : nodes)
+    {
+        stack.push(&n);
+    }
+
+    return Run(numThreads, iterations,
+               [&stack](int iters)
+               {
+                   for (int i = 0; i < iters; ++i)
+                   {
+                       if (Node *n = stack.pop())
+                       {
+                           stack.push(n);
+                       }
+                   }
+               });
+}
+
+// Each iteration moves kBatchSize nodes out of the stack and back.
+double RunBatched(int numThreads, int iterations)
+{
+    std::vector<Node>         nodes(numThreads * kNodesPerThread);
+    priv::LockFreeStack<Node> stack;
+    for (Node &n : nodes)
+    {
+        stack.push(&n);
+    }
+
+    return Run(numThreads, iterations / kBatchSize,
+               [&stack](int iters)
+               {
+                   for (int i = 0; i < iters; ++i)
+                   {
+                       if (Node *first = stack.popStack(kBatchSize))
+                       {
+                           Node *last = first;
+                           while (last->next)
+                           {
+                               last = last->next;
+                           }
+                           stack.pushStack(first, last);
+                       }
+                   }
+               })
+         * kBatchSize;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    std::printf("# nodes moved through the stack per second (millions)\n");
+    std::printf("%8s %14s %14s %8s %14s\n", "threads", "spin-lock bit", "tagged head", "speedup", "batched x16");
+
+    for (int numThreads = 1; numThreads <= 64; numThreads *= 2)
+    {
+        double base   = RunSingle<SpinLockBitStack>(numThreads, iterations);
+        double tagged = RunSingle<priv::LockFreeStack<Node>>(numThreads, iterations);
+        double batch  = RunBatched(numThreads, iterations);
+        std::printf("%8d %14.2f %14.2f %7.2fx %14.2f\n", numThreads, base / 1e6, tagged / 1e6, tagged / base,
+                    batch / 1e6);
+    }
+
+    return EXIT_SUCCESS;
+}
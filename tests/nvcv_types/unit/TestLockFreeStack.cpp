@@ -19,6 +19,10 @@
 
 #include <nvcv/src/priv/LockFreeStack.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace priv = nvcv::priv;
 
 struct Node
@@ -119,3 +123,205 @@ TEST(LockFreeStack, smoke_release)
     EXPECT_EQ(nn + 2, nn[1].next);
     EXPECT_EQ(nullptr, nn[2].next);
 }
+
+TEST(LockFreeStack, smoke_pop_stack)
+{
+    priv::LockFreeStack<Node> stack;
+
+    int count = -1;
+    EXPECT_EQ(nullptr, stack.popStack(2, &count));
+    EXPECT_EQ(0, count);
+
+    Node n[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        n[i].value = i;
+        stack.push(n + i);
+    }
+
+    Node *h = stack.popStack(2, &count);
+    EXPECT_EQ(2, count);
+    ASSERT_EQ(n + 4, h);
+    ASSERT_EQ(n + 3, h->next);
+    EXPECT_EQ(nullptr, n[3].next);
+    EXPECT_EQ(n + 2, stack.top());
+
+    h = stack.popStack(10, &count);
+    EXPECT_EQ(3, count);
+    ASSERT_EQ(n + 2, h);
+    EXPECT_EQ(n + 1, n[2].next);
+    EXPECT_EQ(n + 0, n[1].next);
+    EXPECT_EQ(nullptr, n[0].next);
+    EXPECT_TRUE(stack.empty());
+}
+
+TEST(LockFreeStack, clear_keeps_nodes_intact)
+{
+    priv::LockFreeStack<Node> stack;
+
+    Node n[2];
+    stack.push(n + 0);
+    stack.push(n + 1);
+    stack.clear();
+
+    EXPECT_TRUE(stack.empty());
+    EXPECT_EQ(nullptr, stack.pop());
+    EXPECT_EQ(n + 0, n[1].next);
+}
+
+// Once moved to the locked list, as when a node address can't be packed in the head,
+// the stack keeps the nodes it had and behaves the same
+TEST(LockFreeStack, smoke_locked_fallback)
+{
+    priv::LockFreeStack<Node> stack;
+    ASSERT_TRUE(stack.empty());
+
+    Node n[5];
+    for (int i = 0; i < 3; ++i)
+    {
+        n[i].value = i;
+        stack.push(n + i);
+        if (i == 0)
+        {
+            stack.switchToLocked();
+        }
+    }
+    n[3].next = n + 4;
+    stack.pushStack(n + 3, n + 4);
+
+    ASSERT_EQ(n + 3, stack.top());
+    ASSERT_EQ(n + 2, n[4].next);
+
+    int   count = -1;
+    Node *h     = stack.popStack(2, &count);
+    EXPECT_EQ(2, count);
+    ASSERT_EQ(n + 3, h);
+    EXPECT_EQ(n + 4, n[3].next);
+    EXPECT_EQ(nullptr, n[4].next);
+
+    EXPECT_EQ(n + 2, stack.pop());
+
+    h = stack.release();
+    EXPECT_EQ(n + 1, h);
+    EXPECT_EQ(n + 0, n[1].next);
+    EXPECT_TRUE(stack.empty());
+    EXPECT_EQ(nullptr, stack.pop());
+    EXPECT_EQ(nullptr, stack.popStack(3, &count));
+    EXPECT_EQ(0, count);
+}
+
+// Every thread keeps popping nodes, single or in batches, and pushing them back.
+// A lost node, or one that ends up owned by two threads at once (ABA), is detected
+// by the owner counter or by the final node count.
+struct StressNode
+{
+    std::atomic<int> owners{0};
+    StressNode      *next = nullptr;
+};
+
+template<bool Locked>
+void StressContendedPushPop()
+{
+    constexpr int kNumNodes   = 64;
+    constexpr int kNumThreads = 8;
+    constexpr int kNumIters   = 20000;
+
+    using Stack = priv::LockFreeStack<StressNode>;
+
+    std::vector<StressNode> nodes(kNumNodes);
+    Stack                   stack;
+    for (StressNode &n : nodes)
+    {
+        stack.push(&n);
+    }
+    if (Locked)
+    {
+        stack.switchToLocked();
+    }
+
+    std::atomic<int> numErrors{0};
+
+    auto worker = [&](int tid)
+    {
+        std::vector<StressNode *> held;
+        for (int i = 0; i < kNumIters; ++i)
+        {
+            if ((i + tid) % 4 == 0)
+            {
+                int         count = 0;
+                StressNode *h     = stack.popStack(1 + i % 5, &count);
+                for (; h; h = h->next, --count)
+                {
+                    held.push_back(h);
+                }
+                if (count != 0)
+                {
+                    ++numErrors;
+                }
+            }
+            else if (StressNode *n = stack.pop())
+            {
+                held.push_back(n);
+            }
+
+            for (StressNode *n : held)
+            {
+                if (n->owners.fetch_add(1) != 0)
+                {
+                    ++numErrors;
+                }
+            }
+            for (StressNode *n : held)
+            {
+                n->owners.fetch_sub(1);
+            }
+
+            // Give nodes back, sometimes as a chain.
+            if (held.size() > 1 && i % 3 == 0)
+            {
+                for (size_t j = 0; j + 1 < held.size(); ++j)
+                {
+                    Stack::Link(held[j], held[j + 1]);
+                }
+                stack.pushStack(held.front(), held.back());
+            }
+            else
+            {
+                for (StressNode *n : held)
+                {
+                    stack.push(n);
+                }
+            }
+            held.clear();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t)
+    {
+        threads.emplace_back(worker, t);
+    }
+    for (std::thread &t : threads)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(0, numErrors.load());
+
+    int count = 0;
+    for (StressNode *n = stack.top(); n && count <= kNumNodes; n = n->next)
+    {
+        ++count;
+    }
+    EXPECT_EQ(kNumNodes, count);
+}
+
+TEST(LockFreeStack, stress_contended_push_pop)
+{
+    StressContendedPushPop<false>();
+}
+
+TEST(LockFreeStack, stress_contended_push_pop_locked_fallback)
+{
+    StressContendedPushPop<true>();
+}
@@ -0,0 +1,290 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Definitions.hpp"
+
+#include <nvcv/src/priv/Exception.hpp>
+#include <nvcv/src/priv/SlabHandleManager.hpp>
+#include <nvcv/src/priv/SlabHandleManagerImpl.hpp>
+
+#include <thread>
+#include <unordered_set>
+
+namespace priv = nvcv::priv;
+
+constexpr int FORCE_FAILURE = 0xDEADBEEF;
+
+namespace {
+class ISlabObject
+{
+public:
+    virtual ~ISlabObject() = default;
+
+    virtual int value() const = 0;
+};
+
+class SlabObject : public ISlabObject
+{
+public:
+    explicit SlabObject(int val)
+        : m_value(val)
+    {
+        if (val == FORCE_FAILURE)
+        {
+            throw std::runtime_error("Forced failure");
+        }
+    }
+
+    virtual int value() const override
+    {
+        return m_value;
+    }
+
+private:
+    int m_value;
+};
+} // namespace
+
+namespace nvcv::priv {
+template<>
+struct ResourceStorage<ISlabObject>
+{
+    using type = CompatibleStorage<SlabObject>;
+};
+} // namespace nvcv::priv
+
+using SlabManager = priv::SlabHandleManager<ISlabObject>;
+
+TEST(SlabHandleManager, smoke_handle_generation_doesnt_wrap_around_early)
+{
+    SlabManager mgr("Object");
+
+    mgr.setFixedSize(1);
+
+    std::unordered_set<void *> usedHandles;
+
+    void       *h;
+    SlabObject *obj;
+    std::tie(h, obj) = mgr.create<SlabObject>(0);
+    ASSERT_EQ(obj, mgr.validate(h));
+    usedHandles.insert(h);
+
+    // Way more than the 16 generations supported by HandleManager
+    for (int i = 1; i < 10000; ++i)
+    {
+        ISlabObject *obj = mgr.validate(h);
+        ASSERT_EQ(i - 1, obj->value());
+
+        mgr.decRef(h);
+        ASSERT_EQ(nullptr, mgr.validate(h)) << "Stale handle must not alias the new object";
+
+        void *newh = mgr.create<SlabObject>(i).first;
+        ASSERT_FALSE(usedHandles.contains(newh)) << "Handle generation must be different";
+        usedHandles.insert(newh);
+
+        ISlabObject *newobj = mgr.validate(newh);
+        ASSERT_EQ(obj, newobj) << "Slot must be reused";
+        ASSERT_EQ(i, newobj->value());
+
+        h = newh;
+    }
+
+    mgr.decRef(h);
+}
+
+TEST(SlabHandleManager, smoke_destroy_already_destroyed)
+{
+    SlabManager mgr("Object");
+
+    void *h = mgr.create<SlabObject>(0).first;
+    ASSERT_EQ(0, mgr.decRef(h));
+    ASSERT_THROW(mgr.decRef(h), nvcv::priv::Exception);
+}
+
+TEST(SlabHandleManager, smoke_ref_unref)
+{
+    SlabManager mgr("Object");
+
+    void *h = mgr.create<SlabObject>(0).first;
+    ASSERT_EQ(2, mgr.incRef(h));
+    ASSERT_EQ(1, mgr.decRef(h));
+    ASSERT_EQ(2, mgr.incRef(h));
+    ASSERT_EQ(1, mgr.decRef(h));
+    ASSERT_EQ(0, mgr.decRef(h));
+
+    EXPECT_THROW(mgr.incRef(h), nvcv::priv::Exception); // invalid handle
+    EXPECT_THROW(mgr.decRef(h), nvcv::priv::Exception); // invalid handle
+}
+
+TEST(SlabHandleManager, smoke_validate_invalid)
+{
+    SlabManager mgr("Object");
+
+    void *h = mgr.create<SlabObject>(0).first;
+    ASSERT_NE(nullptr, mgr.validate(h)); // just to have something being managed already
+
+    ASSERT_EQ(nullptr, mgr.validate((void *)0x666));
+    ASSERT_EQ(nullptr, mgr.validate((void *)0xFFFFFFFFFFFFFFFF));
+    EXPECT_THROW(mgr.decRef((void *)0x666), nvcv::priv::Exception);
+
+    ASSERT_EQ(0, mgr.decRef(h));
+}
+
+TEST(SlabHandleManager, smoke_handle_count_overflow)
+{
+    SlabManager mgr("Object");
+    mgr.setFixedSize(1);
+
+    void *h = nullptr;
+    ASSERT_NO_THROW(h = mgr.create<SlabObject>(0).first);
+    NVCV_ASSERT_STATUS(NVCV_ERROR_OUT_OF_MEMORY, mgr.create<SlabObject>(1));
+
+    mgr.decRef(h);
+}
+
+TEST(SlabHandleManager, smoke_no_handle_leak_if_object_creation_throws)
+{
+    SlabManager mgr("Object");
+    mgr.setFixedSize(1);
+
+    ASSERT_THROW(mgr.create<SlabObject>(FORCE_FAILURE), std::runtime_error);
+
+    void *h = nullptr;
+    ASSERT_NO_THROW(h = mgr.create<SlabObject>(1).first);
+    mgr.decRef(h);
+}
+
+TEST(SlabHandleManager, grows_across_several_slabs)
+{
+    SlabManager mgr("Object");
+
+    std::vector<void *> handles;
+    for (int i = 0; i < 3 * SlabManager::kSlabSize + 5; ++i)
+    {
+        handles.push_back(mgr.create<SlabObject>(i).first);
+    }
+
+    for (size_t i = 0; i < handles.size(); ++i)
+    {
+        ISlabObject *obj = mgr.validate(handles[i]);
+        ASSERT_NE(nullptr, obj);
+        ASSERT_EQ((int)i, obj->value());
+    }
+
+    for (void *h : handles)
+    {
+        ASSERT_EQ(0, mgr.decRef(h));
+    }
+}
+
+TEST(SlabHandleManager, grows_across_slab_directory_chunks)
+{
+    SlabManager mgr("Object");
+
+    // A chunk of the slab directory covers 256 slabs, go past the first chunk
+    constexpr int kCount = 257 * SlabManager::kSlabSize + 5;
+    mgr.setDynamicSize(kCount);
+
+    std::vector<void *> handles(kCount);
+    for (int i = 0; i < kCount; ++i)
+    {
+        handles[i] = mgr.create<SlabObject>(i).first;
+    }
+
+    for (int i : {0, 256 * SlabManager::kSlabSize - 1, 256 * SlabManager::kSlabSize, kCount - 1})
+    {
+        ISlabObject *obj = mgr.validate(handles[i]);
+        ASSERT_NE(nullptr, obj);
+        ASSERT_EQ(i, obj->value());
+    }
+
+    for (void *h : handles)
+    {
+        ASSERT_EQ(0, mgr.decRef(h));
+    }
+    ASSERT_EQ(nullptr, mgr.validate(handles.back()));
+}
+
+TEST(SlabHandleManager, slots_freed_by_exited_thread_are_reused)
+{
+    SlabManager mgr("Object");
+    mgr.setDynamicSize(SlabManager::kThreadCacheSize);
+
+    std::unordered_set<ISlabObject *> objs;
+    std::thread                       th(
+        [&]
+        {
+            std::vector<void *> handles;
+            for (int i = 0; i < SlabManager::kThreadCacheSize; ++i)
+            {
+                auto [h, obj] = mgr.create<SlabObject>(i);
+                handles.push_back(h);
+                objs.insert(obj);
+            }
+            for (void *h : handles)
+            {
+                mgr.decRef(h);
+            }
+        });
+    th.join();
+
+    // The exiting thread must have handed its cached slots over, no growth is needed.
+    std::vector<void *> handles;
+    for (int i = 0; i < SlabManager::kThreadCacheSize; ++i)
+    {
+        auto [h, obj] = mgr.create<SlabObject>(i);
+        EXPECT_TRUE(objs.contains(obj));
+        handles.push_back(h);
+    }
+    for (void *h : handles)
+    {
+        mgr.decRef(h);
+    }
+}
+
+TEST(SlabHandleManager, concurrent_create_validate_destroy)
+{
+    SlabManager mgr("Object");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back(
+            [&mgr]
+            {
+                std::vector<void *> handles;
+                for (int i = 0; i < 20000; ++i)
+                {
+                    handles.push_back(mgr.create<SlabObject>(i).first);
+                    ASSERT_EQ(i, mgr.validate(handles.back())->value());
+                    if (handles.size() > 64)
+                    {
+                        ASSERT_EQ(0, mgr.decRef(handles.front()));
+                        handles.erase(handles.begin());
+                    }
+                }
+                for (void *h : handles)
+                {
+                    ASSERT_EQ(0, mgr.decRef(h));
+                }
+            });
+    }
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+}